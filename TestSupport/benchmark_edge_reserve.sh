@@ -0,0 +1,41 @@
+#!/bin/sh
+#
+# Compare the edge storage backends of the graph library by running the same
+# "planarity -b" benchmark with the edge records on the heap, in reserved
+# address space (see gp_ReserveEdgeStorage()), and in reserved address space
+# backed by huge pages. For each backend, the peak resident set size is
+# reported if GNU time is installed as /usr/bin/time, and the data TLB misses
+# are reported if perf is installed.
+#
+# Usage: TestSupport/benchmark_edge_reserve.sh [COMMAND [K [N]]]
+#        (run from the root of the repository; defaults are -p 3 10000000)
+#
+
+command="${1:--p}"
+iterations="${2:-3}"
+numVertices="${3:-10000000}"
+
+srcdir="$(pwd)"
+workdir="$(mktemp -d)" || exit 1
+
+[ -f "${srcdir}/configure" ] || autoreconf -fi || exit 1
+
+(cd "${workdir}" &&
+    "${srcdir}/configure" >configure.log 2>&1 &&
+    make -j >make.log 2>&1) || { echo "Build failed; see ${workdir}"; exit 1; }
+
+for storage in heap reserve hugepages; do
+    runner=""
+    [ -x /usr/bin/time ] && runner="/usr/bin/time -f %M -o ${workdir}/rss.log"
+    command -v perf >/dev/null 2>&1 &&
+        runner="perf stat -x , -e dTLB-load-misses,dTLB-store-misses -o ${workdir}/tlb.log ${runner}"
+
+    rm -f "${workdir}/rss.log" "${workdir}/tlb.log"
+    ${runner} "${workdir}/planarity" -b "${command}" "${iterations}" "${numVertices}" "${storage}" || exit 2
+
+    [ -f "${workdir}/rss.log" ] && echo "Peak resident set size: $(tail -n 1 "${workdir}/rss.log") KB"
+    [ -f "${workdir}/tlb.log" ] && awk -F , '/TLB/ { print $3 ": " $1 }' "${workdir}/tlb.log"
+    echo
+done
+
+rm -rf "${workdir}"
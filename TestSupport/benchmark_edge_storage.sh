@@ -0,0 +1,35 @@
+#!/bin/sh
+#
+# Compare the edge storage layouts of the graph library by building the
+# planarity executable twice, once with the default array of structures
+# layout and once configured with --enable-edge-soa, then running the
+# same "planarity -b" benchmark with each build.
+#
+# Usage: TestSupport/benchmark_edge_storage.sh [COMMAND [K [N]]]
+#        (run from the root of the repository; defaults are -p 20 200000)
+#
+
+command="${1:--p}"
+iterations="${2:-20}"
+numVertices="${3:-200000}"
+
+srcdir="$(pwd)"
+workdir="$(mktemp -d)" || exit 1
+
+[ -f "${srcdir}/configure" ] || autoreconf -fi || exit 1
+
+for layout in aos soa; do
+    configureFlags=""
+    [ "${layout}" = "soa" ] && configureFlags="--enable-edge-soa"
+
+    mkdir -p "${workdir}/${layout}" || exit 1
+    (cd "${workdir}/${layout}" &&
+        "${srcdir}/configure" ${configureFlags} >configure.log 2>&1 &&
+        make -j >make.log 2>&1) || { echo "Build of ${layout} layout failed; see ${workdir}/${layout}"; exit 1; }
+done
+
+for layout in aos soa; do
+    "${workdir}/${layout}/planarity" -b "${command}" "${iterations}" "${numVertices}" || exit 2
+done
+
+rm -rf "${workdir}"
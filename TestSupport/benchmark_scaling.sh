@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Show how the running time of the graph library grows with the size of the
+# graph by building the planarity executable twice, once with the default
+# index type and once configured with --enable-64bit-indices, then running
+# the same "planarity -b" benchmark with each build on graphs whose number of
+# vertices doubles at each step. The time per edge reported for each size
+# stays roughly constant when the running time is linear in the graph size.
+#
+# Usage: TestSupport/benchmark_scaling.sh [COMMAND [K [N [STEPS]]]]
+#        (run from the root of the repository; defaults are -p 5 100000 6)
+#
+
+command="${1:--p}"
+iterations="${2:-5}"
+numVertices="${3:-100000}"
+numSteps="${4:-6}"
+
+srcdir="$(pwd)"
+workdir="$(mktemp -d)" || exit 1
+
+[ -f "${srcdir}/configure" ] || autoreconf -fi || exit 1
+
+for indices in int 64bit; do
+    configureFlags=""
+    [ "${indices}" = "64bit" ] && configureFlags="--enable-64bit-indices"
+
+    mkdir -p "${workdir}/${indices}" || exit 1
+    (cd "${workdir}/${indices}" &&
+        "${srcdir}/configure" ${configureFlags} >configure.log 2>&1 &&
+        make -j >make.log 2>&1) || { echo "Build of ${indices} indices failed; see ${workdir}/${indices}"; exit 1; }
+done
+
+for indices in int 64bit; do
+    echo "Index type: ${indices}"
+    printf "%12s %12s %12s %16s\n" "N" "M" "seconds" "ns per edge"
+
+    N="${numVertices}"
+    step=0
+    while [ "${step}" -lt "${numSteps}" ]; do
+        "${workdir}/${indices}/planarity" -b "${command}" "${iterations}" "${N}" >"${workdir}/run.log" 2>&1 ||
+            { cat "${workdir}/run.log"; exit 2; }
+
+        # The benchmark reports N and M on its first line and the total time on its last line
+        awk -v K="${iterations}" '
+            /^Benchmarking/ { sub(/.*N=/, ""); N = $0 + 0; sub(/.*M=/, ""); M = $0 + 0 }
+            /^Done/ { sub(/.*\(/, ""); seconds = $0 + 0 }
+            END { printf "%12d %12d %12.3f %16.1f\n", N, M, seconds, 1e9 * seconds / (K * M) }' "${workdir}/run.log"
+
+        N=$((N * 2))
+        step=$((step + 1))
+    done
+done
+
+rm -rf "${workdir}"
@@ -8,6 +8,7 @@ See the LICENSE.TXT file for licensing information.
 #include <string.h>
 
 #include "../lowLevelUtils/appconst.h"
+#include "../lowLevelUtils/apiutils.private.h"
 #include "../graph.private.h"
 
 #include "graphExtensions.private.h"
@@ -20,6 +21,7 @@ extern void _InitFunctionTable(graphP theGraph);
 
 /* Private function */
 
+int _AssignModuleID(int *pModuleID);
 void _FreeExtension(graphExtensionP extension);
 void _OverloadFunctions(graphP theGraph, graphFunctionTableP functions);
 void _FixupFunctionTables(graphP theGraph, graphExtensionP curr);
@@ -32,10 +34,17 @@ graphExtensionP _FindNearestOverload(graphP theGraph, graphExtensionP target, in
  * graphs.  It is used in lieu of identifying extensions by a string
  * name, which is noticeably expensive when a frequently called
  * overload function seeks the extension context for a graph.
+ *
+ * The generator and the moduleID variables of the extensions are
+ * shared by all threads, so they are only changed atomically (see
+ * _AssignModuleID()).
  ********************************************************************/
 
 static int moduleIDGenerator = 0;
 
+// The value of a moduleID variable while one thread is assigning its ID
+#define MODULEID_ASSIGNING -1
+
 /********************************************************************
  The extension mechanism allows new modules to equip a graph with the
  data structures and functions needed to implement new algorithms
@@ -99,6 +108,11 @@ static int moduleIDGenerator = 0;
      a) If extra data must be maintained at the graph, vertex or edge
         levels, then fpEnsureVertexCapacity(), fpEnsureEdgeCapacity(),
         fpDeleteEdge(), and fpResetGraphStorage() must be overloaded.
+        If extra data is maintained at the edge level, then fpMoveEdge()
+        must also be overloaded, so gp_CompactEdgeStorage() moves it.
+        The fpResetGraphStorage() overload should only reset the edge
+        level data below the edge high water mark, which it must get
+        before invoking the base function (see gp_ResetGraphStorage()).
 
      b) If any data must be persisted in the file format, then overloads
         of fpReadPostprocess() and fpWritePostprocess() are needed.
@@ -176,6 +190,7 @@ int gp_AddExtension(graphP theGraph,
                     graphFunctionTableP functions)
 {
     graphExtensionP newExtension = NULL;
+    int moduleID = 0;
 
     if (theGraph == NULL || pModuleID == NULL ||
         context == NULL || copyData == NULL || freeContext == NULL ||
@@ -184,25 +199,24 @@ int gp_AddExtension(graphP theGraph,
         return NOTOK;
     }
 
-    if (*pModuleID < 0 || *pModuleID > MAXNUMSUPPORTEDEXTENSIONS)
+    // The moduleID variable is shared by all threads, so it is read atomically
+    moduleID = _gp_AtomicLoad(pModuleID);
+    if ((moduleID < 0 && moduleID != MODULEID_ASSIGNING) || moduleID > MAXNUMSUPPORTEDEXTENSIONS)
     {
         return NOTOK;
     }
 
-    // If the extension already exists, then don't redefine it.
-    if (gp_FindExtension(theGraph, *pModuleID, NULL) == TRUE)
+    // Assign a unique ID to the extension if it does not already have one
+    if (_AssignModuleID(pModuleID) != OK)
     {
         return NOTOK;
     }
+    moduleID = _gp_AtomicLoad(pModuleID);
 
-    // Assign a unique ID to the extension if it does not already have one
-    if (*pModuleID == 0)
+    // If the extension already exists, then don't redefine it.
+    if (gp_FindExtension(theGraph, moduleID, NULL) == TRUE)
     {
-        if (moduleIDGenerator >= MAXNUMSUPPORTEDEXTENSIONS)
-        {
-            return NOTOK;
-        }
-        *pModuleID = ++moduleIDGenerator;
+        return NOTOK;
     }
 
     // Allocate the new extension
@@ -212,7 +226,7 @@ int gp_AddExtension(graphP theGraph,
     }
 
     // Assign the data payload of the extension
-    newExtension->moduleID = *pModuleID;
+    newExtension->moduleID = moduleID;
     newExtension->context = context;
     newExtension->dupContext = dupContext;
     newExtension->copyData = copyData;
@@ -230,6 +244,46 @@ int gp_AddExtension(graphP theGraph,
     return OK;
 }
 
+/********************************************************************
+ _AssignModuleID()
+ Assigns the next ID from the moduleIDGenerator to the moduleID
+ variable of an extension, unless the variable already has an ID.
+
+ Two threads may add the same extension to different graphs for the
+ first time at the same moment. Only the thread that changes the
+ moduleID variable from zero to MODULEID_ASSIGNING takes an ID from the
+ generator, so no ID is wasted by the race, and the other thread waits
+ for that ID to be stored in the variable. The wait is only for one
+ increment of the generator. While the variable is MODULEID_ASSIGNING,
+ gp_FindExtension() treats it as it treats zero.
+
+ Returns OK if the moduleID variable has an ID, NOTOK if the supply
+ of IDs is exhausted.
+ ********************************************************************/
+
+int _AssignModuleID(int *pModuleID)
+{
+    int newModuleID = 0;
+
+    if (_gp_AtomicCompareAndSwap(pModuleID, 0, MODULEID_ASSIGNING))
+    {
+        // If the supply of IDs is exhausted, then the variable is reset
+        // so that it still has no ID
+        if ((newModuleID = _gp_AtomicIncrement(&moduleIDGenerator)) > MAXNUMSUPPORTEDEXTENSIONS)
+            newModuleID = 0;
+
+        (void)_gp_AtomicCompareAndSwap(pModuleID, MODULEID_ASSIGNING, newModuleID);
+
+        return newModuleID != 0 ? OK : NOTOK;
+    }
+
+    // Another thread assigned the ID, or is assigning it
+    while ((newModuleID = _gp_AtomicLoad(pModuleID)) == MODULEID_ASSIGNING)
+        ;
+
+    return newModuleID != 0 ? OK : NOTOK;
+}
+
 /********************************************************************
  _OverloadFunctions()
  For each non-NULL function pointer, the pointer becomes the new value
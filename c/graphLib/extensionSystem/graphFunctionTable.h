@@ -25,36 +25,37 @@ extern "C"
         // the behaviors of protected functions.  Only advanced applications
         // will overload these functions
         int (*fpEmbeddingInitialize)(graphP);
-        void (*fpEmbedBackEdgeToDescendant)(graphP, int, int, int, int);
-        void (*fpWalkUp)(graphP, int, int);
-        int (*fpWalkDown)(graphP, int, int);
-        int (*fpMergeBicomps)(graphP, int, int, int, int);
-        void (*fpMergeVertex)(graphP, int, int, int);
-        int (*fpHandleInactiveVertex)(graphP, int, int *, int *);
-        int (*fpHandleBlockedBicomp)(graphP, int, int, int);
-        int (*fpEmbedPostprocess)(graphP, int, int);
-        int (*fpMarkDFSPath)(graphP, int, int);
+        void (*fpEmbedBackEdgeToDescendant)(graphP, int, graphInt, graphInt, int);
+        void (*fpWalkUp)(graphP, graphInt, graphInt);
+        int (*fpWalkDown)(graphP, graphInt, graphInt);
+        int (*fpMergeBicomps)(graphP, graphInt, graphInt, graphInt, int);
+        void (*fpMergeVertex)(graphP, graphInt, int, graphInt);
+        int (*fpHandleInactiveVertex)(graphP, graphInt, graphInt *, graphInt *);
+        int (*fpHandleBlockedBicomp)(graphP, graphInt, graphInt, graphInt);
+        int (*fpEmbedPostprocess)(graphP, graphInt, int);
+        int (*fpMarkDFSPath)(graphP, graphInt, graphInt);
 
         int (*fpCheckEmbeddingIntegrity)(graphP, graphP);
         int (*fpCheckObstructionIntegrity)(graphP, graphP);
 
         // These function pointers allow extension modules to overload some
         // of the behaviors of gp_* function in the public API
-        int (*fpEnsureVertexCapacity)(graphP, int);
+        int (*fpEnsureVertexCapacity)(graphP, graphInt);
         void (*fpResetGraphStorage)(graphP);
-        int (*fpEnsureEdgeCapacity)(graphP, int);
+        int (*fpEnsureEdgeCapacity)(graphP, graphInt);
         int (*fpSortVertices)(graphP);
 
         int (*fpReadPostprocess)(graphP, char *);
         int (*fpWritePostprocess)(graphP, char **);
 
-        int (*fpDeleteEdge)(graphP, int);
-        void (*fpHideEdge)(graphP, int);
-        void (*fpRestoreEdge)(graphP, int);
-        int (*fpHideVertex)(graphP, int);
+        int (*fpDeleteEdge)(graphP, graphInt);
+        int (*fpMoveEdge)(graphP, graphInt, graphInt);
+        void (*fpHideEdge)(graphP, graphInt);
+        void (*fpRestoreEdge)(graphP, graphInt);
+        int (*fpHideVertex)(graphP, graphInt);
         int (*fpRestoreVertex)(graphP);
-        int (*fpContractEdge)(graphP, int);
-        int (*fpIdentifyVertices)(graphP, int, int, int);
+        int (*fpContractEdge)(graphP, graphInt);
+        int (*fpIdentifyVertices)(graphP, graphInt, graphInt, graphInt);
     };
 
     typedef struct graphFunctionTableStruct graphFunctionTableStruct;
@@ -13,21 +13,23 @@ See the LICENSE.TXT file for licensing information.
 #include "planarityRelated/graphPlanarity.private.h"
 #include "planarityRelated/graphOuterplanarity.h"
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 /* Imported functions for FUNCTION POINTERS */
 
 extern int _EmbeddingInitialize(graphP theGraph);
 extern int _SortVertices(graphP theGraph);
-extern void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, int W, int WPrevLink);
-extern void _WalkUp(graphP theGraph, int v, int e);
-extern int _WalkDown(graphP theGraph, int v, int RootVertex);
-extern int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink);
-extern void _MergeVertex(graphP theGraph, int W, int WPrevLink, int R);
-extern int _HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-extern int _HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevLink);
-extern int _MarkDFSPath(graphP theGraph, int ancestor, int descendant);
-extern int _EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
+extern void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink);
+extern void _WalkUp(graphP theGraph, graphInt v, graphInt e);
+extern int _WalkDown(graphP theGraph, graphInt v, graphInt RootVertex);
+extern int _MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink);
+extern void _MergeVertex(graphP theGraph, graphInt W, int WPrevLink, graphInt R);
+extern int _HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+extern int _HandleInactiveVertex(graphP theGraph, graphInt BicompRoot, graphInt *pW, graphInt *pWPrevLink);
+extern int _MarkDFSPath(graphP theGraph, graphInt ancestor, graphInt descendant);
+extern int _EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
 extern int _CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
 extern int _CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 extern int _ReadPostprocess(graphP theGraph, char *extraData);
@@ -35,11 +37,11 @@ extern int _WritePostprocess(graphP theGraph, char **pExtraData);
 
 /* Internal util functions for FUNCTION POINTERS */
 
-int _HideVertex(graphP theGraph, int vertex);
-void _HideEdge(graphP theGraph, int e);
-void _RestoreEdge(graphP theGraph, int e);
-int _ContractEdge(graphP theGraph, int e);
-int _IdentifyVertices(graphP theGraph, int u, int v, int eBefore);
+int _HideVertex(graphP theGraph, graphInt vertex);
+void _HideEdge(graphP theGraph, graphInt e);
+void _RestoreEdge(graphP theGraph, graphInt e);
+int _ContractEdge(graphP theGraph, graphInt e);
+int _IdentifyVertices(graphP theGraph, graphInt u, graphInt v, graphInt eBefore);
 int _RestoreVertex(graphP theGraph);
 
 /********************************************************************
@@ -50,28 +52,28 @@ void _InitIsolatorContext(graphP theGraph);
 void _ClearAllVisitedFlagsInGraph(graphP theGraph);
 void _ClearVertexVisitedFlags(graphP theGraph, int includeVirtualVertices);
 void _ClearEdgeVisitedFlags(graphP theGraph);
-int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot);
-int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, int BicompRoot);
+int _ClearAllVisitedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
+int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, graphInt BicompRoot);
 void _ClearEdgeVisitedFlagsInUnembeddedEdges(graphP theGraph);
-int _FillVertexVisitedIndexes(graphP theGraph, int FillValue);
-int _FillVertexVisitedIndexesInBicomp(graphP theGraph, int BicompRoot, int FillValue);
-int _ClearObstructionMarksInBicomp(graphP theGraph, int BicompRoot);
+int _FillVertexVisitedIndexes(graphP theGraph, graphInt FillValue);
+int _FillVertexVisitedIndexesInBicomp(graphP theGraph, graphInt BicompRoot, graphInt FillValue);
+int _ClearObstructionMarksInBicomp(graphP theGraph, graphInt BicompRoot);
 
-int _gp_FindEdge(graphP theGraph, int u, int v);
+graphInt _gp_FindEdge(graphP theGraph, graphInt u, graphInt v);
 
-int _ClearAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
-int _SetAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
+int _ClearAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
+int _SetAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
 
-int _ComputeEdgeRecordType(graphP theGraph, int a, int b, int edgeType);
-int _RestoreEdgeType(graphP theGraph, int u, int v);
+int _ComputeEdgeRecordType(graphP theGraph, graphInt a, graphInt b, int edgeType);
+int _RestoreEdgeType(graphP theGraph, graphInt u, graphInt v);
 
-int _HideInternalEdges(graphP theGraph, int vertex);
-int _RestoreInternalEdges(graphP theGraph, int stackBottom);
-int _RestoreHiddenEdges(graphP theGraph, int stackBottom);
+int _HideInternalEdges(graphP theGraph, graphInt vertex);
+int _RestoreInternalEdges(graphP theGraph, graphInt stackBottom);
+int _RestoreHiddenEdges(graphP theGraph, graphInt stackBottom);
 
 int _GetBicompSize(graphP theGraph, int BicompRoot);
 int _DeleteUnmarkedEdgesInBicomp(graphP theGraph, int BicompRoot);
-int _ClearInvertedFlagsInBicomp(graphP theGraph, int BicompRoot);
+int _ClearInvertedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
 
 void _InitFunctionTable(graphP theGraph);
 
@@ -80,42 +82,85 @@ void _InitFunctionTable(graphP theGraph);
  ********************************************************************/
 
 void _InitVertices(graphP theGraph);
-void _InitEdges(graphP theGraph);
+void _InitEdges(graphP theGraph, graphInt upperBound);
+
+int _AllocateEdgeStorage(graphP theGraph, graphInt Esize);
+int _ReallocateEdgeStorage(graphP theGraph, graphInt newEsize);
+void _FreeEdgeStorage(graphP theGraph);
+
+void *_AllocateEdgeArray(graphP theGraph, int whichArray, size_t elementSize, graphInt Esize);
+void *_ReallocateEdgeArray(graphP theGraph, int whichArray, void *ptr, size_t elementSize,
+                           graphInt oldEsize, graphInt newEsize);
+void _FreeEdgeArray(graphP theGraph, int whichArray, void *ptr);
 
 void _ClearGraph(graphP theGraph);
 
+int _ImportCSR(graphP theGraph, graphInt N, const graphInt *offsets, const graphInt *neighbors,
+               graphInt *edgeOf, graphInt *nextPending, graphInt *pending);
+
 typedef struct
 {
-    int u;
-    int v;
+    graphInt u;
+    graphInt v;
 } randomGraphEdgeRec;
 
 typedef struct
 {
-    int a;
-    int b;
-    int c;
+    graphInt a;
+    graphInt b;
+    graphInt c;
 } randomGraphFaceRec;
 
-int _AddRandomGraphEdgeCandidate(randomGraphEdgeRec *edgeList, int edgeListCapacity, int *pEdgeListCount, int u, int v);
-int _ProcessRandomGraphOptionalEdge(graphP theGraph, randomGraphEdgeRec *edgeList, int edgeListCapacity,
-                                    int *pEdgeListCount, int addImmediately, int u, int v);
-void _ShuffleRandomGraphEdgeCandidates(randomGraphEdgeRec *edgeList, int edgeCount);
-
-void _AttachEdgeRecord(graphP theGraph, int v, int e, int link, int newEdge);
-void _DetachEdgeRecord(graphP theGraph, int e);
-void _RestoreEdgeRecord(graphP theGraph, int e);
-int _DeleteEdge(graphP theGraph, int e);
+int _AddRandomGraphEdgeCandidate(randomGraphEdgeRec *edgeList, graphInt edgeListCapacity, graphInt *pEdgeListCount, graphInt u, graphInt v);
+int _ProcessRandomGraphOptionalEdge(graphP theGraph, randomGraphEdgeRec *edgeList, graphInt edgeListCapacity,
+                                    graphInt *pEdgeListCount, int addImmediately, graphInt u, graphInt v);
+void _ShuffleRandomGraphEdgeCandidates(randomGraphEdgeRec *edgeList, graphInt edgeCount);
+
+void _AttachEdgeRecord(graphP theGraph, graphInt v, graphInt e, int link, graphInt newEdge);
+void _DetachEdgeRecord(graphP theGraph, graphInt e);
+
+adjIndexP _gp_GetAdjacencyIndex(graphP theGraph);
+int _BuildAdjacencyIndex(graphP theGraph);
+void _AdjacencyIndexAddEdge(graphP theGraph, graphInt e);
+void _AdjacencyIndexDeleteEdge(graphP theGraph, graphInt e);
+
+// Keep the adjacency index, if it has been built, up to date as the edge
+// records of edge e (and its twin) are added to or removed from the graph
+#define _gp_AdjacencyIndexAddEdge(theGraph, e)             \
+    {                                                      \
+        if (theGraphAdjacencyIndex(theGraph) != NULL)      \
+            _AdjacencyIndexAddEdge(theGraph, e);           \
+    }
+#define _gp_AdjacencyIndexDeleteEdge(theGraph, e)          \
+    {                                                      \
+        if (theGraphAdjacencyIndex(theGraph) != NULL)      \
+            _AdjacencyIndexDeleteEdge(theGraph, e);        \
+    }
+void _RestoreEdgeRecord(graphP theGraph, graphInt e);
+int _DeleteEdge(graphP theGraph, graphInt e);
+int _MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc);
+void _MoveEdgeRecord(graphP theGraph, graphInt eDst, graphInt eSrc, graphInt v);
 
 /* Private functions for which there are FUNCTION POINTERS */
 
-void _InitVertexRec(graphP theGraph, int v);
+void _InitVertexRec(graphP theGraph, graphInt v);
 void _InitVertexInfo(graphP theGraph, int v);
-void _InitEdgeRec(graphP theGraph, int e);
+void _InitEdgeRec(graphP theGraph, graphInt e);
 
-int _EnsureVertexCapacity(graphP theGraph, int N);
+int _EnsureVertexCapacity(graphP theGraph, graphInt N);
 void _ResetGraphStorage(graphP theGraph);
-int _EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity);
+int _EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity);
+
+graphInt _GetStackCapacity(graphInt N, graphInt edgeCapacity);
+size_t _GetArenaCapacity(graphP theGraph, graphInt N, graphInt edgeCapacity);
+graphInt _GetCliqueEdgeCount(graphInt N);
+
+// A vertex or edge capacity is indexable if twice the capacity, plus the
+// two unused edge records at the start of one-based edge storage, does
+// not exceed the largest value of the graphIndex type. For int indices,
+// this only rejects capacities whose storage bounds would overflow, but
+// it limits the order and size of graphs in the libplanarity16 build.
+#define _gp_IsIndexableCapacity(capacity) ((capacity) <= (GRAPHINDEX_MAX - 2) / 2)
 
 /********************************************************************
  gp_New()
@@ -168,6 +213,94 @@ graphP gp_New(void)
     return theGraph;
 }
 
+/********************************************************************
+ gp_NewWithArena()
+ Constructor for a graph object whose storage is laid out in a single
+ cache line aligned block of memory, called the arena.
+
+ The graph is created with a vertex capacity of N and an edge capacity
+ of edgeCapacity (or the default for N if edgeCapacity is not positive),
+ so it is in the state of a graph returned by gp_New() and then given
+ to gp_EnsureEdgeCapacity() and gp_EnsureVertexCapacity().
+
+ The arena is sized to hold the vertex and edge arrays, stacks, list
+ collections and vertex info arrays of the graph, plus a reserve for
+ the parallel arrays of extensions attached later (see
+ _GetArenaCapacity()). Any storage that does not fit, such as edge
+ storage grown by gp_EnsureEdgeCapacity(), comes from the heap, so
+ the arena only affects performance, not behavior. Besides needing
+ one allocation instead of dozens, this keeps the arrays used together
+ by the algorithms near each other in memory, and gp_Free() releases
+ nearly all graph storage with a single call to free().
+
+ Returns the new graph, or NULL on any failure.
+ ********************************************************************/
+
+graphP gp_NewWithArena(graphInt N, graphInt edgeCapacity)
+{
+    graphP theGraph = NULL;
+
+    if (N <= 0 || (theGraph = gp_New()) == NULL)
+        return NULL;
+
+    ((graphPrivateDataP)theGraph->privateData)->useArena = TRUE;
+
+    if ((edgeCapacity > 0 && gp_EnsureEdgeCapacity(theGraph, edgeCapacity) != OK) ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK)
+    {
+        gp_Free(&theGraph);
+        return NULL;
+    }
+
+    return theGraph;
+}
+
+/********************************************************************
+ gp_ReserveEdgeStorage()
+ Selects, for the given graph, an edge storage backend that reserves
+ address space for the edge records of maxEdgeCapacity edges up front,
+ then commits memory pages to it only as the edge capacity grows. Up to
+ maxEdgeCapacity, gp_EnsureEdgeCapacity() then grows the edge records
+ in place, so it never copies them and never needs the old and new
+ edge records in memory at the same time.
+
+ If reserveFlags includes RESERVEFLAGS_HUGEPAGES, the operating system
+ is also advised to back the edge records with huge pages, if it can
+ (e.g., with MADV_HUGEPAGE on Linux), which reduces the TLB misses of
+ the algorithms on very large graphs.
+
+ This method must be invoked before gp_EnsureVertexCapacity(), and the
+ selection lasts for the lifetime of the graph. An edge capacity beyond
+ maxEdgeCapacity is still supported, but the edge records then move to
+ the heap, and if the address space cannot be reserved when the edge
+ records are allocated, then the heap is used instead. Either way, the
+ reservation only affects performance, not behavior. The parallel edge
+ arrays of extensions are not affected by the reservation.
+
+ Returns OK on success, NOTOK if theGraph already has vertices, if the
+     maxEdgeCapacity is not positive or too large for the graphIndex
+     type, or if reserving address space is not supported on this
+     platform (see VR_SUPPORTED in vmregion.h).
+ ********************************************************************/
+
+int gp_ReserveEdgeStorage(graphP theGraph, graphInt maxEdgeCapacity, unsigned reserveFlags)
+{
+    if (theGraph == NULL || gp_GetN(theGraph) > 0 ||
+        maxEdgeCapacity <= 0 || !_gp_IsIndexableCapacity(maxEdgeCapacity))
+        return NOTOK;
+
+#ifdef VR_SUPPORTED
+    ((graphPrivateDataP)theGraph->privateData)->reservedEdgeCapacity = maxEdgeCapacity;
+    ((graphPrivateDataP)theGraph->privateData)->reserveFlags = reserveFlags;
+
+    return OK;
+#else
+    (void)reserveFlags;
+
+    return NOTOK;
+#endif
+}
+
 /********************************************************************
  _InitFunctionTable()
 
@@ -208,6 +341,7 @@ void _InitFunctionTable(graphP theGraph)
         theGraph->functions->fpWritePostprocess = _WritePostprocess;
 
         theGraph->functions->fpDeleteEdge = _DeleteEdge;
+        theGraph->functions->fpMoveEdge = _MoveEdge;
         theGraph->functions->fpHideEdge = _HideEdge;
         theGraph->functions->fpRestoreEdge = _RestoreEdge;
         theGraph->functions->fpHideVertex = _HideVertex;
@@ -237,10 +371,11 @@ void _InitFunctionTable(graphP theGraph)
  The numEdgeHoles is set to 0; it tracks the edgeHoles stack size,
     so the number of edge records in use can be efficiently computed.
 
- The stack, initially empty, is made big enough for a pair of integers
-     per edge (2 * edgeCapacity), or 6N integers if the edgeCapacity
-     was set below the default. Space for 2 extra integers is added so
-     depth-first search can push (NIL, NIL) to start at a DFS tree root.
+ The stack, initially empty, is made big enough for an integer per
+     edge record (2 * edgeCapacity) plus 7 integers per vertex, which
+     suffices for traversing faces, for hiding every edge and vertex,
+     and for depth-first search, which needs a pair of integers per
+     vertex on the current DFS tree path.
 
  The BicompRootLists and sortedDFSChildLists are set to a size of N,
      and they start out empty.
@@ -254,7 +389,7 @@ void _InitFunctionTable(graphP theGraph)
           returned to the post-condition of gp_New().
  ********************************************************************/
 
-int gp_EnsureVertexCapacity(graphP theGraph, int N)
+int gp_EnsureVertexCapacity(graphP theGraph, graphInt N)
 {
     // valid params check
     if (theGraph == NULL || N <= 0)
@@ -264,12 +399,25 @@ int gp_EnsureVertexCapacity(graphP theGraph, int N)
     if (gp_GetN(theGraph) > 0)
         return NOTOK;
 
+    // The vertex and edge storage must be indexable by the graphIndex type
+    if (!_gp_IsIndexableCapacity(N) ||
+        !_gp_IsIndexableCapacity(theGraph->edgeCapacity > 0 ? theGraph->edgeCapacity : DEFAULT_EDGE_CAPACITY_FACTOR * N))
+        return NOTOK;
+
+    // The arena is created before calling the overloadable function so that
+    // extensions can also allocate from it, whether they do so before or
+    // after calling the base function. If the arena cannot be created, then
+    // the heap is used instead.
+    if (((graphPrivateDataP)theGraph->privateData)->useArena && theGraphArena(theGraph) == NULL)
+        theGraphArena(theGraph) = ar_New(_GetArenaCapacity(theGraph, N,
+                                                           theGraph->edgeCapacity > 0 ? theGraph->edgeCapacity : DEFAULT_EDGE_CAPACITY_FACTOR * N));
+
     return theGraph->functions->fpEnsureVertexCapacity(theGraph, N);
 }
 
-int _EnsureVertexCapacity(graphP theGraph, int N)
+int _EnsureVertexCapacity(graphP theGraph, graphInt N)
 {
-    int Vsize, VIsize, Esize, stackSize;
+    graphInt Vsize, VIsize, Esize, stackSize;
 
     // Compute the vertex and edge capacities of the graph
     theGraph->N = N;
@@ -281,24 +429,22 @@ int _EnsureVertexCapacity(graphP theGraph, int N)
     Vsize = gp_UpperBoundVertexStorage(theGraph);
     Esize = gp_UpperBoundEdgeStorage(theGraph);
 
-    // Stack size is 2 integers per edge record plus 2 to start depth-first search at a tree root
-    stackSize = (theGraph->edgeCapacity << 2) + 2;
-    // In case of small edgeCapacity, ensure minimum based on number of vertices
-    stackSize = stackSize <= 2 * 2 * DEFAULT_EDGE_CAPACITY_FACTOR * N ? 2 * 2 * DEFAULT_EDGE_CAPACITY_FACTOR * N + 2 : stackSize;
+    stackSize = _GetStackCapacity(N, theGraph->edgeCapacity);
 
-    // Allocate memory as described above
-    if ((theGraph->V = (vertexRecP)calloc(Vsize, sizeof(vertexRec))) == NULL ||
-        (theGraph->E = (edgeRecP)calloc(Esize, sizeof(edgeRec))) == NULL ||
-        (theGraph->edgeHoles = sp_New(theGraph->edgeCapacity)) == NULL ||
+    // Allocate memory as described above. The arrays are all initialized
+    // below, so they need not be cleared when allocated.
+    if ((theGraph->V = (vertexRecP)_gp_AllocStorage(theGraph, Vsize * sizeof(vertexRec))) == NULL ||
+        _AllocateEdgeStorage(theGraph, Esize) != OK ||
+        (theGraph->edgeHoles = _gp_NewStack(theGraph, theGraph->edgeCapacity)) == NULL ||
 
-        (theGraph->theStack = sp_New(stackSize)) == NULL ||
-        (theGraphBicompRootLists(theGraph) = LCNew(VIsize)) == NULL ||
-        (theGraphDVI(theGraph) = (DFSUtils_VertexInfoP)calloc(VIsize, sizeof(DFSUtils_VertexInfo))) == NULL ||
+        (theGraph->theStack = _gp_NewStack(theGraph, stackSize)) == NULL ||
+        (theGraphBicompRootLists(theGraph) = _gp_NewListCollection(theGraph, VIsize)) == NULL ||
+        (theGraphDVI(theGraph) = (DFSUtils_VertexInfoP)_gp_AllocStorage(theGraph, VIsize * sizeof(DFSUtils_VertexInfo))) == NULL ||
 
-        (theGraphPVI(theGraph) = (Planarity_VertexInfoP)calloc(VIsize, sizeof(Planarity_VertexInfo))) == NULL ||
-        (theGraphSortedDFSChildLists(theGraph) = LCNew(VIsize)) == NULL ||
-        (theGraphExtFace(theGraph) = (extFaceLinkRecP)calloc(Vsize, sizeof(extFaceLinkRec))) == NULL ||
-        (theGraphIC(theGraph) = (isolatorContextP)calloc(1, sizeof(isolatorContextStruct))) == NULL ||
+        (theGraphPVI(theGraph) = (Planarity_VertexInfoP)_gp_AllocStorage(theGraph, VIsize * sizeof(Planarity_VertexInfo))) == NULL ||
+        (theGraphSortedDFSChildLists(theGraph) = _gp_NewListCollection(theGraph, VIsize)) == NULL ||
+        (theGraphExtFace(theGraph) = (extFaceLinkRecP)_gp_AllocStorage(theGraph, Vsize * sizeof(extFaceLinkRec))) == NULL ||
+        (theGraphIC(theGraph) = (isolatorContextP)_gp_AllocStorage(theGraph, sizeof(isolatorContextStruct))) == NULL ||
         0)
     {
         _ClearGraph(theGraph);
@@ -307,12 +453,222 @@ int _EnsureVertexCapacity(graphP theGraph, int N)
 
     // Initialize memory
     _InitVertices(theGraph);
-    _InitEdges(theGraph);
+    _InitEdges(theGraph, gp_UpperBoundEdgeStorage(theGraph));
     _InitIsolatorContext(theGraph);
 
     return OK;
 }
 
+/********************************************************************
+ _GetStackCapacity()
+
+ Face traversal pushes every edge record, and hiding edges pushes one
+ integer per hidden edge, so the stack holds 2 integers per edge. The
+ 7 integers per vertex cover the record that gp_HideVertex() and
+ gp_IdentifyVertices() push for each vertex, and they also cover the
+ depth-first searches, which push a pair of integers per vertex on
+ the current DFS tree path.
+ ********************************************************************/
+
+graphInt _GetStackCapacity(graphInt N, graphInt edgeCapacity)
+{
+    return 2 * edgeCapacity + 7 * N;
+}
+
+/********************************************************************
+ _GetCliqueEdgeCount()
+
+ Returns the number of edges N(N-1)/2 of a complete graph on N vertices,
+ or GRAPHINT_MAX if that number is too large for the graphInt type.
+ ********************************************************************/
+
+graphInt _GetCliqueEdgeCount(graphInt N)
+{
+    graphInt half = N / 2, other = N % 2 == 0 ? N - 1 : N;
+
+    if (half > 0 && other > GRAPHINT_MAX / half)
+        return GRAPHINT_MAX;
+
+    return half * other;
+}
+
+/********************************************************************
+ _GetArenaCapacity()
+
+ Returns the number of bytes needed in an arena to hold all of the
+ allocations made by _EnsureVertexCapacity() for a graph of order N
+ with the given edgeCapacity, plus a reserve for the parallel vertex
+ and edge arrays of extensions.
+
+ The reserve is enough for the largest extensions of this library, which
+ associate up to 8 integers with each vertex and 3 with each edge record.
+ ********************************************************************/
+
+#define ARENA_EXTENSION_INTS_PER_VERTEX 8
+#define ARENA_EXTENSION_INTS_PER_EDGE 3
+#define ARENA_EXTENSION_MAXALLOCATIONS 8
+
+size_t _GetArenaCapacity(graphP theGraph, graphInt N, graphInt edgeCapacity)
+{
+    size_t VIsize = (size_t)gp_LowerBoundVertices(theGraph) + N;
+    size_t Vsize = VIsize + N;
+    size_t Esize = (size_t)gp_LowerBoundEdgeStorage(theGraph) + 2 * (size_t)edgeCapacity;
+    size_t capacity = 0;
+
+    capacity += ar_AlignedSize(Vsize * sizeof(vertexRec));
+
+    // Edge records in reserved address space need no room in the arena
+    if (((graphPrivateDataP)theGraph->privateData)->reservedEdgeCapacity == 0)
+    {
+#ifdef USE_EDGE_SOA
+        capacity += ar_AlignedSize(Esize * sizeof(edgeLinkRec));
+        capacity += ar_AlignedSize(Esize * sizeof(graphIndex));
+        capacity += ar_AlignedSize(Esize * sizeof(unsigned));
+#ifdef USE_VISITED_EPOCHS
+        capacity += ar_AlignedSize(Esize * sizeof(unsigned));
+#endif
+#else
+        capacity += ar_AlignedSize(Esize * sizeof(edgeRec));
+#endif
+    }
+    capacity += ar_AlignedSize(sizeof(stackStruct)) + ar_AlignedSize((size_t)edgeCapacity * sizeof(graphInt));
+    capacity += ar_AlignedSize(sizeof(stackStruct)) + ar_AlignedSize((size_t)_GetStackCapacity(N, edgeCapacity) * sizeof(graphInt));
+    capacity += 2 * (ar_AlignedSize(sizeof(listCollectionStruct)) + ar_AlignedSize(VIsize * sizeof(lcnode)));
+    capacity += ar_AlignedSize(VIsize * sizeof(DFSUtils_VertexInfo));
+    capacity += ar_AlignedSize(VIsize * sizeof(Planarity_VertexInfo));
+    capacity += ar_AlignedSize(Vsize * sizeof(extFaceLinkRec));
+    capacity += ar_AlignedSize(sizeof(isolatorContextStruct));
+
+    capacity += VIsize * ARENA_EXTENSION_INTS_PER_VERTEX * sizeof(int);
+    capacity += Esize * ARENA_EXTENSION_INTS_PER_EDGE * sizeof(int);
+    capacity += ARENA_EXTENSION_MAXALLOCATIONS * ARENA_ALIGNMENT;
+
+    return capacity;
+}
+
+/********************************************************************
+ _gp_AllocStorage()
+
+ Returns size bytes of uninitialized memory from the arena of the
+ graph, if it has one with enough space left, or else from the heap.
+ ********************************************************************/
+
+void *_gp_AllocStorage(graphP theGraph, size_t size)
+{
+    void *ptr = ar_Alloc(theGraphArena(theGraph), size);
+
+    return ptr != NULL ? ptr : malloc(size);
+}
+
+/********************************************************************
+ _gp_ReallocStorage()
+
+ Changes the size of storage obtained from _gp_AllocStorage() from
+ oldSize bytes to newSize bytes, preserving the content (up to the
+ lesser of the two sizes). Storage in the arena cannot grow in place,
+ so it is moved to new storage, and the arena space is not reused.
+
+ Returns the new storage, or NULL on failure, in which case the old
+ storage is left as it was.
+ ********************************************************************/
+
+void *_gp_ReallocStorage(graphP theGraph, void *ptr, size_t oldSize, size_t newSize)
+{
+    void *newPtr = NULL;
+
+    if (!ar_Contains(theGraphArena(theGraph), ptr))
+        return realloc(ptr, newSize);
+
+    if ((newPtr = _gp_AllocStorage(theGraph, newSize)) != NULL)
+        memcpy(newPtr, ptr, oldSize < newSize ? oldSize : newSize);
+
+    return newPtr;
+}
+
+/********************************************************************
+ _gp_FreeStorage()
+
+ Frees storage obtained from _gp_AllocStorage(), unless it is in the
+ arena of the graph, which is only freed as a whole by _ClearGraph().
+ ********************************************************************/
+
+void _gp_FreeStorage(graphP theGraph, void *ptr)
+{
+    if (ptr != NULL && !ar_Contains(theGraphArena(theGraph), ptr))
+        free(ptr);
+}
+
+/********************************************************************
+ _gp_NewStack()
+ _gp_FreeStack()
+
+ Like sp_New() and sp_Free(), except the stack is allocated in the
+ arena of the graph, if it has one with enough space left.
+ ********************************************************************/
+
+stackP _gp_NewStack(graphP theGraph, graphInt capacity)
+{
+    stackP theStack = NULL;
+
+    if (theGraphArena(theGraph) == NULL ||
+        (theStack = (stackP)ar_Alloc(theGraphArena(theGraph), sizeof(stackStruct))) == NULL ||
+        (theStack->S = (graphInt *)ar_Alloc(theGraphArena(theGraph), capacity * sizeof(graphInt))) == NULL)
+        return sp_New(capacity);
+
+    theStack->capacity = capacity;
+    sp_ClearStack(theStack);
+
+    return theStack;
+}
+
+void _gp_FreeStack(graphP theGraph, stackP *pStack)
+{
+    if (pStack == NULL || *pStack == NULL)
+        return;
+
+    if (ar_Contains(theGraphArena(theGraph), *pStack))
+        *pStack = NULL;
+    else
+        sp_Free(pStack);
+}
+
+/********************************************************************
+ _gp_NewListCollection()
+ _gp_FreeListCollection()
+
+ Like LCNew() and LCFree(), except the list collection is allocated
+ in the arena of the graph, if it has one with enough space left.
+ ********************************************************************/
+
+listCollectionP _gp_NewListCollection(graphP theGraph, graphInt N)
+{
+    listCollectionP theListColl = NULL;
+
+    if (N <= 0)
+        return NULL;
+
+    if (theGraphArena(theGraph) == NULL ||
+        (theListColl = (listCollectionP)ar_Alloc(theGraphArena(theGraph), sizeof(listCollectionStruct))) == NULL ||
+        (theListColl->List = (lcnode *)ar_Alloc(theGraphArena(theGraph), N * sizeof(lcnode))) == NULL)
+        return LCNew(N);
+
+    theListColl->N = N;
+    LCReset(theListColl);
+
+    return theListColl;
+}
+
+void _gp_FreeListCollection(graphP theGraph, listCollectionP *pListColl)
+{
+    if (pListColl == NULL || *pListColl == NULL)
+        return;
+
+    if (ar_Contains(theGraphArena(theGraph), *pListColl))
+        *pListColl = NULL;
+    else
+        LCFree(pListColl);
+}
+
 /********************************************************************
  _InitVertices()
  ********************************************************************/
@@ -328,29 +684,279 @@ void _InitVertices(graphP theGraph)
 #ifdef USE_1BASEDARRAYS
 // For 1-based arrays, the memset() initializes the flags correctly
 #else
-    for (int v = gp_LowerBoundVertexStorage(theGraph); v < gp_UpperBoundVertexStorage(theGraph); ++v)
+    for (graphInt v = gp_LowerBoundVertexStorage(theGraph); v < gp_UpperBoundVertexStorage(theGraph); ++v)
         gp_InitFlags(theGraph, v);
 #endif
+
+#ifdef USE_VISITED_EPOCHS
+    // All visited stamps are now zero, so any non-zero epoch has all vertices unvisited
+    theGraph->vertexVisitedEpoch = theGraph->virtualVertexVisitedEpoch = 1;
+#endif
 }
 
 /********************************************************************
  _InitEdges()
+ Initializes the edge records below the given upperBound, which is
+ gp_UpperBoundEdgeStorage() for newly allocated edge storage. When the
+ graph is reset, it is the edge high water mark instead, since all of
+ the edge records at and above it are already in their initial state.
+ Either way, all edge records are then in their initial state.
  ********************************************************************/
-void _InitEdges(graphP theGraph)
+void _InitEdges(graphP theGraph, graphInt upperBound)
 {
-    memset(theGraph->E, NIL_CHAR, gp_UpperBoundEdgeStorage(theGraph) * sizeof(edgeRec));
+#ifdef USE_EDGE_SOA
+    memset(theGraph->E.links, NIL_CHAR, upperBound * sizeof(edgeLinkRec));
+    memset(theGraph->E.neighbor, NIL_CHAR, upperBound * sizeof(graphIndex));
+    memset(theGraph->E.flags, NIL_CHAR, upperBound * sizeof(unsigned));
+#ifdef USE_VISITED_EPOCHS
+    memset(theGraph->E.visitedStamp, 0, upperBound * sizeof(unsigned));
+#endif
+#else
+    memset(theGraph->E, NIL_CHAR, upperBound * sizeof(edgeRec));
+#endif
 
 #ifdef USE_1BASEDARRAYS
 #else
-    for (int e = gp_LowerBoundEdgeStorage(theGraph); e < gp_UpperBoundEdgeStorage(theGraph); ++e)
+    for (graphInt e = gp_LowerBoundEdgeStorage(theGraph); e < upperBound; ++e)
         gp_InitEdgeFlags(theGraph, e);
 #endif
+
+#ifdef USE_VISITED_EPOCHS
+    theGraph->edgeVisitedEpoch = 1;
+#endif
+
+    theGraphEdgeHighWaterMark(theGraph) = gp_LowerBoundEdgeStorage(theGraph);
+
+    _gp_InvalidateAdjacencyIndex(theGraph);
+}
+
+/********************************************************************
+ _AllocateEdgeStorage()
+
+ Allocates Esize edge records in the layout selected at compile time
+ (see USE_EDGE_SOA in graph.h). The edge records are not initialized.
+
+ Returns OK on success, NOTOK on allocation failure (in which case
+     any partially allocated edge storage is freed).
+ ********************************************************************/
+int _AllocateEdgeStorage(graphP theGraph, graphInt Esize)
+{
+#ifdef USE_EDGE_SOA
+    theGraph->E.links = (edgeLinkRecP)_AllocateEdgeArray(theGraph, EDGESTORAGE_LINKS, sizeof(edgeLinkRec), Esize);
+    theGraph->E.neighbor = (graphIndex *)_AllocateEdgeArray(theGraph, EDGESTORAGE_NEIGHBOR, sizeof(graphIndex), Esize);
+    theGraph->E.flags = (unsigned *)_AllocateEdgeArray(theGraph, EDGESTORAGE_FLAGS, sizeof(unsigned), Esize);
+
+    if (theGraph->E.links == NULL || theGraph->E.neighbor == NULL || theGraph->E.flags == NULL)
+    {
+        _FreeEdgeStorage(theGraph);
+        return NOTOK;
+    }
+
+#ifdef USE_VISITED_EPOCHS
+    if ((theGraph->E.visitedStamp = (unsigned *)_AllocateEdgeArray(theGraph, EDGESTORAGE_VISITEDSTAMP, sizeof(unsigned), Esize)) == NULL)
+    {
+        _FreeEdgeStorage(theGraph);
+        return NOTOK;
+    }
+#endif
+#else
+    if ((theGraph->E = (edgeRecP)_AllocateEdgeArray(theGraph, EDGESTORAGE_RECORDS, sizeof(edgeRec), Esize)) == NULL)
+        return NOTOK;
+#endif
+
+    return OK;
+}
+
+/********************************************************************
+ _ReallocateEdgeStorage()
+
+ Changes the size of the edge storage to newEsize edge records,
+ preserving the content of the existing edge records. Any new edge
+ records are not initialized.
+
+ Returns OK on success, NOTOK on reallocation failure. On failure,
+     the edge storage arrays that could not be reallocated are left
+     as they were, so the graph can still be freed normally.
+ ********************************************************************/
+int _ReallocateEdgeStorage(graphP theGraph, graphInt newEsize)
+{
+    graphInt oldEsize = gp_UpperBoundEdgeStorage(theGraph);
+
+#ifdef USE_EDGE_SOA
+    edgeLinkRecP newLinks = NULL;
+    graphIndex *newNeighbor = NULL;
+    unsigned *newFlags = NULL;
+
+    if ((newLinks = (edgeLinkRecP)_ReallocateEdgeArray(theGraph, EDGESTORAGE_LINKS, theGraph->E.links,
+                                                        sizeof(edgeLinkRec), oldEsize, newEsize)) == NULL)
+        return NOTOK;
+    theGraph->E.links = newLinks;
+
+    if ((newNeighbor = (graphIndex *)_ReallocateEdgeArray(theGraph, EDGESTORAGE_NEIGHBOR, theGraph->E.neighbor,
+                                                           sizeof(graphIndex), oldEsize, newEsize)) == NULL)
+        return NOTOK;
+    theGraph->E.neighbor = newNeighbor;
+
+    if ((newFlags = (unsigned *)_ReallocateEdgeArray(theGraph, EDGESTORAGE_FLAGS, theGraph->E.flags,
+                                                      sizeof(unsigned), oldEsize, newEsize)) == NULL)
+        return NOTOK;
+    theGraph->E.flags = newFlags;
+
+#ifdef USE_VISITED_EPOCHS
+    if ((newFlags = (unsigned *)_ReallocateEdgeArray(theGraph, EDGESTORAGE_VISITEDSTAMP, theGraph->E.visitedStamp,
+                                                      sizeof(unsigned), oldEsize, newEsize)) == NULL)
+        return NOTOK;
+    theGraph->E.visitedStamp = newFlags;
+#endif
+#else
+    edgeRecP newE = NULL;
+
+    if ((newE = (edgeRecP)_ReallocateEdgeArray(theGraph, EDGESTORAGE_RECORDS, theGraph->E,
+                                                sizeof(edgeRec), oldEsize, newEsize)) == NULL)
+        return NOTOK;
+    theGraph->E = newE;
+#endif
+
+    return OK;
+}
+
+/********************************************************************
+ _FreeEdgeStorage()
+ ********************************************************************/
+void _FreeEdgeStorage(graphP theGraph)
+{
+#ifdef USE_EDGE_SOA
+    if (theGraph->E.links != NULL)
+    {
+        _FreeEdgeArray(theGraph, EDGESTORAGE_LINKS, theGraph->E.links);
+        theGraph->E.links = NULL;
+    }
+    if (theGraph->E.neighbor != NULL)
+    {
+        _FreeEdgeArray(theGraph, EDGESTORAGE_NEIGHBOR, theGraph->E.neighbor);
+        theGraph->E.neighbor = NULL;
+    }
+    if (theGraph->E.flags != NULL)
+    {
+        _FreeEdgeArray(theGraph, EDGESTORAGE_FLAGS, theGraph->E.flags);
+        theGraph->E.flags = NULL;
+    }
+#ifdef USE_VISITED_EPOCHS
+    if (theGraph->E.visitedStamp != NULL)
+    {
+        _FreeEdgeArray(theGraph, EDGESTORAGE_VISITEDSTAMP, theGraph->E.visitedStamp);
+        theGraph->E.visitedStamp = NULL;
+    }
+#endif
+#else
+    if (theGraph->E != NULL)
+    {
+        _FreeEdgeArray(theGraph, EDGESTORAGE_RECORDS, theGraph->E);
+        theGraph->E = NULL;
+    }
+#endif
+}
+
+/********************************************************************
+ _AllocateEdgeArray()
+
+ Returns uninitialized storage for one of the edge storage arrays,
+ given by whichArray, with Esize elements of elementSize bytes.
+
+ If gp_ReserveEdgeStorage() selected reserved address space for the
+ graph, then the storage is the start of a region with room for the
+ reserved edge capacity, with only the memory for Esize elements
+ committed. Otherwise, or if the region cannot be created, the storage
+ comes from _gp_AllocStorage().
+
+ Returns NULL on allocation failure.
+ ********************************************************************/
+void *_AllocateEdgeArray(graphP theGraph, int whichArray, size_t elementSize, graphInt Esize)
+{
+    graphPrivateDataP privateData = (graphPrivateDataP)theGraph->privateData;
+    graphInt reservedEsize = gp_LowerBoundEdgeStorage(theGraph) + 2 * privateData->reservedEdgeCapacity;
+    vmRegionP theRegion = NULL;
+
+    if (privateData->reservedEdgeCapacity > 0 && Esize <= reservedEsize &&
+        (size_t)reservedEsize <= SIZE_MAX / elementSize &&
+        (theRegion = vr_New((size_t)reservedEsize * elementSize,
+                            (privateData->reserveFlags & RESERVEFLAGS_HUGEPAGES) ? TRUE : FALSE)) != NULL)
+    {
+        if (vr_Commit(theRegion, (size_t)Esize * elementSize) == OK)
+        {
+            privateData->edgeStorageRegions[whichArray] = theRegion;
+            return vr_GetBase(theRegion);
+        }
+
+        vr_Free(&theRegion);
+    }
+
+    return _gp_AllocStorage(theGraph, (size_t)Esize * elementSize);
+}
+
+/********************************************************************
+ _ReallocateEdgeArray()
+
+ Changes the size of edge storage array whichArray, obtained from
+ _AllocateEdgeArray(), from oldEsize to newEsize elements, preserving
+ the content. An array in reserved address space stays where it is
+ while its region can commit the memory for newEsize elements, and
+ otherwise it moves to storage from _gp_AllocStorage().
+
+ Returns the storage, or NULL on failure, in which case the old storage
+     is left as it was.
+ ********************************************************************/
+void *_ReallocateEdgeArray(graphP theGraph, int whichArray, void *ptr, size_t elementSize,
+                           graphInt oldEsize, graphInt newEsize)
+{
+    vmRegionP *pRegion = &((graphPrivateDataP)theGraph->privateData)->edgeStorageRegions[whichArray];
+    void *newPtr = NULL;
+
+    if (*pRegion == NULL)
+        return _gp_ReallocStorage(theGraph, ptr, (size_t)oldEsize * elementSize, (size_t)newEsize * elementSize);
+
+    if (vr_Commit(*pRegion, (size_t)newEsize * elementSize) == OK)
+        return ptr;
+
+    if ((newPtr = _gp_AllocStorage(theGraph, (size_t)newEsize * elementSize)) != NULL)
+    {
+        memcpy(newPtr, ptr, (size_t)(oldEsize < newEsize ? oldEsize : newEsize) * elementSize);
+        vr_Free(pRegion);
+    }
+
+    return newPtr;
+}
+
+/********************************************************************
+ _FreeEdgeArray()
+
+ Frees edge storage array whichArray, obtained from _AllocateEdgeArray().
+ ********************************************************************/
+void _FreeEdgeArray(graphP theGraph, int whichArray, void *ptr)
+{
+    vmRegionP *pRegion = &((graphPrivateDataP)theGraph->privateData)->edgeStorageRegions[whichArray];
+
+    if (*pRegion != NULL)
+        vr_Free(pRegion);
+    else
+        _gp_FreeStorage(theGraph, ptr);
 }
 
 /********************************************************************
  gp_ResetGraphStorage()
  Resets the graph to the state immediately after processing by
  gp_EnsureVertexCapacity().
+
+ Only the edge records below the edge high water mark are reset, so
+ the cost of resetting the edges is proportional to the number of edge
+ records used since the last reset rather than to the edge capacity.
+ This makes it inexpensive to reuse a graph with a large edge capacity
+ for many graphs with fewer edges.
+
+ Extensions that overload fpResetGraphStorage() must follow the same
+ rule for their parallel edge arrays. Since the base function lowers
+ the edge high water mark, an overload must get the mark before it
+ invokes the base function, then reset its edge records below the mark.
  ********************************************************************/
 
 void gp_ResetGraphStorage(graphP theGraph)
@@ -371,8 +977,9 @@ void _ResetGraphStorage(graphP theGraph)
     theGraph->graphFlags &= ~GRAPHFLAGS_LOWPOINTSCOMPUTED;
     theGraph->graphFlags &= ~GRAPHFLAGS_DIRECTEDEDGEDETECTED;
     _InitVertices(theGraph);
-    _InitEdges(theGraph);
+    _InitEdges(theGraph, theGraphEdgeHighWaterMark(theGraph));
     _InitIsolatorContext(theGraph);
+    theGraphIsolationPending(theGraph) = FALSE;
 
     LCReset(theGraphBicompRootLists(theGraph));
     LCReset(theGraphSortedDFSChildLists(theGraph));
@@ -420,7 +1027,7 @@ void _ResetGraphStorage(graphP theGraph)
          satisfy the requiredEdgeCapacity
          OK if reallocation succeeds or is not required
  ********************************************************************/
-int gp_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
+int gp_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity)
 {
     if (theGraph == NULL || requiredEdgeCapacity <= 0)
         return NOTOK;
@@ -428,6 +1035,9 @@ int gp_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
     if (theGraph->edgeCapacity >= requiredEdgeCapacity)
         return OK;
 
+    if (!_gp_IsIndexableCapacity(requiredEdgeCapacity))
+        return NOTOK;
+
     // In the special case where gp_EnsureVertexCapacity() has not yet
     // been called, we can simply set the higher edgeCapacity since normal
     // behavior of gp_EnsureVertexCapacity() will then allocate the
@@ -442,60 +1052,46 @@ int gp_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
     return theGraph->functions->fpEnsureEdgeCapacity(theGraph, requiredEdgeCapacity);
 }
 
-int _EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
+int _EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity)
 {
     stackP newStack = NULL;
-    int newEsize = gp_LowerBoundEdgeStorage(theGraph) + (requiredEdgeCapacity << 1);
+    graphInt newEsize = gp_LowerBoundEdgeStorage(theGraph) + (requiredEdgeCapacity << 1);
 
     // If the new size is less than or equal to the current edge storage size,
     // then the graph already has the required edge capacity
     if (newEsize <= gp_UpperBoundEdgeStorage(theGraph))
         return OK;
 
-    // Expand theStack. Depth-first search needs 2 integers per edge record
-    // (2 edge records per edge), plus 2 to start the DFS on a tree root
-    //
-    if (sp_GetCapacity(theGraph->theStack) < 2 * (2 * requiredEdgeCapacity) + 2)
+    // Expand theStack, which needs an integer per edge record (see _GetStackCapacity())
+    if (sp_GetCapacity(theGraph->theStack) < _GetStackCapacity(gp_GetN(theGraph), requiredEdgeCapacity))
     {
-        int newStackSize = 2 * (2 * requiredEdgeCapacity) + 2;
+        graphInt newStackSize = _GetStackCapacity(gp_GetN(theGraph), requiredEdgeCapacity);
 
-        if (newStackSize < 2 * DEFAULT_EDGE_CAPACITY_FACTOR * gp_GetN(theGraph) + 2)
-        {
-            // NOTE: We enforce a minimum stack based on number of vertices
-            //       if edgeCapacity is small. Currently, this will not
-            //       happen because we only 'ensure' edge capacity, i.e.,
-            //       the capacity can only ever get bigger. However, this
-            //       rule is enforced in case future methods are added
-            //       that reduce edge capacity
-            newStackSize = 2 * DEFAULT_EDGE_CAPACITY_FACTOR * gp_GetN(theGraph) + 2;
-        }
-
-        if ((newStack = sp_New(newStackSize)) == NULL)
+        if ((newStack = _gp_NewStack(theGraph, newStackSize)) == NULL)
             return NOTOK;
 
         sp_CopyContent(newStack, theGraph->theStack);
-        sp_Free(&theGraph->theStack);
+        _gp_FreeStack(theGraph, &theGraph->theStack);
         theGraph->theStack = newStack;
     }
 
     // Expand edgeHoles (at most, every edge is a hole if all edges deleted)
-    if ((newStack = sp_New(requiredEdgeCapacity)) == NULL)
+    if ((newStack = _gp_NewStack(theGraph, requiredEdgeCapacity)) == NULL)
     {
         return NOTOK;
     }
 
     sp_CopyContent(newStack, theGraph->edgeHoles);
-    sp_Free(&theGraph->edgeHoles);
+    _gp_FreeStack(theGraph, &theGraph->edgeHoles);
     theGraph->edgeHoles = newStack;
     theGraph->numEdgeHoles = sp_GetCurrentSize(theGraph->edgeHoles);
 
-    // Reallocate the edgeRec array to the new size,
-    theGraph->E = (edgeRecP)realloc(theGraph->E, newEsize * sizeof(edgeRec));
-    if (theGraph->E == NULL)
+    // Reallocate the edge record storage to the new size,
+    if (_ReallocateEdgeStorage(theGraph, newEsize) != OK)
         return NOTOK;
 
     // Initialize the new edge records
-    for (int e = gp_UpperBoundEdgeStorage(theGraph); e < newEsize; ++e)
+    for (graphInt e = gp_UpperBoundEdgeStorage(theGraph); e < newEsize; ++e)
         _InitEdgeRec(theGraph, e);
 
     // The new edgeCapacity has been successfully allocated
@@ -508,7 +1104,7 @@ int _EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
  Sets the fields in a single vertex record to initial values
  ********************************************************************/
 
-void _InitVertexRec(graphP theGraph, int v)
+void _InitVertexRec(graphP theGraph, graphInt v)
 {
     gp_SetFirstEdge(theGraph, v, NIL);
     gp_SetLastEdge(theGraph, v, NIL);
@@ -540,7 +1136,7 @@ void _InitVertexInfo(graphP theGraph, int v)
  Sets the fields in a single edge record structure to initial values
  ********************************************************************/
 
-void _InitEdgeRec(graphP theGraph, int e)
+void _InitEdgeRec(graphP theGraph, graphInt e)
 {
     gp_SetNeighbor(theGraph, e, NIL);
     gp_SetPrevEdge(theGraph, e, NIL);
@@ -578,26 +1174,55 @@ void _ClearAllVisitedFlagsInGraph(graphP theGraph)
  _ClearVertexVisitedFlags()
  Clears the visited flags of vertices, and if the second parameter
  is truthy, also clears the visited flags of virtual vertices.
+ With USE_VISITED_EPOCHS, this takes constant time except when an
+ epoch wraps around, which requires a sweep to reset the stamps.
  ********************************************************************/
 
 void _ClearVertexVisitedFlags(graphP theGraph, int includeVirtualVertices)
 {
-    for (int v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+#ifdef USE_VISITED_EPOCHS
+    if (++theGraph->vertexVisitedEpoch == UINT_MAX)
+    {
+        for (graphInt v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+            gp_ClearVisited(theGraph, v);
+        theGraph->vertexVisitedEpoch = 1;
+    }
+
+    if (includeVirtualVertices && ++theGraph->virtualVertexVisitedEpoch == UINT_MAX)
+    {
+        for (graphInt vv = gp_LowerBoundVirtualVertices(theGraph); vv < gp_UpperBoundVirtualVertices(theGraph); ++vv)
+            gp_ClearVisited(theGraph, vv);
+        theGraph->virtualVertexVisitedEpoch = 1;
+    }
+#else
+    for (graphInt v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
         gp_ClearVisited(theGraph, v);
 
     if (includeVirtualVertices)
-        for (int vv = gp_LowerBoundVirtualVertices(theGraph); vv < gp_UpperBoundVirtualVertices(theGraph); ++vv)
+        for (graphInt vv = gp_LowerBoundVirtualVertices(theGraph); vv < gp_UpperBoundVirtualVertices(theGraph); ++vv)
             gp_ClearVisited(theGraph, vv);
+#endif
 }
 
 /********************************************************************
  _ClearEdgeVisitedFlags()
+ With USE_VISITED_EPOCHS, advancing the epoch also clears the visited
+ flags of the unused edge records, which are unvisited anyway.
  ********************************************************************/
 
 void _ClearEdgeVisitedFlags(graphP theGraph)
 {
-    for (int e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); ++e)
+#ifdef USE_VISITED_EPOCHS
+    if (++theGraph->edgeVisitedEpoch == UINT_MAX)
+    {
+        for (graphInt e = gp_LowerBoundEdgeStorage(theGraph); e < gp_UpperBoundEdgeStorage(theGraph); ++e)
+            gp_ClearEdgeVisited(theGraph, e);
+        theGraph->edgeVisitedEpoch = 1;
+    }
+#else
+    for (graphInt e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); ++e)
         gp_ClearEdgeVisited(theGraph, e);
+#endif
 }
 
 /********************************************************************
@@ -613,10 +1238,10 @@ void _ClearEdgeVisitedFlags(graphP theGraph)
  Returns OK on success, NOTOK on implementation failure.
  ********************************************************************/
 
-int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot)
+int _ClearAllVisitedFlagsInBicomp(graphP theGraph, graphInt BicompRoot)
 {
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
-    int v, e;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt v, e;
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
@@ -651,9 +1276,9 @@ int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot)
  the given bicomp).
  ********************************************************************/
 
-int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, int BicompRoot)
+int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, graphInt BicompRoot)
 {
-    int R;
+    graphInt R;
 
     for (R = gp_LowerBoundVirtualVertices(theGraph); R < gp_UpperBoundVirtualVertices(theGraph); ++R)
     {
@@ -674,7 +1299,7 @@ int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, int BicompRoot)
 
 void _ClearEdgeVisitedFlagsInUnembeddedEdges(graphP theGraph)
 {
-    int v, e;
+    graphInt v, e;
 
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
@@ -701,9 +1326,9 @@ void _ClearEdgeVisitedFlagsInUnembeddedEdges(graphP theGraph)
  Returns OK on success, NOTOK on internal failure
  ****************************************************************************/
 
-int _ClearAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x)
+int _ClearAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x)
 {
-    int e, eTwin;
+    graphInt e, eTwin;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)w;
@@ -746,9 +1371,9 @@ int _ClearAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x)
  Returns OK on success, NOTOK on internal failure
  ****************************************************************************/
 
-int _SetAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x)
+int _SetAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x)
 {
-    int e, eTwin;
+    graphInt e, eTwin;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)w;
@@ -790,12 +1415,12 @@ int _SetAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x)
  Returns OK on success, NOTOK on failure.
  ********************************************************************/
 
-int _FillVertexVisitedIndexes(graphP theGraph, int FillValue)
+int _FillVertexVisitedIndexes(graphP theGraph, graphInt FillValue)
 {
     if (theGraph == NULL)
         return NOTOK;
 
-    for (int v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    for (graphInt v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
         gp_SetVertexVisitedIndex(theGraph, v, FillValue);
 
     return OK;
@@ -814,10 +1439,10 @@ int _FillVertexVisitedIndexes(graphP theGraph, int FillValue)
  Returns OK on success, NOTOK on implementation failure.
  ********************************************************************/
 
-int _FillVertexVisitedIndexesInBicomp(graphP theGraph, int BicompRoot, int FillValue)
+int _FillVertexVisitedIndexesInBicomp(graphP theGraph, graphInt BicompRoot, graphInt FillValue)
 {
-    int v, e;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt v, e;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
@@ -852,10 +1477,10 @@ int _FillVertexVisitedIndexesInBicomp(graphP theGraph, int BicompRoot, int FillV
  Returns OK on success, NOTOK on implementation failure.
  ********************************************************************/
 
-int _ClearObstructionMarksInBicomp(graphP theGraph, int BicompRoot)
+int _ClearObstructionMarksInBicomp(graphP theGraph, graphInt BicompRoot)
 {
-    int V, e;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt V, e;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
@@ -879,55 +1504,59 @@ int _ClearObstructionMarksInBicomp(graphP theGraph, int BicompRoot)
  _ClearGraph()
  Clears all memory used by the graph, restoring it to the state it
  was in immediately after gp_New() created it.
+
+ For a graph created by gp_NewWithArena(), the arena is freed last, once
+ the graph and its extensions have let go of any storage within it, and
+ a new arena is created by the next call to gp_EnsureVertexCapacity().
  ********************************************************************/
 
 void _ClearGraph(graphP theGraph)
 {
     if (theGraph->V != NULL)
     {
-        free(theGraph->V);
+        _gp_FreeStorage(theGraph, theGraph->V);
         theGraph->V = NULL;
     }
-    if (theGraph->E != NULL)
-    {
-        free(theGraph->E);
-        theGraph->E = NULL;
-    }
+    _FreeEdgeStorage(theGraph);
 
     theGraph->N = 0;
     theGraph->NV = 0;
     theGraph->M = 0;
     theGraph->edgeCapacity = 0;
     theGraph->embedFlags = 0;
+    theGraphEdgeHighWaterMark(theGraph) = 0;
+    _gp_InvalidateAdjacencyIndex(theGraph);
 
-    sp_Free(&theGraph->edgeHoles);
+    _gp_FreeStack(theGraph, &theGraph->edgeHoles);
     theGraph->numEdgeHoles = 0;
 
-    sp_Free(&theGraph->theStack);
-    LCFree(&theGraphBicompRootLists(theGraph));
+    _gp_FreeStack(theGraph, &theGraph->theStack);
+    _gp_FreeListCollection(theGraph, &theGraphBicompRootLists(theGraph));
     if (theGraphDVI(theGraph) != NULL)
     {
-        free(theGraphDVI(theGraph));
+        _gp_FreeStorage(theGraph, theGraphDVI(theGraph));
         theGraphDVI(theGraph) = NULL;
     }
 
     if (theGraphPVI(theGraph) != NULL)
     {
-        free(theGraphPVI(theGraph));
+        _gp_FreeStorage(theGraph, theGraphPVI(theGraph));
         theGraphPVI(theGraph) = NULL;
     }
-    LCFree(&theGraphSortedDFSChildLists(theGraph));
+    _gp_FreeListCollection(theGraph, &theGraphSortedDFSChildLists(theGraph));
     if (theGraphExtFace(theGraph) != NULL)
     {
-        free(theGraphExtFace(theGraph));
+        _gp_FreeStorage(theGraph, theGraphExtFace(theGraph));
         theGraphExtFace(theGraph) = NULL;
     }
     if (theGraphIC(theGraph) != NULL)
     {
-        free(theGraphIC(theGraph));
+        _gp_FreeStorage(theGraph, theGraphIC(theGraph));
         theGraphIC(theGraph) = NULL;
     }
 
+    gp_Free(&theGraphIncrementalBackup(theGraph));
+
     gp_FreeExtensions(theGraph);
 
     // Free the pseudo-extensions
@@ -940,6 +1569,8 @@ void _ClearGraph(graphP theGraph)
     if (gp_GetGraphFlags(theGraph) & GRAPHFLAGS_EXTENDEDWITH_DFSUTILS)
         gp_Detach_DFSUtils(theGraph);
 
+    ar_Free(&theGraphArena(theGraph));
+
     theGraph->graphFlags = 0;
 }
 
@@ -993,7 +1624,7 @@ void gp_Free(graphP *pGraph)
  ********************************************************************/
 int gp_CopyAdjacencyLists(graphP dstGraph, graphP srcGraph)
 {
-    int v, e;
+    graphInt v, e;
 
     if (dstGraph == NULL || srcGraph == NULL)
         return NOTOK;
@@ -1023,6 +1654,8 @@ int gp_CopyAdjacencyLists(graphP dstGraph, graphP srcGraph)
     dstGraph->M = gp_GetM(srcGraph);
     sp_Copy(dstGraph->edgeHoles, srcGraph->edgeHoles);
     dstGraph->numEdgeHoles = sp_GetCurrentSize(dstGraph->edgeHoles);
+    _gp_UpdateEdgeHighWaterMark(dstGraph);
+    _gp_InvalidateAdjacencyIndex(dstGraph);
 
     dstGraph->graphFlags &= ~GRAPHFLAGS_DFSNUMBERED;
     dstGraph->graphFlags &= ~GRAPHFLAGS_SORTEDBYDFI;
@@ -1046,18 +1679,60 @@ int gp_CopyAdjacencyLists(graphP dstGraph, graphP srcGraph)
  then this call will fail unless the caller first ensures that the
  edge capacity of the srcGraph is increased to match the dstGraph.
 
+ Only the live region of the edge storage is copied, i.e. the edge
+ records below the edge high water mark of the srcGraph, since all
+ edge records above it are in their initial state. The dstGraph edge
+ records from there up to the dstGraph high water mark are the only
+ ones that may need to be reinitialized. Extensions' copyData()
+ functions are expected to limit their work on parallel edge arrays
+ in the same way, so both high water marks are still intact when
+ gp_CopyExtensions() is called, and the dstGraph mark is updated last.
+
  Returns OK for success, NOTOK for failure.
  ********************************************************************/
 
-// Give macro names to three copy operations
-#define _gp_CopyVertexRec(dstGraph, vdst, srcGraph, vsrc) (dstGraph->V[vdst] = srcGraph->V[vsrc])
-#define _gp_CopyDFSUtilsVertexInfo(dstGraph, dstI, srcGraph, srcI) (theGraphDVI(dstGraph)[dstI] = theGraphDVI(srcGraph)[srcI])
-#define _gp_CopyPlanarityVertexInfo(dstGraph, dstI, srcGraph, srcI) (theGraphPVI(dstGraph)[dstI] = theGraphPVI(srcGraph)[srcI])
-#define _gp_CopyEdgeRec(dstGraph, edst, srcGraph, esrc) (dstGraph->E[edst] = srcGraph->E[esrc])
+// Give macro names to the block copy operations
+#define _gp_CopyVertexRecs(dstGraph, srcGraph, numRecs) \
+    memcpy(dstGraph->V, srcGraph->V, (numRecs) * sizeof(vertexRec))
+#ifdef USE_EDGE_SOA
+#ifdef USE_VISITED_EPOCHS
+#define _gp_CopyEdgeRecs(dstGraph, srcGraph, numRecs)                                     \
+    (memcpy(dstGraph->E.links, srcGraph->E.links, (numRecs) * sizeof(edgeLinkRec)),       \
+     memcpy(dstGraph->E.neighbor, srcGraph->E.neighbor, (numRecs) * sizeof(graphIndex)), \
+     memcpy(dstGraph->E.flags, srcGraph->E.flags, (numRecs) * sizeof(unsigned)),         \
+     memcpy(dstGraph->E.visitedStamp, srcGraph->E.visitedStamp, (numRecs) * sizeof(unsigned)))
+#else
+#define _gp_CopyEdgeRecs(dstGraph, srcGraph, numRecs)                                     \
+    (memcpy(dstGraph->E.links, srcGraph->E.links, (numRecs) * sizeof(edgeLinkRec)),       \
+     memcpy(dstGraph->E.neighbor, srcGraph->E.neighbor, (numRecs) * sizeof(graphIndex)), \
+     memcpy(dstGraph->E.flags, srcGraph->E.flags, (numRecs) * sizeof(unsigned)))
+#endif
+#else
+#define _gp_CopyEdgeRecs(dstGraph, srcGraph, numRecs) \
+    memcpy(dstGraph->E, srcGraph->E, (numRecs) * sizeof(edgeRec))
+#endif
+
+// Copies edge record eSrc to edge record eDst within a graph
+#ifdef USE_EDGE_SOA
+#ifdef USE_VISITED_EPOCHS
+#define _gp_CopyEdgeRec(theGraph, eDst, eSrc)                         \
+    ((theGraph)->E.links[eDst] = (theGraph)->E.links[eSrc],           \
+     (theGraph)->E.neighbor[eDst] = (theGraph)->E.neighbor[eSrc],     \
+     (theGraph)->E.flags[eDst] = (theGraph)->E.flags[eSrc],           \
+     (theGraph)->E.visitedStamp[eDst] = (theGraph)->E.visitedStamp[eSrc])
+#else
+#define _gp_CopyEdgeRec(theGraph, eDst, eSrc)                         \
+    ((theGraph)->E.links[eDst] = (theGraph)->E.links[eSrc],           \
+     (theGraph)->E.neighbor[eDst] = (theGraph)->E.neighbor[eSrc],     \
+     (theGraph)->E.flags[eDst] = (theGraph)->E.flags[eSrc])
+#endif
+#else
+#define _gp_CopyEdgeRec(theGraph, eDst, eSrc) ((theGraph)->E[eDst] = (theGraph)->E[eSrc])
+#endif
 
 int gp_CopyGraph(graphP dstGraph, graphP srcGraph)
 {
-    int v, e;
+    graphInt e, srcHighWaterMark, dstHighWaterMark;
 
     // Parameter checks
     if (dstGraph == NULL || srcGraph == NULL)
@@ -1079,41 +1754,30 @@ int gp_CopyGraph(graphP dstGraph, graphP srcGraph)
         return NOTOK;
     }
 
-    // Copy the vertices (non-virtual only).  Augmentations to vertices created
-    // by extensions are copied below by gp_CopyExtensions()
-    for (v = gp_LowerBoundVertices(srcGraph); v < gp_UpperBoundVertices(srcGraph); ++v)
-    {
-        _gp_CopyVertexRec(dstGraph, v, srcGraph, v);
-        if (theGraphDVI(dstGraph) != NULL && theGraphDVI(srcGraph) != NULL)
-            _gp_CopyDFSUtilsVertexInfo(dstGraph, v, srcGraph, v);
-        if (theGraphPVI(dstGraph) != NULL && theGraphPVI(srcGraph) != NULL)
-            _gp_CopyPlanarityVertexInfo(dstGraph, v, srcGraph, v);
-        gp_SetExtFaceVertex(dstGraph, v, 0, gp_GetExtFaceVertex(srcGraph, v, 0));
-        gp_SetExtFaceVertex(dstGraph, v, 1, gp_GetExtFaceVertex(srcGraph, v, 1));
-    }
-
-    // Copy the virtual vertices.  Augmentations to virtual vertices created
-    // by extensions are copied below by gp_CopyExtensions()
-    for (v = gp_LowerBoundVirtualVertices(srcGraph); v < gp_UpperBoundVirtualVertices(srcGraph); ++v)
-    {
-        _gp_CopyVertexRec(dstGraph, v, srcGraph, v);
-        gp_SetExtFaceVertex(dstGraph, v, 0, gp_GetExtFaceVertex(srcGraph, v, 0));
-        gp_SetExtFaceVertex(dstGraph, v, 1, gp_GetExtFaceVertex(srcGraph, v, 1));
-    }
-
-    // Copy the basic EdgeRec structures.  Augmentations to the edgeRec structure
-    // created by extensions are copied below by gp_CopyExtensions()
-    for (e = gp_LowerBoundEdgeStorage(srcGraph); e < gp_UpperBoundEdgeStorage(srcGraph); e++)
-        _gp_CopyEdgeRec(dstGraph, e, srcGraph, e);
-
-    // If the dstGraph has more edge storage than the srcGraph, then we clear the extra
-    // base edgeRec structures. In gp_CopyExtensions(), the various extensions' copyData()
-    // functions are expected to clear out any extension-specific extra edgeRec structures
-    if (gp_UpperBoundEdgeStorage(dstGraph) > gp_UpperBoundEdgeStorage(srcGraph))
-    {
-        for (e = gp_UpperBoundEdgeStorage(srcGraph); e < gp_UpperBoundEdgeStorage(dstGraph); e++)
-            _InitEdgeRec(dstGraph, e);
-    }
+    // Copy the vertices, including virtual vertices, and their DFS and
+    // planarity info. Augmentations to vertices created by extensions are
+    // copied below by gp_CopyExtensions()
+    _gp_CopyVertexRecs(dstGraph, srcGraph, gp_UpperBoundVertexStorage(srcGraph));
+    if (theGraphDVI(dstGraph) != NULL && theGraphDVI(srcGraph) != NULL)
+        memcpy(theGraphDVI(dstGraph), theGraphDVI(srcGraph), gp_UpperBoundVertices(srcGraph) * sizeof(DFSUtils_VertexInfo));
+    if (theGraphPVI(dstGraph) != NULL && theGraphPVI(srcGraph) != NULL)
+        memcpy(theGraphPVI(dstGraph), theGraphPVI(srcGraph), gp_UpperBoundVertices(srcGraph) * sizeof(Planarity_VertexInfo));
+    memcpy(theGraphExtFace(dstGraph), theGraphExtFace(srcGraph), gp_UpperBoundVertexStorage(srcGraph) * sizeof(extFaceLinkRec));
+
+    // Copy the live region of the basic EdgeRec structures.  Augmentations to
+    // the edgeRec structure created by extensions are copied below by
+    // gp_CopyExtensions()
+    srcHighWaterMark = theGraphEdgeHighWaterMark(srcGraph);
+    dstHighWaterMark = theGraphEdgeHighWaterMark(dstGraph);
+
+    _gp_CopyEdgeRecs(dstGraph, srcGraph, srcHighWaterMark);
+
+    // If the dstGraph edge records were changed above the live region of the
+    // srcGraph, then we clear them. In gp_CopyExtensions(), the various
+    // extensions' copyData() functions are expected to clear out the same
+    // range of extension-specific edgeRec structures
+    for (e = srcHighWaterMark; e < dstHighWaterMark; e++)
+        _InitEdgeRec(dstGraph, e);
 
     // Give the dstGraph the same size and intrinsic properties
     dstGraph->N = gp_GetN(srcGraph);
@@ -1123,17 +1787,28 @@ int gp_CopyGraph(graphP dstGraph, graphP srcGraph)
 
     dstGraph->graphFlags = gp_GetGraphFlags(srcGraph);
 
+#ifdef USE_VISITED_EPOCHS
+    // The copied visited stamps are only meaningful relative to the srcGraph epochs
+    dstGraph->vertexVisitedEpoch = srcGraph->vertexVisitedEpoch;
+    dstGraph->virtualVertexVisitedEpoch = srcGraph->virtualVertexVisitedEpoch;
+    dstGraph->edgeVisitedEpoch = srcGraph->edgeVisitedEpoch;
+#endif
+
     LCCopy(theGraphBicompRootLists(dstGraph), theGraphBicompRootLists(srcGraph));
     LCCopy(theGraphSortedDFSChildLists(dstGraph), theGraphSortedDFSChildLists(srcGraph));
     sp_Copy(dstGraph->theStack, srcGraph->theStack);
     sp_Copy(dstGraph->edgeHoles, srcGraph->edgeHoles);
     dstGraph->numEdgeHoles = sp_GetCurrentSize((dstGraph)->edgeHoles);
+    _gp_InvalidateAdjacencyIndex(dstGraph);
 
     // Copy the set of extensions, which includes copying the
     // extension data as well as the function overload tables
     if (gp_CopyExtensions(dstGraph, srcGraph) != OK)
         return NOTOK;
 
+    // Now the dstGraph edge records match those of the srcGraph
+    theGraphEdgeHighWaterMark(dstGraph) = srcHighWaterMark;
+
     // We do not copy the function table of srcGraph to the dstGraph
     // because copy extensions now copies all possible data from
     // srcGraph to dstGraph, but it does not extend dstGraph with
@@ -1151,13 +1826,22 @@ graphP gp_DupGraph(graphP theGraph)
 {
     graphP result = NULL;
 
-    if ((result = gp_New()) == NULL)
+    // A graph with an arena is duplicated into a graph with an arena
+    // that is sized to hold the full edge capacity of the source graph
+    if (theGraphArena(theGraph) != NULL)
+    {
+        if ((result = gp_NewWithArena(gp_GetN(theGraph), gp_GetEdgeCapacity(theGraph))) == NULL)
+        {
+            gp_ErrorMessage("Failed to create a new graph with an arena.");
+            return NULL;
+        }
+    }
+    else if ((result = gp_New()) == NULL)
     {
         gp_ErrorMessage("Failed to create a new graph.");
         return NULL;
     }
-
-    if (gp_EnsureVertexCapacity(result, gp_GetN(theGraph)) != OK)
+    else if (gp_EnsureVertexCapacity(result, gp_GetN(theGraph)) != OK)
     {
         gp_ErrorMessage("Failed to increase the vertex capacity of the new "
                         "graph.");
@@ -1190,14 +1874,15 @@ graphP gp_DupGraph(graphP theGraph)
  additional random edges are added.  If an edge already exists, then
  we retry until a non-existent edge is picked.
 
- This function assumes the caller has already called srand().
+ The random numbers come from the calling thread's generator, which the
+ caller can seed with gp_SetRandomSeed().
 
  Returns OK on success, NOTOK on failure
  ********************************************************************/
 
 int gp_CreateRandomGraph(graphP theGraph)
 {
-    int N, M, u, v, m;
+    graphInt N, M, u, v, m;
 
     if (theGraph == NULL)
     {
@@ -1224,8 +1909,8 @@ int gp_CreateRandomGraph(graphP theGraph)
 
     M = gp_GetRandomNumber(7 * N / 8, theGraph->edgeCapacity);
 
-    if (M > N * (N - 1) / 2)
-        M = N * (N - 1) / 2;
+    if (M > _GetCliqueEdgeCount(N))
+        M = _GetCliqueEdgeCount(N);
 
     for (m = N - 1; m < M; m++)
     {
@@ -1247,7 +1932,7 @@ int gp_CreateRandomGraph(graphP theGraph)
     return OK;
 }
 
-int _AddRandomGraphEdgeCandidate(randomGraphEdgeRec *edgeList, int edgeListCapacity, int *pEdgeListCount, int u, int v)
+int _AddRandomGraphEdgeCandidate(randomGraphEdgeRec *edgeList, graphInt edgeListCapacity, graphInt *pEdgeListCount, graphInt u, graphInt v)
 {
     if (edgeList == NULL || pEdgeListCount == NULL || *pEdgeListCount >= edgeListCapacity)
         return NOTOK;
@@ -1259,8 +1944,8 @@ int _AddRandomGraphEdgeCandidate(randomGraphEdgeRec *edgeList, int edgeListCapac
     return OK;
 }
 
-int _ProcessRandomGraphOptionalEdge(graphP theGraph, randomGraphEdgeRec *edgeList, int edgeListCapacity,
-                                    int *pEdgeListCount, int addImmediately, int u, int v)
+int _ProcessRandomGraphOptionalEdge(graphP theGraph, randomGraphEdgeRec *edgeList, graphInt edgeListCapacity,
+                                    graphInt *pEdgeListCount, int addImmediately, graphInt u, graphInt v)
 {
     if (addImmediately)
         return gp_AddEdge(theGraph, u, 0, v, 0) == OK ? OK : NOTOK;
@@ -1271,16 +1956,16 @@ int _ProcessRandomGraphOptionalEdge(graphP theGraph, randomGraphEdgeRec *edgeLis
     return OK;
 }
 
-void _ShuffleRandomGraphEdgeCandidates(randomGraphEdgeRec *edgeList, int edgeCount)
+void _ShuffleRandomGraphEdgeCandidates(randomGraphEdgeRec *edgeList, graphInt edgeCount)
 {
-    int e;
+    graphInt e;
 
     if (edgeList == NULL)
         return;
 
     for (e = edgeCount - 1; e > 0; --e)
     {
-        int e2 = gp_GetRandomNumber(0, e);
+        graphInt e2 = gp_GetRandomNumber(0, e);
         randomGraphEdgeRec temp = edgeList[e];
 
         edgeList[e] = edgeList[e2];
@@ -1303,22 +1988,24 @@ void _ShuffleRandomGraphEdgeCandidates(randomGraphEdgeRec *edgeList, int edgeCou
  subgraph of a random maximal planar graph. The output graph will
  have exactly numEdges edges.
 
- NOTE: This function assumes the caller has already called srand().
+ NOTE: The random numbers come from the calling thread's generator,
+       which the caller can seed with gp_SetRandomSeed().
 
  NOTE: If numEdges is larger than the edge capacity of theGraph, then
        then its value is reduced internally. The caller can invoke
        gp_EnsureEdgeCapacity() beforehand, if desired.
  ********************************************************************/
 
-int gp_CreateRandomGraphEx(graphP theGraph, int numEdges)
+int gp_CreateRandomGraphEx(graphP theGraph, graphInt numEdges)
 {
     randomGraphEdgeRec *optionalEdges = NULL;
     randomGraphFaceRec *faces = NULL;
-    int N, maxNumEdges, maxPlanarEdges, numPlanarCoreEdges;
-    int lowerVertex, upperVertex, faceCapacity, optionalEdgeCapacity;
-    int optionalEdgeCount = 0, faceCount = 0, addAllPlanarEdges;
+    graphInt N, maxNumEdges, maxPlanarEdges, numPlanarCoreEdges;
+    graphInt lowerVertex, upperVertex, faceCapacity, optionalEdgeCapacity;
+    graphInt optionalEdgeCount = 0, faceCount = 0;
+    int addAllPlanarEdges;
     int Result = OK;
-    int v, u, e;
+    graphInt v, u, e;
 
     // Parameter checks: Must have a graph of at least three vertices, and the
     // number of edges must be at least enough to support making a random tree.
@@ -1328,7 +2015,7 @@ int gp_CreateRandomGraphEx(graphP theGraph, int numEdges)
     N = gp_GetN(theGraph);
     lowerVertex = gp_LowerBoundVertices(theGraph);
     upperVertex = gp_UpperBoundVertices(theGraph);
-    maxNumEdges = (N * (N - 1)) >> 1;
+    maxNumEdges = _GetCliqueEdgeCount(N);
     maxPlanarEdges = 3 * N - 6;
 
     if (numEdges > theGraph->edgeCapacity)
@@ -1382,12 +2069,12 @@ int gp_CreateRandomGraphEx(graphP theGraph, int numEdges)
 
     for (v = lowerVertex + 3; v < upperVertex; ++v)
     {
-        int faceIndex = gp_GetRandomNumber(0, faceCount - 1);
-        int a = faces[faceIndex].a;
-        int b = faces[faceIndex].b;
-        int c = faces[faceIndex].c;
-        int faceVertices[3] = {a, b, c};
-        int treeEdgeIndex = gp_GetRandomNumber(0, 2);
+        graphInt faceIndex = gp_GetRandomNumber(0, faceCount - 1);
+        graphInt a = faces[faceIndex].a;
+        graphInt b = faces[faceIndex].b;
+        graphInt c = faces[faceIndex].c;
+        graphInt faceVertices[3] = {a, b, c};
+        graphInt treeEdgeIndex = gp_GetRandomNumber(0, 2);
         int i;
 
         if (gp_AddEdge(theGraph, v, 0, faceVertices[treeEdgeIndex], 0) != OK)
@@ -1448,37 +2135,183 @@ int gp_CreateRandomGraphEx(graphP theGraph, int numEdges)
         goto gp_CreateRandomGraphEx_Cleanup;
     }
 
-    /* Add additional random edges if the limit has not yet been reached. */
+    /* Add additional random edges if the limit has not yet been reached. */
+
+    while (gp_GetM(theGraph) < numEdges)
+    {
+        u = gp_GetRandomNumber(lowerVertex, upperVertex - 1);
+        v = gp_GetRandomNumber(lowerVertex, upperVertex - 1);
+
+        if (u != v && !gp_IsNeighbor(theGraph, u, v))
+        {
+            if (gp_AddEdge(theGraph, u, 0, v, 0) != OK)
+            {
+                Result = NOTOK;
+                goto gp_CreateRandomGraphEx_Cleanup;
+            }
+        }
+    }
+
+gp_CreateRandomGraphEx_Cleanup:
+
+    if (optionalEdges != NULL)
+    {
+        free(optionalEdges);
+        optionalEdges = NULL;
+    }
+    if (faces != NULL)
+    {
+        free(faces);
+        faces = NULL;
+    }
+
+    return Result;
+}
+
+/********************************************************************
+ gp_EnableAdjacencyIndex()
+
+ Enables an index that maps each vertex u and neighbor v to the edge
+ records in the adjacency list of u that indicate v. Once enabled,
+ gp_IsNeighbor(), gp_IsNeighborDirected(), gp_FindEdge() and
+ gp_FindDirectedEdge() take expected constant time rather than time
+ proportional to the degree of u.
+
+ The index is built on demand by the first such query, then kept up to
+ date by gp_AddEdge(), gp_InsertEdge(), gp_DeleteEdge(), gp_HideEdge(),
+ gp_RestoreEdge(), gp_ContractEdge(), gp_IdentifyVertices() and
+ gp_RestoreVertex(), as well as the operations based on them. Other
+ operations that rearrange the graph wholesale, such as gp_Embed(),
+ gp_SortVertices(), gp_CopyGraph() and resetting or reading the graph,
+ discard the index, and it is rebuilt on demand by the next query.
+
+ The index costs space proportional to the number of edges, so it is
+ worthwhile when adjacency queries are made on vertices of high degree.
+ When there are parallel edges, a query may find any of them, not
+ necessarily the first in the adjacency list.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int gp_EnableAdjacencyIndex(graphP theGraph)
+{
+    if (theGraph == NULL)
+        return NOTOK;
+
+    ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = TRUE;
+    return OK;
+}
+
+/********************************************************************
+ gp_DisableAdjacencyIndex()
+
+ Discards the adjacency index, if any, and stops it from being rebuilt,
+ so adjacency queries go back to scanning adjacency lists.
+ ********************************************************************/
+
+void gp_DisableAdjacencyIndex(graphP theGraph)
+{
+    if (theGraph == NULL)
+        return;
+
+    ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = FALSE;
+    _gp_InvalidateAdjacencyIndex(theGraph);
+}
+
+/********************************************************************
+ _gp_InvalidateAdjacencyIndex()
+ ********************************************************************/
+
+void _gp_InvalidateAdjacencyIndex(graphP theGraph)
+{
+    ai_Free(&theGraphAdjacencyIndex(theGraph));
+}
+
+/********************************************************************
+ _gp_GetAdjacencyIndex()
+
+ Returns the adjacency index of the graph, first building it if it is
+ enabled but has not been built since it was last invalidated. Returns
+ NULL if the index is not enabled, or if it could not be built, in
+ which case the caller falls back to scanning adjacency lists.
+ ********************************************************************/
+
+adjIndexP _gp_GetAdjacencyIndex(graphP theGraph)
+{
+    if (theGraphAdjacencyIndex(theGraph) == NULL &&
+        ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex &&
+        gp_GetN(theGraph) > 0)
+        _BuildAdjacencyIndex(theGraph);
+
+    return theGraphAdjacencyIndex(theGraph);
+}
+
+/********************************************************************
+ _BuildAdjacencyIndex()
+
+ Indexes every edge record in the adjacency list of every vertex and
+ virtual vertex. Hidden edge records are not in any adjacency list, so
+ they are not indexed until they are restored.
+
+ Returns OK on success, NOTOK on allocation failure.
+ ********************************************************************/
+
+int _BuildAdjacencyIndex(graphP theGraph)
+{
+    adjIndexP theIndex = ai_New(2 * gp_GetM(theGraph));
+    graphInt e;
+
+    if (theIndex == NULL)
+        return NOTOK;
 
-    while (gp_GetM(theGraph) < numEdges)
+    for (graphInt v = gp_LowerBoundVertexStorage(theGraph); v < gp_UpperBoundVertexStorage(theGraph); ++v)
     {
-        u = gp_GetRandomNumber(lowerVertex, upperVertex - 1);
-        v = gp_GetRandomNumber(lowerVertex, upperVertex - 1);
-
-        if (u != v && !gp_IsNeighbor(theGraph, u, v))
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
         {
-            if (gp_AddEdge(theGraph, u, 0, v, 0) != OK)
+            if (ai_Insert(theIndex, v, gp_GetNeighbor(theGraph, e), e) != OK)
             {
-                Result = NOTOK;
-                goto gp_CreateRandomGraphEx_Cleanup;
+                ai_Free(&theIndex);
+                return NOTOK;
             }
+            e = gp_GetNextEdge(theGraph, e);
         }
     }
 
-gp_CreateRandomGraphEx_Cleanup:
+    theGraphAdjacencyIndex(theGraph) = theIndex;
+    return OK;
+}
 
-    if (optionalEdges != NULL)
-    {
-        free(optionalEdges);
-        optionalEdges = NULL;
-    }
-    if (faces != NULL)
-    {
-        free(faces);
-        faces = NULL;
-    }
+/********************************************************************
+ _AdjacencyIndexAddEdge()
+ _AdjacencyIndexDeleteEdge()
 
-    return Result;
+ Add or remove the index entries of edge record e and its twin. The
+ vertex whose adjacency list contains an edge record is the neighbor
+ of its twin, so the neighbor members of both edge records must be
+ the same on removal as they were on addition.
+
+ If an entry cannot be added, the index is discarded so that it can
+ never give a wrong answer; it is rebuilt by the next query.
+ ********************************************************************/
+
+void _AdjacencyIndexAddEdge(graphP theGraph, graphInt e)
+{
+    adjIndexP theIndex = theGraphAdjacencyIndex(theGraph);
+    graphInt eTwin = gp_GetTwin(theGraph, e);
+
+    if (ai_Insert(theIndex, gp_GetNeighbor(theGraph, eTwin), gp_GetNeighbor(theGraph, e), e) != OK ||
+        ai_Insert(theIndex, gp_GetNeighbor(theGraph, e), gp_GetNeighbor(theGraph, eTwin), eTwin) != OK)
+        _gp_InvalidateAdjacencyIndex(theGraph);
+}
+
+void _AdjacencyIndexDeleteEdge(graphP theGraph, graphInt e)
+{
+    adjIndexP theIndex = theGraphAdjacencyIndex(theGraph);
+    graphInt eTwin = gp_GetTwin(theGraph, e);
+
+    ai_Delete(theIndex, gp_GetNeighbor(theGraph, eTwin), gp_GetNeighbor(theGraph, e), e);
+    ai_Delete(theIndex, gp_GetNeighbor(theGraph, e), gp_GetNeighbor(theGraph, eTwin), eTwin);
 }
 
 /********************************************************************
@@ -1494,9 +2327,10 @@ gp_CreateRandomGraphEx_Cleanup:
        method gp_IsNeighborDirected() instead.
  ********************************************************************/
 
-int gp_IsNeighbor(graphP theGraph, int u, int v)
+int gp_IsNeighbor(graphP theGraph, graphInt u, graphInt v)
 {
-    int e = NIL;
+    adjIndexP theIndex = NULL;
+    graphInt e = NIL;
 
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || u >= gp_UpperBoundVertexStorage(theGraph) ||
@@ -1508,6 +2342,9 @@ int gp_IsNeighbor(graphP theGraph, int u, int v)
         return FALSE;
     }
 
+    if ((theIndex = _gp_GetAdjacencyIndex(theGraph)) != NULL)
+        return ai_FindFirst(theIndex, u, v) != AI_NIL_SLOT ? TRUE : FALSE;
+
     e = gp_GetFirstEdge(theGraph, u);
     while (gp_IsEdge(theGraph, e))
     {
@@ -1532,9 +2369,10 @@ int gp_IsNeighbor(graphP theGraph, int u, int v)
        or EDGEFLAG_DIRECTION_INONLY to test if v is an in-neighbor of u,
        or EDGEFLAG_DIRECTION_OUTONLY to test if v is an out-neighbor of u.
  ********************************************************************/
-int gp_IsNeighborDirected(graphP theGraph, int u, int v, unsigned direction)
+int gp_IsNeighborDirected(graphP theGraph, graphInt u, graphInt v, unsigned direction)
 {
-    int e = NIL;
+    adjIndexP theIndex = NULL;
+    graphInt e = NIL, slot;
 
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || u >= gp_UpperBoundVertexStorage(theGraph) ||
@@ -1547,6 +2385,16 @@ int gp_IsNeighborDirected(graphP theGraph, int u, int v, unsigned direction)
         return FALSE;
     }
 
+    if ((theIndex = _gp_GetAdjacencyIndex(theGraph)) != NULL)
+    {
+        for (slot = ai_FindFirst(theIndex, u, v); slot != AI_NIL_SLOT; slot = ai_FindNext(theIndex, u, v, slot))
+        {
+            if (direction == 0 || direction == gp_GetDirection(theGraph, ai_GetValue(theIndex, slot)))
+                return TRUE;
+        }
+        return FALSE;
+    }
+
     e = gp_GetFirstEdge(theGraph, u);
     while (gp_IsEdge(theGraph, e))
     {
@@ -1575,7 +2423,7 @@ int gp_IsNeighborDirected(graphP theGraph, int u, int v, unsigned direction)
        edges, use gp_FindDirectedEdge() instead.
  ********************************************************************/
 
-int gp_FindEdge(graphP theGraph, int u, int v)
+graphInt gp_FindEdge(graphP theGraph, graphInt u, graphInt v)
 {
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || u >= gp_UpperBoundVertexStorage(theGraph) ||
@@ -1588,6 +2436,9 @@ int gp_FindEdge(graphP theGraph, int u, int v)
         return NIL;
     }
 
+    // Build the adjacency index, if enabled, so _gp_FindEdge() can use it
+    _gp_GetAdjacencyIndex(theGraph);
+
     return _gp_FindEdge(theGraph, u, v);
 }
 
@@ -1599,10 +2450,23 @@ int gp_FindEdge(graphP theGraph, int u, int v)
  * from other private methods of the graph library, to avoid
  * duplication of the effort of the checks performed by invoking
  * public methods.
+ *
+ * The adjacency index is used if it has already been built, but it is
+ * not built on demand here, since private methods are also called by
+ * algorithms like gp_Embed() that change the graph without keeping the
+ * index up to date.
  */
-int _gp_FindEdge(graphP theGraph, int u, int v)
+graphInt _gp_FindEdge(graphP theGraph, graphInt u, graphInt v)
 {
-    int e = gp_GetFirstEdge(theGraph, u);
+    graphInt e, slot;
+
+    if (theGraphAdjacencyIndex(theGraph) != NULL)
+    {
+        slot = ai_FindFirst(theGraphAdjacencyIndex(theGraph), u, v);
+        return slot != AI_NIL_SLOT ? ai_GetValue(theGraphAdjacencyIndex(theGraph), slot) : NIL;
+    }
+
+    e = gp_GetFirstEdge(theGraph, u);
     while (gp_IsEdge(theGraph, e))
     {
         if (gp_GetNeighbor(theGraph, e) == v)
@@ -1625,9 +2489,10 @@ int _gp_FindEdge(graphP theGraph, int u, int v)
  NOTE: The valid direction flag value are 0 for any direction,
        EDGEFLAG_DIRECTION_INONLY, or EDGEFLAG_DIRECTION_OUTONLY.
  ********************************************************************/
-int gp_FindDirectedEdge(graphP theGraph, int u, int v, unsigned direction)
+graphInt gp_FindDirectedEdge(graphP theGraph, graphInt u, graphInt v, unsigned direction)
 {
-    int e = NIL;
+    adjIndexP theIndex = NULL;
+    graphInt e = NIL, slot;
 
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || u >= gp_UpperBoundVertexStorage(theGraph) ||
@@ -1641,11 +2506,23 @@ int gp_FindDirectedEdge(graphP theGraph, int u, int v, unsigned direction)
         return NIL;
     }
 
+    theIndex = _gp_GetAdjacencyIndex(theGraph);
+
     // If undirected, call the undirected version
     if (direction == 0)
         return _gp_FindEdge(theGraph, u, v);
 
     // If a direction was given, then use it
+    if (theIndex != NULL)
+    {
+        for (slot = ai_FindFirst(theIndex, u, v); slot != AI_NIL_SLOT; slot = ai_FindNext(theIndex, u, v, slot))
+        {
+            if (gp_GetDirection(theGraph, ai_GetValue(theIndex, slot)) == direction)
+                return ai_GetValue(theIndex, slot);
+        }
+        return NIL;
+    }
+
     e = gp_GetFirstEdge(theGraph, u);
     while (gp_IsEdge(theGraph, e))
     {
@@ -1674,9 +2551,9 @@ NOTE: This function determines the degree by counting. An extension
     cached value as edges are added and deleted.
 ********************************************************************/
 
-int gp_GetVertexDegree(graphP theGraph, int v)
+graphInt gp_GetVertexDegree(graphP theGraph, graphInt v)
 {
-    int e, degree;
+    graphInt e, degree;
 
     if (theGraph == NULL ||
         v < gp_LowerBoundVertexStorage(theGraph) || v >= gp_UpperBoundVertexStorage(theGraph))
@@ -1714,9 +2591,9 @@ int gp_GetVertexDegree(graphP theGraph, int v)
        cached value as edges are added and deleted.
  ********************************************************************/
 
-int gp_GetVertexInDegree(graphP theGraph, int v)
+graphInt gp_GetVertexInDegree(graphP theGraph, graphInt v)
 {
-    int e, degree;
+    graphInt e, degree;
 
     if (theGraph == NULL ||
         v < gp_LowerBoundVertexStorage(theGraph) || v >= gp_UpperBoundVertexStorage(theGraph))
@@ -1754,9 +2631,9 @@ int gp_GetVertexInDegree(graphP theGraph, int v)
        cached value as edges are added and deleted.
  ********************************************************************/
 
-int gp_GetVertexOutDegree(graphP theGraph, int v)
+graphInt gp_GetVertexOutDegree(graphP theGraph, graphInt v)
 {
-    int e, degree;
+    graphInt e, degree;
 
     if (theGraph == NULL ||
         v < gp_LowerBoundVertexStorage(theGraph) || v >= gp_UpperBoundVertexStorage(theGraph))
@@ -1800,11 +2677,11 @@ int gp_GetVertexOutDegree(graphP theGraph, int v)
  See also _RestoreEdgeRecord()
  ********************************************************************/
 
-void _AttachEdgeRecord(graphP theGraph, int v, int e, int link, int newEdge)
+void _AttachEdgeRecord(graphP theGraph, graphInt v, graphInt e, int link, graphInt newEdge)
 {
     if (gp_IsEdge(theGraph, e))
     {
-        int e2 = gp_GetAdjacentEdge(theGraph, e, link);
+        graphInt e2 = gp_GetAdjacentEdge(theGraph, e, link);
 
         // e's link is newEdge, and newEdge's 1^link is e
         gp_SetAdjacentEdge(theGraph, e, link, newEdge);
@@ -1822,7 +2699,7 @@ void _AttachEdgeRecord(graphP theGraph, int v, int e, int link, int newEdge)
     }
     else
     {
-        int e2 = gp_GetEdgeByLink(theGraph, v, link);
+        graphInt e2 = gp_GetEdgeByLink(theGraph, v, link);
 
         // v's link is newEdge, and newEdge's 1^link is NIL
         gp_SetEdgeByLink(theGraph, v, link, newEdge);
@@ -1861,9 +2738,9 @@ void _AttachEdgeRecord(graphP theGraph, int v, int e, int link, int newEdge)
  gp_RestoreVertices(), which unwinds the stack with gp_RestoreVertex().
  ****************************************************************************/
 
-void _DetachEdgeRecord(graphP theGraph, int e)
+void _DetachEdgeRecord(graphP theGraph, graphInt e)
 {
-    int nextEdge = gp_GetNextEdge(theGraph, e),
+    graphInt nextEdge = gp_GetNextEdge(theGraph, e),
         prevEdge = gp_GetPrevEdge(theGraph, e);
 
     if (gp_IsEdge(theGraph, nextEdge))
@@ -1912,9 +2789,9 @@ void _DetachEdgeRecord(graphP theGraph, int e)
          caller can use gp_DynamicAddEdge()).
  ********************************************************************/
 
-int gp_AddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
+int gp_AddEdge(graphP theGraph, graphInt u, int ulink, graphInt v, int vlink)
 {
-    int upos, vpos;
+    graphInt upos, vpos;
 
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || v < gp_LowerBoundVertexStorage(theGraph) ||
@@ -1945,8 +2822,10 @@ int gp_AddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
     _AttachEdgeRecord(theGraph, u, NIL, ulink, upos);
     gp_SetNeighbor(theGraph, vpos, u);
     _AttachEdgeRecord(theGraph, v, NIL, vlink, vpos);
+    _gp_AdjacencyIndexAddEdge(theGraph, vpos);
 
     theGraph->M++;
+    _gp_UpdateEdgeHighWaterMark(theGraph);
     return OK;
 }
 
@@ -1959,7 +2838,7 @@ int gp_AddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
 
  Returns OK on success, NOTOK on failure.
  ********************************************************************/
-int gp_DynamicAddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
+int gp_DynamicAddEdge(graphP theGraph, graphInt u, int ulink, graphInt v, int vlink)
 {
     int Result = OK;
 
@@ -1968,15 +2847,15 @@ int gp_DynamicAddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
     if (Result == AT_EDGE_CAPACITY_LIMIT)
     {
         // The candidate edge capacity is double the current capacity
-        int candidateEdgeCapacity = gp_GetEdgeCapacity(theGraph) << 1;
-        int N = gp_GetN(theGraph);
-        int newEdgeCapacity = candidateEdgeCapacity;
+        graphInt candidateEdgeCapacity = gp_GetEdgeCapacity(theGraph) << 1;
+        graphInt N = gp_GetN(theGraph);
+        graphInt newEdgeCapacity = candidateEdgeCapacity;
 
         // If the candidate edge capacity exceeds the number of edges
         // needed in an undirected clique on N vertices, then attempt
         // to use that as the new edge capacity.
-        if (candidateEdgeCapacity > ((N * (N - 1)) >> 1))
-            newEdgeCapacity = ((N * (N - 1)) >> 1);
+        if (candidateEdgeCapacity > _GetCliqueEdgeCount(N))
+            newEdgeCapacity = _GetCliqueEdgeCount(N);
 
         // However, if the edge capacity is already greater than or
         // equal to that maximum capacity needed for an undirected
@@ -1996,6 +2875,362 @@ int gp_DynamicAddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
     return Result != OK ? NOTOK : Result;
 }
 
+/********************************************************************
+ gp_AddEdgesBulk()
+
+ Adds m undirected edges to the graph, where edge i joins the vertices
+ pairs[2*i] and pairs[2*i+1]. The result is the same as that of calling
+ gp_AddEdge(theGraph, pairs[2*i], 0, pairs[2*i+1], 0) for each edge in
+ order, so each new edge record becomes the first in the adjacency list
+ of its vertex.
+
+ The edge capacity is increased, if needed, once for all of the edges,
+ and all of the vertices are validated before the graph is changed.
+ Then the new edges fill any edge holes, as gp_AddEdge() would, and the
+ rest fill consecutive unused edge records. The adjacency lists are
+ stitched in one pass over the new edge records, without the per-edge
+ parameter and capacity checks of gp_AddEdge().
+
+ As with gp_AddEdge(), duplicate and loop edges are not rejected.
+
+ Returns OK on success, NOTOK on failure, in which case no edges have
+         been added, though the edge capacity may have been increased.
+ ********************************************************************/
+
+// Adds the edge (u, v) in the edge records vpos and its twin, and makes
+// them the first edge records in the adjacency lists of u and v
+#define _gp_AddFirstEdge(theGraph, u, v, vpos)                         \
+    {                                                                  \
+        gp_SetNeighbor(theGraph, gp_GetTwin(theGraph, vpos), v);       \
+        gp_AttachFirstEdge(theGraph, u, gp_GetTwin(theGraph, vpos));   \
+        gp_SetNeighbor(theGraph, vpos, u);                             \
+        gp_AttachFirstEdge(theGraph, v, vpos);                         \
+    }
+
+int gp_AddEdgesBulk(graphP theGraph, const graphInt *pairs, graphInt m)
+{
+    graphInt i, e, u, v;
+
+    if (theGraph == NULL || m < 0 || (pairs == NULL && m > 0) ||
+        m > GRAPHINT_MAX - gp_GetM(theGraph))
+        return NOTOK;
+
+    if (m == 0)
+        return OK;
+
+    if (gp_GetM(theGraph) + m > gp_GetEdgeCapacity(theGraph) &&
+        gp_EnsureEdgeCapacity(theGraph, gp_GetM(theGraph) + m) != OK)
+        return NOTOK;
+
+    for (i = 0; i < 2 * m; i++)
+    {
+        if (pairs[i] < gp_LowerBoundVertexStorage(theGraph) ||
+            pairs[i] >= gp_UpperBoundVertexStorage(theGraph))
+            return NOTOK;
+    }
+
+    // Once the edge holes are filled, the edges are added at the upper
+    // bound of the edges, which does not change while holes are filled
+    e = gp_UpperBoundEdges(theGraph);
+
+    for (i = 0; i < m && sp_NonEmpty(theGraph->edgeHoles); i++)
+    {
+        graphInt hole;
+
+        sp_Pop(theGraph->edgeHoles, hole);
+        u = pairs[i << 1];
+        v = pairs[(i << 1) + 1];
+        _gp_AddFirstEdge(theGraph, u, v, hole);
+    }
+    theGraph->numEdgeHoles = sp_GetCurrentSize(theGraph->edgeHoles);
+
+    for (; i < m; i++, e += 2)
+    {
+        u = pairs[i << 1];
+        v = pairs[(i << 1) + 1];
+        _gp_AddFirstEdge(theGraph, u, v, e);
+    }
+
+    theGraph->M += m;
+    _gp_UpdateEdgeHighWaterMark(theGraph);
+
+    // The adjacency index is rebuilt on demand rather than updated per edge
+    _gp_InvalidateAdjacencyIndex(theGraph);
+
+    return OK;
+}
+
+/********************************************************************
+ gp_ExportCSR()
+
+ Writes the adjacency lists of the vertices of theGraph in compressed
+ sparse row (CSR) form, in one pass over the lists. The vertices are
+ numbered 0 to N-1, in the order of the vertex records, and the i-th
+ vertex has the neighbors (*pNeighbors)[(*pOffsets)[i]] through
+ (*pNeighbors)[(*pOffsets)[i+1] - 1], so (*pOffsets)[N] is 2M.
+
+ Each neighbors range is in the order of the adjacency list, from the
+ first edge to the last. After gp_Embed() produces an embedding, this
+ is the rotation system of the embedding, since the vertices inverted
+ during embedding, as indicated by the EDGEFLAG_INVERTED flags, are
+ reoriented by _OrientVerticesInEmbedding() before gp_Embed() returns.
+ Each edge appears in the ranges of both of its endpoints, and edge
+ directions are not exported.
+
+ If *pOffsets is NULL, then an array of N+1 offsets is allocated with
+ malloc(), and if *pNeighbors is NULL, then an array of 2M neighbors is
+ allocated with malloc(). The caller must free() them. Otherwise, the
+ caller's arrays must have room for N+1 offsets and 2M neighbors.
+
+ Returns OK on success, NOTOK on failure, including when an adjacency
+ list contains a virtual vertex, as it does before the bicomps of an
+ embedding are joined. On failure, arrays allocated by this function
+ are freed and the caller's pointers are restored.
+ ********************************************************************/
+
+int gp_ExportCSR(graphP theGraph, graphInt **pOffsets, graphInt **pNeighbors)
+{
+    graphInt *offsets = NULL, *neighbors = NULL;
+    graphInt v, e, w, numNeighbors = 0;
+    int Result = OK;
+
+    if (theGraph == NULL || pOffsets == NULL || pNeighbors == NULL)
+        return NOTOK;
+
+    offsets = *pOffsets != NULL ? *pOffsets : (graphInt *)malloc((gp_GetN(theGraph) + 1) * sizeof(graphInt));
+    neighbors = *pNeighbors != NULL ? *pNeighbors : (graphInt *)malloc((2 * gp_GetM(theGraph) + 1) * sizeof(graphInt));
+
+    if (offsets == NULL || neighbors == NULL)
+        Result = NOTOK;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph) && Result == OK; ++v)
+    {
+        offsets[v - gp_LowerBoundVertices(theGraph)] = numNeighbors;
+
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            w = gp_GetNeighbor(theGraph, e);
+            if (w < gp_LowerBoundVertices(theGraph) || w >= gp_UpperBoundVertices(theGraph) ||
+                numNeighbors >= 2 * gp_GetM(theGraph))
+            {
+                Result = NOTOK;
+                break;
+            }
+
+            neighbors[numNeighbors++] = w - gp_LowerBoundVertices(theGraph);
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    if (Result == OK)
+        offsets[gp_GetN(theGraph)] = numNeighbors;
+
+    if (Result != OK)
+    {
+        if (offsets != *pOffsets)
+            free(offsets);
+        if (neighbors != *pNeighbors)
+            free(neighbors);
+        return NOTOK;
+    }
+
+    *pOffsets = offsets;
+    *pNeighbors = neighbors;
+    return OK;
+}
+
+/********************************************************************
+ gp_ImportCSR()
+
+ Builds theGraph from the compressed sparse row (CSR) form produced by
+ gp_ExportCSR(), so that the i-th vertex, for i from 0 to N-1, has the
+ neighbors neighbors[offsets[i]] through neighbors[offsets[i+1] - 1],
+ in that order, in its adjacency list. Each edge must appear in the
+ ranges of both of its endpoints; if vertices u and v are joined by
+ k edges, the j-th v in the range of u and the j-th u in the range of
+ v are the two edge records of the same edge. Loops are not accepted.
+
+ theGraph must either be new (as from gp_New()), in which case its
+ vertex capacity is set to N, or have N vertices and no edges (as after
+ gp_ResetGraphStorage()). The edge capacity is increased if needed.
+
+ The edge records are assigned and their adjacency lists stitched
+ directly, without the per-edge checks of gp_AddEdge(), and the two
+ ranges that contain each edge are paired in linear time. The index
+ of each vertex is set to the vertex, as when a graph is read.
+
+ Returns OK on success, NOTOK if the CSR form is invalid or on any
+ other failure, in which case theGraph has no edges.
+ ********************************************************************/
+
+int gp_ImportCSR(graphP theGraph, graphInt N, const graphInt *offsets, const graphInt *neighbors)
+{
+    graphInt *edgeOf = NULL, *nextPending = NULL, *pending = NULL;
+    graphInt i, numNeighbors;
+    int Result = OK;
+
+    if (theGraph == NULL || N <= 0 || offsets == NULL || offsets[0] != 0)
+        return NOTOK;
+
+    for (i = 0; i < N; i++)
+    {
+        if (offsets[i + 1] < offsets[i])
+            return NOTOK;
+    }
+
+    numNeighbors = offsets[N];
+    if ((numNeighbors & 1) || (neighbors == NULL && numNeighbors > 0))
+        return NOTOK;
+
+    if (gp_GetN(theGraph) == 0)
+    {
+        if (gp_EnsureVertexCapacity(theGraph, N) != OK)
+            return NOTOK;
+    }
+    else if (gp_GetN(theGraph) != N || gp_GetM(theGraph) != 0 || theGraph->numEdgeHoles != 0)
+        return NOTOK;
+
+    if (numNeighbors / 2 > gp_GetEdgeCapacity(theGraph) &&
+        gp_EnsureEdgeCapacity(theGraph, numNeighbors / 2) != OK)
+        return NOTOK;
+
+    // The edge record of each neighbor, the pending edges of each vertex,
+    // and a cursor into the pending edges of each vertex (see _ImportCSR())
+    edgeOf = (graphInt *)malloc((numNeighbors + 1) * sizeof(graphInt));
+    nextPending = (graphInt *)malloc((numNeighbors + 1) * sizeof(graphInt));
+    pending = (graphInt *)malloc(3 * N * sizeof(graphInt));
+
+    if (edgeOf == NULL || nextPending == NULL || pending == NULL ||
+        _ImportCSR(theGraph, N, offsets, neighbors, edgeOf, nextPending, pending) != OK)
+    {
+        // Any edge records assigned are returned to their initial state
+        _InitEdges(theGraph, gp_LowerBoundEdges(theGraph) + numNeighbors);
+        Result = NOTOK;
+    }
+
+    free(edgeOf);
+    free(nextPending);
+    free(pending);
+
+    if (Result == OK)
+    {
+        theGraph->M = numNeighbors / 2;
+        _gp_UpdateEdgeHighWaterMark(theGraph);
+        _gp_InvalidateAdjacencyIndex(theGraph);
+
+        for (i = gp_LowerBoundVertices(theGraph); i < gp_UpperBoundVertices(theGraph); ++i)
+            gp_SetIndex(theGraph, i, i);
+    }
+
+    return Result;
+}
+
+/********************************************************************
+ _ImportCSR()
+
+ The vertices are processed in ascending order. When vertex u reaches
+ a neighbor v > u, a new edge is assigned, and the neighbor is appended
+ to the pending edges of v, which are therefore in ascending order of
+ u. When vertex v is processed, its own neighbors u < v take the next
+ pending edge of u, found with a cursor into the run of pending edges
+ of v that come from u. Any mismatch, or any pending edge left over,
+ means that an edge is missing from the range of one of its endpoints.
+
+ Lastly, the adjacency list of each vertex is stitched in the order of
+ its range.
+
+ The pending array holds the head and tail of the pending edges of each
+ vertex and the cursor of each vertex into the run of pending edges of
+ the vertex being processed. Returns OK on success, NOTOK on invalid input.
+ ********************************************************************/
+
+int _ImportCSR(graphP theGraph, graphInt N, const graphInt *offsets, const graphInt *neighbors,
+               graphInt *edgeOf, graphInt *nextPending, graphInt *pending)
+{
+    graphInt *pendingHead = pending, *pendingTail = pending + N, *cursor = pending + 2 * N;
+    graphInt v, u, j, k, e, numPending, numMatched;
+    graphInt nextEdge = gp_LowerBoundEdges(theGraph);
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph);
+
+    for (v = 0; v < 3 * N; v++)
+        pending[v] = -1;
+
+    for (v = 0; v < N; v++)
+    {
+        // Position a cursor at the start of each run of pending edges of v
+        numPending = numMatched = 0;
+        for (j = pendingHead[v]; j != -1; j = nextPending[j], numPending++)
+        {
+            u = gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, edgeOf[j])) - lowerBound;
+            if (cursor[u] == -1)
+                cursor[u] = j;
+        }
+
+        for (k = offsets[v]; k < offsets[v + 1]; k++)
+        {
+            u = neighbors[k];
+            if (u < 0 || u >= N || u == v)
+                return NOTOK;
+
+            if (u > v)
+            {
+                // More edges than half of the neighbors cannot all be paired
+                if (nextEdge - gp_LowerBoundEdges(theGraph) >= offsets[N])
+                    return NOTOK;
+
+                e = nextEdge;
+                nextEdge += 2;
+                edgeOf[k] = e;
+                gp_SetNeighbor(theGraph, e, u + lowerBound);
+                gp_SetNeighbor(theGraph, gp_GetTwin(theGraph, e), v + lowerBound);
+
+                nextPending[k] = -1;
+                if (pendingTail[u] == -1)
+                    pendingHead[u] = k;
+                else
+                    nextPending[pendingTail[u]] = k;
+                pendingTail[u] = k;
+            }
+            else
+            {
+                j = cursor[u];
+                if (j == -1 || gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, edgeOf[j])) - lowerBound != u)
+                    return NOTOK;
+
+                edgeOf[k] = gp_GetTwin(theGraph, edgeOf[j]);
+                cursor[u] = nextPending[j];
+                numMatched++;
+            }
+        }
+
+        if (numMatched != numPending)
+            return NOTOK;
+
+        for (j = pendingHead[v]; j != -1; j = nextPending[j])
+            cursor[gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, edgeOf[j])) - lowerBound] = -1;
+    }
+
+    for (v = 0; v < N; v++)
+    {
+        if (offsets[v] == offsets[v + 1])
+            continue;
+
+        gp_SetFirstEdge(theGraph, v + lowerBound, edgeOf[offsets[v]]);
+        gp_SetLastEdge(theGraph, v + lowerBound, edgeOf[offsets[v + 1] - 1]);
+        gp_SetPrevEdge(theGraph, edgeOf[offsets[v]], NIL);
+        gp_SetNextEdge(theGraph, edgeOf[offsets[v + 1] - 1], NIL);
+
+        for (k = offsets[v] + 1; k < offsets[v + 1]; k++)
+        {
+            gp_SetNextEdge(theGraph, edgeOf[k - 1], edgeOf[k]);
+            gp_SetPrevEdge(theGraph, edgeOf[k], edgeOf[k - 1]);
+        }
+    }
+
+    return OK;
+}
+
 /********************************************************************
  gp_DynamicInsertEdge()
  Refer to documentation for gp_InsertEdge() for parameter description.
@@ -2005,8 +3240,8 @@ int gp_DynamicAddEdge(graphP theGraph, int u, int ulink, int v, int vlink)
 
  Returns OK on success, NOTOK on failure.
  ********************************************************************/
-int gp_DynamicInsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
-                         int v, int e_v, int e_vlink)
+int gp_DynamicInsertEdge(graphP theGraph, graphInt u, graphInt e_u, int e_ulink,
+                         graphInt v, graphInt e_v, int e_vlink)
 {
     int Result = OK;
 
@@ -2015,15 +3250,15 @@ int gp_DynamicInsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
     if (Result == AT_EDGE_CAPACITY_LIMIT)
     {
         // The candidate edge capacity is double the current capacity
-        int candidateEdgeCapacity = gp_GetEdgeCapacity(theGraph) << 1;
-        int N = gp_GetN(theGraph);
-        int newEdgeCapacity = candidateEdgeCapacity;
+        graphInt candidateEdgeCapacity = gp_GetEdgeCapacity(theGraph) << 1;
+        graphInt N = gp_GetN(theGraph);
+        graphInt newEdgeCapacity = candidateEdgeCapacity;
 
         // If the candidate edge capacity exceeds the number of edges
         // needed in an undirected clique on N vertices, then attempt
         // to use that as the new edge capacity.
-        if (candidateEdgeCapacity > ((N * (N - 1)) >> 1))
-            newEdgeCapacity = ((N * (N - 1)) >> 1);
+        if (candidateEdgeCapacity > _GetCliqueEdgeCount(N))
+            newEdgeCapacity = _GetCliqueEdgeCount(N);
 
         // However, if the edge capacity is already greater than or
         // equal to that maximum capacity needed for an undirected
@@ -2065,10 +3300,10 @@ int gp_DynamicInsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
          an AT_EDGE_CAPACITY_LIMIT result).
  ********************************************************************/
 
-int gp_InsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
-                  int v, int e_v, int e_vlink)
+int gp_InsertEdge(graphP theGraph, graphInt u, graphInt e_u, int e_ulink,
+                  graphInt v, graphInt e_v, int e_vlink)
 {
-    int upos, vpos;
+    graphInt upos, vpos;
 
     if (theGraph == NULL)
         return NOTOK;
@@ -2111,8 +3346,10 @@ int gp_InsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
 
     gp_SetNeighbor(theGraph, vpos, u);
     _AttachEdgeRecord(theGraph, v, e_v, e_vlink, vpos);
+    _gp_AdjacencyIndexAddEdge(theGraph, vpos);
 
     theGraph->M++;
+    _gp_UpdateEdgeHighWaterMark(theGraph);
 
     return OK;
 }
@@ -2130,7 +3367,7 @@ int gp_InsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
  Returns OK on success, NOTOK on failure
  ****************************************************************************/
 
-int gp_DeleteEdge(graphP theGraph, int e)
+int gp_DeleteEdge(graphP theGraph, graphInt e)
 {
     if (theGraph == NULL ||
         e < gp_LowerBoundEdges(theGraph) ||
@@ -2141,15 +3378,16 @@ int gp_DeleteEdge(graphP theGraph, int e)
     return theGraph->functions->fpDeleteEdge(theGraph, e);
 }
 
-int _DeleteEdge(graphP theGraph, int e)
+int _DeleteEdge(graphP theGraph, graphInt e)
 {
     // Delete the edge records e and eTwin from their adjacency lists.
+    _gp_AdjacencyIndexDeleteEdge(theGraph, e);
     _DetachEdgeRecord(theGraph, e);
     _DetachEdgeRecord(theGraph, gp_GetTwin(theGraph, e));
 
     // Clear the two edge records
     // (the bit twiddle (e & ~1) chooses the lesser of e and its twin)
-#ifdef USE_1BASEDARRAYS
+#if defined(USE_1BASEDARRAYS) && !defined(USE_EDGE_SOA)
     memset(theGraph->E + (e & ~1), NIL_CHAR, sizeof(edgeRec) << 1);
 #else
     _InitEdgeRec(theGraph, e);
@@ -2174,12 +3412,136 @@ int _DeleteEdge(graphP theGraph, int e)
     return OK;
 }
 
+/****************************************************************************
+ gp_CompactEdgeStorage()
+
+ Removes the edge holes left by gp_DeleteEdge() by moving the edges in use
+ at the top of the edge storage down into the holes, so that all of the
+ edge records below gp_UpperBoundEdges() are in use again. Loops over the
+ edge records then no longer need to skip edge records that are not in
+ use, and the edge records vacated at the top are in their initial state.
+
+ Each edge is moved by fpMoveEdge(), which the base graph implements by
+ copying the two edge records and redirecting the links to them in their
+ adjacency lists and vertices. Extensions having parallel edge record
+ extension data elements must overload fpMoveEdge() to move that data too.
+
+ NOTE: Edge record indices obtained before this call, other than those
+       of adjacency list links, do not survive it. For this reason, the
+       graph must not have hidden edges, since restoring them depends on
+       saved edge record indices (see gp_HideEdge()), and the adjacency
+       index, if any, is rebuilt on demand.
+
+ Returns OK on success, NOTOK if the graph has hidden edges or on failure.
+ ****************************************************************************/
+
+int gp_CompactEdgeStorage(graphP theGraph)
+{
+    graphInt v, e, eDst, eSrc, numEdgeRecords = 0;
+
+    if (theGraph == NULL)
+        return NOTOK;
+
+    if (theGraph->numEdgeHoles == 0)
+        return OK;
+
+    // Every edge record in use must be in an adjacency list, i.e. not hidden
+    for (v = gp_LowerBoundVertexStorage(theGraph); v < gp_UpperBoundVertexStorage(theGraph); ++v)
+    {
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            numEdgeRecords++;
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    if (numEdgeRecords != 2 * gp_GetM(theGraph))
+        return NOTOK;
+
+    // Move the highest edge in use into the lowest hole until they meet.
+    // The edge records of an edge are a pair whose lesser index is even.
+    eDst = gp_LowerBoundEdges(theGraph);
+    eSrc = gp_UpperBoundEdges(theGraph) - 2;
+    while (1)
+    {
+        while (eDst < eSrc && gp_EdgeInUse(theGraph, eDst))
+            eDst += 2;
+        while (eDst < eSrc && gp_EdgeNotInUse(theGraph, eSrc))
+            eSrc -= 2;
+
+        if (eDst >= eSrc)
+            break;
+
+        if (theGraph->functions->fpMoveEdge(theGraph, eDst, eSrc) != OK)
+            return NOTOK;
+    }
+
+    sp_ClearStack(theGraph->edgeHoles);
+    theGraph->numEdgeHoles = 0;
+
+    _gp_InvalidateAdjacencyIndex(theGraph);
+
+    return OK;
+}
+
+/****************************************************************************
+ _MoveEdge()
+
+ Moves the edge in edge records eSrc and its twin, which must be in use,
+ to the edge records eDst and its twin, which must not be in use. The
+ edge records eSrc and its twin are then reinitialized.
+ ****************************************************************************/
+
+int _MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc)
+{
+    graphInt u = gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, eSrc));
+    graphInt v = gp_GetNeighbor(theGraph, eSrc);
+
+    // If the edge is a loop, then the second move can relink the edge
+    // record moved by the first move, which is why they are sequential
+    _MoveEdgeRecord(theGraph, eDst, eSrc, u);
+    _MoveEdgeRecord(theGraph, gp_GetTwin(theGraph, eDst), gp_GetTwin(theGraph, eSrc), v);
+
+    _InitEdgeRec(theGraph, eSrc);
+    _InitEdgeRec(theGraph, gp_GetTwin(theGraph, eSrc));
+
+    return OK;
+}
+
+/****************************************************************************
+ _MoveEdgeRecord()
+
+ Copies edge record eSrc, which is in the adjacency list of v, to eDst,
+ then makes its predecessor and successor in the list, or v if there is
+ none, link to eDst instead of eSrc.
+ ****************************************************************************/
+
+void _MoveEdgeRecord(graphP theGraph, graphInt eDst, graphInt eSrc, graphInt v)
+{
+    graphInt e;
+
+    _gp_CopyEdgeRec(theGraph, eDst, eSrc);
+
+    e = gp_GetPrevEdge(theGraph, eDst);
+    if (gp_IsEdge(theGraph, e))
+        gp_SetNextEdge(theGraph, e, eDst);
+    else
+        gp_SetFirstEdge(theGraph, v, eDst);
+
+    e = gp_GetNextEdge(theGraph, eDst);
+    if (gp_IsEdge(theGraph, e))
+        gp_SetPrevEdge(theGraph, e, eDst);
+    else
+        gp_SetLastEdge(theGraph, v, eDst);
+}
+
 int gp_ClearEdgeDirectionFlags(graphP theGraph)
 {
     if (theGraph == NULL)
         return NOTOK;
 
-    for (int e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
+    for (graphInt e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
     {
         if (gp_EdgeInUse(theGraph, e))
         {
@@ -2202,7 +3564,7 @@ int gp_TransposeDirectedGraph(graphP theGraph)
     if (theGraph == NULL)
         return NOTOK;
 
-    for (int e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
+    for (graphInt e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
     {
         if (gp_EdgeInUse(theGraph, e))
         {
@@ -2235,9 +3597,9 @@ int gp_TransposeDirectedGraph(graphP theGraph)
  that the hidden edges will be pushed on a stack from which they will
  be popped during restoration.
  ********************************************************************/
-void _RestoreEdgeRecord(graphP theGraph, int e)
+void _RestoreEdgeRecord(graphP theGraph, graphInt e)
 {
-    int nextEdge = gp_GetNextEdge(theGraph, e),
+    graphInt nextEdge = gp_GetNextEdge(theGraph, e),
         prevEdge = gp_GetPrevEdge(theGraph, e);
 
     if (gp_IsEdge(theGraph, nextEdge))
@@ -2267,7 +3629,7 @@ void _RestoreEdgeRecord(graphP theGraph, int e)
  be reattached by gp_RestoreEdge().
  ********************************************************************/
 
-void gp_HideEdge(graphP theGraph, int e)
+void gp_HideEdge(graphP theGraph, graphInt e)
 {
     if (theGraph == NULL ||
         e < gp_LowerBoundEdges(theGraph) || e >= gp_UpperBoundEdges(theGraph) ||
@@ -2282,8 +3644,9 @@ void gp_HideEdge(graphP theGraph, int e)
     theGraph->functions->fpHideEdge(theGraph, e);
 }
 
-void _HideEdge(graphP theGraph, int e)
+void _HideEdge(graphP theGraph, graphInt e)
 {
+    _gp_AdjacencyIndexDeleteEdge(theGraph, e);
     _DetachEdgeRecord(theGraph, e);
     _DetachEdgeRecord(theGraph, gp_GetTwin(theGraph, e));
 }
@@ -2305,7 +3668,7 @@ void _HideEdge(graphP theGraph, int e)
        from the order in which they were hidden by gp_HideEdge().
  ********************************************************************/
 
-void gp_RestoreEdge(graphP theGraph, int e)
+void gp_RestoreEdge(graphP theGraph, graphInt e)
 {
     if (theGraph == NULL ||
         e < gp_LowerBoundEdges(theGraph) || e >= gp_UpperBoundEdges(theGraph) ||
@@ -2320,10 +3683,11 @@ void gp_RestoreEdge(graphP theGraph, int e)
     theGraph->functions->fpRestoreEdge(theGraph, e);
 }
 
-void _RestoreEdge(graphP theGraph, int e)
+void _RestoreEdge(graphP theGraph, graphInt e)
 {
     _RestoreEdgeRecord(theGraph, gp_GetTwin(theGraph, e));
     _RestoreEdgeRecord(theGraph, e);
+    _gp_AdjacencyIndexAddEdge(theGraph, e);
 }
 
 /********************************************************************
@@ -2341,9 +3705,9 @@ void _RestoreEdge(graphP theGraph, int e)
  needed to _RestoreInternalEdges().
  ********************************************************************/
 
-int _HideInternalEdges(graphP theGraph, int vertex)
+int _HideInternalEdges(graphP theGraph, graphInt vertex)
 {
-    int e = gp_GetFirstEdge(theGraph, vertex);
+    graphInt e = gp_GetFirstEdge(theGraph, vertex);
 
     // If the vertex adjacency list is empty or if it contains
     // only one edge, then there are no *internal* edges to hide
@@ -2371,7 +3735,7 @@ int _HideInternalEdges(graphP theGraph, int vertex)
  Reverses the effects of _HideInternalEdges()
  ********************************************************************/
 
-int _RestoreInternalEdges(graphP theGraph, int stackBottom)
+int _RestoreInternalEdges(graphP theGraph, graphInt stackBottom)
 {
     return _RestoreHiddenEdges(theGraph, stackBottom);
 }
@@ -2387,9 +3751,9 @@ int _RestoreInternalEdges(graphP theGraph, int stackBottom)
  Returns OK on success, NOTOK on internal failure.
  ********************************************************************/
 
-int _RestoreHiddenEdges(graphP theGraph, int stackBottom)
+int _RestoreHiddenEdges(graphP theGraph, graphInt stackBottom)
 {
-    int e;
+    graphInt e;
 
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
     {
@@ -2413,7 +3777,7 @@ int _RestoreHiddenEdges(graphP theGraph, int stackBottom)
  Returns OK for success, NOTOK for internal failure.
  ********************************************************************/
 
-int gp_HideVertex(graphP theGraph, int vertex)
+int gp_HideVertex(graphP theGraph, graphInt vertex)
 {
     if (theGraph == NULL ||
         vertex < gp_LowerBoundVertexStorage(theGraph) || vertex >= gp_UpperBoundVertexStorage(theGraph))
@@ -2424,10 +3788,10 @@ int gp_HideVertex(graphP theGraph, int vertex)
     return theGraph->functions->fpHideVertex(theGraph, vertex);
 }
 
-int _HideVertex(graphP theGraph, int vertex)
+int _HideVertex(graphP theGraph, graphInt vertex)
 {
-    int hiddenEdgeStackBottom = sp_GetCurrentSize(theGraph->theStack);
-    int e = gp_GetFirstEdge(theGraph, vertex);
+    graphInt hiddenEdgeStackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt e = gp_GetFirstEdge(theGraph, vertex);
 
     // Cycle through all the edges, pushing and hiding each
     while (gp_IsEdge(theGraph, e))
@@ -2471,7 +3835,7 @@ int _HideVertex(graphP theGraph, int vertex)
  Returns OK for success, NOTOK for internal failure.
  ********************************************************************/
 
-int gp_ContractEdge(graphP theGraph, int e)
+int gp_ContractEdge(graphP theGraph, graphInt e)
 {
     if (theGraph == NULL ||
         e < gp_LowerBoundEdges(theGraph) || e >= gp_UpperBoundEdges(theGraph) ||
@@ -2483,9 +3847,9 @@ int gp_ContractEdge(graphP theGraph, int e)
     return theGraph->functions->fpContractEdge(theGraph, e);
 }
 
-int _ContractEdge(graphP theGraph, int e)
+int _ContractEdge(graphP theGraph, graphInt e)
 {
-    int eBefore, u, v;
+    graphInt eBefore, u, v;
 
     if (gp_IsNotEdge(theGraph, e))
         return NOTOK;
@@ -2542,7 +3906,7 @@ int _ContractEdge(graphP theGraph, int e)
  Returns OK on success, NOTOK on internal failure
  ********************************************************************/
 
-int gp_IdentifyVertices(graphP theGraph, int u, int v, int eBefore)
+int gp_IdentifyVertices(graphP theGraph, graphInt u, graphInt v, graphInt eBefore)
 {
     if (theGraph == NULL ||
         u < gp_LowerBoundVertexStorage(theGraph) || u >= gp_UpperBoundVertexStorage(theGraph) ||
@@ -2557,18 +3921,18 @@ int gp_IdentifyVertices(graphP theGraph, int u, int v, int eBefore)
     return theGraph->functions->fpIdentifyVertices(theGraph, u, v, eBefore);
 }
 
-int _IdentifyVertices(graphP theGraph, int u, int v, int eBefore)
+int _IdentifyVertices(graphP theGraph, graphInt u, graphInt v, graphInt eBefore)
 {
-    int e = _gp_FindEdge(theGraph, u, v);
-    int hiddenEdgeStackBottom, eBeforePred;
+    graphInt e = _gp_FindEdge(theGraph, u, v);
+    graphInt hiddenEdgeStackBottom, eBeforePred;
 
     // If the vertices are adjacent, then the identification is
     // essentially an edge contraction with a bit of fixup.
     if (gp_IsEdge(theGraph, e))
     {
         int result = gp_ContractEdge(theGraph, e);
-        int hiddenEdgesStackBottomIndex;
-        int hiddenEdgesStackBottomValue;
+        graphInt hiddenEdgesStackBottomIndex;
+        graphInt hiddenEdgesStackBottomValue;
 
         if (result != OK)
             return result;
@@ -2672,7 +4036,9 @@ int _IdentifyVertices(graphP theGraph, int u, int v, int eBefore)
     e = gp_GetFirstEdge(theGraph, v);
     while (gp_IsEdge(theGraph, e))
     {
+        _gp_AdjacencyIndexDeleteEdge(theGraph, e);
         gp_SetNeighbor(theGraph, gp_GetTwin(theGraph, e), u);
+        _gp_AdjacencyIndexAddEdge(theGraph, e);
         e = gp_GetNextEdge(theGraph, e);
     }
 
@@ -2765,7 +4131,7 @@ int gp_RestoreVertex(graphP theGraph)
 
 int _RestoreVertex(graphP theGraph)
 {
-    int u, v, e_u_succ, e_u_pred, e_v_first, e_v_last, HESB, e;
+    graphInt u, v, e_u_succ, e_u_pred, e_v_first, e_v_last, HESB, e;
 
     if (sp_GetCurrentSize(theGraph->theStack) < 7)
     {
@@ -2822,7 +4188,9 @@ int _RestoreVertex(graphP theGraph)
         e = e_v_first;
         while (gp_IsEdge(theGraph, e))
         {
+            _gp_AdjacencyIndexDeleteEdge(theGraph, e);
             gp_SetNeighbor(theGraph, gp_GetTwin(theGraph, e), v);
+            _gp_AdjacencyIndexAddEdge(theGraph, e);
             e = (e == e_v_last ? NIL : gp_GetNextEdge(theGraph, e));
         }
     }
@@ -2882,7 +4250,7 @@ int gp_RestoreVertices(graphP theGraph)
  Symmetric conditions define the types for a > b.
  ****************************************************************************/
 
-int _ComputeEdgeRecordType(graphP theGraph, int a, int b, int edgeType)
+int _ComputeEdgeRecordType(graphP theGraph, graphInt a, graphInt b, int edgeType)
 {
     a = gp_IsVirtualVertex(theGraph, a) ? _gp_GetVertexFromBicompRoot(theGraph, a) : a;
     b = gp_IsVirtualVertex(theGraph, b) ? _gp_GetVertexFromBicompRoot(theGraph, b) : b;
@@ -2903,9 +4271,9 @@ int _ComputeEdgeRecordType(graphP theGraph, int a, int b, int edgeType)
  constant time if u is known to have a degree bound by a constant.
  ****************************************************************************/
 
-int _RestoreEdgeType(graphP theGraph, int u, int v)
+int _RestoreEdgeType(graphP theGraph, graphInt u, graphInt v)
 {
-    int e, eTwin, u_orig, v_orig;
+    graphInt e, eTwin, u_orig, v_orig;
 
     // If u or v is a virtual vertex (a root copy), then get the non-virtual counterpart.
     u_orig = gp_IsVirtualVertex(theGraph, u) ? (_gp_GetVertexFromBicompRoot(theGraph, u)) : u;
@@ -2967,8 +4335,8 @@ int _RestoreEdgeType(graphP theGraph, int u, int v)
 
 int _DeleteUnmarkedEdgesInBicomp(graphP theGraph, int BicompRoot)
 {
-    int V, e, eNext;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt V, e, eNext;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
@@ -3003,10 +4371,10 @@ int _DeleteUnmarkedEdgesInBicomp(graphP theGraph, int BicompRoot)
  Returns OK on success, NOTOK on implementation failure
  ********************************************************************/
 
-int _ClearInvertedFlagsInBicomp(graphP theGraph, int BicompRoot)
+int _ClearInvertedFlagsInBicomp(graphP theGraph, graphInt BicompRoot)
 {
-    int V, e;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt V, e;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
@@ -3042,9 +4410,9 @@ int _ClearInvertedFlagsInBicomp(graphP theGraph, int BicompRoot)
 
 int _GetBicompSize(graphP theGraph, int BicompRoot)
 {
-    int V, e;
+    graphInt V, e;
     int theSize = 0;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push(theGraph->theStack, BicompRoot);
     while (sp_GetCurrentSize(theGraph->theStack) > stackBottom)
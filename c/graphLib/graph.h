@@ -26,9 +26,14 @@ extern "C"
 
     // Methods related to graph allocation and destruction
     graphP gp_New(void);
+    graphP gp_NewWithArena(graphInt N, graphInt edgeCapacity);
+    int gp_ReserveEdgeStorage(graphP theGraph, graphInt maxEdgeCapacity, unsigned reserveFlags);
 
-    int gp_EnsureVertexCapacity(graphP theGraph, int N);
-    int gp_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity);
+// Flags for gp_ReserveEdgeStorage()
+#define RESERVEFLAGS_HUGEPAGES 1
+
+    int gp_EnsureVertexCapacity(graphP theGraph, graphInt N);
+    int gp_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity);
     void gp_ResetGraphStorage(graphP theGraph);
 
     void gp_Free(graphP *pGraph);
@@ -45,43 +50,51 @@ extern "C"
     int gp_CopyAdjacencyLists(graphP dstGraph, graphP srcGraph);
 
     int gp_CreateRandomGraph(graphP theGraph);
-    int gp_CreateRandomGraphEx(graphP theGraph, int numEdges);
+    int gp_CreateRandomGraphEx(graphP theGraph, graphInt numEdges);
 
     // Basic graph I/O methods: see graphIO.h
     // Intermediate graph I/O methods: see g6-read-iterator.h and g6-write-iterator.h
 
     // Basic vertex interrogators
-    int gp_IsNeighbor(graphP theGraph, int u, int v);
-    int gp_FindEdge(graphP theGraph, int u, int v);
-    int gp_GetVertexDegree(graphP theGraph, int v);
+    int gp_IsNeighbor(graphP theGraph, graphInt u, graphInt v);
+    graphInt gp_FindEdge(graphP theGraph, graphInt u, graphInt v);
+    graphInt gp_GetVertexDegree(graphP theGraph, graphInt v);
+
+    // Optional index that accelerates the adjacency queries above
+    int gp_EnableAdjacencyIndex(graphP theGraph);
+    void gp_DisableAdjacencyIndex(graphP theGraph);
 
     // Basic interrogators for directed graphs
     // The direction can be EDGEFLAG_DIRECTION_INONLY or EDGEFLAG_DIRECTION_OUTONLY
-    int gp_IsNeighborDirected(graphP theGraph, int u, int v, unsigned direction);
-    int gp_FindDirectedEdge(graphP theGraph, int u, int v, unsigned direction);
-    int gp_GetVertexInDegree(graphP theGraph, int v);
-    int gp_GetVertexOutDegree(graphP theGraph, int v);
+    int gp_IsNeighborDirected(graphP theGraph, graphInt u, graphInt v, unsigned direction);
+    graphInt gp_FindDirectedEdge(graphP theGraph, graphInt u, graphInt v, unsigned direction);
+    graphInt gp_GetVertexInDegree(graphP theGraph, graphInt v);
+    graphInt gp_GetVertexOutDegree(graphP theGraph, graphInt v);
 
     // Basic graph structure manipulators
-    int gp_AddEdge(graphP theGraph, int u, int ulink, int v, int vlink);
-    int gp_DynamicAddEdge(graphP theGraph, int u, int ulink, int v, int vlink);
-    int gp_InsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
-                      int v, int e_v, int e_vlink);
-    int gp_DynamicInsertEdge(graphP theGraph, int u, int e_u, int e_ulink,
-                             int v, int e_v, int e_vlink);
-    int gp_DeleteEdge(graphP theGraph, int e);
+    int gp_AddEdge(graphP theGraph, graphInt u, int ulink, graphInt v, int vlink);
+    int gp_DynamicAddEdge(graphP theGraph, graphInt u, int ulink, graphInt v, int vlink);
+    int gp_AddEdgesBulk(graphP theGraph, const graphInt *pairs, graphInt m);
+    int gp_ExportCSR(graphP theGraph, graphInt **pOffsets, graphInt **pNeighbors);
+    int gp_ImportCSR(graphP theGraph, graphInt N, const graphInt *offsets, const graphInt *neighbors);
+    int gp_InsertEdge(graphP theGraph, graphInt u, graphInt e_u, int e_ulink,
+                      graphInt v, graphInt e_v, int e_vlink);
+    int gp_DynamicInsertEdge(graphP theGraph, graphInt u, graphInt e_u, int e_ulink,
+                             graphInt v, graphInt e_v, int e_vlink);
+    int gp_DeleteEdge(graphP theGraph, graphInt e);
+    int gp_CompactEdgeStorage(graphP theGraph);
     int gp_ClearEdgeDirectionFlags(graphP theGraph);
     int gp_TransposeDirectedGraph(graphP theGraph);
 
     // Intermediate graph structure manipulators
-    void gp_HideEdge(graphP theGraph, int e);
-    void gp_RestoreEdge(graphP theGraph, int e);
-    int gp_HideVertex(graphP theGraph, int vertex);
+    void gp_HideEdge(graphP theGraph, graphInt e);
+    void gp_RestoreEdge(graphP theGraph, graphInt e);
+    int gp_HideVertex(graphP theGraph, graphInt vertex);
     int gp_RestoreVertex(graphP theGraph);
 
     // Advanced graph structure manipulators
-    int gp_ContractEdge(graphP theGraph, int e);
-    int gp_IdentifyVertices(graphP theGraph, int u, int v, int eBefore);
+    int gp_ContractEdge(graphP theGraph, graphInt e);
+    int gp_IdentifyVertices(graphP theGraph, graphInt u, graphInt v, graphInt eBefore);
     int gp_RestoreVertices(graphP theGraph);
 
     // For methods and declarations related to depth-first search (DFS), see graphDFSUtils.h
@@ -132,13 +145,37 @@ extern "C"
             Bit 3: Obstruction type qualifier RYW (set) versus RXW (clear)
             Bit 4: Obstruction type qualifier high (set) versus low (clear)
                     Bits 2-4 used in planarity-related algorithms
+
+     visitedStamp: only present if USE_VISITED_EPOCHS is defined, in which
+            case it replaces bit 0 of the flags (see below).
      ********************************************************************/
 
+/********************************************************************
+ Epoch-Stamped Visited Flags
+
+ By default, the visited flags of vertices and edge records are bits
+ in their flags, so clearing all of the visited flags of a graph takes
+ a sweep over the vertex and edge arrays. Define USE_VISITED_EPOCHS (or
+ configure with --enable-visited-epochs) to instead give each vertex
+ and edge record a visited stamp. A record is visited if its stamp
+ equals the current visited epoch of the graph, so all of the visited
+ flags are cleared in constant time by advancing the epoch. The vertices
+ and the virtual vertices have separate epochs so that the visited flags
+ of either can be cleared without affecting the other.
+
+ This is a compile-time choice, and the visited flag accessor macros
+ work the same way in both cases.
+ ********************************************************************/
+// #define USE_VISITED_EPOCHS
+
     struct vertexRec
     {
-        int link[2];
-        int index;
+        graphIndex link[2];
+        graphIndex index;
         unsigned flags;
+#ifdef USE_VISITED_EPOCHS
+        unsigned visitedStamp;
+#endif
     };
 
     typedef struct vertexRec vertexRec;
@@ -230,6 +267,19 @@ extern "C"
 #define gp_GetIndex(theGraph, v) (theGraph->V[v].index)
 #define gp_SetIndex(theGraph, v, theIndex) (theGraph->V[v].index = theIndex)
 
+#ifdef USE_VISITED_EPOCHS
+// Initializer for non-virtual and virtual vertex flags, including the visited stamp
+#define gp_InitFlags(theGraph, v) (theGraph->V[v].flags = 0, theGraph->V[v].visitedStamp = 0)
+
+// The visited epoch that applies to vertex or virtual vertex v
+#define _gp_VertexVisitedEpoch(theGraph, v) \
+    ((v) < gp_UpperBoundVertices(theGraph) ? (theGraph)->vertexVisitedEpoch : (theGraph)->virtualVertexVisitedEpoch)
+
+// Accessors for the non-virtual and virtual vertex visited flag
+#define gp_GetVisited(theGraph, v) (theGraph->V[v].visitedStamp == _gp_VertexVisitedEpoch(theGraph, v))
+#define gp_ClearVisited(theGraph, v) (theGraph->V[v].visitedStamp = 0)
+#define gp_SetVisited(theGraph, v) (theGraph->V[v].visitedStamp = _gp_VertexVisitedEpoch(theGraph, v))
+#else
 // Initializer for non-virtual and virtual vertex flags
 #define gp_InitFlags(theGraph, v) (theGraph->V[v].flags = 0)
 
@@ -238,6 +288,7 @@ extern "C"
 #define gp_GetVisited(theGraph, v) (theGraph->V[v].flags & VERTEX_VISITED_MASK)
 #define gp_ClearVisited(theGraph, v) (theGraph->V[v].flags &= ~VERTEX_VISITED_MASK)
 #define gp_SetVisited(theGraph, v) (theGraph->V[v].flags |= VERTEX_VISITED_MASK)
+#endif
 
 // Definition and accessors for the non-virtual and virtual vertex marked flag
 // Essentially, this is a second visitation flag that can help applications that
@@ -269,18 +320,73 @@ extern "C"
             Bit 5: Inverted (same as marking an edge with a "sign" of -1)
             Bit 6: Edge record is directed into the containing vertex only
             Bit 7: Edge record is directed from the containing vertex only
+
+     visitedStamp: only present if USE_VISITED_EPOCHS is defined, in which
+            case it replaces bit 0 of the flags (see above).
      ********************************************************************/
 
     struct edgeRec
     {
-        int link[2];
-        int neighbor;
+        graphIndex link[2];
+        graphIndex neighbor;
         unsigned flags;
+#ifdef USE_VISITED_EPOCHS
+        unsigned visitedStamp;
+#endif
     };
 
     typedef struct edgeRec edgeRec;
     typedef edgeRec *edgeRecP;
 
+/********************************************************************
+ Edge Storage Layout
+
+ By default, array E is an array of edgeRec structures (the members of
+ each edge record are interleaved in memory). Define USE_EDGE_SOA (or
+ configure with --enable-edge-soa) to instead store the edge records
+ as a structure of arrays, i.e., separate arrays for the link pairs,
+ the neighbors and the flags. Adjacency list traversals mostly touch
+ only the links and neighbors, so this layout reduces the memory
+ bandwidth consumed by traversals on large graphs.
+
+ The layout is a compile-time choice, and all of the edge accessor
+ macros below work the same way in both layouts. Code outside of the
+ base graph class must not access the members of E directly.
+ ********************************************************************/
+// #define USE_EDGE_SOA
+
+#ifdef USE_EDGE_SOA
+    struct edgeLinkRec
+    {
+        graphIndex link[2];
+    };
+
+    typedef struct edgeLinkRec edgeLinkRec;
+    typedef edgeLinkRec *edgeLinkRecP;
+
+    struct edgeStorageRec
+    {
+        edgeLinkRecP links;
+        graphIndex *neighbor;
+        unsigned *flags;
+#ifdef USE_VISITED_EPOCHS
+        unsigned *visitedStamp;
+#endif
+    };
+
+    typedef struct edgeStorageRec edgeStorageRec;
+
+#define _gp_EdgeLink(theGraph, e, theLink) ((theGraph)->E.links[e].link[theLink])
+#define _gp_EdgeNeighbor(theGraph, e) ((theGraph)->E.neighbor[e])
+#define _gp_EdgeFlags(theGraph, e) ((theGraph)->E.flags[e])
+#define _gp_EdgeVisitedStamp(theGraph, e) ((theGraph)->E.visitedStamp[e])
+#else
+#define _gp_EdgeLink(theGraph, e, theLink) ((theGraph)->E[e].link[theLink])
+#define _gp_EdgeNeighbor(theGraph, e) ((theGraph)->E[e].neighbor)
+#define _gp_EdgeFlags(theGraph, e) ((theGraph)->E[e].flags)
+#define _gp_EdgeVisitedStamp(theGraph, e) ((theGraph)->E[e].visitedStamp)
+#endif
+
 // An edge is represented by two consecutive edge records in the edge array E.
 // If an even number, xor 1 will add one; if an odd number, xor 1 will subtract 1
 #define gp_GetTwin(theGraph, e) ((e) ^ 1)
@@ -289,13 +395,13 @@ extern "C"
 // Access to adjacency list pointers
 // such as for adjacency list iteration
 ////////////////////////////////////////////
-#define gp_GetNextEdge(theGraph, e) (theGraph->E[e].link[0])
-#define gp_GetPrevEdge(theGraph, e) (theGraph->E[e].link[1])
-#define gp_GetAdjacentEdge(theGraph, e, theLink) (theGraph->E[e].link[theLink])
+#define gp_GetNextEdge(theGraph, e) (_gp_EdgeLink(theGraph, e, 0))
+#define gp_GetPrevEdge(theGraph, e) (_gp_EdgeLink(theGraph, e, 1))
+#define gp_GetAdjacentEdge(theGraph, e, theLink) (_gp_EdgeLink(theGraph, e, theLink))
 
-#define gp_SetNextEdge(theGraph, e, newNextEdge) (theGraph->E[e].link[0] = newNextEdge)
-#define gp_SetPrevEdge(theGraph, e, newPrevEdge) (theGraph->E[e].link[1] = newPrevEdge)
-#define gp_SetAdjacentEdge(theGraph, e, theLink, newEdge) (theGraph->E[e].link[theLink] = newEdge)
+#define gp_SetNextEdge(theGraph, e, newNextEdge) (_gp_EdgeLink(theGraph, e, 0) = newNextEdge)
+#define gp_SetPrevEdge(theGraph, e, newPrevEdge) (_gp_EdgeLink(theGraph, e, 1) = newPrevEdge)
+#define gp_SetAdjacentEdge(theGraph, e, theLink, newEdge) (_gp_EdgeLink(theGraph, e, theLink) = newEdge)
 
 ////////////////////////////////////////////
 // gp_IsEdge() helps detect the end of an
@@ -310,25 +416,35 @@ extern "C"
 #endif
 
 // Get/set 'neighbor' member indicated by edge record e
-#define gp_GetNeighbor(theGraph, e) (theGraph->E[e].neighbor)
-#define gp_SetNeighbor(theGraph, e, v) (theGraph->E[e].neighbor = v)
+#define gp_GetNeighbor(theGraph, e) (_gp_EdgeNeighbor(theGraph, e))
+#define gp_SetNeighbor(theGraph, e, v) (_gp_EdgeNeighbor(theGraph, e) = v)
 
+#ifdef USE_VISITED_EPOCHS
+// Initializer for edge flags, including the visited stamp
+#define gp_InitEdgeFlags(theGraph, e) (_gp_EdgeFlags(theGraph, e) = 0, _gp_EdgeVisitedStamp(theGraph, e) = 0)
+
+// Access to the edge visited flag (see USE_VISITED_EPOCHS above)
+#define gp_GetEdgeVisited(theGraph, e) (_gp_EdgeVisitedStamp(theGraph, e) == (theGraph)->edgeVisitedEpoch)
+#define gp_ClearEdgeVisited(theGraph, e) (_gp_EdgeVisitedStamp(theGraph, e) = 0)
+#define gp_SetEdgeVisited(theGraph, e) (_gp_EdgeVisitedStamp(theGraph, e) = (theGraph)->edgeVisitedEpoch)
+#else
 // Initializer for edge flags
-#define gp_InitEdgeFlags(theGraph, e) (theGraph->E[e].flags = 0)
+#define gp_InitEdgeFlags(theGraph, e) (_gp_EdgeFlags(theGraph, e) = 0)
 
 // Definitions of and access to edge flags
 #define EDGE_VISITED_MASK 1
-#define gp_GetEdgeVisited(theGraph, e) (theGraph->E[e].flags & EDGE_VISITED_MASK)
-#define gp_ClearEdgeVisited(theGraph, e) (theGraph->E[e].flags &= ~EDGE_VISITED_MASK)
-#define gp_SetEdgeVisited(theGraph, e) (theGraph->E[e].flags |= EDGE_VISITED_MASK)
+#define gp_GetEdgeVisited(theGraph, e) (_gp_EdgeFlags(theGraph, e) & EDGE_VISITED_MASK)
+#define gp_ClearEdgeVisited(theGraph, e) (_gp_EdgeFlags(theGraph, e) &= ~EDGE_VISITED_MASK)
+#define gp_SetEdgeVisited(theGraph, e) (_gp_EdgeFlags(theGraph, e) |= EDGE_VISITED_MASK)
+#endif
 
 // Definition and accessors for the edge marked flag
 // Essentially, this is a second visitation flag that can help applications that
 // must visit all edges to analyze and mark the ones important for some purpose.
 #define EDGE_MARKED_MASK 2
-#define gp_GetEdgeMarked(theGraph, e) (theGraph->E[e].flags & EDGE_MARKED_MASK)
-#define gp_ClearEdgeMarked(theGraph, e) (theGraph->E[e].flags &= ~EDGE_MARKED_MASK)
-#define gp_SetEdgeMarked(theGraph, e) (theGraph->E[e].flags |= EDGE_MARKED_MASK)
+#define gp_GetEdgeMarked(theGraph, e) (_gp_EdgeFlags(theGraph, e) & EDGE_MARKED_MASK)
+#define gp_ClearEdgeMarked(theGraph, e) (_gp_EdgeFlags(theGraph, e) &= ~EDGE_MARKED_MASK)
+#define gp_SetEdgeMarked(theGraph, e) (_gp_EdgeFlags(theGraph, e) |= EDGE_MARKED_MASK)
 
 // The edge type is defined by bits 2-4 and 8, 4+8+16+256=284
 // Bit 2 set means the edge record neighbor field indicates a parent (in a
@@ -362,17 +478,17 @@ extern "C"
 //        in a parent-or-ancestor/child-or-descendant relationship
 #define EDGE_TYPE_CROSS 256
 
-#define gp_GetEdgeType(theGraph, e) (theGraph->E[e].flags & EDGE_TYPE_MASK)
-#define gp_ClearEdgeType(theGraph, e) (theGraph->E[e].flags &= ~EDGE_TYPE_MASK)
-#define gp_SetEdgeType(theGraph, e, type) (theGraph->E[e].flags |= type)
+#define gp_GetEdgeType(theGraph, e) (_gp_EdgeFlags(theGraph, e) & EDGE_TYPE_MASK)
+#define gp_ClearEdgeType(theGraph, e) (_gp_EdgeFlags(theGraph, e) &= ~EDGE_TYPE_MASK)
+#define gp_SetEdgeType(theGraph, e, type) (_gp_EdgeFlags(theGraph, e) |= type)
 #define gp_ResetEdgeType(theGraph, e, type) \
-    (theGraph->E[e].flags = (theGraph->E[e].flags & ~EDGE_TYPE_MASK) | type)
+    (_gp_EdgeFlags(theGraph, e) = (_gp_EdgeFlags(theGraph, e) & ~EDGE_TYPE_MASK) | type)
 
 #define EDGEFLAG_INVERTED_MASK 32
-#define gp_GetEdgeFlagInverted(theGraph, e) (theGraph->E[e].flags & EDGEFLAG_INVERTED_MASK)
-#define gp_SetEdgeFlagInverted(theGraph, e) (theGraph->E[e].flags |= EDGEFLAG_INVERTED_MASK)
-#define gp_ClearEdgeFlagInverted(theGraph, e) (theGraph->E[e].flags &= (~EDGEFLAG_INVERTED_MASK))
-#define gp_XorEdgeFlagInverted(theGraph, e) (theGraph->E[e].flags ^= EDGEFLAG_INVERTED_MASK)
+#define gp_GetEdgeFlagInverted(theGraph, e) (_gp_EdgeFlags(theGraph, e) & EDGEFLAG_INVERTED_MASK)
+#define gp_SetEdgeFlagInverted(theGraph, e) (_gp_EdgeFlags(theGraph, e) |= EDGEFLAG_INVERTED_MASK)
+#define gp_ClearEdgeFlagInverted(theGraph, e) (_gp_EdgeFlags(theGraph, e) &= (~EDGEFLAG_INVERTED_MASK))
+#define gp_XorEdgeFlagInverted(theGraph, e) (_gp_EdgeFlags(theGraph, e) ^= EDGEFLAG_INVERTED_MASK)
 
 #define EDGEFLAG_DIRECTION_INONLY 64
 #define EDGEFLAG_DIRECTION_OUTONLY 128
@@ -382,7 +498,7 @@ extern "C"
 //       so next available bit is bit 9 = 512
 
 // Returns the direction, if any, of the edge record
-#define gp_GetDirection(theGraph, e) (theGraph->E[e].flags & EDGEFLAG_DIRECTION_MASK)
+#define gp_GetDirection(theGraph, e) (_gp_EdgeFlags(theGraph, e) & EDGEFLAG_DIRECTION_MASK)
 
 // A direction of 0 clears directedness. Otherwise, edge record e is set
 // to direction and e's twin edge record is set to the opposing setting.
@@ -390,8 +506,8 @@ extern "C"
     {                                                                                             \
         if (direction == EDGEFLAG_DIRECTION_INONLY)                                               \
         {                                                                                         \
-            theGraph->E[e].flags |= EDGEFLAG_DIRECTION_INONLY;                                    \
-            theGraph->E[gp_GetTwin(theGraph, e)].flags |= EDGEFLAG_DIRECTION_OUTONLY;             \
+            _gp_EdgeFlags(theGraph, e) |= EDGEFLAG_DIRECTION_INONLY;                              \
+            _gp_EdgeFlags(theGraph, gp_GetTwin(theGraph, e)) |= EDGEFLAG_DIRECTION_OUTONLY;       \
             if (gp_GetNeighbor(theGraph, e) != gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e))) \
             {                                                                                     \
                 theGraph->graphFlags |= GRAPHFLAGS_DIRECTEDEDGEDETECTED;                          \
@@ -399,8 +515,8 @@ extern "C"
         }                                                                                         \
         else if (direction == EDGEFLAG_DIRECTION_OUTONLY)                                         \
         {                                                                                         \
-            theGraph->E[e].flags |= EDGEFLAG_DIRECTION_OUTONLY;                                   \
-            theGraph->E[gp_GetTwin(theGraph, e)].flags |= EDGEFLAG_DIRECTION_INONLY;              \
+            _gp_EdgeFlags(theGraph, e) |= EDGEFLAG_DIRECTION_OUTONLY;                             \
+            _gp_EdgeFlags(theGraph, gp_GetTwin(theGraph, e)) |= EDGEFLAG_DIRECTION_INONLY;        \
             if (gp_GetNeighbor(theGraph, e) != gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e))) \
             {                                                                                     \
                 theGraph->graphFlags |= GRAPHFLAGS_DIRECTEDEDGEDETECTED;                          \
@@ -408,8 +524,8 @@ extern "C"
         }                                                                                         \
         else                                                                                      \
         {                                                                                         \
-            theGraph->E[e].flags &= ~EDGEFLAG_DIRECTION_MASK;                                     \
-            theGraph->E[gp_GetTwin(theGraph, e)].flags &= ~EDGEFLAG_DIRECTION_MASK;               \
+            _gp_EdgeFlags(theGraph, e) &= ~EDGEFLAG_DIRECTION_MASK;                               \
+            _gp_EdgeFlags(theGraph, gp_GetTwin(theGraph, e)) &= ~EDGEFLAG_DIRECTION_MASK;         \
         }                                                                                         \
     }
 
@@ -477,7 +593,8 @@ extern "C"
                 NV: Number of virtual vertices (currently always equal to N)
 
                 E : Array of edge records (edge records come in pairs and represent
-                    an edge in each of the two vertex endpoints of the edge)
+                    an edge in each of the two vertex endpoints of the edge), or the
+                    structure of edge record arrays if USE_EDGE_SOA is defined
                 M: Number of edges (the "size" of the graph)
                 edgeCapacity: the maximum number of edges allowed in E
                 edgeHoles: free locations in E where edges have been deleted
@@ -486,6 +603,9 @@ extern "C"
                 graphFlags: Additional state information about the graph
                 embedFlags: records the type of embedding requested (uses EMBEDFLAGS)
 
+                vertexVisitedEpoch, virtualVertexVisitedEpoch, edgeVisitedEpoch:
+                    the current visited epochs if USE_VISITED_EPOCHS is defined
+
                 theStack: Used by methods of the base Graph class and its subclasses
 
                 extensions: an object-oriented hierarchy of graph classes is implemented
@@ -503,15 +623,23 @@ extern "C"
     struct graphStruct
     {
         vertexRecP V;
-        int N, NV;
+        graphInt N, NV;
 
+#ifdef USE_EDGE_SOA
+        edgeStorageRec E;
+#else
         edgeRecP E;
-        int M, edgeCapacity;
+#endif
+        graphInt M, edgeCapacity;
         stackP edgeHoles;
-        int numEdgeHoles;
+        graphInt numEdgeHoles;
 
         unsigned graphFlags, embedFlags;
 
+#ifdef USE_VISITED_EPOCHS
+        unsigned vertexVisitedEpoch, virtualVertexVisitedEpoch, edgeVisitedEpoch;
+#endif
+
         // Used by base Graph class and its subclasses
         stackP theStack;
 
@@ -12,6 +12,14 @@ See the LICENSE.TXT file for licensing information.
 
 #include "lowLevelUtils/listcoll.h"
 #include "lowLevelUtils/stack.h"
+#include "lowLevelUtils/arena.h"
+#include "lowLevelUtils/adjindex.h"
+#include "lowLevelUtils/vmregion.h"
+
+// Declares the embedStatsStruct gathered by gp_Embed()
+#ifdef USE_EMBED_STATS
+#include "planarityRelated/graphPlanarity.h"
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -48,6 +56,19 @@ extern "C"
     typedef isolatorContextStruct *isolatorContextP;
 
 
+    // The separately allocated arrays of edge storage (see USE_EDGE_SOA
+    // in graph.h), which index the edgeStorageRegions below
+#ifdef USE_EDGE_SOA
+#define EDGESTORAGE_LINKS 0
+#define EDGESTORAGE_NEIGHBOR 1
+#define EDGESTORAGE_FLAGS 2
+#define EDGESTORAGE_VISITEDSTAMP 3
+#define NUMEDGESTORAGEARRAYS 4
+#else
+#define EDGESTORAGE_RECORDS 0
+#define NUMEDGESTORAGEARRAYS 1
+#endif
+
     /********************************************************************
      A structure for package private data associated with a graph.
 
@@ -64,6 +85,47 @@ extern "C"
                 lists of each vertex
         extFace: For Planarity graphs, an array of (N + NV) external face
                 short circuit records
+
+        useArena: TRUE if the graph was created by gp_NewWithArena(), in which
+                case gp_EnsureVertexCapacity() creates the arena
+        arena: if not NULL, the single block of memory from which the vertex
+                and edge arrays, stacks, list collections and vertex info
+                arrays of the graph and its extensions are allocated
+
+        reservedEdgeCapacity: if positive, the edge capacity for which
+                gp_ReserveEdgeStorage() has reserved address space
+        reserveFlags: the RESERVEFLAGS_* given to gp_ReserveEdgeStorage()
+        edgeStorageRegions: for each separately allocated array of edge
+                storage, the region of reserved address space that holds it,
+                or NULL if the array is on the heap (or in the arena)
+
+        edgeHighWaterMark: one more than the largest edge record index that
+                may have been changed since the edge records were last
+                initialized; all edge records at and above it, including
+                parallel extension edge records, are in their initial state
+
+        useAdjacencyIndex: TRUE if enabled by gp_EnableAdjacencyIndex()
+        adjacencyIndex: if not NULL, maps each vertex and neighbor pair to the
+                edge records in the vertex's adjacency list that indicate the
+                neighbor (see _gp_GetAdjacencyIndex() in graph.c)
+
+        testOnly: TRUE if the current gp_Embed() was given EMBEDFLAGS_TESTONLY,
+                so only its result is needed, not the embedding or obstruction
+        deferIsolation: TRUE if the current gp_Embed() was given
+                EMBEDFLAGS_DEFERISOLATION, so the obstruction is only isolated
+                if gp_IsolateObstruction() is called
+        isolationPending: TRUE if the Walkdown was blocked while deferIsolation
+                was set, so the isolator context holds the vertex and bicomp
+                root from which gp_IsolateObstruction() isolates the obstruction
+
+        incrementalBackup: if not NULL, a graph into which gp_AddEdgeToEmbedding()
+                copies the embedding before it embeds the graph again with a
+                new edge, so that the embedding can be restored if the edge
+                is rejected (see _SaveIncrementalBackup())
+
+        embedStats: only present if USE_EMBED_STATS is defined, in which case
+                gp_Embed() gathers its counts and timings here (see
+                gp_GetEmbedStats())
      ********************************************************************/
     struct graphPrivateDataStruct
     {
@@ -76,6 +138,36 @@ extern "C"
         listCollectionP sortedDFSChildLists;
         extFaceLinkRecP extFace;
         isolatorContextP IC;
+
+        // Single-allocation storage for all of the above and extension data
+        int useArena;
+        arenaP arena;
+
+        // Reserved address space in which the edge storage grows in place
+        graphInt reservedEdgeCapacity;
+        unsigned reserveFlags;
+        vmRegionP edgeStorageRegions[NUMEDGESTORAGEARRAYS];
+
+        // Bounds the edge records that gp_CopyGraph() must copy or clear
+        graphInt edgeHighWaterMark;
+
+        // Optional index that accelerates gp_IsNeighbor() and gp_FindEdge()
+        int useAdjacencyIndex;
+        adjIndexP adjacencyIndex;
+
+        // Set by gp_Embed() from the EMBEDFLAGS_TESTONLY bit of its embedFlags
+        int testOnly;
+
+        // Set by gp_Embed() from the EMBEDFLAGS_DEFERISOLATION bit of its embedFlags,
+        // and the state of an obstruction awaiting gp_IsolateObstruction()
+        int deferIsolation, isolationPending;
+
+        // Kept by gp_AddEdgeToEmbedding() to restore an embedding
+        graphP incrementalBackup;
+
+#ifdef USE_EMBED_STATS
+        embedStatsStruct embedStats;
+#endif
     };
 
     typedef struct graphPrivateDataStruct graphPrivateDataStruct;
@@ -92,6 +184,49 @@ extern "C"
 #define theGraphSortedDFSChildLists(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->sortedDFSChildLists)
 #define theGraphExtFace(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->extFace)
 #define theGraphIC(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->IC)
+#define theGraphArena(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->arena)
+#define theGraphEdgeHighWaterMark(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->edgeHighWaterMark)
+#define theGraphAdjacencyIndex(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->adjacencyIndex)
+#define theGraphTestOnly(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->testOnly)
+#define theGraphDeferIsolation(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->deferIsolation)
+#define theGraphIsolationPending(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->isolationPending)
+#define theGraphIncrementalBackup(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->incrementalBackup)
+
+// Counts an event of the embedder in the named member of the embedStats, if
+// the library is built with USE_EMBED_STATS, and otherwise compiles to nothing
+#ifdef USE_EMBED_STATS
+#define theGraphEmbedStats(theGraph) (((graphPrivateDataP)((theGraph)->privateData))->embedStats)
+#define _gp_CountEmbedStat(theGraph, member) (theGraphEmbedStats(theGraph).member++)
+#else
+#define _gp_CountEmbedStat(theGraph, member)
+#endif
+
+// Must be invoked whenever the upper bound of the edges in use may have grown
+#define _gp_UpdateEdgeHighWaterMark(theGraph)                                      \
+    {                                                                              \
+        if (theGraphEdgeHighWaterMark(theGraph) < gp_UpperBoundEdges(theGraph))    \
+            theGraphEdgeHighWaterMark(theGraph) = gp_UpperBoundEdges(theGraph);    \
+    }
+
+    // Allocators for the arrays, stacks and list collections associated with
+    // a graph, including those of extensions. They use the graph's arena, if
+    // any, and the heap otherwise, so memory obtained from them must only be
+    // released by the matching _gp_Free*() function.
+    void *_gp_AllocStorage(graphP theGraph, size_t size);
+    void *_gp_ReallocStorage(graphP theGraph, void *ptr, size_t oldSize, size_t newSize);
+    void _gp_FreeStorage(graphP theGraph, void *ptr);
+
+    stackP _gp_NewStack(graphP theGraph, graphInt capacity);
+    void _gp_FreeStack(graphP theGraph, stackP *pStack);
+
+    listCollectionP _gp_NewListCollection(graphP theGraph, graphInt N);
+    void _gp_FreeListCollection(graphP theGraph, listCollectionP *pListColl);
+
+    // Must be invoked by any operation that changes the neighbor members of
+    // edge records, or that hides or restores edge records, other than through
+    // the graph operations that keep the adjacency index up to date. The index,
+    // if enabled, is then rebuilt on demand by the next adjacency query.
+    void _gp_InvalidateAdjacencyIndex(graphP theGraph);
 
 /********************************************************************
  Additional edge link accessors and manipulators
@@ -103,12 +238,12 @@ extern "C"
 #define gp_GetNextEdgeCircular(theGraph, e)           \
     (gp_IsEdge(theGraph, gp_GetNextEdge(theGraph, e)) \
          ? gp_GetNextEdge(theGraph, e)                \
-         : gp_GetFirstEdge(theGraph, theGraph->E[gp_GetTwin(theGraph, e)].neighbor))
+         : gp_GetFirstEdge(theGraph, gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e))))
 
 #define gp_GetPrevEdgeCircular(theGraph, e)           \
     (gp_IsEdge(theGraph, gp_GetPrevEdge(theGraph, e)) \
          ? gp_GetPrevEdge(theGraph, e)                \
-         : gp_GetLastEdge(theGraph, theGraph->E[gp_GetTwin(theGraph, e)].neighbor))
+         : gp_GetLastEdge(theGraph, gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e))))
 
 // Methods that make the cross-link binding between a vertex and an
 // edge record. The old first or last edge record should be bound to
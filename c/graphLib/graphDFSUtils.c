@@ -15,9 +15,15 @@ See the LICENSE.TXT file for licensing information.
 // Allows the default _SortVertices() to swap planarity vertex info, if present
 #include "planarityRelated/graphPlanarity.private.h"
 
+#include <stdlib.h>
+
 // Private methods, except exported within library
 int _SortVertices(graphP theGraph);
 
+// Private methods
+int _DepthFirstSearch(graphP theGraph, int computeLeastAncestors);
+void _ComputeLeastAncestorsFromEdgeTypes(graphP theGraph);
+
 // Imported methods
 extern void _ClearVertexVisitedFlags(graphP theGraph, int);
 
@@ -95,9 +101,6 @@ int gp_Detach_DFSUtils(graphP theGraph)
 
 int gp_DepthFirstSearch(graphP theGraph)
 {
-    stackP theStack;
-    int DFI, v, uparent, u, e;
-
     if (theGraph == NULL)
         return NOTOK;
 
@@ -115,76 +118,11 @@ int gp_DepthFirstSearch(graphP theGraph)
 
     _gp_LogLine("\ngraphDFSUtils.c/gp_DepthFirstSearch() start");
 
-    theStack = theGraph->theStack;
-
-    /* There are 2M edge records and for each we can push 2 integers,
-        plus one extra (NIL, NIL) at the beginning to represent
-        arriving at a DFS tree root. So, a stack of 2 * 2 * (1+M)
-        integers suffices.
-        This stack is already in theGraph structure, so we make sure
-        it has the capacity and, if so, that it's empty. */
-
-    if (sp_GetCapacity(theStack) < 2 * 2 * gp_GetM(theGraph) + 2)
+    if (_DepthFirstSearch(theGraph, FALSE) != OK)
         return NOTOK;
 
-    sp_ClearStack(theStack);
-
-    /* Clear the visited flags because they are used to detect what has
-        been visited as the DFS traverses the graph. */
-    _ClearVertexVisitedFlags(theGraph, FALSE);
-
-    /* This outer loop causes the connected subgraphs of a disconnected
-            graph to be numbered */
-
-    for (DFI = v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
-    {
-        if (_gp_IsNotDFSTreeRoot(theGraph, v))
-            continue;
-
-        sp_Push2(theStack, NIL, NIL);
-        while (sp_NonEmpty(theStack))
-        {
-            sp_Pop2(theStack, uparent, e);
-            u = gp_IsNotVertex(theGraph, uparent) ? v : gp_GetNeighbor(theGraph, e);
-
-            if (!gp_GetVisited(theGraph, u))
-            {
-                _gp_LogLine(_gp_MakeLogStr3("V=%d, DFI=%d, Parent=%d", u, DFI, uparent));
-
-                gp_SetVisited(theGraph, u);
-                gp_SetIndex(theGraph, u, DFI++);
-                gp_SetVertexParent(theGraph, u, uparent);
-                if (gp_IsEdge(theGraph, e))
-                {
-                    gp_SetEdgeType(theGraph, e, EDGE_TYPE_CHILD);
-                    gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_PARENT);
-                }
-
-                /* Push edges to all unvisited neighbors. These will be either
-                      tree edges to children or forward edge records of back edges */
-
-                e = gp_GetFirstEdge(theGraph, u);
-                while (gp_IsEdge(theGraph, e))
-                {
-                    if (!gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e)))
-                        sp_Push2(theStack, u, e);
-                    e = gp_GetNextEdge(theGraph, e);
-                }
-            }
-            else
-            {
-                // If the edge leads to a visited vertex, then it is
-                // the forward component of a back edge.
-                gp_SetEdgeType(theGraph, e, EDGE_TYPE_FORWARD);
-                gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_BACK);
-            }
-        }
-    }
-
     _gp_LogLine("graphDFSUtils.c/gp_DepthFirstSearch() end\n");
 
-    theGraph->graphFlags |= GRAPHFLAGS_DFSNUMBERED;
-
     return OK;
 }
 
@@ -213,6 +151,10 @@ int gp_SortVertices(graphP theGraph)
     if (gp_ExtendWith_DFSUtils(theGraph) != OK)
         return NOTOK;
 
+    // Sorting renumbers the vertices, so the adjacency index is rebuilt
+    // on demand afterward
+    _gp_InvalidateAdjacencyIndex(theGraph);
+
     return theGraph->functions->fpSortVertices(theGraph);
 }
 
@@ -243,11 +185,33 @@ int gp_SortVertices(graphP theGraph)
         theGraphPVI(srcGraph)[srcPos] = tempPVI;                        \
     }
 
+// If USE_HOT_VERTEX_INFO is defined, then some of the vertex info is in the
+// external face link records, and only those members are swapped since the
+// external face links are not swapped when the vertex info is not hot
+#ifdef USE_HOT_VERTEX_INFO
+#define _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, member)      \
+    {                                                                              \
+        graphIndex tempMember = theGraphExtFace(dstGraph)[dstPos].member;          \
+        theGraphExtFace(dstGraph)[dstPos].member = theGraphExtFace(srcGraph)[srcPos].member; \
+        theGraphExtFace(srcGraph)[srcPos].member = tempMember;                     \
+    }
+#define _gp_SwapHotVertexInfo(dstGraph, dstPos, srcGraph, srcPos)                                     \
+    {                                                                                               \
+        _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, pertinentEdge);            \
+        _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, pertinentRoots);           \
+        _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, futurePertinentChild);     \
+        _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, visitedIndex);             \
+        _gp_SwapHotVertexInfoMember(dstGraph, dstPos, srcGraph, srcPos, leastAncestor);            \
+    }
+#else
+#define _gp_SwapHotVertexInfo(dstGraph, dstPos, srcGraph, srcPos)
+#endif
+
 // This is the default method for sorting vertices into and back
 // out of DFI order.
 int _SortVertices(graphP theGraph)
 {
-    int v, srcPos, dstPos;
+    graphInt v, srcPos, dstPos;
 
     if (theGraph == NULL)
         return NOTOK;
@@ -267,13 +231,13 @@ int _SortVertices(graphP theGraph)
         // Slightly optimized loop body, for when edge deletion has not been used
         // (Optimization level O1 or higher hoists the upperBoundEdges calculation,
         //  so this is mainly just a little less work in the loop body).
-        int upperBoundEdges = gp_LowerBoundEdges(theGraph) + (gp_GetM(theGraph) << 1);
-        for (int e = gp_LowerBoundEdges(theGraph); e < upperBoundEdges; ++e)
+        graphInt upperBoundEdges = gp_LowerBoundEdges(theGraph) + (gp_GetM(theGraph) << 1);
+        for (graphInt e = gp_LowerBoundEdges(theGraph); e < upperBoundEdges; ++e)
             gp_SetNeighbor(theGraph, e, gp_GetIndex(theGraph, gp_GetNeighbor(theGraph, e)));
     }
     else
     {
-        for (int e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
+        for (graphInt e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 2)
         {
             if (gp_EdgeInUse(theGraph, e))
             {
@@ -316,6 +280,7 @@ int _SortVertices(graphP theGraph)
             _gp_SwapVertexRec(theGraph, dstPos, theGraph, v);
             _gp_SwapDFSUtilsVertexInfo(theGraph, dstPos, theGraph, v);
             _gp_SwapPlanarityVertexInfo(theGraph, dstPos, theGraph, v);
+            _gp_SwapHotVertexInfo(theGraph, dstPos, theGraph, v);
 
             gp_SetVisited(theGraph, dstPos);
             gp_SetIndex(theGraph, dstPos, srcPos);
@@ -366,7 +331,7 @@ int _SortVertices(graphP theGraph)
 int gp_ComputeLowpoints(graphP theGraph)
 {
     stackP theStack = NULL;
-    int v, u, uneighbor, e, L, leastAncestor;
+    graphInt v, u, uneighbor, e, L, leastAncestor;
 
     if (theGraph == NULL)
         return NOTOK;
@@ -492,7 +457,7 @@ int gp_ComputeLowpoints(graphP theGraph)
 int gp_ComputeLeastAncestors(graphP theGraph)
 {
     stackP theStack = NULL;
-    int v, u, uneighbor, e, leastAncestor;
+    graphInt v, u, uneighbor, e, leastAncestor;
 
     if (theGraph == NULL)
         return NOTOK;
@@ -523,6 +488,8 @@ int gp_ComputeLeastAncestors(graphP theGraph)
 
     sp_ClearStack(theStack);
 
+    _ClearVertexVisitedFlags(theGraph, FALSE);
+
     // This outer loop causes the connected subgraphs of a disconnected graph to be processed
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph);)
     {
@@ -569,6 +536,248 @@ int gp_ComputeLeastAncestors(graphP theGraph)
     return OK;
 }
 
+/********************************************************************
+ gp_ComputeDFSInfo()
+
+ Computes the subset of the DFS information given by the what flags
+ (see DFSINFO_* in graphDFSUtils.h) with fewer passes over the graph
+ than the separate calls to gp_DepthFirstSearch(), gp_SortVertices(),
+ gp_ComputeLeastAncestors() and gp_ComputeLowpoints() would make.
+
+ Least ancestors are found during the depth-first search itself, as
+ each back edge is typed from its descendant endpoint. The lowpoints are then computed without another traversal
+ of the DFS tree. Once the vertices are sorted, each DFS child has a
+ greater index than its parent, so a single pass in descending order
+ can fold the lowpoint of each vertex into that of its parent.
+
+ The least ancestor and lowpoint values are given as DFIs, so both
+ imply DFSINFO_SORTBYDFI, and sorting implies DFSINFO_DFSNUMBERING.
+ Information that the graph flags show is already present is not
+ recomputed. On success, the graph is left with the same flags and
+ values as the separate calls produce, i.e., GRAPHFLAGS_DFSNUMBERED,
+ GRAPHFLAGS_SORTEDBYDFI and GRAPHFLAGS_LOWPOINTSCOMPUTED are set
+ according to what was requested.
+
+ Returns OK on success, NOTOK on failure, including for unknown bits
+ in what and for graphs with directed edges.
+ ********************************************************************/
+
+int gp_ComputeDFSInfo(graphP theGraph, unsigned what)
+{
+    graphInt v, p;
+    int needLeastAncestors;
+
+    if (theGraph == NULL || (what & ~DFSINFO_ALL) != 0)
+        return NOTOK;
+
+    if (gp_GetGraphFlags(theGraph) & GRAPHFLAGS_DIRECTEDEDGEDETECTED)
+    {
+        gp_ErrorMessage("gp_ComputeDFSInfo() does not support directed graphs.");
+        return NOTOK;
+    }
+
+    if (gp_ExtendWith_DFSUtils(theGraph) != OK)
+        return NOTOK;
+
+    if (what & (DFSINFO_LEASTANCESTORS | DFSINFO_LOWPOINTS))
+        what |= DFSINFO_SORTBYDFI;
+    if (what & DFSINFO_SORTBYDFI)
+        what |= DFSINFO_DFSNUMBERING;
+
+    // The least ancestors are already known if the lowpoints are
+    needLeastAncestors = (what & (DFSINFO_LEASTANCESTORS | DFSINFO_LOWPOINTS)) &&
+                         !(gp_GetGraphFlags(theGraph) & GRAPHFLAGS_LOWPOINTSCOMPUTED);
+
+    _gp_LogLine("\ngraphDFSUtils.c/gp_ComputeDFSInfo() start");
+
+    if ((what & DFSINFO_DFSNUMBERING) && !(gp_GetGraphFlags(theGraph) & GRAPHFLAGS_DFSNUMBERED))
+    {
+        if (_DepthFirstSearch(theGraph, needLeastAncestors) != OK)
+            return NOTOK;
+
+        needLeastAncestors = FALSE;
+    }
+
+    if ((what & DFSINFO_SORTBYDFI) && !(gp_GetGraphFlags(theGraph) & GRAPHFLAGS_SORTEDBYDFI))
+    {
+        // Sorting clears GRAPHFLAGS_LOWPOINTSCOMPUTED, but the least
+        // ancestors are DFIs, so they survive it
+        if (gp_SortVertices(theGraph) != OK)
+            return NOTOK;
+    }
+
+    // The DFS was done beforehand, so the least ancestors are taken from
+    // the back edge records, which needs no traversal of the DFS tree
+    if (needLeastAncestors)
+        _ComputeLeastAncestorsFromEdgeTypes(theGraph);
+
+    if ((what & DFSINFO_LOWPOINTS) && !(gp_GetGraphFlags(theGraph) & GRAPHFLAGS_LOWPOINTSCOMPUTED))
+    {
+        // Each lowpoint starts as the least ancestor, and the children of a
+        // vertex are all finished before the vertex is folded into its parent
+        for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+            gp_SetVertexLowpoint(theGraph, v, gp_GetVertexLeastAncestor(theGraph, v));
+
+        for (v = gp_UpperBoundVertices(theGraph) - 1; v >= gp_LowerBoundVertices(theGraph); --v)
+        {
+            p = gp_GetVertexParent(theGraph, v);
+            if (gp_IsVertex(theGraph, p) &&
+                gp_GetVertexLowpoint(theGraph, p) > gp_GetVertexLowpoint(theGraph, v))
+                gp_SetVertexLowpoint(theGraph, p, gp_GetVertexLowpoint(theGraph, v));
+        }
+
+        theGraph->graphFlags |= GRAPHFLAGS_LOWPOINTSCOMPUTED;
+    }
+
+    _gp_LogLine("graphDFSUtils.c/gp_ComputeDFSInfo() end\n");
+
+    return OK;
+}
+
+/********************************************************************
+ _DepthFirstSearch()
+
+ Assigns a DFI and a DFS parent to each vertex and sets the type of
+ each edge record, as described for gp_DepthFirstSearch(). If it is
+ requested, the least ancestor of each vertex is also computed as a
+ DFI, which is valid once the vertices are sorted by DFI.
+
+ The stack holds a pair of integers for each vertex on the current
+ DFS tree path: the vertex and its cursor, which is the edge record
+ to the DFS child being explored, or NIL before the first edge record
+ of the vertex has been examined. So, the stack needs only 2N integers,
+ rather than 2 integers for each edge record to an unvisited neighbor.
+
+ The adjacency list of each vertex is explored from last to first,
+ which numbers the vertices in the same order as a search that pushes
+ the edge records to all unvisited neighbors of a vertex at once.
+
+ An edge record to a visited neighbor other than the DFS parent is
+ typed when it leads to an ancestor, i.e., a neighbor with a lower
+ DFI. The edge record from the ancestor side is then found to lead to
+ a visited descendant, so it is skipped, since it is already typed.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _DepthFirstSearch(graphP theGraph, int computeLeastAncestors)
+{
+    stackP theStack = theGraph->theStack;
+    graphInt DFI, v, uparent, u, e;
+
+    // A pair of integers for each vertex on the DFS tree path, plus the
+    // (NIL, NIL) pushed to start at a DFS tree root, which is popped
+    // before the root is pushed
+    if (sp_GetCapacity(theStack) < 2 * gp_GetN(theGraph))
+        return NOTOK;
+
+    sp_ClearStack(theStack);
+
+    // Clear the visited flags because they are used to detect what has
+    // been visited as the DFS traverses the graph.
+    _ClearVertexVisitedFlags(theGraph, FALSE);
+
+    // This outer loop causes the connected subgraphs of a disconnected
+    // graph to be numbered
+    for (DFI = v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        if (_gp_IsNotDFSTreeRoot(theGraph, v))
+            continue;
+
+        sp_Push2(theStack, NIL, NIL);
+        while (sp_NonEmpty(theStack))
+        {
+            sp_Pop2(theStack, uparent, e);
+
+            if (gp_IsNotVertex(theGraph, uparent))
+                u = v;
+            else
+            {
+                // Advance the cursor of uparent to the next edge record that leads
+                // to an unvisited neighbor, typing the back edges passed on the way
+                e = gp_IsEdge(theGraph, e) ? gp_GetPrevEdge(theGraph, e) : gp_GetLastEdge(theGraph, uparent);
+                while (gp_IsEdge(theGraph, e))
+                {
+                    u = gp_GetNeighbor(theGraph, e);
+                    if (!gp_GetVisited(theGraph, u))
+                        break;
+
+                    if (gp_GetEdgeType(theGraph, e) != EDGE_TYPE_PARENT &&
+                        gp_GetIndex(theGraph, u) < gp_GetIndex(theGraph, uparent))
+                    {
+                        gp_SetEdgeType(theGraph, e, EDGE_TYPE_BACK);
+                        gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_FORWARD);
+
+                        if (computeLeastAncestors &&
+                            gp_GetVertexLeastAncestor(theGraph, uparent) > gp_GetIndex(theGraph, u))
+                            gp_SetVertexLeastAncestor(theGraph, uparent, gp_GetIndex(theGraph, u));
+                    }
+
+                    e = gp_GetPrevEdge(theGraph, e);
+                }
+
+                // If all edge records of uparent have been examined, then the DFS
+                // resumes from the cursor of the DFS parent of uparent
+                if (gp_IsNotEdge(theGraph, e))
+                    continue;
+
+                // Otherwise, the cursor is saved and e leads to a new DFS child u
+                sp_Push2(theStack, uparent, e);
+            }
+
+            _gp_LogLine(_gp_MakeLogStr3("V=%d, DFI=%d, Parent=%d", u, DFI, uparent));
+
+            gp_SetVisited(theGraph, u);
+            gp_SetIndex(theGraph, u, DFI);
+            gp_SetVertexParent(theGraph, u, uparent);
+            if (computeLeastAncestors)
+                gp_SetVertexLeastAncestor(theGraph, u, DFI);
+            DFI++;
+
+            if (gp_IsEdge(theGraph, e))
+            {
+                gp_SetEdgeType(theGraph, e, EDGE_TYPE_CHILD);
+                gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_PARENT);
+            }
+
+            sp_Push2(theStack, u, NIL);
+        }
+    }
+
+    theGraph->graphFlags |= GRAPHFLAGS_DFSNUMBERED;
+
+    return OK;
+}
+
+/********************************************************************
+ _ComputeLeastAncestorsFromEdgeTypes()
+
+ For a graph sorted by DFI, sets the least ancestor of each vertex
+ from the back edge records in its adjacency list.
+ ********************************************************************/
+
+void _ComputeLeastAncestorsFromEdgeTypes(graphP theGraph)
+{
+    graphInt v, e, leastAncestor;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        leastAncestor = v;
+
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            if (gp_GetEdgeType(theGraph, e) == EDGE_TYPE_BACK &&
+                leastAncestor > gp_GetNeighbor(theGraph, e))
+                leastAncestor = gp_GetNeighbor(theGraph, e);
+
+            e = gp_GetNextEdge(theGraph, e);
+        }
+
+        gp_SetVertexLeastAncestor(theGraph, v, leastAncestor);
+    }
+}
+
 /********************************************************************
  gp_CountConnectedComponents()
 
@@ -576,9 +785,9 @@ int gp_ComputeLeastAncestors(graphP theGraph)
  the number of connected components identified by DFS tree roots.
  Returns -1 on error, such as a NULL graph or DFS tree not created yet.
  ********************************************************************/
-int gp_CountConnectedComponents(graphP theGraph)
+graphInt gp_CountConnectedComponents(graphP theGraph)
 {
-    int v, connectedComponents;
+    graphInt v, connectedComponents;
 
     if (theGraph == NULL)
         return -1;
@@ -593,6 +802,289 @@ int gp_CountConnectedComponents(graphP theGraph)
     return connectedComponents;
 }
 
+/********************************************************************
+ gp_LabelConnectedComponents()
+
+ Labels each vertex v of theGraph with the number of the connected
+ component that contains it, in componentOf[v - gp_LowerBoundVertices()],
+ which must have room for N labels. The components are numbered from 0
+ in ascending order of their least vertex, which is the order in which
+ gp_DepthFirstSearch() would find their DFS tree roots, so component
+ number i contains the vertices of the i-th DFS tree.
+
+ Unlike gp_CountConnectedComponents(), this method does not need, and
+ does not create, a DFS tree, so the graph is not otherwise changed.
+ The stack is used and left empty.
+
+ Returns the number of connected components, or -1 on error, such as
+ a NULL graph or array.
+ ********************************************************************/
+graphInt gp_LabelConnectedComponents(graphP theGraph, graphInt *componentOf)
+{
+    stackP theStack;
+    graphInt v, u, e, w, connectedComponents;
+    graphInt lowerBound;
+
+    if (theGraph == NULL || componentOf == NULL)
+        return -1;
+
+    theStack = theGraph->theStack;
+    lowerBound = gp_LowerBoundVertices(theGraph);
+
+    // Each vertex is pushed at most once
+    if (sp_GetCapacity(theStack) < gp_GetN(theGraph))
+        return -1;
+
+    sp_ClearStack(theStack);
+
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+        componentOf[v - lowerBound] = -1;
+
+    connectedComponents = 0;
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        if (componentOf[v - lowerBound] != -1)
+            continue;
+
+        // Label all of the vertices reachable from the least unlabeled vertex
+        componentOf[v - lowerBound] = connectedComponents;
+        sp_Push(theStack, v);
+        while (sp_NonEmpty(theStack))
+        {
+            sp_Pop(theStack, u);
+
+            e = gp_GetFirstEdge(theGraph, u);
+            while (gp_IsEdge(theGraph, e))
+            {
+                w = gp_GetNeighbor(theGraph, e);
+                if (componentOf[w - lowerBound] == -1)
+                {
+                    componentOf[w - lowerBound] = connectedComponents;
+                    sp_Push(theStack, w);
+                }
+
+                e = gp_GetNextEdge(theGraph, e);
+            }
+        }
+
+        connectedComponents++;
+    }
+
+    return connectedComponents;
+}
+
+/********************************************************************
+ gp_ComputeBiconnectedComponents()
+
+ Finds the blocks (biconnected components) of theGraph and the
+ block-cut tree that joins them at the cut vertices, as described
+ for blockCutTreeStruct in graphDFSUtils.h, in linear time.
+
+ A block is a maximal set of edges in which every two edges lie on a
+ common simple cycle, together with the endpoints of those edges, so
+ each edge is in exactly one block, and a vertex is in more than one
+ block if and only if it is a cut vertex. A vertex with no edges is
+ given a block of its own, with no edges, so every vertex is in a block.
+
+ The blocks are found by a depth first search, with the lowpoints of
+ Hopcroft and Tarjan, which starts from the least vertex of each
+ connected component. Each block is numbered as it is completed, so
+ the blocks of each DFS subtree are numbered before the block that
+ attaches the subtree to the rest of the component. Hence, the parent
+ of a block in the block-cut tree has a greater number than the block.
+ The first vertex of each block is its least DFI vertex, and the other
+ vertices follow in no particular order.
+
+ Like gp_LabelConnectedComponents(), this method does not create a DFS
+ tree in theGraph, which is not changed.
+
+ On success, *pBlockCutTree receives a block-cut tree that must be
+ freed with gp_FreeBlockCutTree(), and the number of blocks is returned.
+ Returns -1 on error, such as a NULL graph or pointer.
+ ********************************************************************/
+graphInt gp_ComputeBiconnectedComponents(graphP theGraph, blockCutTreeP *pBlockCutTree)
+{
+    blockCutTreeP theTree = NULL;
+    graphInt N, lowerBound, *dfiOf = NULL, *lowOf = NULL, *cursorOf = NULL, *parentEdgeOf = NULL;
+    graphInt *vertexStack = NULL, *edgeStack = NULL, *blockMarkOf = NULL;
+    graphInt r, v, u, w, e, eTop, nextDFI, vertexStackSize, edgeStackSize, numVertices, numEdges, B;
+
+    if (theGraph == NULL || pBlockCutTree == NULL)
+        return -1;
+
+    *pBlockCutTree = NULL;
+    N = gp_GetN(theGraph);
+    lowerBound = gp_LowerBoundVertices(theGraph);
+
+    if ((theTree = (blockCutTreeP)calloc(1, sizeof(blockCutTreeStruct))) == NULL ||
+        (theTree->blockStart = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (theTree->blockVertices = (graphInt *)malloc((2 * N + 1) * sizeof(graphInt))) == NULL ||
+        (theTree->edgeStart = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (theTree->blockEdges = (graphInt *)malloc((gp_GetM(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (theTree->parentBlockOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (theTree->blockCountOf = (graphInt *)calloc(N + 1, sizeof(graphInt))) == NULL ||
+        (dfiOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (lowOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (cursorOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (parentEdgeOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (vertexStack = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL ||
+        (edgeStack = (graphInt *)malloc((gp_GetM(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (blockMarkOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL)
+    {
+        gp_FreeBlockCutTree(&theTree);
+        free(dfiOf);
+        free(lowOf);
+        free(cursorOf);
+        free(parentEdgeOf);
+        free(vertexStack);
+        free(edgeStack);
+        free(blockMarkOf);
+        return -1;
+    }
+
+    for (v = 0; v < N; v++)
+    {
+        dfiOf[v] = -1;
+        blockMarkOf[v] = -1;
+        theTree->parentBlockOf[v] = -1;
+    }
+
+    nextDFI = numVertices = numEdges = B = edgeStackSize = 0;
+    theTree->blockStart[0] = theTree->edgeStart[0] = 0;
+
+    for (r = lowerBound; r < gp_UpperBoundVertices(theGraph); ++r)
+    {
+        if (dfiOf[r - lowerBound] != -1)
+            continue;
+
+        dfiOf[r - lowerBound] = lowOf[r - lowerBound] = nextDFI++;
+        parentEdgeOf[r - lowerBound] = NIL;
+
+        // A vertex with no edges is a block by itself
+        if (gp_IsNotEdge(theGraph, gp_GetFirstEdge(theGraph, r)))
+        {
+            theTree->blockVertices[numVertices++] = r - lowerBound;
+            theTree->blockCountOf[r - lowerBound] = 1;
+            theTree->blockStart[++B] = numVertices;
+            theTree->edgeStart[B] = numEdges;
+            continue;
+        }
+
+        cursorOf[r - lowerBound] = gp_GetFirstEdge(theGraph, r);
+        vertexStack[0] = r;
+        vertexStackSize = 1;
+
+        while (vertexStackSize > 0)
+        {
+            v = vertexStack[vertexStackSize - 1];
+            e = cursorOf[v - lowerBound];
+
+            // Advance along the adjacency list of the vertex on top of the stack
+            if (gp_IsEdge(theGraph, e))
+            {
+                cursorOf[v - lowerBound] = gp_GetNextEdge(theGraph, e);
+
+                // The tree edge to the DFS parent was pushed by the parent
+                if (gp_IsEdge(theGraph, parentEdgeOf[v - lowerBound]) &&
+                    e == gp_GetTwin(theGraph, parentEdgeOf[v - lowerBound]))
+                    continue;
+
+                w = gp_GetNeighbor(theGraph, e);
+                if (dfiOf[w - lowerBound] == -1)
+                {
+                    edgeStack[edgeStackSize++] = e;
+                    parentEdgeOf[w - lowerBound] = e;
+                    dfiOf[w - lowerBound] = lowOf[w - lowerBound] = nextDFI++;
+                    cursorOf[w - lowerBound] = gp_GetFirstEdge(theGraph, w);
+                    vertexStack[vertexStackSize++] = w;
+                }
+
+                // A back edge is pushed from its descendant endpoint only
+                else if (dfiOf[w - lowerBound] < dfiOf[v - lowerBound])
+                {
+                    edgeStack[edgeStackSize++] = e;
+                    if (lowOf[v - lowerBound] > dfiOf[w - lowerBound])
+                        lowOf[v - lowerBound] = dfiOf[w - lowerBound];
+                }
+
+                continue;
+            }
+
+            // Once v is finished, its lowpoint is folded into its DFS parent u,
+            // and if no back edge from the DFS subtree of v reaches above u,
+            // then the edges pushed since the tree edge (u, v) form a block
+            vertexStackSize--;
+            if (gp_IsNotEdge(theGraph, parentEdgeOf[v - lowerBound]))
+                continue;
+
+            u = gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, parentEdgeOf[v - lowerBound]));
+            if (lowOf[u - lowerBound] > lowOf[v - lowerBound])
+                lowOf[u - lowerBound] = lowOf[v - lowerBound];
+
+            if (lowOf[v - lowerBound] < dfiOf[u - lowerBound])
+                continue;
+
+            theTree->blockVertices[numVertices++] = u - lowerBound;
+            theTree->blockCountOf[u - lowerBound]++;
+            blockMarkOf[u - lowerBound] = B;
+
+            do
+            {
+                eTop = edgeStack[--edgeStackSize];
+                theTree->blockEdges[numEdges++] = eTop;
+
+                // Each vertex other than u enters the block by its tree edge
+                w = gp_GetNeighbor(theGraph, eTop);
+                if (blockMarkOf[w - lowerBound] != B)
+                {
+                    theTree->blockVertices[numVertices++] = w - lowerBound;
+                    theTree->blockCountOf[w - lowerBound]++;
+                    theTree->parentBlockOf[w - lowerBound] = B;
+                    blockMarkOf[w - lowerBound] = B;
+                }
+            } while (eTop != parentEdgeOf[v - lowerBound]);
+
+            theTree->blockStart[++B] = numVertices;
+            theTree->edgeStart[B] = numEdges;
+        }
+    }
+
+    theTree->numBlocks = B;
+    *pBlockCutTree = theTree;
+
+    free(dfiOf);
+    free(lowOf);
+    free(cursorOf);
+    free(parentEdgeOf);
+    free(vertexStack);
+    free(edgeStack);
+    free(blockMarkOf);
+
+    return B;
+}
+
+/********************************************************************
+ gp_FreeBlockCutTree()
+
+ Frees a block-cut tree made by gp_ComputeBiconnectedComponents(),
+ and sets *pBlockCutTree to NULL.
+ ********************************************************************/
+void gp_FreeBlockCutTree(blockCutTreeP *pBlockCutTree)
+{
+    if (pBlockCutTree == NULL || *pBlockCutTree == NULL)
+        return;
+
+    free((*pBlockCutTree)->blockStart);
+    free((*pBlockCutTree)->blockVertices);
+    free((*pBlockCutTree)->edgeStart);
+    free((*pBlockCutTree)->blockEdges);
+    free((*pBlockCutTree)->parentBlockOf);
+    free((*pBlockCutTree)->blockCountOf);
+    free(*pBlockCutTree);
+
+    *pBlockCutTree = NULL;
+}
+
 /********************************************************************
  gp_GetParent()
 
@@ -601,7 +1093,7 @@ int gp_CountConnectedComponents(graphP theGraph)
  for a DFS tree root, which has no DFS parent. Also returns NIL on
  error, such as invalid parameters or DFS tree not created yet.
  ********************************************************************/
-int gp_GetParent(graphP theGraph, int v)
+graphInt gp_GetParent(graphP theGraph, graphInt v)
 {
     if (theGraph == NULL ||
         v < gp_LowerBoundVertices(theGraph) || v >= gp_UpperBoundVertices(theGraph))
@@ -622,7 +1114,7 @@ int gp_GetParent(graphP theGraph, int v)
  This method returns the visited index of the given vertex v.
  Returns NIL on error, such as invalid parameters.
  ********************************************************************/
-int gp_GetVisitedIndex(graphP theGraph, int v)
+graphInt gp_GetVisitedIndex(graphP theGraph, graphInt v)
 {
     if (theGraph == NULL ||
         v < gp_LowerBoundVertices(theGraph) || v >= gp_UpperBoundVertices(theGraph))
@@ -646,7 +1138,7 @@ int gp_GetVisitedIndex(graphP theGraph, int v)
  given vertex v. Returns NIL on error, such as invalid parameters
  or least ancestor values not computed yet.
  ********************************************************************/
-int gp_GetLeastAncestor(graphP theGraph, int v)
+graphInt gp_GetLeastAncestor(graphP theGraph, graphInt v)
 {
     if (theGraph == NULL ||
         v < gp_LowerBoundVertices(theGraph) || v >= gp_UpperBoundVertices(theGraph))
@@ -668,7 +1160,7 @@ int gp_GetLeastAncestor(graphP theGraph, int v)
  returns the lowpoint value for the given vertex v. Returns NIL on
  error, such as invalid parameters or lowpoints not computed yet.
  ********************************************************************/
-int gp_GetLowpoint(graphP theGraph, int v)
+graphInt gp_GetLowpoint(graphP theGraph, graphInt v)
 {
     if (theGraph == NULL ||
         v < gp_LowerBoundVertices(theGraph) || v >= gp_UpperBoundVertices(theGraph))
@@ -45,14 +45,56 @@ extern "C"
         int gp_ComputeLowpoints(graphP theGraph);
         int gp_ComputeLeastAncestors(graphP theGraph);
 
+// The what flags of gp_ComputeDFSInfo(), which computes the requested subset
+// of the results of the four methods above with fewer passes over the graph.
+// Least ancestors and lowpoints imply sorting, which implies DFS numbering.
+#define DFSINFO_DFSNUMBERING 1
+#define DFSINFO_SORTBYDFI 2
+#define DFSINFO_LEASTANCESTORS 4
+#define DFSINFO_LOWPOINTS 8
+#define DFSINFO_ALL (DFSINFO_DFSNUMBERING | DFSINFO_SORTBYDFI | DFSINFO_LEASTANCESTORS | DFSINFO_LOWPOINTS)
+
+        int gp_ComputeDFSInfo(graphP theGraph, unsigned what);
+
+        // Labels the vertices with the connected components that contain them,
+        // without creating a DFS tree (see gp_CountConnectedComponents() below)
+        graphInt gp_LabelConnectedComponents(graphP theGraph, graphInt *componentOf);
+
+        // The blocks (biconnected components) of a graph, which with its cut
+        // vertices are the nodes of its block-cut tree, as computed without
+        // creating a DFS tree by gp_ComputeBiconnectedComponents() below.
+        // All arrays are indexed from 0, and each vertex v is given by its
+        // offset v - gp_LowerBoundVertices(), both as an index and as a value
+        // in blockVertices. Block B has the vertices
+        // blockVertices[blockStart[B]] to blockVertices[blockStart[B+1] - 1]
+        // and the edges blockEdges[edgeStart[B]] to blockEdges[edgeStart[B+1] - 1],
+        // each given by one of its edge records. The first vertex of a block is
+        // the one through which it is attached to its parent in the block-cut
+        // tree, and parentBlockOf[v] is the block through which v is attached to
+        // its parent, or -1 if v is the root of its connected component.
+        // Vertex v is a cut vertex if and only if blockCountOf[v] > 1.
+        typedef struct blockCutTreeStruct blockCutTreeStruct;
+        typedef blockCutTreeStruct *blockCutTreeP;
+
+        struct blockCutTreeStruct
+        {
+                graphInt numBlocks;
+                graphInt *blockStart, *blockVertices;
+                graphInt *edgeStart, *blockEdges;
+                graphInt *parentBlockOf, *blockCountOf;
+        };
+
+        graphInt gp_ComputeBiconnectedComponents(graphP theGraph, blockCutTreeP *pBlockCutTree);
+        void gp_FreeBlockCutTree(blockCutTreeP *pBlockCutTree);
+
         // Additional DFS-related uitility methods (functions and macros) that assume
         // one or more of the above methods have been called to create a DFS tree,
         // sort vertices and/or compute least ancestor and lowpoint values
-        int gp_CountConnectedComponents(graphP theGraph);
-        int gp_GetParent(graphP theGraph, int v);
-        int gp_GetVisitedIndex(graphP theGraph, int v);
-        int gp_GetLeastAncestor(graphP theGraph, int v);
-        int gp_GetLowpoint(graphP theGraph, int v);
+        graphInt gp_CountConnectedComponents(graphP theGraph);
+        graphInt gp_GetParent(graphP theGraph, graphInt v);
+        graphInt gp_GetVisitedIndex(graphP theGraph, graphInt v);
+        graphInt gp_GetLeastAncestor(graphP theGraph, graphInt v);
+        graphInt gp_GetLowpoint(graphP theGraph, graphInt v);
 
 // A DFS tree root is one that has no DFS parent. There is one DFS tree root
 // per connected component of a graph (connected, not biconnected; component, not bicomp)
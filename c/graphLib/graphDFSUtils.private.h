@@ -36,7 +36,11 @@ extern "C"
 
     struct DFSUtils_VertexInfo
     {
-        int parent, leastAncestor, lowpoint, visitedIndex;
+#ifdef USE_HOT_VERTEX_INFO
+        graphIndex parent, lowpoint;
+#else
+        graphIndex parent, leastAncestor, lowpoint, visitedIndex;
+#endif
     };
 
     typedef struct DFSUtils_VertexInfo DFSUtils_VertexInfo;
@@ -49,14 +53,24 @@ extern "C"
 #define _gp_IsNotDFSTreeRoot(theGraph, v) gp_IsVertex(theGraph, gp_GetVertexParent(theGraph, v))
 #define _gp_GetVertexFromBicompRoot(theGraph, R) gp_GetVertexParent(theGraph, gp_GetDFSChildFromBicompRoot(theGraph, R))
 
-#define gp_GetVertexLeastAncestor(theGraph, v) (theGraphDVI(theGraph)[v].leastAncestor)
-#define gp_SetVertexLeastAncestor(theGraph, v, theLeastAncestor) (theGraphDVI(theGraph)[v].leastAncestor = theLeastAncestor)
+// If USE_HOT_VERTEX_INFO is defined, then the leastAncestor and visitedIndex
+// are in the external face link record of the vertex (see extFaceLinkRec in
+// graphPlanarity.private.h), so these two accessors can only be used where
+// that record is defined.
+#ifdef USE_HOT_VERTEX_INFO
+#define _gp_DFSHotVertexInfo(theGraph, v) (theGraphExtFace(theGraph)[v])
+#else
+#define _gp_DFSHotVertexInfo(theGraph, v) (theGraphDVI(theGraph)[v])
+#endif
+
+#define gp_GetVertexLeastAncestor(theGraph, v) (_gp_DFSHotVertexInfo(theGraph, v).leastAncestor)
+#define gp_SetVertexLeastAncestor(theGraph, v, theLeastAncestor) (_gp_DFSHotVertexInfo(theGraph, v).leastAncestor = theLeastAncestor)
 
 #define gp_GetVertexLowpoint(theGraph, v) (theGraphDVI(theGraph)[v].lowpoint)
 #define gp_SetVertexLowpoint(theGraph, v, theLowpoint) (theGraphDVI(theGraph)[v].lowpoint = theLowpoint)
 
-#define gp_GetVertexVisitedIndex(theGraph, v) (theGraphDVI(theGraph)[v].visitedIndex)
-#define gp_SetVertexVisitedIndex(theGraph, v, newVisitedIndex) (theGraphDVI(theGraph)[v].visitedIndex = newVisitedIndex)
+#define gp_GetVertexVisitedIndex(theGraph, v) (_gp_DFSHotVertexInfo(theGraph, v).visitedIndex)
+#define gp_SetVertexVisitedIndex(theGraph, v, newVisitedIndex) (_gp_DFSHotVertexInfo(theGraph, v).visitedIndex = newVisitedIndex)
 
 #ifdef __cplusplus
 }
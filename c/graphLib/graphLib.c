@@ -15,7 +15,7 @@ See the LICENSE.TXT file for licensing information.
 
 const char *gp_GetProjectVersionFull(void)
 {
-    static char projectVersionStr[MAXLINE + 1];
+    static GP_THREAD_LOCAL char projectVersionStr[MAXLINE + 1];
     sprintf(projectVersionStr, "%d.%d.%d.%d",
             GP_PROJECTVERSION_MAJOR,
             GP_PROJECTVERSION_MINOR,
@@ -31,7 +31,7 @@ const char *gp_GetProjectVersionFull(void)
 
 const char *gp_GetLibPlanarityVersionFull(void)
 {
-    static char libPlanarityVersionStr[MAXLINE + 1];
+    static GP_THREAD_LOCAL char libPlanarityVersionStr[MAXLINE + 1];
     sprintf(libPlanarityVersionStr, "%d:%d:%d",
             GP_LIBPLANARITYVERSION_CURRENT,
             GP_LIBPLANARITYVERSION_REVISION,
@@ -38,10 +38,23 @@ extern "C"
 // Public APIs for extensions to the edge addition planarity algorithm
 #include "planarityRelated/graphOuterplanarity.h"
 #include "planarityRelated/graphDrawPlanar.h"
+#include "planarityRelated/graphMaximalPlanarSubgraph.h"
 #include "homeomorphSearch/graphK23Search.h"
 #include "homeomorphSearch/graphK33Search.h"
 #include "homeomorphSearch/graphK4Search.h"
 
+    // Concurrency: if GP_THREADSAFE is defined (see appconst.h), different
+    // threads may call the graph library at the same time, provided that no
+    // graph is used by more than one thread at a time. A graph, including its
+    // extensions, holds all of the state of an algorithm run on it, so any
+    // number of threads can each embed their own graphs. The state that is not
+    // kept in a graph is either per thread, i.e. the quiet mode, the random
+    // number generator (see gp_SetRandomSeed()) and the version strings, or is
+    // shared and changed atomically, i.e. the moduleID of each extension, which
+    // is assigned when the extension is first added to any graph. The source
+    // graph of gp_CopyGraph() is not changed, so many threads can copy the
+    // same graph at once, as long as no thread changes it.
+
     // This is the main location for the project and shared library version numbering.
     // Changes here must be mirrored in configure.ac
     //
@@ -11,29 +11,29 @@ See the LICENSE.TXT file for licensing information.
 
 extern void _ClearAllVisitedFlagsInGraph(graphP);
 
-extern int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink);
-extern int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns);
+extern int _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink);
+extern int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns);
 extern int _JoinBicomps(graphP theGraph);
 
 extern int _MarkHighestXYPath(graphP theGraph);
 
-extern int _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex, int *pAncestor, int *pDescendant);
-extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescendant);
-extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor, int SubtreeRoot, int *pDescendant);
+extern int _FindUnembeddedEdgeToAncestor(graphP theGraph, graphInt cutVertex, graphInt *pAncestor, graphInt *pDescendant);
+extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex, graphInt *pDescendant);
+extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, graphInt ancestor, graphInt SubtreeRoot, graphInt *pDescendant);
 
-extern int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert);
+extern int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert);
 
-extern int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant);
+extern int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
 
 extern int _DeleteUnmarkedVerticesAndEdges(graphP theGraph);
 
-extern int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R);
+extern int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, graphInt v, graphInt R);
 extern int _IsolateOuterplanarityObstructionA(graphP theGraph);
 extern int _IsolateOuterplanarityObstructionB(graphP theGraph);
 
 /* Private function declarations for K_{2,3} searching */
 
-int _SearchForK23InBicomp(graphP theGraph, int v, int R);
+int _SearchForK23InBicomp(graphP theGraph, graphInt v, graphInt R);
 int _IsolateOuterplanarityObstructionE1orE2(graphP theGraph);
 int _IsolateOuterplanarityObstructionE3orE4(graphP theGraph);
 
@@ -41,10 +41,11 @@ int _IsolateOuterplanarityObstructionE3orE4(graphP theGraph);
  _SearchForK23InBicomp()
  ****************************************************************************/
 
-int _SearchForK23InBicomp(graphP theGraph, int v, int R)
+int _SearchForK23InBicomp(graphP theGraph, graphInt v, graphInt R)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int X, Y, XPrevLink, YPrevLink;
+    graphInt X, Y;
+    int XPrevLink, YPrevLink;
 
     /* Begin by determining whether minor A, B or E is detected */
 
@@ -68,7 +69,7 @@ int _SearchForK23InBicomp(graphP theGraph, int v, int R)
         }
         else if (theGraphIC(theGraph)->minorType & MINORTYPE_B)
         {
-            int SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
+            graphInt SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
 
             if (_FindUnembeddedEdgeToSubtree(theGraph, IC->v, SubtreeRoot, &IC->dw) != TRUE)
                 return NOTOK;
@@ -205,7 +206,7 @@ int _IsolateOuterplanarityObstructionE1orE2(graphP theGraph)
 int _IsolateOuterplanarityObstructionE3orE4(graphP theGraph)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int u, d, XorY;
+    graphInt u, d, XorY;
 
     // Minor E3
     gp_UpdateVertexFuturePertinentChild(theGraph, theGraphIC(theGraph)->x, theGraphIC(theGraph)->v);
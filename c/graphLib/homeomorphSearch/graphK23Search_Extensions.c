@@ -12,17 +12,17 @@ See the LICENSE.TXT file for licensing information.
 // Need to save and restore a graph flag related to IO
 #include "../io/graphIO.h"
 
-extern int _SearchForK23InBicomp(graphP theGraph, int v, int R);
+extern int _SearchForK23InBicomp(graphP theGraph, graphInt v, graphInt R);
 
-extern int _TestForK23GraphObstruction(graphP theGraph, int *degrees, int *imageVerts);
+extern int _TestForK23GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts);
 extern int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
-                             int *imageVerts, int maxNumImageVerts);
+                             graphInt *imageVerts, int maxNumImageVerts);
 extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
 /* Forward declarations of overloading functions */
 
-int _K23Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-int _K23Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
+int _K23Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+int _K23Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
 int _K23Search_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
 int _K23Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 
@@ -154,7 +154,7 @@ void _K23Search_FreeContext(void *pContext)
 /********************************************************************
  ********************************************************************/
 
-int _K23Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
+int _K23Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
 {
     if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK23)
     {
@@ -189,7 +189,7 @@ int _K23Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R
 /********************************************************************
  ********************************************************************/
 
-int _K23Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
+int _K23Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
 {
     int savedEmbedFlags = 0, savedZEROBASEDIO = 0;
 
@@ -261,7 +261,8 @@ int _K23Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph)
     // the original graph and that it contains a K2,3 homeomorph
     if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK23)
     {
-        int degrees[4], imageVerts[5];
+        int degrees[4];
+        graphInt imageVerts[5];
 
         if (_TestSubgraph(theGraph, origGraph) != TRUE)
             return NOTOK;
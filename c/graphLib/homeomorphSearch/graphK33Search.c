@@ -10,38 +10,38 @@ See the LICENSE.TXT file for licensing information.
 /* Imported functions */
 
 // extern void _ClearAllVisitedFlagsInGraph(graphP);
-extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot);
-extern int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, int BicompRoot);
+extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
+extern int _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, graphInt BicompRoot);
 extern void _ClearEdgeVisitedFlagsInUnembeddedEdges(graphP theGraph);
-extern int _FillVertexVisitedIndexesInBicomp(graphP theGraph, int BicompRoot, int FillValue);
+extern int _FillVertexVisitedIndexesInBicomp(graphP theGraph, graphInt BicompRoot, graphInt FillValue);
 
 // extern int  _GetBicompSize(graphP theGraph, int BicompRoot);
-extern int _HideInternalEdges(graphP theGraph, int vertex);
-extern int _RestoreInternalEdges(graphP theGraph, int stackBottom);
-extern int _ClearInvertedFlagsInBicomp(graphP theGraph, int BicompRoot);
-extern int _ComputeEdgeRecordType(graphP theGraph, int a, int b, int edgeType);
-extern int _RestoreEdgeType(graphP theGraph, int u, int v);
+extern int _HideInternalEdges(graphP theGraph, graphInt vertex);
+extern int _RestoreInternalEdges(graphP theGraph, graphInt stackBottom);
+extern int _ClearInvertedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
+extern int _ComputeEdgeRecordType(graphP theGraph, graphInt a, graphInt b, int edgeType);
+extern int _RestoreEdgeType(graphP theGraph, graphInt u, graphInt v);
 
-extern int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink);
+extern int _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink);
 extern int _JoinBicomps(graphP theGraph);
-extern int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns);
+extern int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns);
 extern int _OrientVerticesInEmbedding(graphP theGraph);
 // extern void _InvertVertex(graphP theGraph, int V);
-extern int _ClearAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
-extern int _SetAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
-extern int _OrientExternalFacePath(graphP theGraph, int u, int v, int w, int x);
+extern int _ClearAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
+extern int _SetAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
+extern int _OrientExternalFacePath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
 
-extern int _ChooseTypeOfNonplanarityMinor(graphP theGraph, int v, int R);
+extern int _ChooseTypeOfNonplanarityMinor(graphP theGraph, graphInt v, graphInt R);
 extern int _MarkLowestXYPath(graphP theGraph);
-extern int _IsolateKuratowskiSubgraph(graphP theGraph, int v, int R);
+extern int _IsolateKuratowskiSubgraph(graphP theGraph, graphInt v, graphInt R);
 
-extern int _GetLeastAncestorConnection(graphP theGraph, int cutVertex);
-extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescendant);
-extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor, int SubtreeRoot, int *pDescendant);
+extern int _GetLeastAncestorConnection(graphP theGraph, graphInt cutVertex);
+extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex, graphInt *pDescendant);
+extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, graphInt ancestor, graphInt SubtreeRoot, graphInt *pDescendant);
 
-extern int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert);
+extern int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert);
 
-extern int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant);
+extern int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
 
 extern int _DeleteUnmarkedVerticesAndEdges(graphP theGraph);
 
@@ -57,33 +57,33 @@ extern int _IsolateMinorE4(graphP theGraph);
 extern int _MarkDFSPathsToDescendants(graphP theGraph);
 extern int _AddAndMarkUnembeddedEdges(graphP theGraph);
 
-extern void _K33Search_InitEdgeRec(K33SearchContext *context, int e);
+extern void _K33Search_InitEdgeRec(K33SearchContext *context, graphInt e);
 
 /* Private functions for K_{3,3} searching. */
 
-int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, int v, int R);
+int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, graphInt v, graphInt R);
 
 int _RunExtraK33Tests(graphP theGraph, K33SearchContext *context);
 int _SearchForMinorE1(graphP theGraph);
 int _FinishIsolatorContextInitialization(graphP theGraph, K33SearchContext *context);
-int _SearchForDescendantExternalConnection(graphP theGraph, K33SearchContext *context, int cutVertex, int u_max);
-int _Fast_GetLeastAncestorConnection(graphP theGraph, K33SearchContext *context, int cutVertex);
-int _GetAdjacentAncestorInRange(graphP theGraph, K33SearchContext *context, int vertex,
-                                int closerAncestor, int fartherAncestor);
-int _FindExternalConnectionDescendantEndpoint(graphP theGraph, int ancestor,
-                                              int cutVertex, int *pDescendant);
-int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int *pMergeBlocker);
-int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int mergeBlocker);
+graphInt _SearchForDescendantExternalConnection(graphP theGraph, K33SearchContext *context, graphInt cutVertex, graphInt u_max);
+graphInt _Fast_GetLeastAncestorConnection(graphP theGraph, K33SearchContext *context, graphInt cutVertex);
+graphInt _GetAdjacentAncestorInRange(graphP theGraph, K33SearchContext *context, graphInt vertex,
+                                graphInt closerAncestor, graphInt fartherAncestor);
+int _FindExternalConnectionDescendantEndpoint(graphP theGraph, graphInt ancestor,
+                                              graphInt cutVertex, graphInt *pDescendant);
+int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt *pMergeBlocker);
+int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt mergeBlocker);
 
 int _TestForZtoWPath(graphP theGraph);
-int _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, int u_max);
-int _K33Search_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K33SearchContext *context, int BicompRoot);
-int _ReduceBicomp(graphP theGraph, K33SearchContext *context, int R);
-int _ReduceExternalFacePathToEdge(graphP theGraph, K33SearchContext *context, int u, int x, int edgeType);
-int _ReduceXYPathToEdge(graphP theGraph, K33SearchContext *context, int u, int x, int edgeType);
-int _RestoreReducedPath(graphP theGraph, K33SearchContext *context, int e);
+graphInt _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, graphInt u_max);
+int _K33Search_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K33SearchContext *context, graphInt BicompRoot);
+int _ReduceBicomp(graphP theGraph, K33SearchContext *context, graphInt R);
+int _ReduceExternalFacePathToEdge(graphP theGraph, K33SearchContext *context, graphInt u, graphInt x, int edgeType);
+int _ReduceXYPathToEdge(graphP theGraph, K33SearchContext *context, graphInt u, graphInt x, int edgeType);
+int _RestoreReducedPath(graphP theGraph, K33SearchContext *context, graphInt e);
 int _RestoreAndOrientReducedPaths(graphP theGraph, K33SearchContext *context);
-int _MarkStraddlingBridgePath(graphP theGraph, int u_min, int u_max, int u_d, int d);
+int _MarkStraddlingBridgePath(graphP theGraph, graphInt u_min, graphInt u_max, graphInt u_d, graphInt d);
 
 int _IsolateMinorE5(graphP theGraph);
 int _IsolateMinorE6(graphP theGraph, K33SearchContext *context);
@@ -93,7 +93,7 @@ int _IsolateMinorE7(graphP theGraph, K33SearchContext *context);
  _SearchForK33InBicomp()
  ****************************************************************************/
 
-int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, int v, int R)
+int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, graphInt v, graphInt R)
 {
     isolatorContextP IC = theGraphIC(theGraph);
     int tempResult;
@@ -234,10 +234,10 @@ int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, int v, int
 int _RunExtraK33Tests(graphP theGraph, K33SearchContext *context)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int u_max = MAX3(IC->ux, IC->uy, IC->uz);
+    graphInt u_max = MAX3(IC->ux, IC->uy, IC->uz);
 
 #ifndef USE_MERGEBLOCKER
-    int u;
+    graphInt u;
 #endif
 
     /* Case 1: If there is a pertinent or future pertinent vertex other than W
@@ -452,7 +452,8 @@ int _RunExtraK33Tests(graphP theGraph, K33SearchContext *context)
 
 int _SearchForMinorE1(graphP theGraph)
 {
-    int Z = theGraphIC(theGraph)->px, ZPrevLink = 1;
+    graphInt Z = theGraphIC(theGraph)->px;
+    int ZPrevLink = 1;
 
     Z = _GetNeighborOnExtFace(theGraph, Z, &ZPrevLink);
 
@@ -572,10 +573,10 @@ int _FinishIsolatorContextInitialization(graphP theGraph, K33SearchContext *cont
  except in constant time.
  ****************************************************************************/
 
-int _Fast_GetLeastAncestorConnection(graphP theGraph, K33SearchContext *context, int cutVertex)
+graphInt _Fast_GetLeastAncestorConnection(graphP theGraph, K33SearchContext *context, graphInt cutVertex)
 {
-    int ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
-    int child = context->VI[cutVertex].separatedDFSChildList;
+    graphInt ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
+    graphInt child = context->VI[cutVertex].separatedDFSChildList;
 
     if (gp_IsVertex(theGraph, child) && ancestor > gp_GetVertexLowpoint(theGraph, child))
         ancestor = gp_GetVertexLowpoint(theGraph, child);
@@ -591,10 +592,10 @@ int _Fast_GetLeastAncestorConnection(graphP theGraph, K33SearchContext *context,
  Returns NIL if theVertex has no such neighboring ancestor.
  ****************************************************************************/
 
-int _GetAdjacentAncestorInRange(graphP theGraph, K33SearchContext *context, int theVertex,
-                                int closerAncestor, int fartherAncestor)
+graphInt _GetAdjacentAncestorInRange(graphP theGraph, K33SearchContext *context, graphInt theVertex,
+                                graphInt closerAncestor, graphInt fartherAncestor)
 {
-    int e = context->VI[theVertex].backEdgeList;
+    graphInt e = context->VI[theVertex].backEdgeList;
 
     while (gp_IsEdge(theGraph, e))
     {
@@ -618,11 +619,11 @@ int _GetAdjacentAncestorInRange(graphP theGraph, K33SearchContext *context, int
  connection to the given cut vertex.
  ****************************************************************************/
 
-int _SearchForDescendantExternalConnection(graphP theGraph, K33SearchContext *context, int cutVertex, int u_max)
+graphInt _SearchForDescendantExternalConnection(graphP theGraph, K33SearchContext *context, graphInt cutVertex, graphInt u_max)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int u2 = _GetAdjacentAncestorInRange(theGraph, context, cutVertex, IC->v, u_max);
-    int child, descendant;
+    graphInt u2 = _GetAdjacentAncestorInRange(theGraph, context, cutVertex, IC->v, u_max);
+    graphInt child, descendant;
 
     // Test cutVertex for an external connection to descendant of u_max via direct back edge
     if (gp_IsVertex(theGraph, u2))
@@ -693,10 +694,10 @@ int _SearchForDescendantExternalConnection(graphP theGraph, K33SearchContext *co
     has already determined the existence of the descendant).
  ****************************************************************************/
 
-int _FindExternalConnectionDescendantEndpoint(graphP theGraph, int ancestor,
-                                              int cutVertex, int *pDescendant)
+int _FindExternalConnectionDescendantEndpoint(graphP theGraph, graphInt ancestor,
+                                              graphInt cutVertex, graphInt *pDescendant)
 {
-    int child, e;
+    graphInt child, e;
 
     // Check whether the cutVertex is directly adjacent to the ancestor
     // by an unembedded back edge.
@@ -748,10 +749,10 @@ int _FindExternalConnectionDescendantEndpoint(graphP theGraph, int ancestor,
          pMergeBlocker is set to NIL unless a merge blocker is found.
  ****************************************************************************/
 
-int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int *pMergeBlocker)
+int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt *pMergeBlocker)
 {
     stackP tempStack;
-    int Z;
+    graphInt Z;
 
     /* Set return result to 'not found' then return if there is no stack to inspect */
 
@@ -794,9 +795,10 @@ int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, int v, in
  Returns OK on success, NOTOK on internal function failure
  ****************************************************************************/
 
-int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int mergeBlocker)
+int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt mergeBlocker)
 {
-    int R, RPrevLink, u_max, u, e;
+    graphInt R, u_max, u, e;
+    int RPrevLink;
     isolatorContextP IC = theGraphIC(theGraph);
 
     /* First, we orient the vertices so we can successfully restore all of the
@@ -982,7 +984,7 @@ int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, int v,
 int _TestForZtoWPath(graphP theGraph)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int v, e, w;
+    graphInt v, e, w;
 
     sp_ClearStack(theGraph->theStack);
     sp_Push2(theGraph->theStack, IC->w, NIL);
@@ -1089,10 +1091,10 @@ int _TestForZtoWPath(graphP theGraph)
         bridge query is asked at most twice along any DFS tree path.
  ****************************************************************************/
 
-int _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, int u_max)
+graphInt _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, graphInt u_max)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int p, c, d, excludedChild, e;
+    graphInt p, c, d, excludedChild, e;
 
     p = IC->v;
     excludedChild = gp_GetDFSChildFromBicompRoot(theGraph, IC->r);
@@ -1114,7 +1116,7 @@ int _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, int u_m
         // in not using the separatedDFSChildList
         /*
         {
-        int c = gp_GetVertexSortedDFSChildList(theGraph, p);
+        graphInt c = gp_GetVertexSortedDFSChildList(theGraph, p);
         while (gp_IsVertex(c))
         {
             if (c != excludedChild && gp_IsSeparatedDFSChild(theGraph, c))
@@ -1206,10 +1208,10 @@ int _TestForStraddlingBridge(graphP theGraph, K33SearchContext *context, int u_m
        edges along the paths we intend to keep.
  ****************************************************************************/
 
-int _ReduceBicomp(graphP theGraph, K33SearchContext *context, int R)
+int _ReduceBicomp(graphP theGraph, K33SearchContext *context, graphInt R)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int min, max, A, A_edge, B, B_edge;
+    graphInt min, max, A, A_edge, B, B_edge;
     int rxType, xwType, wyType, yrType, xyType;
 
     /* The vertices in the bicomp need to be oriented so that functions
@@ -1423,10 +1425,10 @@ int _ReduceBicomp(graphP theGraph, K33SearchContext *context, int R)
  Returns OK on success, NOTOK on implementation failure
  ********************************************************************/
 
-int _K33Search_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K33SearchContext *context, int BicompRoot)
+int _K33Search_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K33SearchContext *context, graphInt BicompRoot)
 {
-    int V, e, eNext;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt V, e, eNext;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)context;
@@ -1455,9 +1457,10 @@ int _K33Search_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K33SearchContext *co
  _ReduceExternalFacePathToEdge()
  ****************************************************************************/
 
-int _ReduceExternalFacePathToEdge(graphP theGraph, K33SearchContext *context, int u, int x, int edgeType)
+int _ReduceExternalFacePathToEdge(graphP theGraph, K33SearchContext *context, graphInt u, graphInt x, int edgeType)
 {
-    int prevLink, v, w, e;
+    graphInt v, w, e;
+    int prevLink;
 
     /* If the path is a single edge, then no need for a reduction */
 
@@ -1534,9 +1537,9 @@ int _ReduceExternalFacePathToEdge(graphP theGraph, K33SearchContext *context, in
  _ReduceXYPathToEdge()
  ****************************************************************************/
 
-int _ReduceXYPathToEdge(graphP theGraph, K33SearchContext *context, int u, int x, int edgeType)
+int _ReduceXYPathToEdge(graphP theGraph, K33SearchContext *context, graphInt u, graphInt x, int edgeType)
 {
-    int e, v, w;
+    graphInt e, v, w;
 
     e = gp_GetFirstEdge(theGraph, u);
     e = gp_GetNextEdge(theGraph, e);
@@ -1604,10 +1607,10 @@ int _ReduceXYPathToEdge(graphP theGraph, K33SearchContext *context, int u, int x
  return OK on success, NOTOK on failure
  ****************************************************************************/
 
-int _RestoreReducedPath(graphP theGraph, K33SearchContext *context, int e)
+int _RestoreReducedPath(graphP theGraph, K33SearchContext *context, graphInt e)
 {
-    int eTwin, u, v, w, x;
-    int e0, e1, eTwin0, eTwin1;
+    graphInt eTwin, u, v, w, x;
+    graphInt e0, e1, eTwin0, eTwin1;
 
     // Edge e does not represent a reducible path unless it has a
     // pathConnect vertex (i.e., a non-NIL value indicating the vertex)
@@ -1688,8 +1691,9 @@ int _RestoreReducedPath(graphP theGraph, K33SearchContext *context, int e)
 
 int _RestoreAndOrientReducedPaths(graphP theGraph, K33SearchContext *context)
 {
-    int e, eTwin, u, v, w, x, visited;
-    int e0, eTwin0, e1, eTwin1;
+    graphInt e, eTwin, u, v, w, x;
+    int visited;
+    graphInt e0, eTwin0, e1, eTwin1;
 
     for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph);)
     {
@@ -1798,10 +1802,10 @@ int _RestoreAndOrientReducedPaths(graphP theGraph, K33SearchContext *context)
  _MarkStraddlingBridgePath()
  ****************************************************************************/
 
-int _MarkStraddlingBridgePath(graphP theGraph, int u_min, int u_max, int u_d, int d)
+int _MarkStraddlingBridgePath(graphP theGraph, graphInt u_min, graphInt u_max, graphInt u_d, graphInt d)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int p, e;
+    graphInt p, e;
 
     /* Find the point of intersection p between the path (v ... u_max)
            and the path (d ... u_max). */
@@ -1912,7 +1916,7 @@ int _IsolateMinorE5(graphP theGraph)
 int _IsolateMinorE6(graphP theGraph, K33SearchContext *context)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int u_min, u_max, d, u_d;
+    graphInt u_min, u_max, d, u_d;
 
     /* Clear the previously marked x-y path */
 
@@ -1958,7 +1962,7 @@ int _IsolateMinorE6(graphP theGraph, K33SearchContext *context)
 int _IsolateMinorE7(graphP theGraph, K33SearchContext *context)
 {
     isolatorContextP IC = theGraphIC(theGraph);
-    int u_min, u_max, d, u_d;
+    graphInt u_min, u_max, d, u_d;
 
     /* Mark the appropriate two portions of the external face depending on
         symmetry condition */
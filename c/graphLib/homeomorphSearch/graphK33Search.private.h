@@ -17,7 +17,7 @@ extern "C"
     // Additional equipment for each EdgeRec
     typedef struct
     {
-        int noStraddle, pathConnector;
+        graphInt noStraddle, pathConnector;
     } K33Search_EdgeRec;
 
     typedef K33Search_EdgeRec *K33Search_EdgeRecP;
@@ -25,7 +25,7 @@ extern "C"
     // Additional equipment for each vertex (non-virtual only)
     typedef struct
     {
-        int separatedDFSChildList, backEdgeList, mergeBlocker;
+        graphInt separatedDFSChildList, backEdgeList, mergeBlocker;
     } K33Search_VertexInfo;
 
     typedef K33Search_VertexInfo *K33Search_VertexInfoP;
@@ -47,7 +47,7 @@ extern "C"
         // Storage for the separatedDFSChildLists, and
         // to help with linear time sorting of same by lowpoints
         listCollectionP separatedDFSChildLists;
-        int *buckets;
+        graphInt *buckets;
         listCollectionP bin;
 
         // Overloaded function pointers
@@ -12,22 +12,22 @@ See the LICENSE.TXT file for licensing information.
 // Need to save and restore a graph flag related to IO
 #include "../io/graphIO.h"
 
-extern int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int *pMergeBlocker);
-extern int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, int v, int mergeBlocker);
-extern int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, int v, int R);
+extern int _SearchForMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt *pMergeBlocker);
+extern int _FindK33WithMergeBlocker(graphP theGraph, K33SearchContext *context, graphInt v, graphInt mergeBlocker);
+extern int _SearchForK33InBicomp(graphP theGraph, K33SearchContext *context, graphInt v, graphInt R);
 
-extern int _TestForK33GraphObstruction(graphP theGraph, int *degrees, int *imageVerts);
+extern int _TestForK33GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts);
 extern int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
-                             int *imageVerts, int maxNumImageVerts);
+                             graphInt *imageVerts, int maxNumImageVerts);
 extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
 /* Forward declarations of local functions */
 
 void _K33Search_ClearStructures(K33SearchContext *context);
 int _K33Search_CreateStructures(K33SearchContext *context);
-int _K33Search_InitStructures(K33SearchContext *context);
+int _K33Search_InitStructures(K33SearchContext *context, graphInt edgeUpperBound);
 
-void _K33Search_InitEdgeRec(K33SearchContext *context, int e);
+void _K33Search_InitEdgeRec(K33SearchContext *context, graphInt e);
 void _K33Search_InitVertexInfo(K33SearchContext *context, int v);
 
 /* Forward declarations of overloading functions */
@@ -35,18 +35,19 @@ void _K33Search_InitVertexInfo(K33SearchContext *context, int v);
 int _K33Search_EmbeddingInitialize(graphP theGraph);
 void _CreateBackEdgeLists(graphP theGraph, K33SearchContext *context);
 void _CreateSeparatedDFSChildLists(graphP theGraph, K33SearchContext *context);
-void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, int W, int WPrevLink);
-int _K33Search_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink);
-void _K33Search_MergeVertex(graphP theGraph, int W, int WPrevLink, int R);
-int _K33Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-int _K33Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
-int _K33Search_DeleteEdge(graphP theGraph, int e);
+void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink);
+int _K33Search_MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink);
+void _K33Search_MergeVertex(graphP theGraph, graphInt W, int WPrevLink, graphInt R);
+int _K33Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+int _K33Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
+int _K33Search_DeleteEdge(graphP theGraph, graphInt e);
+int _K33Search_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc);
 int _K33Search_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
 int _K33Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 
-int _K33Search_EnsureVertexCapacity(graphP theGraph, int N);
+int _K33Search_EnsureVertexCapacity(graphP theGraph, graphInt N);
 void _K33Search_ResetGraphStorage(graphP theGraph);
-int _K33Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity);
+int _K33Search_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity);
 
 /* Forward declarations of functions used by the extension system */
 
@@ -119,6 +120,7 @@ int gp_ExtendWith_K33Search(graphP theGraph)
     context->functions.fpResetGraphStorage = _K33Search_ResetGraphStorage;
     context->functions.fpEnsureEdgeCapacity = _K33Search_EnsureEdgeCapacity;
     context->functions.fpDeleteEdge = _K33Search_DeleteEdge;
+    context->functions.fpMoveEdge = _K33Search_MoveEdge;
 
     _K33Search_ClearStructures(context);
 
@@ -145,7 +147,7 @@ int gp_ExtendWith_K33Search(graphP theGraph)
     if (gp_GetN(theGraph) > 0)
     {
         if (_K33Search_CreateStructures(context) != OK ||
-            _K33Search_InitStructures(context) != OK)
+            _K33Search_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         {
             _K33Search_FreeContext(context);
             context = NULL;
@@ -175,7 +177,8 @@ void _K33Search_ClearStructures(K33SearchContext *context)
     if (!context->initialized)
     {
         // Before initialization, the pointers are stray, not NULL
-        // Once NULL or allocated, free() or LCFree() can do the job
+        // Once NULL or allocated, _gp_FreeStorage() or
+        // _gp_FreeListCollection() can do the job
         context->E = NULL;
         context->VI = NULL;
 
@@ -189,22 +192,22 @@ void _K33Search_ClearStructures(K33SearchContext *context)
     {
         if (context->E != NULL)
         {
-            free(context->E);
+            _gp_FreeStorage(context->theGraph, context->E);
             context->E = NULL;
         }
         if (context->VI != NULL)
         {
-            free(context->VI);
+            _gp_FreeStorage(context->theGraph, context->VI);
             context->VI = NULL;
         }
 
-        LCFree(&context->separatedDFSChildLists);
+        _gp_FreeListCollection(context->theGraph, &context->separatedDFSChildLists);
         if (context->buckets != NULL)
         {
-            free(context->buckets);
+            _gp_FreeStorage(context->theGraph, context->buckets);
             context->buckets = NULL;
         }
-        LCFree(&context->bin);
+        _gp_FreeListCollection(context->theGraph, &context->bin);
     }
 }
 
@@ -215,17 +218,17 @@ void _K33Search_ClearStructures(K33SearchContext *context)
  ********************************************************************/
 int _K33Search_CreateStructures(K33SearchContext *context)
 {
-    int VIsize = gp_UpperBoundVertices(context->theGraph);
-    int Esize = gp_UpperBoundEdgeStorage(context->theGraph);
+    graphInt VIsize = gp_UpperBoundVertices(context->theGraph);
+    graphInt Esize = gp_UpperBoundEdgeStorage(context->theGraph);
 
     if (gp_GetN(context->theGraph) <= 0)
         return NOTOK;
 
-    if ((context->E = (K33Search_EdgeRecP)malloc(Esize * sizeof(K33Search_EdgeRec))) == NULL ||
-        (context->VI = (K33Search_VertexInfoP)malloc(VIsize * sizeof(K33Search_VertexInfo))) == NULL ||
-        (context->separatedDFSChildLists = LCNew(VIsize)) == NULL ||
-        (context->buckets = (int *)malloc(VIsize * sizeof(int))) == NULL ||
-        (context->bin = LCNew(VIsize)) == NULL)
+    if ((context->E = (K33Search_EdgeRecP)_gp_AllocStorage(context->theGraph, Esize * sizeof(K33Search_EdgeRec))) == NULL ||
+        (context->VI = (K33Search_VertexInfoP)_gp_AllocStorage(context->theGraph, VIsize * sizeof(K33Search_VertexInfo))) == NULL ||
+        (context->separatedDFSChildLists = _gp_NewListCollection(context->theGraph, VIsize)) == NULL ||
+        (context->buckets = (graphInt *)malloc(VIsize * sizeof(graphInt))) == NULL ||
+        (context->bin = _gp_NewListCollection(context->theGraph, VIsize)) == NULL)
     {
         return NOTOK;
     }
@@ -235,11 +238,13 @@ int _K33Search_CreateStructures(K33SearchContext *context)
 
 /********************************************************************
  _K33Search_InitStructures()
+ Initializes the edge records below edgeUpperBound, which is the edge
+ high water mark when the graph is reset (see gp_ResetGraphStorage()).
  ********************************************************************/
-int _K33Search_InitStructures(K33SearchContext *context)
+int _K33Search_InitStructures(K33SearchContext *context, graphInt edgeUpperBound)
 {
     memset(context->VI, NIL_CHAR, gp_UpperBoundVertices(context->theGraph) * sizeof(K33Search_VertexInfo));
-    memset(context->E, NIL_CHAR, gp_UpperBoundEdgeStorage(context->theGraph) * sizeof(K33Search_EdgeRec));
+    memset(context->E, NIL_CHAR, edgeUpperBound * sizeof(K33Search_EdgeRec));
 
     return OK;
 }
@@ -247,7 +252,7 @@ int _K33Search_InitStructures(K33SearchContext *context)
 /********************************************************************
  ********************************************************************/
 
-int _K33Search_EnsureVertexCapacity(graphP theGraph, int N)
+int _K33Search_EnsureVertexCapacity(graphP theGraph, graphInt N)
 {
     K33SearchContext *context = NULL;
     gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
@@ -263,7 +268,7 @@ int _K33Search_EnsureVertexCapacity(graphP theGraph, int N)
         theGraph->edgeCapacity = DEFAULT_EDGE_CAPACITY_FACTOR * N;
 
     if (_K33Search_CreateStructures(context) != OK ||
-        _K33Search_InitStructures(context) != OK)
+        _K33Search_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         return NOTOK;
 
     context->functions.fpEnsureVertexCapacity(theGraph, N);
@@ -281,11 +286,15 @@ void _K33Search_ResetGraphStorage(graphP theGraph)
 
     if (context != NULL)
     {
+        // Only the edge records below the edge high water mark need to be
+        // reset, and resetting the base class lowers the mark
+        graphInt edgeHighWaterMark = theGraphEdgeHighWaterMark(theGraph);
+
         // Reset the graph storage in base class(es)
         context->functions.fpResetGraphStorage(theGraph);
 
         // Do the reset that is specific to this module
-        _K33Search_InitStructures(context);
+        _K33Search_InitStructures(context, edgeHighWaterMark);
         LCReset(context->separatedDFSChildLists);
         LCReset(context->bin);
     }
@@ -295,11 +304,11 @@ void _K33Search_ResetGraphStorage(graphP theGraph)
  _K33Search_EnsureEdgeCapacity()
  ********************************************************************/
 
-int _K33Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
+int _K33Search_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity)
 {
     K33SearchContext *context = NULL;
     K33Search_EdgeRecP oldE = NULL, newE = NULL;
-    int oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
+    graphInt oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
 
     // If the requirement is already satisfied, then no work to do
     if (gp_GetEdgeCapacity(theGraph) >= requiredEdgeCapacity)
@@ -324,7 +333,7 @@ int _K33Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
     newEsize = gp_UpperBoundEdgeStorage(theGraph);
 
     // We must successfully allocate the new parallel edge array
-    newE = (K33Search_EdgeRecP)malloc(newEsize * sizeof(K33Search_EdgeRec));
+    newE = (K33Search_EdgeRecP)_gp_AllocStorage(theGraph, newEsize * sizeof(K33Search_EdgeRec));
     if (newE == NULL)
         return NOTOK;
 
@@ -336,7 +345,7 @@ int _K33Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
 
     // Set the new edge array into the context and free the old one
     context->E = newE;
-    free(oldE);
+    _gp_FreeStorage(theGraph, oldE);
 
     return OK;
 }
@@ -352,8 +361,8 @@ void *_K33Search_DupContext(void *pContext, void *theGraph)
 
     if (newContext != NULL)
     {
-        int VIsize = gp_UpperBoundVertices((graphP)theGraph);
-        int Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
+        graphInt VIsize = gp_UpperBoundVertices((graphP)theGraph);
+        graphInt Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
 
         *newContext = *context;
 
@@ -396,7 +405,7 @@ int _K33Search_CopyData(void *dstContext, void *srcContext)
 {
     K33SearchContext *dstK33Context = (K33SearchContext *)dstContext;
     K33SearchContext *srcK33Context = (K33SearchContext *)srcContext;
-    int dstEdgeStorage, srcEdgeStorage;
+    graphInt dstEdgeStorage, srcEdgeStorage, dstHighWaterMark, srcHighWaterMark;
 
     if (dstContext == NULL)
         return NOTOK;
@@ -405,7 +414,7 @@ int _K33Search_CopyData(void *dstContext, void *srcContext)
     // structures in the dstContext to be reset/reinitialized
 
     if (srcContext == NULL)
-        return _K33Search_InitStructures(dstK33Context);
+        return _K33Search_InitStructures(dstK33Context, gp_UpperBoundEdgeStorage(dstK33Context->theGraph));
 
     // ELSE: If there is also a srcContext, then we copy data from it
     dstEdgeStorage = gp_UpperBoundEdgeStorage(dstK33Context->theGraph);
@@ -416,14 +425,17 @@ int _K33Search_CopyData(void *dstContext, void *srcContext)
     if (dstEdgeStorage < srcEdgeStorage)
         return NOTOK;
 
-    // If the destination graph has more edge capacity, then we make sure that the
-    // extra edge capacity is reinitialized
-    if (dstEdgeStorage > srcEdgeStorage)
-    {
-        memset(dstK33Context->E, NIL_CHAR, gp_UpperBoundEdgeStorage(dstK33Context->theGraph) * sizeof(K33Search_EdgeRec));
-    }
+    // Only the edge records below the source graph's edge high water mark
+    // can differ from their initial state, so only they are copied. Then,
+    // the destination edge records that were changed above that mark are
+    // reinitialized (gp_CopyGraph() updates the destination mark later)
+    srcHighWaterMark = theGraphEdgeHighWaterMark(srcK33Context->theGraph);
+    dstHighWaterMark = theGraphEdgeHighWaterMark(dstK33Context->theGraph);
 
-    memcpy(dstK33Context->E, srcK33Context->E, gp_UpperBoundEdgeStorage(dstK33Context->theGraph) * sizeof(K33Search_EdgeRec));
+    memcpy(dstK33Context->E, srcK33Context->E, srcHighWaterMark * sizeof(K33Search_EdgeRec));
+
+    if (dstHighWaterMark > srcHighWaterMark)
+        memset(dstK33Context->E + srcHighWaterMark, NIL_CHAR, (dstHighWaterMark - srcHighWaterMark) * sizeof(K33Search_EdgeRec));
 
     memcpy(dstK33Context->VI, srcK33Context->VI, gp_UpperBoundVertices(dstK33Context->theGraph) * sizeof(K33Search_VertexInfo));
 
@@ -478,7 +490,7 @@ int _K33Search_EmbeddingInitialize(graphP theGraph)
  ********************************************************************/
 void _CreateBackEdgeLists(graphP theGraph, K33SearchContext *context)
 {
-    int v, e, eTwin, ancestor;
+    graphInt v, e, eTwin, ancestor;
 
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
@@ -498,8 +510,8 @@ void _CreateBackEdgeLists(graphP theGraph, K33SearchContext *context)
             }
             else
             {
-                int eHead = context->VI[ancestor].backEdgeList;
-                int eTail = gp_GetPrevEdge(theGraph, eHead);
+                graphInt eHead = context->VI[ancestor].backEdgeList;
+                graphInt eTail = gp_GetPrevEdge(theGraph, eHead);
                 gp_SetPrevEdge(theGraph, eTwin, eTail);
                 gp_SetNextEdge(theGraph, eTwin, eHead);
                 gp_SetPrevEdge(theGraph, eHead, eTwin);
@@ -522,9 +534,9 @@ void _CreateBackEdgeLists(graphP theGraph, K33SearchContext *context)
 
 void _CreateSeparatedDFSChildLists(graphP theGraph, K33SearchContext *context)
 {
-    int *buckets;
+    graphInt *buckets;
     listCollectionP bin;
-    int v, L, DFSParent, theList;
+    graphInt v, L, DFSParent, theList;
 
     buckets = context->buckets;
     bin = context->bin;
@@ -577,7 +589,7 @@ void _CreateSeparatedDFSChildLists(graphP theGraph, K33SearchContext *context)
  that list since it is now being put back into the adjacency list.
  ********************************************************************/
 
-void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, int W, int WPrevLink)
+void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink)
 {
     K33SearchContext *context = NULL;
     gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
@@ -589,7 +601,7 @@ void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int Roo
         {
             // Get the forward edge record from the adjacentTo field, and
             // use it to get the back edge record
-            int backEdgeRec = gp_GetTwin(theGraph, gp_GetVertexPertinentEdge(theGraph, W));
+            graphInt backEdgeRec = gp_GetTwin(theGraph, gp_GetVertexPertinentEdge(theGraph, W));
 
             // Remove the backEdgeRecfrom the backEdgeList
             if (context->VI[W].backEdgeList == backEdgeRec)
@@ -622,7 +634,7 @@ void _K33Search_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int Roo
           a K_{3,3} homeomorph was isolated.
  ********************************************************************/
 
-int _K33Search_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
+int _K33Search_MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink)
 {
     K33SearchContext *context = NULL;
     gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
@@ -634,7 +646,7 @@ int _K33Search_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int W
 
         if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK33)
         {
-            int mergeBlocker;
+            graphInt mergeBlocker;
 
             // We want to test all merge points on the stack
             // as well as W, since the connection will go
@@ -654,8 +666,8 @@ int _K33Search_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int W
             }
 
             // If no merge blocker was found, then remove W from the stack.
-            sp_Pop2(theGraph->theStack, W, WPrevLink);
-            sp_Pop2(theGraph->theStack, W, WPrevLink);
+            sp_Pop2_Discard(theGraph->theStack);
+            sp_Pop2_Discard(theGraph->theStack);
         }
 
         // If the merge was not blocked, then we perform the merge
@@ -677,7 +689,7 @@ int _K33Search_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int W
  Overload of merge vertex that does basic behavior but also removes
  the DFS child associated with R from the separatedDFSChildList of W.
  ********************************************************************/
-void _K33Search_MergeVertex(graphP theGraph, int W, int WPrevLink, int R)
+void _K33Search_MergeVertex(graphP theGraph, graphInt W, int WPrevLink, graphInt R)
 {
     K33SearchContext *context = NULL;
     gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
@@ -686,7 +698,7 @@ void _K33Search_MergeVertex(graphP theGraph, int W, int WPrevLink, int R)
     {
         if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK33)
         {
-            int theList = context->VI[W].separatedDFSChildList;
+            graphInt theList = context->VI[W].separatedDFSChildList;
             theList = LCDelete(context->separatedDFSChildLists, theList, gp_GetDFSChildFromBicompRoot(theGraph, R));
             context->VI[W].separatedDFSChildList = theList;
         }
@@ -698,7 +710,7 @@ void _K33Search_MergeVertex(graphP theGraph, int W, int WPrevLink, int R)
 /********************************************************************
  ********************************************************************/
 
-void _K33Search_InitEdgeRec(K33SearchContext *context, int e)
+void _K33Search_InitEdgeRec(K33SearchContext *context, graphInt e)
 {
     context->E[e].noStraddle = NIL;
     context->E[e].pathConnector = NIL;
@@ -717,7 +729,7 @@ void _K33Search_InitVertexInfo(K33SearchContext *context, int v)
 /********************************************************************
  ********************************************************************/
 
-int _K33Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
+int _K33Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
 {
     K33SearchContext *context = NULL;
 
@@ -748,7 +760,7 @@ int _K33Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R
 /********************************************************************
  ********************************************************************/
 
-int _K33Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
+int _K33Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
 {
     int savedEmbedFlags = 0, savedZEROBASEDIO = 0;
 
@@ -794,7 +806,7 @@ int _K33Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
  marked for isolation.
  ********************************************************************/
 
-int _K33Search_DeleteEdge(graphP theGraph, int e)
+int _K33Search_DeleteEdge(graphP theGraph, graphInt e)
 {
     K33SearchContext *context = NULL;
     gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
@@ -808,6 +820,27 @@ int _K33Search_DeleteEdge(graphP theGraph, int e)
     return context->functions.fpDeleteEdge(theGraph, e);
 }
 
+/********************************************************************
+ Moving an edge during gp_CompactEdgeStorage() is augmented by moving
+ the K_{3,3} search-specific data members of its edge records.
+ ********************************************************************/
+
+int _K33Search_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc)
+{
+    K33SearchContext *context = NULL;
+    gp_FindExtension(theGraph, K33SEARCH_ID, (void *)&context);
+
+    if (context == NULL)
+        return NOTOK;
+
+    context->E[eDst] = context->E[eSrc];
+    context->E[gp_GetTwin(theGraph, eDst)] = context->E[gp_GetTwin(theGraph, eSrc)];
+    _K33Search_InitEdgeRec(context, eSrc);
+    _K33Search_InitEdgeRec(context, gp_GetTwin(theGraph, eSrc));
+
+    return context->functions.fpMoveEdge(theGraph, eDst, eSrc);
+}
+
 /********************************************************************
  ********************************************************************/
 
@@ -842,7 +875,8 @@ int _K33Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph)
     // the original graph and that it contains a K3,3 homeomorph
     if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK33)
     {
-        int degrees[5], imageVerts[6];
+        int degrees[5];
+        graphInt imageVerts[6];
 
         if (_TestSubgraph(theGraph, origGraph) != TRUE)
         {
@@ -11,70 +11,70 @@ See the LICENSE.TXT file for licensing information.
 
 extern void _InitIsolatorContext(graphP theGraph);
 extern void _ClearAllVisitedFlagsInGraph(graphP);
-extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot);
+extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
 // extern int  _ClearAllVisitedFlagsInOtherBicomps(graphP theGraph, int BicompRoot);
 // extern void _ClearEdgeVisitedFlagsInUnembeddedEdges(graphP theGraph);
-extern int _ClearObstructionMarksInBicomp(graphP theGraph, int BicompRoot);
+extern int _ClearObstructionMarksInBicomp(graphP theGraph, graphInt BicompRoot);
 // extern int  _DeleteUnmarkedEdgesInBicomp(graphP theGraph, int BicompRoot);
-extern int _ComputeEdgeRecordType(graphP theGraph, int a, int b, int edgeType);
-extern int _RestoreEdgeType(graphP theGraph, int u, int v);
+extern int _ComputeEdgeRecordType(graphP theGraph, graphInt a, graphInt b, int edgeType);
+extern int _RestoreEdgeType(graphP theGraph, graphInt u, graphInt v);
 
-extern int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink);
+extern int _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink);
 extern int _JoinBicomps(graphP theGraph);
 // extern void _FindActiveVertices(graphP theGraph, int R, int *pX, int *pY);
-extern int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns);
+extern int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns);
 extern int _OrientVerticesInEmbedding(graphP theGraph);
 // extern void _InvertVertex(graphP theGraph, int V);
-extern int _ClearAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
-extern int _SetAllVisitedFlagsOnPath(graphP theGraph, int u, int v, int w, int x);
-extern int _OrientExternalFacePath(graphP theGraph, int u, int v, int w, int x);
+extern int _ClearAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
+extern int _SetAllVisitedFlagsOnPath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
+extern int _OrientExternalFacePath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
 
-extern int _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex, int *pAncestor, int *pDescendant);
-extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescendant);
-extern int _GetLeastAncestorConnection(graphP theGraph, int cutVertex);
+extern int _FindUnembeddedEdgeToAncestor(graphP theGraph, graphInt cutVertex, graphInt *pAncestor, graphInt *pDescendant);
+extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex, graphInt *pDescendant);
+extern int _GetLeastAncestorConnection(graphP theGraph, graphInt cutVertex);
 
 extern int _SetVertexTypesForMarkingXYPath(graphP theGraph);
 extern int _MarkHighestXYPath(graphP theGraph);
-extern int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert);
-extern int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant);
+extern int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert);
+extern int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
 extern int _DeleteUnmarkedVerticesAndEdges(graphP theGraph);
 
 extern int _IsolateOuterplanarityObstructionA(graphP theGraph);
 // extern int  _IsolateOuterplanarityObstructionB(graphP theGraph);
 extern int _IsolateOuterplanarityObstructionE(graphP theGraph);
 
-extern void _K4Search_InitEdgeRec(K4SearchContext *context, int e);
+extern void _K4Search_InitEdgeRec(K4SearchContext *context, graphInt e);
 
 /* Private functions for K4 searching (exposed to the extension). */
 
-int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, int v, int R);
+int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, graphInt v, graphInt R);
 
 /* Private functions for K4 searching. */
 
-int _K4_ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R);
+int _K4_ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, graphInt v, graphInt R);
 
 int _K4_FindSecondActiveVertexOnLowExtFacePath(graphP theGraph);
-int _K4_FindPlanarityActiveVertex(graphP theGraph, int v, int R, int prevLink, int *pW);
-int _K4_FindSeparatingInternalEdge(graphP theGraph, int R, int prevLink, int A, int *pW, int *pX, int *pY);
-void _K4_SetMarksOnExternalFacePath(graphP theGraph, int R, int prevLink, int A);
-void _K4_ClearMarksOnExternalFacePath(graphP theGraph, int R, int prevLink, int A);
+int _K4_FindPlanarityActiveVertex(graphP theGraph, graphInt v, graphInt R, int prevLink, graphInt *pW);
+int _K4_FindSeparatingInternalEdge(graphP theGraph, graphInt R, int prevLink, graphInt A, graphInt *pW, graphInt *pX, graphInt *pY);
+void _K4_SetMarksOnExternalFacePath(graphP theGraph, graphInt R, int prevLink, graphInt A);
+void _K4_ClearMarksOnExternalFacePath(graphP theGraph, graphInt R, int prevLink, graphInt A);
 
 int _K4_IsolateMinorA1(graphP theGraph);
 int _K4_IsolateMinorA2(graphP theGraph);
 int _K4_IsolateMinorB1(graphP theGraph);
 int _K4_IsolateMinorB2(graphP theGraph);
 
-int _K4_ReduceBicompToEdge(graphP theGraph, K4SearchContext *context, int R, int W);
-int _K4_ReducePathComponent(graphP theGraph, K4SearchContext *context, int R, int prevLink, int A);
-int _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType, int R, int e_R, int A, int e_A);
+int _K4_ReduceBicompToEdge(graphP theGraph, K4SearchContext *context, graphInt R, graphInt W);
+int _K4_ReducePathComponent(graphP theGraph, K4SearchContext *context, graphInt R, int prevLink, graphInt A);
+graphInt _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType, graphInt R, graphInt e_R, graphInt A, graphInt e_A);
 
-int _K4_GetCumulativeOrientationOnDFSPath(graphP theGraph, int ancestor, int descendant);
-int _K4_TestPathComponentForAncestor(graphP theGraph, int R, int prevLink, int A);
-void _K4_ClearVisitedInPathComponent(graphP theGraph, int R, int prevLink, int A);
-int _K4_DeleteUnmarkedEdgesInPathComponent(graphP theGraph, int R, int prevLink, int A);
-int _K4_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K4SearchContext *context, int BicompRoot);
+int _K4_GetCumulativeOrientationOnDFSPath(graphP theGraph, graphInt ancestor, graphInt descendant);
+int _K4_TestPathComponentForAncestor(graphP theGraph, graphInt R, int prevLink, graphInt A);
+void _K4_ClearVisitedInPathComponent(graphP theGraph, graphInt R, int prevLink, graphInt A);
+int _K4_DeleteUnmarkedEdgesInPathComponent(graphP theGraph, graphInt R, int prevLink, graphInt A);
+int _K4_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K4SearchContext *context, graphInt BicompRoot);
 
-int _K4_RestoreReducedPath(graphP theGraph, K4SearchContext *context, int e);
+int _K4_RestoreReducedPath(graphP theGraph, K4SearchContext *context, graphInt e);
 int _K4_RestoreAndOrientReducedPaths(graphP theGraph, K4SearchContext *context);
 
 // int _MarkEdge(graphP theGraph, int x, int y);
@@ -83,7 +83,7 @@ int _K4_RestoreAndOrientReducedPaths(graphP theGraph, K4SearchContext *context);
  _SearchForK4InBicomp()
  ****************************************************************************/
 
-int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, int v, int R)
+int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, graphInt v, graphInt R)
 {
     isolatorContextP IC = theGraphIC(theGraph);
 
@@ -242,7 +242,7 @@ int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, int v, int R
     // the WalkDown can be reinvoked on the bicomp
     else if (theGraphIC(theGraph)->minorType & MINORTYPE_B)
     {
-        int a_x, a_y;
+        graphInt a_x, a_y;
 
         // Reality check on stack state
         if (sp_NonEmpty(theGraph->theStack))
@@ -400,10 +400,11 @@ int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, int v, int R
  of the bicomp that won't be reduced, except by a constant amount of course.
  ****************************************************************************/
 
-int _K4_ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R)
+int _K4_ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, graphInt v, graphInt R)
 {
     int XPrevLink = 1, YPrevLink = 0;
-    int Wx, WxPrevLink, Wy, WyPrevLink;
+    graphInt Wx, Wy;
+    int WxPrevLink, WyPrevLink;
 
     _InitIsolatorContext(theGraph);
 
@@ -490,7 +491,8 @@ int _K4_ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R)
 
 int _K4_FindSecondActiveVertexOnLowExtFacePath(graphP theGraph)
 {
-    int Z = theGraphIC(theGraph)->r, ZPrevLink = 1;
+    graphInt Z = theGraphIC(theGraph)->r;
+    int ZPrevLink = 1;
 
     // First we test X for future pertinence only (if it were pertinent, then
     // we wouldn't have been blocked up on this bicomp)
@@ -550,9 +552,10 @@ int _K4_FindSecondActiveVertexOnLowExtFacePath(graphP theGraph)
  that is pertinent or future pertinent.
  ****************************************************************************/
 
-int _K4_FindPlanarityActiveVertex(graphP theGraph, int v, int R, int prevLink, int *pW)
+int _K4_FindPlanarityActiveVertex(graphP theGraph, graphInt v, graphInt R, int prevLink, graphInt *pW)
 {
-    int W = R, WPrevLink = prevLink;
+    graphInt W = R;
+    int WPrevLink = prevLink;
 
     W = _GetNeighborOnExtFace(theGraph, R, &WPrevLink);
 
@@ -613,9 +616,10 @@ int _K4_FindPlanarityActiveVertex(graphP theGraph, int v, int R, int prevLink, i
  Returns TRUE if separator edge found or FALSE otherwise
  ****************************************************************************/
 
-int _K4_FindSeparatingInternalEdge(graphP theGraph, int R, int prevLink, int A, int *pW, int *pX, int *pY)
+int _K4_FindSeparatingInternalEdge(graphP theGraph, graphInt R, int prevLink, graphInt A, graphInt *pW, graphInt *pX, graphInt *pY)
 {
-    int Z, ZPrevLink, e, neighbor;
+    graphInt Z, e, neighbor;
+    int ZPrevLink;
 
     // Mark the vertex obstruction type settings along the path [R ... A]
     _K4_SetMarksOnExternalFacePath(theGraph, R, prevLink, A);
@@ -667,9 +671,10 @@ int _K4_FindSeparatingInternalEdge(graphP theGraph, int R, int prevLink, int A,
  with R's link[1^prevLink] edge record.
  ****************************************************************************/
 
-void _K4_SetMarksOnExternalFacePath(graphP theGraph, int R, int prevLink, int A)
+void _K4_SetMarksOnExternalFacePath(graphP theGraph, graphInt R, int prevLink, graphInt A)
 {
-    int Z, ZPrevLink;
+    graphInt Z;
+    int ZPrevLink;
 
     gp_SetMarked(theGraph, R);
     ZPrevLink = prevLink;
@@ -689,9 +694,10 @@ void _K4_SetMarksOnExternalFacePath(graphP theGraph, int R, int prevLink, int A)
  with R's link[1^prevLink] edge record.
  ****************************************************************************/
 
-void _K4_ClearMarksOnExternalFacePath(graphP theGraph, int R, int prevLink, int A)
+void _K4_ClearMarksOnExternalFacePath(graphP theGraph, graphInt R, int prevLink, graphInt A)
 {
-    int Z, ZPrevLink;
+    graphInt Z;
+    int ZPrevLink;
 
     gp_ClearMarked(theGraph, R);
     ZPrevLink = prevLink;
@@ -858,9 +864,9 @@ int _K4_IsolateMinorB2(graphP theGraph)
  Returns OK for success, NOTOK for internal (implementation) error.
  ****************************************************************************/
 
-int _K4_ReduceBicompToEdge(graphP theGraph, K4SearchContext *context, int R, int W)
+int _K4_ReduceBicompToEdge(graphP theGraph, K4SearchContext *context, graphInt R, graphInt W)
 {
-    int newEdge;
+    graphInt newEdge;
 
     if (_OrientVerticesInBicomp(theGraph, R, 0) != OK ||
         _ClearAllVisitedFlagsInBicomp(theGraph, R) != OK)
@@ -937,9 +943,10 @@ int _K4_ReduceBicompToEdge(graphP theGraph, K4SearchContext *context, int R, int
  Returns OK for success, NOTOK for internal (implementation) error.
  ****************************************************************************/
 
-int _K4_ReducePathComponent(graphP theGraph, K4SearchContext *context, int R, int prevLink, int A)
+int _K4_ReducePathComponent(graphP theGraph, K4SearchContext *context, graphInt R, int prevLink, graphInt A)
 {
-    int e_R, e_A, Z, ZPrevLink, edgeType, invertedFlag = 0;
+    graphInt e_R, e_A, Z;
+    int ZPrevLink, edgeType, invertedFlag = 0;
 
     // Check whether the external face path (R, ..., A) is just an edge
     e_R = gp_GetEdgeByLink(theGraph, R, 1 ^ prevLink);
@@ -1022,10 +1029,10 @@ int _K4_ReducePathComponent(graphP theGraph, K4SearchContext *context, int R, in
  Returns OK on success, NOTOK on implementation failure
  ********************************************************************/
 
-int _K4_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K4SearchContext *context, int BicompRoot)
+int _K4_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K4SearchContext *context, graphInt BicompRoot)
 {
-    int V, e, eNext;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt V, e, eNext;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)context;
@@ -1053,9 +1060,9 @@ int _K4_DeleteUnmarkedEdgesInBicomp(graphP theGraph, K4SearchContext *context, i
 /****************************************************************************
  _K4_GetCumulativeOrientationOnDFSPath()
  ****************************************************************************/
-int _K4_GetCumulativeOrientationOnDFSPath(graphP theGraph, int ancestor, int descendant)
+int _K4_GetCumulativeOrientationOnDFSPath(graphP theGraph, graphInt ancestor, graphInt descendant)
 {
-    int e, parent;
+    graphInt e, parent;
     int invertedFlag = 0;
 
     /* If we are marking from a root vertex upward, then go up to the parent
@@ -1115,9 +1122,10 @@ int _K4_GetCumulativeOrientationOnDFSPath(graphP theGraph, int ancestor, int des
  Returns TRUE if found, FALSE otherwise.
  ****************************************************************************/
 
-int _K4_TestPathComponentForAncestor(graphP theGraph, int R, int prevLink, int A)
+int _K4_TestPathComponentForAncestor(graphP theGraph, graphInt R, int prevLink, graphInt A)
 {
-    int Z, ZPrevLink;
+    graphInt Z;
+    int ZPrevLink;
 
     ZPrevLink = prevLink;
     Z = R;
@@ -1151,9 +1159,10 @@ int _K4_TestPathComponentForAncestor(graphP theGraph, int R, int prevLink, int A
  (R, A)-cut.
  ****************************************************************************/
 
-void _K4_ClearVisitedInPathComponent(graphP theGraph, int R, int prevLink, int A)
+void _K4_ClearVisitedInPathComponent(graphP theGraph, graphInt R, int prevLink, graphInt A)
 {
-    int Z, ZPrevLink, e;
+    graphInt Z, e;
+    int ZPrevLink;
 
     ZPrevLink = prevLink;
     Z = _GetNeighborOnExtFace(theGraph, R, &ZPrevLink);
@@ -1192,9 +1201,10 @@ void _K4_ClearVisitedInPathComponent(graphP theGraph, int R, int prevLink, int A
  Returns OK on success, NOTOK on internal error
  ****************************************************************************/
 
-int _K4_DeleteUnmarkedEdgesInPathComponent(graphP theGraph, int R, int prevLink, int A)
+int _K4_DeleteUnmarkedEdgesInPathComponent(graphP theGraph, graphInt R, int prevLink, graphInt A)
 {
-    int Z, ZPrevLink, e;
+    graphInt Z, e;
+    int ZPrevLink;
     K4SearchContext *context = NULL;
     gp_FindExtension(theGraph, K4SEARCH_ID, (void *)&context);
 
@@ -1256,7 +1266,7 @@ int _K4_DeleteUnmarkedEdgesInPathComponent(graphP theGraph, int R, int prevLink,
  can be tested for success or failure using gp_IsEdge() or gp_IsNotEdge()
  ****************************************************************************/
 
-int _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType, int R, int e_R, int A, int e_A)
+graphInt _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType, graphInt R, graphInt e_R, graphInt A, graphInt e_A)
 {
     // Find out the links used in vertex R for edge e_R and in vertex A for edge e_A
     int Rlink = gp_GetFirstEdge(theGraph, R) == e_R ? 0 : 1;
@@ -1268,7 +1278,7 @@ int _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType
     // been deleted
     if (gp_GetNeighbor(theGraph, e_R) != A)
     {
-        int v_R, v_A;
+        graphInt v_R, v_A;
 
         // Prepare for removing each of the two edges that join the path to the bicomp by
         // restoring it if it is a reduction edge (a constant time operation)
@@ -1361,10 +1371,10 @@ int _K4_ReducePathToEdge(graphP theGraph, K4SearchContext *context, int edgeType
  Return OK on success, NOTOK on failure
  ****************************************************************************/
 
-int _K4_RestoreReducedPath(graphP theGraph, K4SearchContext *context, int e)
+int _K4_RestoreReducedPath(graphP theGraph, K4SearchContext *context, graphInt e)
 {
-    int eTwin, u, v, w, x;
-    int e0, e1, eTwin0, eTwin1;
+    graphInt eTwin, u, v, w, x;
+    graphInt e0, e1, eTwin0, eTwin1;
 
     // An edge e does not represent a path reduction that needs to be restored
     // unless it was assigned a pathConnector vertex (and so is non-NIL)
@@ -1443,7 +1453,8 @@ int _K4_RestoreReducedPath(graphP theGraph, K4SearchContext *context, int e)
 
 int _K4_RestoreAndOrientReducedPaths(graphP theGraph, K4SearchContext *context)
 {
-    int e, eTwin, u, v, w, x, visited;
+    graphInt e, eTwin, u, v, w, x;
+    int visited;
 
     for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph);)
     {
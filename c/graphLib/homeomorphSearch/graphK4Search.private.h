@@ -28,7 +28,7 @@ extern "C"
      */
     typedef struct
     {
-        int pathConnector;
+        graphInt pathConnector;
     } K4Search_EdgeRec;
 
     typedef K4Search_EdgeRec *K4Search_EdgeRecP;
@@ -12,13 +12,13 @@ See the LICENSE.TXT file for licensing information.
 // Need to save and restore a graph flag related to IO
 #include "../io/graphIO.h"
 
-extern int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, int v, int R);
+extern int _SearchForK4InBicomp(graphP theGraph, K4SearchContext *context, graphInt v, graphInt R);
 
 extern int _TestForCompleteGraphObstruction(graphP theGraph, int numVerts,
-                                            int *degrees, int *imageVerts);
+                                            int *degrees, graphInt *imageVerts);
 
 extern int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
-                             int *imageVerts, int maxNumImageVerts);
+                             graphInt *imageVerts, int maxNumImageVerts);
 
 extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
@@ -26,20 +26,21 @@ extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
 void _K4Search_ClearStructures(K4SearchContext *context);
 int _K4Search_CreateStructures(K4SearchContext *context);
-int _K4Search_InitStructures(K4SearchContext *context);
+int _K4Search_InitStructures(K4SearchContext *context, graphInt edgeUpperBound);
 
-void _K4Search_InitEdgeRec(K4SearchContext *context, int e);
+void _K4Search_InitEdgeRec(K4SearchContext *context, graphInt e);
 
 /* Forward declarations of overloading functions */
-int _K4Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-int _K4Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
-int _K4Search_DeleteEdge(graphP theGraph, int e);
+int _K4Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+int _K4Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
+int _K4Search_DeleteEdge(graphP theGraph, graphInt e);
+int _K4Search_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc);
 int _K4Search_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
 int _K4Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 
-int _K4Search_EnsureVertexCapacity(graphP theGraph, int N);
+int _K4Search_EnsureVertexCapacity(graphP theGraph, graphInt N);
 void _K4Search_ResetGraphStorage(graphP theGraph);
-int _K4Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity);
+int _K4Search_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity);
 
 /* Forward declarations of functions used by the extension system */
 
@@ -107,6 +108,7 @@ int gp_ExtendWith_K4Search(graphP theGraph)
     context->functions.fpResetGraphStorage = _K4Search_ResetGraphStorage;
     context->functions.fpEnsureEdgeCapacity = _K4Search_EnsureEdgeCapacity;
     context->functions.fpDeleteEdge = _K4Search_DeleteEdge;
+    context->functions.fpMoveEdge = _K4Search_MoveEdge;
 
     _K4Search_ClearStructures(context);
 
@@ -133,7 +135,7 @@ int gp_ExtendWith_K4Search(graphP theGraph)
     if (gp_GetN(theGraph) > 0)
     {
         if (_K4Search_CreateStructures(context) != OK ||
-            _K4Search_InitStructures(context) != OK)
+            _K4Search_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         {
             _K4Search_FreeContext(context);
             context = NULL;
@@ -163,7 +165,7 @@ void _K4Search_ClearStructures(K4SearchContext *context)
     if (!context->initialized)
     {
         // Before initialization, the pointers are stray, not NULL
-        // Once NULL or allocated, free() or LCFree() can do the job
+        // Once NULL or allocated, _gp_FreeStorage() can do the job
         context->E = NULL;
 
         context->handlingBlockedBicomp = FALSE;
@@ -174,7 +176,7 @@ void _K4Search_ClearStructures(K4SearchContext *context)
     {
         if (context->E != NULL)
         {
-            free(context->E);
+            _gp_FreeStorage(context->theGraph, context->E);
             context->E = NULL;
         }
         context->handlingBlockedBicomp = FALSE;
@@ -191,7 +193,7 @@ int _K4Search_CreateStructures(K4SearchContext *context)
     if (gp_GetN(context->theGraph) <= 0)
         return NOTOK;
 
-    if ((context->E = (K4Search_EdgeRecP)malloc(gp_UpperBoundEdgeStorage(context->theGraph) * sizeof(K4Search_EdgeRec))) == NULL ||
+    if ((context->E = (K4Search_EdgeRecP)_gp_AllocStorage(context->theGraph, gp_UpperBoundEdgeStorage(context->theGraph) * sizeof(K4Search_EdgeRec))) == NULL ||
         0)
     {
         return NOTOK;
@@ -202,10 +204,12 @@ int _K4Search_CreateStructures(K4SearchContext *context)
 
 /********************************************************************
  _K4Search_InitStructures()
+ Initializes the edge records below edgeUpperBound, which is the edge
+ high water mark when the graph is reset (see gp_ResetGraphStorage()).
  ********************************************************************/
-int _K4Search_InitStructures(K4SearchContext *context)
+int _K4Search_InitStructures(K4SearchContext *context, graphInt edgeUpperBound)
 {
-    memset(context->E, NIL_CHAR, gp_UpperBoundEdgeStorage(context->theGraph) * sizeof(K4Search_EdgeRec));
+    memset(context->E, NIL_CHAR, edgeUpperBound * sizeof(K4Search_EdgeRec));
 
     return OK;
 }
@@ -213,7 +217,7 @@ int _K4Search_InitStructures(K4SearchContext *context)
 /********************************************************************
  ********************************************************************/
 
-int _K4Search_EnsureVertexCapacity(graphP theGraph, int N)
+int _K4Search_EnsureVertexCapacity(graphP theGraph, graphInt N)
 {
     K4SearchContext *context = NULL;
     gp_FindExtension(theGraph, K4SEARCH_ID, (void *)&context);
@@ -227,7 +231,7 @@ int _K4Search_EnsureVertexCapacity(graphP theGraph, int N)
         theGraph->edgeCapacity = DEFAULT_EDGE_CAPACITY_FACTOR * N;
 
     if (_K4Search_CreateStructures(context) != OK ||
-        _K4Search_InitStructures(context) != OK)
+        _K4Search_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         return NOTOK;
 
     context->functions.fpEnsureVertexCapacity(theGraph, N);
@@ -245,11 +249,15 @@ void _K4Search_ResetGraphStorage(graphP theGraph)
 
     if (context != NULL)
     {
+        // Only the edge records below the edge high water mark need to be
+        // reset, and resetting the base class lowers the mark
+        graphInt edgeHighWaterMark = theGraphEdgeHighWaterMark(theGraph);
+
         // Reset the graph storage in base class(es)
         context->functions.fpResetGraphStorage(theGraph);
 
         // Do the reset that is specific to this module
-        _K4Search_InitStructures(context);
+        _K4Search_InitStructures(context, edgeHighWaterMark);
     }
 }
 
@@ -257,11 +265,11 @@ void _K4Search_ResetGraphStorage(graphP theGraph)
  _K4Search_EnsureEdgeCapacity()
  ********************************************************************/
 
-int _K4Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
+int _K4Search_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity)
 {
     K4SearchContext *context = NULL;
     K4Search_EdgeRecP oldE = NULL, newE = NULL;
-    int oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
+    graphInt oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
 
     // If the requirement is already satisfied, then no work to do
     if (gp_GetEdgeCapacity(theGraph) >= requiredEdgeCapacity)
@@ -286,7 +294,7 @@ int _K4Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
     newEsize = gp_UpperBoundEdgeStorage(theGraph);
 
     // We must successfully allocate the new parallel edge array
-    newE = (K4Search_EdgeRecP)malloc(newEsize * sizeof(K4Search_EdgeRec));
+    newE = (K4Search_EdgeRecP)_gp_AllocStorage(theGraph, newEsize * sizeof(K4Search_EdgeRec));
     if (newE == NULL)
         return NOTOK;
 
@@ -298,7 +306,7 @@ int _K4Search_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
 
     // Set the new edge array into the context and free the old one
     context->E = newE;
-    free(oldE);
+    _gp_FreeStorage(theGraph, oldE);
 
     return OK;
 }
@@ -314,7 +322,7 @@ void *_K4Search_DupContext(void *pContext, void *theGraph)
 
     if (newContext != NULL)
     {
-        int Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
+        graphInt Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
 
         *newContext = *context;
 
@@ -346,7 +354,7 @@ int _K4Search_CopyData(void *dstContext, void *srcContext)
 {
     K4SearchContext *dstK4Context = (K4SearchContext *)dstContext;
     K4SearchContext *srcK4Context = (K4SearchContext *)srcContext;
-    int dstEdgeStorage, srcEdgeStorage;
+    graphInt dstEdgeStorage, srcEdgeStorage, dstHighWaterMark, srcHighWaterMark;
 
     if (dstContext == NULL)
         return NOTOK;
@@ -355,7 +363,7 @@ int _K4Search_CopyData(void *dstContext, void *srcContext)
     // structures in the dstContext to be reset/reinitialized
 
     if (srcContext == NULL)
-        return _K4Search_InitStructures(dstK4Context);
+        return _K4Search_InitStructures(dstK4Context, gp_UpperBoundEdgeStorage(dstK4Context->theGraph));
 
     // ELSE: If there is also a srcContext, then we copy data from it
     dstEdgeStorage = gp_UpperBoundEdgeStorage(dstK4Context->theGraph);
@@ -366,14 +374,17 @@ int _K4Search_CopyData(void *dstContext, void *srcContext)
     if (dstEdgeStorage < srcEdgeStorage)
         return NOTOK;
 
-    // If the destination graph has more edge capacity, then we make sure that the
-    // extra edge capacity is reinitialized
-    if (dstEdgeStorage > srcEdgeStorage)
-    {
-        memset(dstK4Context->E, NIL_CHAR, gp_UpperBoundEdgeStorage(dstK4Context->theGraph) * sizeof(K4Search_EdgeRec));
-    }
+    // Only the edge records below the source graph's edge high water mark
+    // can differ from their initial state, so only they are copied. Then,
+    // the destination edge records that were changed above that mark are
+    // reinitialized (gp_CopyGraph() updates the destination mark later)
+    srcHighWaterMark = theGraphEdgeHighWaterMark(srcK4Context->theGraph);
+    dstHighWaterMark = theGraphEdgeHighWaterMark(dstK4Context->theGraph);
 
-    memcpy(dstK4Context->E, srcK4Context->E, gp_UpperBoundEdgeStorage(dstK4Context->theGraph) * sizeof(K4Search_EdgeRec));
+    memcpy(dstK4Context->E, srcK4Context->E, srcHighWaterMark * sizeof(K4Search_EdgeRec));
+
+    if (dstHighWaterMark > srcHighWaterMark)
+        memset(dstK4Context->E + srcHighWaterMark, NIL_CHAR, (dstHighWaterMark - srcHighWaterMark) * sizeof(K4Search_EdgeRec));
     return OK;
 }
 
@@ -392,7 +403,7 @@ void _K4Search_FreeContext(void *pContext)
 /********************************************************************
  ********************************************************************/
 
-void _K4Search_InitEdgeRec(K4SearchContext *context, int e)
+void _K4Search_InitEdgeRec(K4SearchContext *context, graphInt e)
 {
     context->E[e].pathConnector = NIL;
 }
@@ -406,7 +417,7 @@ void _K4Search_InitEdgeRec(K4SearchContext *context, int e)
          NOTOK on internal error
  ********************************************************************/
 
-int _K4Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
+int _K4Search_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
 {
     K4SearchContext *context = NULL;
 
@@ -488,7 +499,7 @@ int _K4Search_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
 /********************************************************************
  ********************************************************************/
 
-int _K4Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
+int _K4Search_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
 {
     int savedEmbedFlags = 0, savedZEROBASEDIO = 0;
 
@@ -534,7 +545,7 @@ int _K4Search_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
  marked for isolation.
  ********************************************************************/
 
-int _K4Search_DeleteEdge(graphP theGraph, int e)
+int _K4Search_DeleteEdge(graphP theGraph, graphInt e)
 {
     K4SearchContext *context = NULL;
     gp_FindExtension(theGraph, K4SEARCH_ID, (void *)&context);
@@ -548,6 +559,27 @@ int _K4Search_DeleteEdge(graphP theGraph, int e)
     return context->functions.fpDeleteEdge(theGraph, e);
 }
 
+/********************************************************************
+ Moving an edge during gp_CompactEdgeStorage() is augmented by moving
+ the K_4 search-specific data members of its edge records.
+ ********************************************************************/
+
+int _K4Search_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc)
+{
+    K4SearchContext *context = NULL;
+    gp_FindExtension(theGraph, K4SEARCH_ID, (void *)&context);
+
+    if (context == NULL)
+        return NOTOK;
+
+    context->E[eDst] = context->E[eSrc];
+    context->E[gp_GetTwin(theGraph, eDst)] = context->E[gp_GetTwin(theGraph, eSrc)];
+    _K4Search_InitEdgeRec(context, eSrc);
+    _K4Search_InitEdgeRec(context, gp_GetTwin(theGraph, eSrc));
+
+    return context->functions.fpMoveEdge(theGraph, eDst, eSrc);
+}
+
 /********************************************************************
  ********************************************************************/
 
@@ -582,7 +614,8 @@ int _K4Search_CheckObstructionIntegrity(graphP theGraph, graphP origGraph)
     // the original graph and that it contains a K4 homeomorph
     if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_SEARCHFORK4)
     {
-        int degrees[4], imageVerts[4];
+        int degrees[4];
+        graphInt imageVerts[4];
 
         if (_TestSubgraph(theGraph, origGraph) != TRUE)
             return NOTOK;
@@ -32,11 +32,16 @@ int _g6_ValidateHeader(strOrFileP inputContainer);
 int _g6_ValidateFirstChar(char c, const int lineNum);
 int _g6_DetermineOrderFromInput(strOrFileP inputContainer, int *order);
 
-int _g6_DecodeGraph(char *graphBuff, const int order, const int numChars, graphP theGraph);
+int _g6_DecodeGraph(G6ReadIteratorP theG6ReadIterator, char *graphBuff);
 
 int _g6_ReadGraphFromFile(graphP theGraph, char *pathToG6File);
 int _g6_ReadGraphFromString(graphP theGraph, char *g6EncodedString);
 
+// The most edges for which the edge pairs buffer is allocated when the reader
+// is initialized. Graphs of higher order start with this capacity, which is
+// doubled whenever a graph has more edges.
+#define G6_MAXINITIALEDGEPAIRSCAPACITY ((size_t)1 << 20)
+
 /********************************************************************
  Package private structure declaration for read iterator
  ********************************************************************/
@@ -54,6 +59,10 @@ struct G6ReadIteratorStruct
     size_t currGraphBuffSize;
     char *currGraphBuff;
 
+    // The edges of each graph are gathered here as vertex pairs for gp_AddEdgesBulk()
+    graphInt *edgePairs;
+    size_t edgePairsCapacity;
+
     graphP currGraph;
 
     int endReached;
@@ -324,7 +333,7 @@ int _g6_InitReader(G6ReadIteratorP theG6ReadIterator)
         {
             gp_ErrorMessage("Unable to initialize reader, as graph structure "
                             "passed in was already initialized with order "
-                            "%d, which doesn't match the graph order %d "
+                            "%" GRAPHINT_FMT ", which doesn't match the graph order %d "
                             "specified in the file.",
                             gp_GetN(theG6ReadIterator->currGraph), order);
             return NOTOK;
@@ -351,6 +360,22 @@ int _g6_InitReader(G6ReadIteratorP theG6ReadIterator)
         return NOTOK;
     }
 
+    // Room for the most edges a graph of this order can have, so that decoding
+    // allocates nothing, unless the order is so high that the buffer would be
+    // too large to allocate up front
+    theG6ReadIterator->edgePairsCapacity = (size_t)order * (order > 0 ? order - 1 : 0) / 2;
+    if (theG6ReadIterator->edgePairsCapacity > G6_MAXINITIALEDGEPAIRSCAPACITY)
+        theG6ReadIterator->edgePairsCapacity = G6_MAXINITIALEDGEPAIRSCAPACITY;
+    else if (theG6ReadIterator->edgePairsCapacity == 0)
+        theG6ReadIterator->edgePairsCapacity = 1;
+    theG6ReadIterator->edgePairs = (graphInt *)malloc(2 * theG6ReadIterator->edgePairsCapacity * sizeof(graphInt));
+
+    if (theG6ReadIterator->edgePairs == NULL)
+    {
+        gp_ErrorMessage("Unable to allocate memory for edgePairs.");
+        return NOTOK;
+    }
+
     return OK;
 }
 
@@ -532,7 +557,7 @@ int g6_ReadGraph(G6ReadIteratorP theG6ReadIterator)
             currGraph->graphFlags |= GRAPHFLAGS_ZEROBASEDIO;
         }
 
-        if (_g6_DecodeGraph(graphEncodingChars, order, numCharsForGraphEncoding, currGraph) != OK)
+        if (_g6_DecodeGraph(theG6ReadIterator, graphEncodingChars) != OK)
         {
             gp_ErrorMessage("Unable to interpret bits on line %d to populate "
                             "adjacency matrix.",
@@ -550,21 +575,28 @@ int g6_ReadGraph(G6ReadIteratorP theG6ReadIterator)
     return OK;
 }
 
-// Takes the character array graphBuff, the derived number of vertices order,
-// and the numChars corresponding to the number of characters after the first byte
-// and performs the inverse transformation of the graph encoding: we subtract 63 from
-// each byte, then only process the 6 least significant bits of the resulting byte. For
-// the final byte, we determine how many padding zeroes to expect, and exclude them
-// from being processed. We index into the adjacency matrix by row and column, which
-// are incremented such that row ranges from 0 to one less than the column index.
-int _g6_DecodeGraph(char *graphBuff, const int order, const int numChars, graphP theGraph)
+// Takes the character array graphBuff, holding the encoding of a graph of the
+// reader's order in the reader's numCharsForGraphEncoding characters after the
+// first byte, and performs the inverse transformation of the graph encoding: we
+// subtract 63 from each byte, then only process the 6 least significant bits of
+// the resulting byte. For the final byte, we determine how many padding zeroes
+// to expect, and exclude them from being processed. We index into the adjacency
+// matrix by row and column, which are incremented such that row ranges from 0 to
+// one less than the column index.
+// The edges are gathered in one pass into the reader's buffer of vertex pairs,
+// which is added to the graph with one call to gp_AddEdgesBulk().
+int _g6_DecodeGraph(G6ReadIteratorP theG6ReadIterator, char *graphBuff)
 {
+    const int order = theG6ReadIterator->order;
+    const int numChars = (int)theG6ReadIterator->numCharsForGraphEncoding;
+    graphP theGraph = theG6ReadIterator->currGraph;
     int numPaddingZeroes = _g6_GetExpectedNumPaddingZeroes(order, numChars);
 
     char currByte = '\0';
-    int bitValue = 0;
     int row = 0;
     int col = 1;
+    graphInt *pairs = theG6ReadIterator->edgePairs, *newPairs = NULL;
+    graphInt numEdges = 0, firstVertex = 0;
 
     if (theGraph == NULL)
     {
@@ -573,6 +605,9 @@ int _g6_DecodeGraph(char *graphBuff, const int order, const int numChars, graphP
         return NOTOK;
     }
 
+    // The G6 file is 0-based, but in-memory storage may not be.
+    firstVertex = gp_LowerBoundVertexStorage(theGraph);
+
     for (int i = 0; i < numChars; i++)
     {
         currByte = graphBuff[i] - 63;
@@ -591,22 +626,29 @@ int _g6_DecodeGraph(char *graphBuff, const int order, const int numChars, graphP
                 col++;
             }
 
-            bitValue = ((currByte >> j) & 1u) ? 1 : 0;
-            if (bitValue == 1)
+            if ((currByte >> j) & 1u)
             {
-                // Also add the offset to the first vertex in in-memory storage,
-                // because the G6 file is 0-based, but im-memory storage may not be.
-                if (gp_DynamicAddEdge(theGraph,
-                                      row + gp_LowerBoundVertexStorage(theGraph), 0,
-                                      col + gp_LowerBoundVertexStorage(theGraph), 0) != OK)
-                    return NOTOK;
+                if ((size_t)numEdges == theG6ReadIterator->edgePairsCapacity)
+                {
+                    if ((newPairs = (graphInt *)realloc(pairs, 4 * theG6ReadIterator->edgePairsCapacity * sizeof(graphInt))) == NULL)
+                    {
+                        gp_ErrorMessage("Unable to allocate memory for the edges of the graph.");
+                        return NOTOK;
+                    }
+                    theG6ReadIterator->edgePairs = pairs = newPairs;
+                    theG6ReadIterator->edgePairsCapacity *= 2;
+                }
+
+                pairs[2 * numEdges] = row + firstVertex;
+                pairs[2 * numEdges + 1] = col + firstVertex;
+                numEdges++;
             }
 
             row++;
         }
     }
 
-    return OK;
+    return numEdges == 0 ? OK : gp_AddEdgesBulk(theGraph, pairs, numEdges);
 }
 
 void g6_FreeReader(G6ReadIteratorP *pG6ReadIterator)
@@ -625,6 +667,12 @@ void g6_FreeReader(G6ReadIteratorP *pG6ReadIterator)
             (*pG6ReadIterator)->currGraphBuff = NULL;
         }
 
+        if ((*pG6ReadIterator)->edgePairs != NULL)
+        {
+            free((*pG6ReadIterator)->edgePairs);
+            (*pG6ReadIterator)->edgePairs = NULL;
+        }
+
         (*pG6ReadIterator)->currGraph = NULL;
 
         free((*pG6ReadIterator));
@@ -26,8 +26,8 @@ int _g6_InitWriter(G6WriteIteratorP theG6WriteIterator);
 int _g6_IsWriterInitialized(G6WriteIteratorP theG6WriteIterator, int reportUninitializedParts);
 void _g6_PrecomputeColumnOffsets(size_t *columnOffsets, int order);
 void _g6_EncodeAdjMatAsG6(G6WriteIteratorP theG6WriteIterator);
-void _g6_GetFirstEdgeInUse(graphP theGraph, int *e, int *u, int *v);
-void _g6_GetNextEdgeInUse(graphP theGraph, int *e, int *u, int *v);
+void _g6_GetFirstEdgeInUse(graphP theGraph, graphInt *e, graphInt *u, graphInt *v);
+void _g6_GetNextEdgeInUse(graphP theGraph, graphInt *e, graphInt *u, graphInt *v);
 int _g6_WriteEncodedGraph(G6WriteIteratorP theG6WriteIterator);
 
 int _g6_WriteGraphToFile(graphP theGraph, char *g6OutputFileName);
@@ -288,14 +288,14 @@ int _g6_InitWriter(G6WriteIteratorP theG6WriteIterator)
 {
     char const *g6Header = ">>graph6<<";
 
-    theG6WriteIterator->order = gp_GetN(theG6WriteIterator->currGraph);
-
-    if (theG6WriteIterator->order > 100000)
+    if (gp_GetN(theG6WriteIterator->currGraph) > 100000)
     {
         gp_ErrorMessage("Graphs of order n > 100000 are not supported at this time.");
         return NOTOK;
     }
 
+    theG6WriteIterator->order = (int)gp_GetN(theG6WriteIterator->currGraph);
+
     if (sf_fputs(g6Header, theG6WriteIterator->outputContainer) < 0)
     {
         gp_ErrorMessage("Unable to initialize writer due to failure to fputs "
@@ -406,7 +406,7 @@ void _g6_EncodeAdjMatAsG6(G6WriteIteratorP theG6WriteIterator)
     size_t numCharsForGraphEncoding = 0;
     size_t totalNumCharsForOrderAndGraph = 0;
 
-    int u = NIL, v = NIL, e = NIL;
+    graphInt u = NIL, v = NIL, e = NIL;
     size_t charOffset = 0;
     int bitPositionPower = 0;
     int bitPosition = 0;
@@ -459,7 +459,7 @@ void _g6_EncodeAdjMatAsG6(G6WriteIteratorP theG6WriteIterator)
         // and col = max(u, v) in the upper-triangular adjacency matrix.
         if (v < u)
         {
-            int tempVert = v;
+            graphInt tempVert = v;
             v = u;
             u = tempVert;
         }
@@ -489,14 +489,14 @@ void _g6_EncodeAdjMatAsG6(G6WriteIteratorP theG6WriteIterator)
         g6Encoding[i] += 63;
 }
 
-void _g6_GetFirstEdgeInUse(graphP theGraph, int *e, int *u, int *v)
+void _g6_GetFirstEdgeInUse(graphP theGraph, graphInt *e, graphInt *u, graphInt *v)
 {
     (*e) = NIL;
 
     _g6_GetNextEdgeInUse(theGraph, e, u, v);
 }
 
-void _g6_GetNextEdgeInUse(graphP theGraph, int *e, int *u, int *v)
+void _g6_GetNextEdgeInUse(graphP theGraph, graphInt *e, graphInt *u, graphInt *v)
 {
     (*u) = NIL;
     (*v) = NIL;
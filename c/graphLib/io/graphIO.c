@@ -41,8 +41,8 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer);
 int _WritePostprocess(graphP theGraph, char **pExtraData);
 
 /* Private functions */
-char _GetEdgeTypeChar(graphP theGraph, int e);
-char _GetObstructionMarkChar(graphP theGraph, int v);
+char _GetEdgeTypeChar(graphP theGraph, graphInt e);
+char _GetObstructionMarkChar(graphP theGraph, graphInt v);
 
 /********************************************************************
  _ReadAdjMatrix()
@@ -133,7 +133,8 @@ int _ReadAdjList(graphP theGraph, strOrFileP inputContainer)
 {
     int ErrorCode = OK;
 
-    int N = 0, v = NIL, W = NIL, adjList = NIL, e = NIL, indexValue = NIL;
+    graphInt adjList = NIL, e = NIL;
+    int N = 0, v = NIL, W = NIL, indexValue = NIL;
     int zeroBased = FALSE, inputOffset = NIL, inputTerminatorLowerBound = NIL;
 
     if (!sf_IsValidStrOrFile(inputContainer))
@@ -617,17 +618,18 @@ int _ReadPostprocess(graphP theGraph, char *extraData)
 
 int _WriteAdjList(graphP theGraph, strOrFileP outputContainer)
 {
-    int v = NIL, e = NIL;
+    graphInt v = NIL, e = NIL;
     int zeroBasedVertexOffset = 0, adjacencyListTerminator = NIL;
-    char numberStr[MAXCHARSFOR32BITINT + 1];
+    // Leaves room for the "N=" prefix and the newline of the first line
+    char numberStr[MAXCHARSFORGRAPHINT + 4];
 
-    memset(numberStr, '\0', (MAXCHARSFOR32BITINT + 1) * sizeof(char));
+    memset(numberStr, '\0', (MAXCHARSFORGRAPHINT + 4) * sizeof(char));
 
     if (theGraph == NULL || !sf_IsValidStrOrFile(outputContainer))
         return NOTOK;
 
     // Write the number of vertices of the graph to the file or string buffer
-    if (sprintf(numberStr, "N=%d\n", gp_GetN(theGraph)) < 1)
+    if (sprintf(numberStr, "N=%" GRAPHINT_FMT "\n", gp_GetN(theGraph)) < 1)
         return NOTOK;
     if (sf_fputs(numberStr, outputContainer) == EOF)
         return NOTOK;
@@ -648,7 +650,7 @@ int _WriteAdjList(graphP theGraph, strOrFileP outputContainer)
     // Write the adjacency list of each vertex
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
-        if (sprintf(numberStr, "%d:", v - zeroBasedVertexOffset) < 1)
+        if (sprintf(numberStr, "%" GRAPHINT_FMT ":", v - zeroBasedVertexOffset) < 1)
             return NOTOK;
         if (sf_fputs(numberStr, outputContainer) == EOF)
             return NOTOK;
@@ -658,7 +660,7 @@ int _WriteAdjList(graphP theGraph, strOrFileP outputContainer)
         {
             if (gp_GetDirection(theGraph, e) != EDGEFLAG_DIRECTION_INONLY)
             {
-                if (sprintf(numberStr, " %d", gp_GetNeighbor(theGraph, e) - zeroBasedVertexOffset) < 1)
+                if (sprintf(numberStr, " %" GRAPHINT_FMT, gp_GetNeighbor(theGraph, e) - zeroBasedVertexOffset) < 1)
                     return NOTOK;
                 if (sf_fputs(numberStr, outputContainer) == EOF)
                     return NOTOK;
@@ -692,10 +694,10 @@ int _WriteAdjList(graphP theGraph, strOrFileP outputContainer)
 
 int _WriteAdjMatrix(graphP theGraph, strOrFileP outputContainer)
 {
-    int v = NIL, e = NIL;
+    graphInt v = NIL, e = NIL;
     char *Row = NULL;
-    char numberStr[MAXCHARSFOR32BITINT + 1];
-    memset(numberStr, '\0', (MAXCHARSFOR32BITINT + 1) * sizeof(char));
+    char numberStr[MAXCHARSFORGRAPHINT + 2];
+    memset(numberStr, '\0', (MAXCHARSFORGRAPHINT + 2) * sizeof(char));
 
     if (theGraph == NULL || !sf_IsValidStrOrFile(outputContainer))
         return NOTOK;
@@ -707,7 +709,7 @@ int _WriteAdjMatrix(graphP theGraph, strOrFileP outputContainer)
     }
 
     // Write the number of vertices in the graph to the file or string buffer
-    if (sprintf(numberStr, "%d\n", gp_GetN(theGraph)) < 1)
+    if (sprintf(numberStr, "%" GRAPHINT_FMT "\n", gp_GetN(theGraph)) < 1)
         return NOTOK;
     if (sf_fputs(numberStr, outputContainer) == EOF)
         return NOTOK;
@@ -720,10 +722,10 @@ int _WriteAdjMatrix(graphP theGraph, strOrFileP outputContainer)
     // Construct the upper triangular matrix representation one row at a time
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
-        for (int i = gp_LowerBoundVertices(theGraph); i <= v; i++)
+        for (graphInt i = gp_LowerBoundVertices(theGraph); i <= v; i++)
             Row[i - gp_LowerBoundVertices(theGraph)] = ' ';
 
-        for (int i = v + 1; i < gp_UpperBoundVertices(theGraph); i++)
+        for (graphInt i = v + 1; i < gp_UpperBoundVertices(theGraph); i++)
             Row[i - gp_LowerBoundVertices(theGraph)] = '0';
 
         e = gp_GetFirstEdge(theGraph, v);
@@ -755,7 +757,7 @@ int _WriteAdjMatrix(graphP theGraph, strOrFileP outputContainer)
 /********************************************************************
  ********************************************************************/
 
-char _GetEdgeTypeChar(graphP theGraph, int e)
+char _GetEdgeTypeChar(graphP theGraph, graphInt e)
 {
     char type = 'U';
 
@@ -776,7 +778,7 @@ char _GetEdgeTypeChar(graphP theGraph, int e)
 /********************************************************************
  ********************************************************************/
 
-char _GetObstructionMarkChar(graphP theGraph, int v)
+char _GetObstructionMarkChar(graphP theGraph, graphInt v)
 {
     char type = 'U';
 
@@ -801,7 +803,7 @@ char _GetObstructionMarkChar(graphP theGraph, int v)
 
 int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
 {
-    int v = NIL, e = NIL;
+    graphInt v = NIL, e = NIL;
     char lineBuf[MAXLINE + 1];
 
     memset(lineBuf, '\0', (MAXLINE + 1) * sizeof(char));
@@ -810,14 +812,14 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
         return NOTOK;
 
     /* Print parent copy vertices and their adjacency lists */
-    if (sprintf(lineBuf, "DEBUG N=%d M=%d\n", gp_GetN(theGraph), gp_GetM(theGraph)) < 1)
+    if (sprintf(lineBuf, "DEBUG N=%" GRAPHINT_FMT " M=%" GRAPHINT_FMT "\n", gp_GetN(theGraph), gp_GetM(theGraph)) < 1)
         return NOTOK;
     if (sf_fputs(lineBuf, outputContainer) == EOF)
         return NOTOK;
 
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
-        if (sprintf(lineBuf, "%d(P=%d,lA=%d,LowPt=%d,v=%d):",
+        if (sprintf(lineBuf, "%" GRAPHINT_FMT "(P=%" GRAPHINT_FMT ",lA=%" GRAPHINT_FMT ",LowPt=%" GRAPHINT_FMT ",v=%" GRAPHINT_FMT "):",
                     v, gp_GetVertexParent(theGraph, v),
                     gp_GetVertexLeastAncestor(theGraph, v),
                     gp_GetVertexLowpoint(theGraph, v),
@@ -829,7 +831,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
         e = gp_GetFirstEdge(theGraph, v);
         while (gp_IsEdge(theGraph, e))
         {
-            if (sprintf(lineBuf, " %d(e=%d)", gp_GetNeighbor(theGraph, e), e) < 1)
+            if (sprintf(lineBuf, " %" GRAPHINT_FMT "(e=%" GRAPHINT_FMT ")", gp_GetNeighbor(theGraph, e), e) < 1)
                 return NOTOK;
             if (sf_fputs(lineBuf, outputContainer) == EOF)
                 return NOTOK;
@@ -849,7 +851,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
         if (!gp_VirtualVertexInUse(theGraph, v))
             continue;
 
-        if (sprintf(lineBuf, "%d(copy of=%d, DFS child=%d):",
+        if (sprintf(lineBuf, "%" GRAPHINT_FMT "(copy of=%" GRAPHINT_FMT ", DFS child=%" GRAPHINT_FMT "):",
                     v, gp_GetIndex(theGraph, v),
                     gp_GetDFSChildFromBicompRoot(theGraph, v)) < 1)
             return NOTOK;
@@ -859,7 +861,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
         e = gp_GetFirstEdge(theGraph, v);
         while (gp_IsEdge(theGraph, e))
         {
-            if (sprintf(lineBuf, " %d(e=%d)", gp_GetNeighbor(theGraph, e), e) < 1)
+            if (sprintf(lineBuf, " %" GRAPHINT_FMT "(e=%" GRAPHINT_FMT ")", gp_GetNeighbor(theGraph, e), e) < 1)
                 return NOTOK;
             if (sf_fputs(lineBuf, outputContainer) == EOF)
                 return NOTOK;
@@ -879,7 +881,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
 
     for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
     {
-        if (sprintf(lineBuf, "V[%3d] index=%3d, type=%c, first edge=%3d, last edge=%3d\n",
+        if (sprintf(lineBuf, "V[%3" GRAPHINT_FMT "] index=%3" GRAPHINT_FMT ", type=%c, first edge=%3" GRAPHINT_FMT ", last edge=%3" GRAPHINT_FMT "\n",
                     v,
                     gp_GetIndex(theGraph, v),
                     (gp_IsVirtualVertex(theGraph, v) ? 'X' : _GetObstructionMarkChar(theGraph, v)),
@@ -894,7 +896,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
         if (gp_VirtualVertexNotInUse(theGraph, v))
             continue;
 
-        if (sprintf(lineBuf, "V[%3d] index=%3d, type=%c, first edge=%3d, last edge=%3d\n",
+        if (sprintf(lineBuf, "V[%3" GRAPHINT_FMT "] index=%3" GRAPHINT_FMT ", type=%c, first edge=%3" GRAPHINT_FMT ", last edge=%3" GRAPHINT_FMT "\n",
                     v,
                     gp_GetIndex(theGraph, v),
                     (gp_IsVirtualVertex(theGraph, v) ? 'X' : _GetObstructionMarkChar(theGraph, v)),
@@ -914,7 +916,7 @@ int _WriteDebugInfo(graphP theGraph, strOrFileP outputContainer)
     {
         if (gp_EdgeInUse(theGraph, e))
         {
-            if (sprintf(lineBuf, "E[%3d] neighbor=%3d, type=%c, next edge=%3d, prev edge=%3d\n",
+            if (sprintf(lineBuf, "E[%3" GRAPHINT_FMT "] neighbor=%3" GRAPHINT_FMT ", type=%c, next edge=%3" GRAPHINT_FMT ", prev edge=%3" GRAPHINT_FMT "\n",
                         e,
                         gp_GetNeighbor(theGraph, e),
                         _GetEdgeTypeChar(theGraph, e),
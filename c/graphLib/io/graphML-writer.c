@@ -108,7 +108,7 @@ int _WriteGraphMLGraphStartTag(graphP theGraph, int index, strOrFileP outputCont
  ********************************************************************/
 int _WriteGraphMLGraphVertices(graphP theGraph, int index, strOrFileP outputContainer)
 {
-    int v = NIL;
+    graphInt v = NIL;
     int zeroBasedVertexOffset = 0;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
@@ -138,12 +138,12 @@ int _WriteGraphMLGraphVertices(graphP theGraph, int index, strOrFileP outputCont
  ********************************************************************/
 int _WriteGraphMLGraphEdges(graphP theGraph, int index, strOrFileP outputContainer)
 {
-    int e = NIL;
-    int edgeID = 1;
-    int sourceEdge = NIL;
-    int targetEdge = NIL;
-    int sourceVertex = NIL;
-    int targetVertex = NIL;
+    graphInt e = NIL;
+    graphInt edgeID = 1;
+    graphInt sourceEdge = NIL;
+    graphInt targetEdge = NIL;
+    graphInt sourceVertex = NIL;
+    graphInt targetVertex = NIL;
     int zeroBasedVertexOffset = 0;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
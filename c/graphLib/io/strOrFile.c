@@ -291,7 +291,7 @@ char sf_getc(strOrFileP theStrOrFile)
 
     if ((theStrOrFile->ungetBuf != NULL) && (sp_GetCurrentSize(theStrOrFile->ungetBuf) > 0))
     {
-        int currChar = 0;
+        graphInt currChar = 0;
         // Technically, this returns NOTOK on error, but the error is underflow, which is
         // checked above and so cannot happen. Therefore, safe to use sp_Pop() here.
 
@@ -627,7 +627,7 @@ char *sf_fgets(char *str, int count, strOrFileP theStrOrFile)
 
     if (theStrOrFile->ungetBuf != NULL)
     {
-        int numCharsInUngetBuf = sp_GetCurrentSize(theStrOrFile->ungetBuf);
+        int numCharsInUngetBuf = (int)sp_GetCurrentSize(theStrOrFile->ungetBuf);
         if (numCharsInUngetBuf > 0)
         {
             char currChar = '\0';
@@ -736,7 +736,7 @@ int sf_fputs(char const *strToWrite, strOrFileP theStrOrFile)
  Returns OK on success, NOTOK on failure.
  ********************************************************************/
 
-int sf_WriteInteger(int intToWrite, strOrFileP theStrOrFile)
+int sf_WriteInteger(graphInt intToWrite, strOrFileP theStrOrFile)
 {
     int result = OK;
 
@@ -745,7 +745,7 @@ int sf_WriteInteger(int intToWrite, strOrFileP theStrOrFile)
         return NOTOK;
 
     if (theStrOrFile->pFile != NULL)
-        result = fprintf(theStrOrFile->pFile, "%d", intToWrite) < 0 ? NOTOK : OK;
+        result = fprintf(theStrOrFile->pFile, "%" GRAPHINT_FMT, intToWrite) < 0 ? NOTOK : OK;
     else if (theStrOrFile->theStrBuf != NULL)
         result = sb_ConcatInt(theStrOrFile->theStrBuf, intToWrite);
 
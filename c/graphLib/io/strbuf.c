@@ -231,11 +231,11 @@ int sb_ConcatChar(strBufP theStrBuf, char ch)
  Converts theInt into a string, then invokes sb_ConcatString().
  Returns Same as sb_ConcatString()
  ********************************************************************/
-int sb_ConcatInt(strBufP theStrBuf, int theInt)
+int sb_ConcatInt(strBufP theStrBuf, graphInt theInt)
 {
-    char numberStr[MAXCHARSFOR32BITINT + 1];
+    char numberStr[MAXCHARSFORGRAPHINT + 1];
 
-    if (sprintf(numberStr, "%d", theInt) < 1)
+    if (sprintf(numberStr, "%" GRAPHINT_FMT, theInt) < 1)
         return NOTOK;
 
     return sb_ConcatString(theStrBuf, numberStr);
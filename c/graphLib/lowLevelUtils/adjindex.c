@@ -0,0 +1,271 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "appconst.h"
+#include "adjindex.h"
+#include <limits.h>
+#include <stdlib.h>
+
+// An empty slot has a negative value, since stored values are non-negative
+#define AI_EMPTY_VALUE -1
+
+#define AI_MIN_CAPACITY 16
+
+unsigned _ai_Hash(graphInt u, graphInt v);
+adjIndexEntry *_ai_NewTable(graphInt capacity);
+int _ai_Grow(adjIndexP theIndex);
+
+/*****************************************************************************
+ _ai_Hash()
+ Mixes the two integers of a pair so that both contribute to all the bits
+ that select a slot.
+ *****************************************************************************/
+
+unsigned _ai_Hash(graphInt u, graphInt v)
+{
+    unsigned h;
+
+#ifdef USE_64BIT_INDICES
+    // Fold the high halves in so that they also select the slot
+    u ^= u >> 32;
+    v ^= v >> 32;
+#endif
+
+    h = (unsigned)u * 0x9E3779B1u ^ ((unsigned)v + 0x7F4A7C15u) * 0x85EBCA77u;
+
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+
+    return h;
+}
+
+#define _ai_HomeSlot(theIndex, u, v) ((graphInt)(_ai_Hash(u, v) & (unsigned)((theIndex)->capacity - 1)))
+#define _ai_NextSlot(theIndex, slot) (((slot) + 1) & ((theIndex)->capacity - 1))
+
+/*****************************************************************************
+ _ai_NewTable()
+ Returns a table of capacity empty slots, or NULL on allocation failure.
+ *****************************************************************************/
+
+adjIndexEntry *_ai_NewTable(graphInt capacity)
+{
+    adjIndexEntry *table = (adjIndexEntry *)malloc(capacity * sizeof(adjIndexEntry));
+
+    if (table != NULL)
+    {
+        for (graphInt slot = 0; slot < capacity; slot++)
+            table[slot].value = AI_EMPTY_VALUE;
+    }
+
+    return table;
+}
+
+/*****************************************************************************
+ ai_New()
+ Creates an empty adjacency index with enough capacity to receive
+ expectedSize entries without growing.
+ Returns NULL on allocation failure.
+ *****************************************************************************/
+
+adjIndexP ai_New(graphInt expectedSize)
+{
+    adjIndexP theIndex = NULL;
+    graphInt capacity = AI_MIN_CAPACITY;
+
+    if (expectedSize < 0 || expectedSize > GRAPHINT_MAX / 4)
+        return NULL;
+
+    while (capacity < 2 * expectedSize)
+        capacity <<= 1;
+
+    theIndex = (adjIndexP)malloc(sizeof(adjIndexStruct));
+    if (theIndex != NULL)
+    {
+        if ((theIndex->table = _ai_NewTable(capacity)) == NULL)
+        {
+            free(theIndex);
+            return NULL;
+        }
+
+        theIndex->capacity = capacity;
+        theIndex->size = 0;
+    }
+
+    return theIndex;
+}
+
+/*****************************************************************************
+ ai_Free()
+ Releases the adjacency index, then sets the caller's pointer to NULL.
+ *****************************************************************************/
+
+void ai_Free(adjIndexP *pIndex)
+{
+    if (pIndex == NULL || *pIndex == NULL)
+        return;
+
+    if ((*pIndex)->table != NULL)
+        free((*pIndex)->table);
+    (*pIndex)->table = NULL;
+    (*pIndex)->capacity = (*pIndex)->size = 0;
+
+    free(*pIndex);
+    *pIndex = NULL;
+}
+
+/*****************************************************************************
+ _ai_Grow()
+ Doubles the capacity of the table and reinserts all of the entries.
+ Returns OK on success, NOTOK on allocation failure, in which case the
+ index is left unchanged.
+ *****************************************************************************/
+
+int _ai_Grow(adjIndexP theIndex)
+{
+    adjIndexEntry *oldTable = theIndex->table;
+    graphInt oldCapacity = theIndex->capacity, slot;
+
+    if (oldCapacity > GRAPHINT_MAX / 2 ||
+        (theIndex->table = _ai_NewTable(2 * oldCapacity)) == NULL)
+    {
+        theIndex->table = oldTable;
+        return NOTOK;
+    }
+
+    theIndex->capacity = 2 * oldCapacity;
+
+    for (graphInt oldSlot = 0; oldSlot < oldCapacity; oldSlot++)
+    {
+        if (oldTable[oldSlot].value == AI_EMPTY_VALUE)
+            continue;
+
+        slot = _ai_HomeSlot(theIndex, oldTable[oldSlot].u, oldTable[oldSlot].v);
+        while (theIndex->table[slot].value != AI_EMPTY_VALUE)
+            slot = _ai_NextSlot(theIndex, slot);
+
+        theIndex->table[slot] = oldTable[oldSlot];
+    }
+
+    free(oldTable);
+    return OK;
+}
+
+/*****************************************************************************
+ ai_Insert()
+ Adds an entry mapping the pair (u, v) to the given non-negative value.
+ The same pair may be added more than once with different values.
+ Returns OK on success, NOTOK on a negative value or allocation failure.
+ *****************************************************************************/
+
+int ai_Insert(adjIndexP theIndex, graphInt u, graphInt v, graphInt value)
+{
+    graphInt slot;
+
+    if (theIndex == NULL || value < 0)
+        return NOTOK;
+
+    if (2 * (theIndex->size + 1) > theIndex->capacity && _ai_Grow(theIndex) != OK)
+        return NOTOK;
+
+    slot = _ai_HomeSlot(theIndex, u, v);
+    while (theIndex->table[slot].value != AI_EMPTY_VALUE)
+        slot = _ai_NextSlot(theIndex, slot);
+
+    theIndex->table[slot].u = u;
+    theIndex->table[slot].v = v;
+    theIndex->table[slot].value = value;
+    theIndex->size++;
+
+    return OK;
+}
+
+/*****************************************************************************
+ ai_Delete()
+ Removes the entry that maps the pair (u, v) to the given value, if any.
+ Each later entry of the same cluster that could have been placed in the
+ vacated slot is shifted back into it, which keeps every entry reachable
+ from its home slot without leaving a deletion marker.
+ *****************************************************************************/
+
+void ai_Delete(adjIndexP theIndex, graphInt u, graphInt v, graphInt value)
+{
+    graphInt slot, nextSlot, homeSlot;
+
+    if (theIndex == NULL)
+        return;
+
+    slot = ai_FindFirst(theIndex, u, v);
+    while (slot != AI_NIL_SLOT && theIndex->table[slot].value != value)
+        slot = ai_FindNext(theIndex, u, v, slot);
+
+    if (slot == AI_NIL_SLOT)
+        return;
+
+    nextSlot = slot;
+    while (1)
+    {
+        nextSlot = _ai_NextSlot(theIndex, nextSlot);
+        if (theIndex->table[nextSlot].value == AI_EMPTY_VALUE)
+            break;
+
+        // The entry in nextSlot stays if its home slot is cyclically
+        // in the range (slot, nextSlot], since then it must not move
+        // to an earlier position than its home slot
+        homeSlot = _ai_HomeSlot(theIndex, theIndex->table[nextSlot].u, theIndex->table[nextSlot].v);
+        if (slot <= nextSlot ? (slot < homeSlot && homeSlot <= nextSlot)
+                             : (slot < homeSlot || homeSlot <= nextSlot))
+            continue;
+
+        theIndex->table[slot] = theIndex->table[nextSlot];
+        slot = nextSlot;
+    }
+
+    theIndex->table[slot].value = AI_EMPTY_VALUE;
+    theIndex->size--;
+}
+
+/*****************************************************************************
+ ai_FindFirst()
+ Returns the slot of the first entry found for the pair (u, v), or
+ AI_NIL_SLOT if there is none.
+ *****************************************************************************/
+
+graphInt ai_FindFirst(adjIndexP theIndex, graphInt u, graphInt v)
+{
+    graphInt slot = _ai_HomeSlot(theIndex, u, v);
+
+    while (theIndex->table[slot].value != AI_EMPTY_VALUE)
+    {
+        if (theIndex->table[slot].u == u && theIndex->table[slot].v == v)
+            return slot;
+
+        slot = _ai_NextSlot(theIndex, slot);
+    }
+
+    return AI_NIL_SLOT;
+}
+
+/*****************************************************************************
+ ai_FindNext()
+ Given the slot of an entry for the pair (u, v), returns the slot of the
+ next entry found for the pair, or AI_NIL_SLOT if there is none.
+ *****************************************************************************/
+
+graphInt ai_FindNext(adjIndexP theIndex, graphInt u, graphInt v, graphInt slot)
+{
+    slot = _ai_NextSlot(theIndex, slot);
+
+    while (theIndex->table[slot].value != AI_EMPTY_VALUE)
+    {
+        if (theIndex->table[slot].u == u && theIndex->table[slot].v == v)
+            return slot;
+
+        slot = _ai_NextSlot(theIndex, slot);
+    }
+
+    return AI_NIL_SLOT;
+}
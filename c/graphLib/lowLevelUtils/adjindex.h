@@ -0,0 +1,66 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#ifndef ADJINDEX_H
+#define ADJINDEX_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+        /*
+         An adjacency index is a hash table that maps a pair of integers (u, v)
+         to one or more non-negative integer values. The graph library uses it
+         to map a vertex u and a neighbor v to the edge records in the adjacency
+         list of u that indicate v, so that an adjacency can be found without
+         scanning the adjacency list.
+
+         The table uses open addressing with linear probing, and it grows as
+         needed to keep the load factor at or below one half. Deletion shifts
+         back the following entries of the probe sequence, so no tombstones
+         are left behind.
+
+         ai_FindFirst() and ai_FindNext() iterate the slots of the entries for
+         a given pair, returning AI_NIL_SLOT when there are no more. The value in
+         a slot is obtained with ai_GetValue().
+         */
+
+#define AI_NIL_SLOT -1
+
+        struct adjIndexEntry
+        {
+                graphIndex u, v, value;
+        };
+
+        typedef struct adjIndexEntry adjIndexEntry;
+
+        struct adjIndexStruct
+        {
+                adjIndexEntry *table;
+                graphInt capacity, size;
+        };
+
+        typedef struct adjIndexStruct adjIndexStruct;
+        typedef adjIndexStruct *adjIndexP;
+
+        adjIndexP ai_New(graphInt expectedSize);
+        void ai_Free(adjIndexP *pIndex);
+
+        int ai_Insert(adjIndexP theIndex, graphInt u, graphInt v, graphInt value);
+        void ai_Delete(adjIndexP theIndex, graphInt u, graphInt v, graphInt value);
+
+        graphInt ai_FindFirst(adjIndexP theIndex, graphInt u, graphInt v);
+        graphInt ai_FindNext(adjIndexP theIndex, graphInt u, graphInt v, graphInt slot);
+
+#define ai_GetValue(theIndex, slot) ((theIndex)->table[slot].value)
+#define ai_GetSize(theIndex) ((theIndex)->size)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
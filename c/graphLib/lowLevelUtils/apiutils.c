@@ -7,6 +7,7 @@ See the LICENSE.TXT file for licensing information.
 #include <limits.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #include "appconst.h"
 
@@ -14,8 +15,9 @@ See the LICENSE.TXT file for licensing information.
 #include "apiutils.private.h"
 
 // The graphLib gp_ErrorMessage() and gp_Message() calls are suppressed by
-// default, but an application can turn them on if desired.
-unsigned quietMode = QUIETMODE_ALL;
+// default, but an application can turn them on if desired. Each thread has
+// its own quiet mode, so every thread starts with the default.
+static GP_THREAD_LOCAL unsigned quietMode = QUIETMODE_ALL;
 
 unsigned gp_GetQuietMode(void)
 {
@@ -80,26 +82,76 @@ void gp_LogErrorMessage(int lineNum, const char *srcFileName, const char *messag
     }
 }
 
+/********************************************************************
+ The random numbers of the graph library are generated by an xorshift*
+ generator rather than by rand(), whose state is shared by all threads.
+ Each thread has its own generator state, so the sequence of random
+ numbers, and hence the random graphs, that a thread produces after
+ calling gp_SetRandomSeed() do not depend on what other threads do.
+ A thread that never sets the seed starts with the seed 1.
+ ********************************************************************/
+
+static GP_THREAD_LOCAL uint64_t randomState = 0;
+
+uint64_t _gp_NextRandom(void);
+
+/********************************************************************
+ gp_SetRandomSeed()
+ Seeds the random number generator of the calling thread, which is
+ used by gp_GetRandomNumber() and the random graph generators.
+ ********************************************************************/
+
+void gp_SetRandomSeed(unsigned seed)
+{
+    // Scramble the seed with a splitmix64 step so that nearby seeds
+    // give unrelated sequences and no seed gives the zero state
+    uint64_t z = (uint64_t)seed + 0x9E3779B97F4A7C15ULL;
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+
+    randomState = z != 0 ? z : 0x9E3779B97F4A7C15ULL;
+}
+
+/********************************************************************
+ _gp_NextRandom()
+ Returns the next 64 random bits of the calling thread's generator.
+ ********************************************************************/
+
+uint64_t _gp_NextRandom(void)
+{
+    if (randomState == 0)
+        gp_SetRandomSeed(1);
+
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+
+    return randomState * 0x2545F4914F6CDD1DULL;
+}
+
 /********************************************************************
  gp_GetRandomNumber()
  This function generates a random number between NMin and NMax
- inclusive.  It assumes that the caller has called srand().
- It calls rand(), but before truncating to the proper range,
- it adds the high bits of the rand() result into the low bits.
- The result of this is that the randomness appearing in the
- truncated bits also has an affect on the non-truncated bits.
+ inclusive, using the random number generator of the calling thread
+ (see gp_SetRandomSeed()). The high bits of the generator output are
+ the most random, so those are the ones truncated to the range.
  ********************************************************************/
 
-int gp_GetRandomNumber(int NMin, int NMax)
+graphInt gp_GetRandomNumber(graphInt NMin, graphInt NMax)
 {
-    int N = rand();
+    graphInt N = (graphInt)(_gp_NextRandom() >> 33);
 
     if (NMax < NMin)
         return NMin;
 
-    N += ((N & 0xFFFF0000) >> 16);
-    N += ((N & 0x0000FF00) >> 8);
-    N &= 0x7FFFFFFF;
+#ifdef USE_64BIT_INDICES
+    // Only a range wider than 31 bits needs more random bits
+    if (NMax - NMin >= 0x7FFFFFFF)
+        N = (graphInt)(_gp_NextRandom() >> 1);
+#endif
+
     N %= (NMax - NMin + 1);
     return N + NMin;
 }
@@ -143,35 +195,41 @@ int debugNOTOK(void)
 
  On first write, the file is created or cleared.
  Call this method with NULL to close the log file.
+
+ The log file is shared by all threads. Only the first thread to write
+ opens it, and logfileReady tells the other threads when it is open.
+ Lines written by other threads while it is being opened are dropped.
  ********************************************************************/
 
 void closeLogFileAtExit(void);
 
+static FILE *logfile = NULL;
+static int triedlogfile = FALSE;
+static int logfileReady = FALSE;
+
 void _Log(char const *Str)
 {
-    static FILE *logfile = NULL;
-    static int triedlogfile = FALSE;
-
-    if (logfile == NULL && !triedlogfile)
+    if (!_gp_AtomicLoad(&logfileReady) && _gp_AtomicCompareAndSwap(&triedlogfile, FALSE, TRUE))
     {
-        triedlogfile = TRUE;
         if (atexit(closeLogFileAtExit) != 0)
             gp_ErrorMessage("Unable to set up atexit() to close Edge_Addition_Planarity_Suite log file on exit");
         else
         {
             if ((logfile = fopen("Edge_Addition_Planarity_Suite.LOG", WRITETEXT)) == NULL)
                 gp_ErrorMessage("Unable to open the Edge_Addition_Planarity_Suite log file");
+            else
+                (void)_gp_AtomicCompareAndSwap(&logfileReady, FALSE, TRUE);
         }
     }
 
-    if (logfile != NULL)
+    if (_gp_AtomicLoad(&logfileReady))
     {
         if (Str != NULL)
         {
             fprintf(logfile, "%s", Str);
             fflush(logfile);
         }
-        else
+        else if (_gp_AtomicCompareAndSwap(&logfileReady, TRUE, FALSE))
         {
             fclose(logfile);
             logfile = NULL;
@@ -190,7 +248,8 @@ void closeLogFileAtExit(void)
     _gp_Log(NULL);
 }
 
-static char LogStr[MAXLINE + 1];
+// Each thread makes its log strings in its own buffer
+static GP_THREAD_LOCAL char LogStr[MAXLINE + 1];
 
 char *_MakeLogStr1(const char *format, int one)
 {
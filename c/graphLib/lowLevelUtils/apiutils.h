@@ -19,6 +19,14 @@ extern "C"
 // then 10 digits (max signed 32-bit int), and a null-terminator
 #define MAXCHARSFOR32BITINT 11
 
+// The string representation for a graphInt, which in the 64-bit index build
+// is an optional '-' then up to 19 digits
+#ifdef USE_64BIT_INDICES
+#define MAXCHARSFORGRAPHINT 20
+#else
+#define MAXCHARSFORGRAPHINT MAXCHARSFOR32BITINT
+#endif
+
 #if defined(_MSC_VER) && !defined(__llvm__) && !defined(__INTEL_COMPILER)
 #define APPLY_FORMAT_ATTRIBUTE 0
 #elif defined(__has_attribute)
@@ -40,7 +48,7 @@ extern "C"
 #endif
 
     // These methods control whether gp_ErrorMessage() and gp_Message() calls
-    // emit output or skip producing output (the default)
+    // emit output or skip producing output (the default) in the calling thread
     unsigned gp_GetQuietMode(void);
     void gp_SetQuietMode(unsigned newQuietMode);
 
@@ -55,7 +63,9 @@ extern "C"
 #define gp_ErrorMessage(...) (gp_LogErrorMessage(__LINE__, __FILE__, __VA_ARGS__))
     void gp_LogErrorMessage(int lineNum, const char *srcFileName, const char *message, ...) FORMAT_PRINTF(3, 4);
 
-    int gp_GetRandomNumber(int NMin, int NMax);
+    // The random number generator is per thread (see gp_SetRandomSeed())
+    void gp_SetRandomSeed(unsigned seed);
+    graphInt gp_GetRandomNumber(graphInt NMin, graphInt NMax);
 
 #ifdef __cplusplus
 }
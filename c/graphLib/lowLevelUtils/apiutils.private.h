@@ -20,6 +20,33 @@ extern "C"
        Logging is used to see more details of how various algorithms
        handle a particular graph. */
 
+    /* PRIVATE ATOMIC OPERATIONS ON INT VARIABLES SHARED BY ALL THREADS.
+
+       _gp_AtomicLoad() reads the variable, _gp_AtomicIncrement() returns its
+       incremented value, and _gp_AtomicCompareAndSwap() sets it to newValue
+       and returns TRUE only if it equals oldValue. Each is a memory barrier,
+       so writes made before a variable is changed are visible to a thread
+       that reads the new value. Where GP_THREADSAFE is not defined (see
+       appconst.h), they are plain operations. */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define _gp_AtomicLoad(pVar) __atomic_load_n(pVar, __ATOMIC_SEQ_CST)
+#define _gp_AtomicIncrement(pVar) __atomic_add_fetch(pVar, 1, __ATOMIC_SEQ_CST)
+#define _gp_AtomicCompareAndSwap(pVar, oldValue, newValue) \
+    (__sync_bool_compare_and_swap(pVar, oldValue, newValue) ? TRUE : FALSE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define _gp_AtomicLoad(pVar) ((int)_InterlockedCompareExchange((long volatile *)(pVar), 0, 0))
+#define _gp_AtomicIncrement(pVar) ((int)_InterlockedIncrement((long volatile *)(pVar)))
+#define _gp_AtomicCompareAndSwap(pVar, oldValue, newValue) \
+    (_InterlockedCompareExchange((long volatile *)(pVar), newValue, oldValue) == (oldValue) ? TRUE : FALSE)
+#else
+#define _gp_AtomicLoad(pVar) (*(pVar))
+#define _gp_AtomicIncrement(pVar) (++(*(pVar)))
+#define _gp_AtomicCompareAndSwap(pVar, oldValue, newValue) \
+    (*(pVar) == (oldValue) ? (*(pVar) = (newValue), TRUE) : FALSE)
+#endif
+
 // #define LOGGING
 #ifdef LOGGING
 
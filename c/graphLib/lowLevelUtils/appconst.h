@@ -7,8 +7,6 @@ All rights reserved.
 See the LICENSE.TXT file for licensing information.
 */
 
-#include "apiutils.h"
-
 // NOTE: This is defined on 32- and 64-bit Windows systems; see
 // https://sourceforge.net/p/predef/wiki/OperatingSystems
 #if defined(WIN32) || defined(_WIN32)
@@ -65,6 +63,39 @@ extern int debugNOTOK(void);
 #define NULL ((void *)0)
 #endif
 
+// GP_THREAD_LOCAL declares a static variable of which each thread has its own
+// instance. The graph library uses it for the little state that is not kept in
+// a graph, so that different graphs can be processed by different threads at
+// the same time (see the concurrency notes in graphLib.h). GP_THREADSAFE is
+// defined for the compilers that also provide the atomic operations needed to
+// register extensions safely (see apiutils.private.h). Otherwise, the graph
+// library must be used by one thread at a time.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define GP_THREAD_LOCAL __declspec(thread)
+#define GP_THREADSAFE
+#elif defined(__GNUC__) || defined(__clang__)
+#define GP_THREAD_LOCAL __thread
+#define GP_THREADSAFE
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define GP_THREAD_LOCAL _Thread_local
+#else
+#define GP_THREAD_LOCAL
+#endif
+
+// GP_FORCEINLINE declares a static function that the compiler is asked to
+// inline into its callers regardless of its size. The graph library uses it
+// for the core functions of gp_Embed() so that its embedding loop can be
+// specialized for graphs whose function table has no overloads of them.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define GP_FORCEINLINE static __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define GP_FORCEINLINE static inline __attribute__((always_inline))
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define GP_FORCEINLINE static inline
+#else
+#define GP_FORCEINLINE static
+#endif
+
 // Define one of these to use 1-based arrays or the original 0-based arrays
 // It used to be true that the 1-based arrays were faster, but compiler
 // optimizations have come a long way in two decades.
@@ -79,6 +110,61 @@ extern int debugNOTOK(void);
 #undef USE_1BASEDARRAYS
 #endif
 
+// Define USE_16BIT_INDICES to store the vertex and edge indices held in the
+// graph data structures (vertex, edge, vertex info and list collection records)
+// as 16-bit integers, which roughly halves the working set of a small graph.
+// Computations still use int, so only the storage type changes. A graph
+// whose vertex or edge storage cannot be indexed by the graphIndex type is
+// rejected by gp_EnsureVertexCapacity() and gp_EnsureEdgeCapacity().
+//
+// The libplanarity16 library is compiled with this definition (see Makefile.am).
+// #define USE_16BIT_INDICES
+
+// Define USE_64BIT_INDICES (or configure with --enable-64bit-indices) to both
+// store and compute vertex and edge indices, counts and capacities as 64-bit
+// integers, so that a graph can have more than 2^31 edge records. This doubles
+// the size of the index members of the graph data structures. The graphInt
+// type is used for the computations, and GRAPHINT_FMT and GRAPHINT_SCN are the
+// printf() and scanf() length modifier and conversion for a graphInt.
+//
+// USE_16BIT_INDICES takes precedence, so libplanarity16 is not affected.
+// #define USE_64BIT_INDICES
+
+#ifdef USE_16BIT_INDICES
+#undef USE_64BIT_INDICES
+#endif
+
+#include <limits.h>
+
+#if defined(USE_16BIT_INDICES)
+#include <stdint.h>
+typedef int16_t graphIndex;
+typedef int graphInt;
+#define GRAPHINDEX_MAX INT16_MAX
+#define GRAPHINT_MAX INT_MAX
+#define GRAPHINT_FMT "d"
+#define GRAPHINT_SCN "d"
+#elif defined(USE_64BIT_INDICES)
+#include <stdint.h>
+#include <inttypes.h>
+typedef int64_t graphIndex;
+typedef int64_t graphInt;
+#define GRAPHINDEX_MAX INT64_MAX
+#define GRAPHINT_MAX INT64_MAX
+#define GRAPHINT_FMT PRId64
+#define GRAPHINT_SCN SCNd64
+#else
+typedef int graphIndex;
+typedef int graphInt;
+#define GRAPHINDEX_MAX INT_MAX
+#define GRAPHINT_MAX INT_MAX
+#define GRAPHINT_FMT "d"
+#define GRAPHINT_SCN "d"
+#endif
+
+// The API utilities use the index types defined above
+#include "apiutils.h"
+
 /* Array indexes are used as pointers, and NIL means bad pointer */
 #ifdef USE_1BASEDARRAYS
 // This definition is used with 1-based array indexing
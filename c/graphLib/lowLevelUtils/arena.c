@@ -0,0 +1,103 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "appconst.h"
+#include "arena.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ ar_New()
+ Creates an arena of capacity bytes whose first allocation starts on a
+ cache line boundary. The memory is not initialized.
+ Returns NULL on allocation failure.
+ *****************************************************************************/
+
+arenaP ar_New(size_t capacity)
+{
+    arenaP theArena = NULL;
+    uintptr_t blockAddress = 0;
+
+    capacity = ar_AlignedSize(capacity);
+
+    theArena = (arenaP)malloc(sizeof(arenaStruct));
+    if (theArena != NULL)
+    {
+        // The malloc() alignment guarantee is less than a cache line, so
+        // allocate enough extra to be able to start on the next boundary
+        theArena->block = (char *)malloc(capacity + ARENA_ALIGNMENT - 1);
+        if (theArena->block == NULL)
+        {
+            free(theArena);
+            theArena = NULL;
+        }
+    }
+
+    if (theArena != NULL)
+    {
+        blockAddress = (uintptr_t)theArena->block;
+        theArena->base = theArena->block + (ar_AlignedSize(blockAddress) - blockAddress);
+        theArena->capacity = capacity;
+        theArena->used = 0;
+    }
+
+    return theArena;
+}
+
+/*****************************************************************************
+ ar_Free()
+ Releases the arena and all allocations made from it, then sets the
+ caller's arena pointer to NULL.
+ *****************************************************************************/
+
+void ar_Free(arenaP *pArena)
+{
+    if (pArena == NULL || *pArena == NULL)
+        return;
+
+    if ((*pArena)->block != NULL)
+        free((*pArena)->block);
+    (*pArena)->block = (*pArena)->base = NULL;
+    (*pArena)->capacity = (*pArena)->used = 0;
+
+    free(*pArena);
+    *pArena = NULL;
+}
+
+/*****************************************************************************
+ ar_Alloc()
+ Returns size bytes of uninitialized, cache line aligned memory from the
+ arena, or NULL if the arena does not have enough space left.
+ *****************************************************************************/
+
+void *ar_Alloc(arenaP theArena, size_t size)
+{
+    void *ptr = NULL;
+
+    if (theArena == NULL || size == 0 || ar_AlignedSize(size) > theArena->capacity - theArena->used)
+        return NULL;
+
+    ptr = theArena->base + theArena->used;
+    theArena->used += ar_AlignedSize(size);
+
+    return ptr;
+}
+
+/*****************************************************************************
+ ar_Contains()
+ Returns TRUE if ptr points into memory managed by the arena, FALSE otherwise.
+ *****************************************************************************/
+
+int ar_Contains(arenaP theArena, void const *ptr)
+{
+    uintptr_t address = (uintptr_t)ptr, baseAddress = 0;
+
+    if (theArena == NULL || ptr == NULL)
+        return FALSE;
+
+    baseAddress = (uintptr_t)theArena->base;
+    return address >= baseAddress && address - baseAddress < theArena->capacity ? TRUE : FALSE;
+}
@@ -0,0 +1,57 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// includes size_t
+#include <stddef.h>
+
+        /*
+         An arena is one contiguous block of memory from which a sequence of
+         allocations is carved out, each starting on a cache line boundary.
+         There is no way to free an individual allocation; the whole block
+         is released at once by ar_Free().
+
+         ar_Alloc() returns NULL once the arena has too little space left,
+         so callers can fall back to the heap, and ar_Contains() tells the
+         caller whether a pointer was obtained from the arena (and therefore
+         must not be passed to free()).
+         */
+
+#define ARENA_ALIGNMENT 64
+
+// The number of bytes an allocation of size bytes consumes in an arena
+#define ar_AlignedSize(size) (((size) + (ARENA_ALIGNMENT - 1)) & ~((size_t)(ARENA_ALIGNMENT - 1)))
+
+        struct arenaStruct
+        {
+                char *block, *base;
+                size_t capacity, used;
+        };
+
+        typedef struct arenaStruct arenaStruct;
+        typedef arenaStruct *arenaP;
+
+        arenaP ar_New(size_t capacity);
+        void ar_Free(arenaP *pArena);
+
+        void *ar_Alloc(arenaP theArena, size_t size);
+        int ar_Contains(arenaP theArena, void const *ptr);
+
+#define ar_GetCapacity(theArena) ((theArena)->capacity)
+#define ar_GetUsed(theArena) ((theArena)->used)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
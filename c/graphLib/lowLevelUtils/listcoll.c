@@ -73,7 +73,7 @@ See the LICENSE.TXT file for licensing information.
  LCNew()
  *****************************************************************************/
 
-listCollectionP LCNew(int N)
+listCollectionP LCNew(graphInt N)
 {
      listCollectionP theListColl = NULL;
 
@@ -118,7 +118,7 @@ void LCFree(listCollectionP *pListColl)
  LCInsertAfter()
  *****************************************************************************/
 
-void LCInsertAfter(listCollectionP listColl, int theAnchor, int theNewNode)
+void LCInsertAfter(listCollectionP listColl, graphInt theAnchor, graphInt theNewNode)
 {
      listColl->List[theNewNode].prev = theAnchor;
      listColl->List[theNewNode].next = listColl->List[theAnchor].next;
@@ -130,7 +130,7 @@ void LCInsertAfter(listCollectionP listColl, int theAnchor, int theNewNode)
  LCInsertBefore()
  *****************************************************************************/
 
-void LCInsertBefore(listCollectionP listColl, int theAnchor, int theNewNode)
+void LCInsertBefore(listCollectionP listColl, graphInt theAnchor, graphInt theNewNode)
 {
      LCPrepend(listColl, theAnchor, theNewNode);
 }
@@ -143,7 +143,7 @@ void LCInsertBefore(listCollectionP listColl, int theAnchor, int theNewNode)
 
 void LCReset(listCollectionP listColl)
 {
-     int K;
+     graphInt K;
 
      for (K = 0; K < listColl->N; K++)
           listColl->List[K].prev = listColl->List[K].next = NIL;
@@ -155,7 +155,7 @@ void LCReset(listCollectionP listColl)
 
 void LCCopy(listCollectionP dst, listCollectionP src)
 {
-     int K;
+     graphInt K;
 
      if (dst == NULL || src == NULL || dst->N != src->N)
           return;
@@ -168,9 +168,9 @@ void LCCopy(listCollectionP dst, listCollectionP src)
  LCGetNext()
  *****************************************************************************/
 
-int LCGetNext(listCollectionP listColl, int theList, int theNode)
+graphInt LCGetNext(listCollectionP listColl, graphInt theList, graphInt theNode)
 {
-     int next;
+     graphInt next;
 
      if (listColl == NULL || theList == NIL || theNode == NIL)
           return NIL;
@@ -182,7 +182,7 @@ int LCGetNext(listCollectionP listColl, int theList, int theNode)
  LCGetPrev()
  *****************************************************************************/
 
-int LCGetPrev(listCollectionP listColl, int theList, int theNode)
+graphInt LCGetPrev(listCollectionP listColl, graphInt theList, graphInt theNode)
 {
      if (listColl == NULL || theList == NIL)
           return NIL;
@@ -197,7 +197,7 @@ int LCGetPrev(listCollectionP listColl, int theList, int theNode)
  LCPrepend()
  *****************************************************************************/
 
-int LCPrepend(listCollectionP listColl, int theList, int theNode)
+graphInt LCPrepend(listCollectionP listColl, graphInt theList, graphInt theNode)
 {
      /* If the append worked, then theNode is last, which in a circular
         list is the direct predecessor of the list head node, so we
@@ -210,7 +210,7 @@ int LCPrepend(listCollectionP listColl, int theList, int theNode)
  LCAppend()
  *****************************************************************************/
 
-int LCAppend(listCollectionP listColl, int theList, int theNode)
+graphInt LCAppend(listCollectionP listColl, graphInt theList, graphInt theNode)
 {
      /* If the given list is empty, then the given node becomes the
         singleton list output */
@@ -226,7 +226,7 @@ int LCAppend(listCollectionP listColl, int theList, int theNode)
 
      else
      {
-          int pred = listColl->List[theList].prev;
+          graphInt pred = listColl->List[theList].prev;
 
           listColl->List[theList].prev = theNode;
           listColl->List[theNode].next = theList;
@@ -243,7 +243,7 @@ int LCAppend(listCollectionP listColl, int theList, int theNode)
  LCDelete()
  *****************************************************************************/
 
-int LCDelete(listCollectionP listColl, int theList, int theNode)
+graphInt LCDelete(listCollectionP listColl, graphInt theList, graphInt theNode)
 {
      /* If the list is a singleton, then NIL its pointers and
         return NIL for theList*/
@@ -260,7 +260,7 @@ int LCDelete(listCollectionP listColl, int theList, int theNode)
 
      else
      {
-          int pred = listColl->List[theNode].prev,
+          graphInt pred = listColl->List[theNode].prev,
               succ = listColl->List[theNode].next;
 
           listColl->List[pred].next = succ;
@@ -17,35 +17,35 @@ extern "C"
 
         typedef struct
         {
-                int prev, next;
+                graphIndex prev, next;
         } lcnode;
 
         struct listCollectionStruct
         {
-                int N;
+                graphInt N;
                 lcnode *List;
         };
 
         typedef struct listCollectionStruct listCollectionStruct;
         typedef listCollectionStruct *listCollectionP;
 
-        listCollectionP LCNew(int N);
+        listCollectionP LCNew(graphInt N);
         void LCFree(listCollectionP *pListColl);
 
-        void LCInsertAfter(listCollectionP listColl, int theAnchor, int theNewNode);
-        void LCInsertBefore(listCollectionP listColl, int theAnchor, int theNewNode);
+        void LCInsertAfter(listCollectionP listColl, graphInt theAnchor, graphInt theNewNode);
+        void LCInsertBefore(listCollectionP listColl, graphInt theAnchor, graphInt theNewNode);
 
 #ifndef SPEED_MACROS
 
         void LCReset(listCollectionP listColl);
         void LCCopy(listCollectionP dst, listCollectionP src);
 
-        int LCGetNext(listCollectionP listColl, int theList, int theNode);
-        int LCGetPrev(listCollectionP listColl, int theList, int theNode);
+        graphInt LCGetNext(listCollectionP listColl, graphInt theList, graphInt theNode);
+        graphInt LCGetPrev(listCollectionP listColl, graphInt theList, graphInt theNode);
 
-        int LCPrepend(listCollectionP listColl, int theList, int theNode);
-        int LCAppend(listCollectionP listColl, int theList, int theNode);
-        int LCDelete(listCollectionP listColl, int theList, int theNode);
+        graphInt LCPrepend(listCollectionP listColl, graphInt theList, graphInt theNode);
+        graphInt LCAppend(listCollectionP listColl, graphInt theList, graphInt theNode);
+        graphInt LCDelete(listCollectionP listColl, graphInt theList, graphInt theNode);
 
 #else
 
@@ -57,12 +57,12 @@ extern "C"
 
 #define LCCopy(dst, src) memcpy(dst->List, src->List, src->N * sizeof(lcnode))
 
-/* int  LCGetNext(listCollectionP listColl, int theList, int theNode);
+/* graphInt LCGetNext(listCollectionP listColl, graphInt theList, graphInt theNode);
         Return theNode's successor, unless it is theList head pointer */
 
 #define LCGetNext(listColl, theList, theNode) listColl->List[theNode].next == theList ? NIL : listColl->List[theNode].next
 
-/* int  LCGetPrev(listCollectionP listColl, int theList, int theNode);
+/* graphInt LCGetPrev(listCollectionP listColl, graphInt theList, graphInt theNode);
         Return theNode's predecessor unless theNode is theList head.
         To start going backwards, use NIL for theNode, which returns theList head's predecessor
         Usage: Obtain last node, loop while NIL not returned, process node then get predecessor.
@@ -75,7 +75,7 @@ extern "C"
          : theNode == theList ? NIL           \
                               : listColl->List[theNode].prev)
 
-/* int  LCPrepend(listCollectionP listColl, int theList, int theNode);
+/* graphInt LCPrepend(listCollectionP listColl, graphInt theList, graphInt theNode);
         If theList is empty, then theNode becomes its only member and is returned.
         Otherwise, theNode is placed before theList head, and theNode is returned as the new head. */
 
@@ -88,7 +88,7 @@ extern "C"
                 listColl->List[theList].prev = theNode,                                \
                 listColl->List[theList].prev))
 
-/* int  LCAppend(listCollectionP listColl, int theList, int theNode);
+/* graphInt LCAppend(listCollectionP listColl, graphInt theList, graphInt theNode);
         If theList is empty, then theNode becomes its only member and is returned.
         Otherwise, theNode is placed before theList head, and then theList head is returned. */
 
@@ -101,7 +101,7 @@ extern "C"
                 listColl->List[theList].prev = theNode,                                \
                 theList))
 
-/* int  LCDelete(listCollectionP listColl, int theList, int theNode);
+/* graphInt LCDelete(listCollectionP listColl, graphInt theList, graphInt theNode);
         If theList contains only one node, then NIL it out and return NIL meaning empty list
         Otherwise, join the predecessor and successor, then
         return either the list head or its successor if the deleted node is the list head
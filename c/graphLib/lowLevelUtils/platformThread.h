@@ -0,0 +1,39 @@
+#ifndef PLATFORM_THREAD
+#define PLATFORM_THREAD
+
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+// A thread function is declared with platform_ThreadFunction(name, arg) and
+// ends with return platform_ThreadReturn. The platform_CreateThread() macro
+// evaluates to OK if the thread was started, NOTOK otherwise.
+
+#ifdef WINDOWS
+
+#include <windows.h>
+
+#define platform_thread HANDLE
+#define platform_ThreadFunction(name, arg) DWORD WINAPI name(LPVOID arg)
+#define platform_ThreadReturn 0
+#define platform_CreateThread(threadVar, function, arg) \
+    ((threadVar = CreateThread(NULL, 0, function, arg, 0, NULL)) != NULL ? OK : NOTOK)
+#define platform_JoinThread(threadVar) \
+    (WaitForSingleObject(threadVar, INFINITE), CloseHandle(threadVar))
+
+#else
+
+#include <pthread.h>
+
+#define platform_thread pthread_t
+#define platform_ThreadFunction(name, arg) void *name(void *arg)
+#define platform_ThreadReturn NULL
+#define platform_CreateThread(threadVar, function, arg) \
+    (pthread_create(&(threadVar), NULL, function, arg) == 0 ? OK : NOTOK)
+#define platform_JoinThread(threadVar) pthread_join(threadVar, NULL)
+
+#endif
+
+#endif
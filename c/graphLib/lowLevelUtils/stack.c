@@ -8,7 +8,7 @@ See the LICENSE.TXT file for licensing information.
 #include "stack.h"
 #include <stdlib.h>
 
-stackP sp_New(int capacity)
+stackP sp_New(graphInt capacity)
 {
     stackP theStack;
 
@@ -16,7 +16,7 @@ stackP sp_New(int capacity)
 
     if (theStack != NULL)
     {
-        theStack->S = (int *)malloc(capacity * sizeof(int));
+        theStack->S = (graphInt *)malloc(capacity * sizeof(graphInt));
         if (theStack->S == NULL)
         {
             free(theStack);
@@ -54,7 +54,7 @@ int sp_CopyContent(stackP stackDst, stackP stackSrc)
         return NOTOK;
 
     if (stackSrc->size > 0)
-        memcpy(stackDst->S, stackSrc->S, stackSrc->size * sizeof(int));
+        memcpy(stackDst->S, stackSrc->S, stackSrc->size * sizeof(graphInt));
 
     stackDst->size = stackSrc->size;
     return OK;
@@ -69,7 +69,7 @@ stackP sp_Duplicate(stackP theStack)
 
     if (theStack->size > 0)
     {
-        memcpy(newStack->S, theStack->S, theStack->size * sizeof(int));
+        memcpy(newStack->S, theStack->S, theStack->size * sizeof(graphInt));
         newStack->size = theStack->size;
     }
 
@@ -81,7 +81,7 @@ int sp_Copy(stackP stackDst, stackP stackSrc)
     if (sp_CopyContent(stackDst, stackSrc) != OK)
     {
         stackP newStack = sp_Duplicate(stackSrc);
-        int *p;
+        graphInt *p;
 
         if (newStack == NULL)
             return NOTOK;
@@ -107,12 +107,12 @@ int sp_ClearStack(stackP theStack)
     return OK;
 }
 
-int sp_GetCurrentSize(stackP theStack)
+graphInt sp_GetCurrentSize(stackP theStack)
 {
     return theStack->size;
 }
 
-int sp_SetCurrentSize(stackP theStack, int size)
+int sp_SetCurrentSize(stackP theStack, graphInt size)
 {
     return size > theStack->capacity ? NOTOK : (theStack->size = size, OK);
 }
@@ -122,12 +122,12 @@ int sp_IsEmpty(stackP theStack)
     return !theStack->size;
 }
 
-int sp_NonEmpty(stackP theStack)
+graphInt sp_NonEmpty(stackP theStack)
 {
     return theStack->size;
 }
 
-int sp__Push(stackP theStack, int a)
+int sp__Push(stackP theStack, graphInt a)
 {
     if (theStack->size >= theStack->capacity)
         return NOTOK;
@@ -136,7 +136,7 @@ int sp__Push(stackP theStack, int a)
     return OK;
 }
 
-int sp__Push2(stackP theStack, int a, int b)
+int sp__Push2(stackP theStack, graphInt a, graphInt b)
 {
     if (theStack->size + 1 >= theStack->capacity)
         return NOTOK;
@@ -146,7 +146,7 @@ int sp__Push2(stackP theStack, int a, int b)
     return OK;
 }
 
-int sp__Pop(stackP theStack, int *pA)
+int sp__Pop(stackP theStack, graphInt *pA)
 {
     if (theStack->size <= 0)
         return NOTOK;
@@ -164,7 +164,7 @@ int sp__Pop_Discard(stackP theStack)
     return OK;
 }
 
-int sp__Pop2(stackP theStack, int *pA, int *pB)
+int sp__Pop2(stackP theStack, graphInt *pA, graphInt *pB)
 {
     if (theStack->size <= 1)
         return NOTOK;
@@ -175,7 +175,7 @@ int sp__Pop2(stackP theStack, int *pA, int *pB)
     return OK;
 }
 
-int sp__Pop2_Discard1(stackP theStack, int *pA)
+int sp__Pop2_Discard1(stackP theStack, graphInt *pA)
 {
     if (theStack->size <= 1)
         return NOTOK;
@@ -200,12 +200,12 @@ int sp__Pop2_Discard(stackP theStack)
     return OK;
 }
 
-int sp_Top(stackP theStack)
+graphInt sp_Top(stackP theStack)
 {
     return theStack->size ? theStack->S[theStack->size - 1] : NIL;
 }
 
-int sp_Get(stackP theStack, int pos)
+graphInt sp_Get(stackP theStack, graphInt pos)
 {
     if (theStack == NULL || pos < 0 || pos >= theStack->size)
         return NOTOK;
@@ -213,7 +213,7 @@ int sp_Get(stackP theStack, int pos)
     return (theStack->S[pos]);
 }
 
-int sp_Set(stackP theStack, int pos, int val)
+graphInt sp_Set(stackP theStack, graphInt pos, graphInt val)
 {
     if (theStack == NULL || pos < 0 || pos >= theStack->size)
         return NOTOK;
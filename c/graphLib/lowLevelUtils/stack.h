@@ -15,16 +15,19 @@ extern "C"
 // includes mem functions like memcpy
 #include <string.h>
 
+// includes the graphInt type of the stack elements
+#include "appconst.h"
+
         struct stackStruct
         {
-                int *S;
-                int size, capacity;
+                graphInt *S;
+                graphInt size, capacity;
         };
 
         typedef struct stackStruct stackStruct;
         typedef stackStruct *stackP;
 
-        stackP sp_New(int capacity);
+        stackP sp_New(graphInt capacity);
         void sp_Free(stackP *pStack);
 
         int sp_Copy(stackP stackDst, stackP stackSrc);
@@ -37,11 +40,11 @@ extern "C"
 #ifndef SPEED_MACROS
 
         int sp_ClearStack(stackP theStack);
-        int sp_GetCurrentSize(stackP theStack);
-        int sp_SetCurrentSize(stackP theStack, int top);
+        graphInt sp_GetCurrentSize(stackP theStack);
+        int sp_SetCurrentSize(stackP theStack, graphInt top);
 
         int sp_IsEmpty(stackP theStack);
-        int sp_NonEmpty(stackP theStack);
+        graphInt sp_NonEmpty(stackP theStack);
 
 #define sp_Push(theStack, a)                       \
         {                                          \
@@ -54,8 +57,8 @@ extern "C"
                         return NOTOK;                    \
         }
 
-        int sp__Push(stackP theStack, int a);
-        int sp__Push2(stackP theStack, int a, int b);
+        int sp__Push(stackP theStack, graphInt a);
+        int sp__Push2(stackP theStack, graphInt a, graphInt b);
 
 #define sp_Pop(theStack, a)                        \
         {                                          \
@@ -84,16 +87,16 @@ extern "C"
                         return NOTOK;                 \
         }
 
-        int sp__Pop(stackP theStack, int *pA);
+        int sp__Pop(stackP theStack, graphInt *pA);
         int sp__Pop_Discard(stackP theStack);
 
-        int sp__Pop2(stackP theStack, int *pA, int *pB);
-        int sp__Pop2_Discard1(stackP theStack, int *pA);
+        int sp__Pop2(stackP theStack, graphInt *pA, graphInt *pB);
+        int sp__Pop2_Discard1(stackP theStack, graphInt *pA);
         int sp__Pop2_Discard(stackP theStack);
 
-        int sp_Top(stackP theStack);
-        int sp_Get(stackP theStack, int pos);
-        int sp_Set(stackP theStack, int pos, int val);
+        graphInt sp_Top(stackP theStack);
+        graphInt sp_Get(stackP theStack, graphInt pos);
+        graphInt sp_Set(stackP theStack, graphInt pos, graphInt val);
 
 #else
 
@@ -0,0 +1,193 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "appconst.h"
+#include "vmregion.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(WINDOWS)
+#include <windows.h>
+#elif defined(VR_SUPPORTED)
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+// The pages are committed by vr_Commit(), so no swap space is set aside for them up front
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+#endif
+
+size_t _vr_RoundUp(size_t size, size_t granularity);
+size_t _vr_GetPageSize(void);
+
+/*****************************************************************************
+ _vr_RoundUp()
+ Returns the least multiple of granularity, a power of two, that is at least
+ size.
+ *****************************************************************************/
+
+size_t _vr_RoundUp(size_t size, size_t granularity)
+{
+    return (size + (granularity - 1)) & ~(granularity - 1);
+}
+
+/*****************************************************************************
+ _vr_GetPageSize()
+ Returns the size of a memory page of the operating system.
+ *****************************************************************************/
+
+size_t _vr_GetPageSize(void)
+{
+#if defined(WINDOWS)
+    SYSTEM_INFO systemInfo;
+
+    GetSystemInfo(&systemInfo);
+    return (size_t)systemInfo.dwPageSize;
+#elif defined(VR_SUPPORTED)
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    return pageSize > 0 ? (size_t)pageSize : 4096;
+#else
+    return 4096;
+#endif
+}
+
+/*****************************************************************************
+ vr_New()
+ Reserves at least capacity bytes of address space, none of which is
+ committed. If useHugePages is TRUE, the region starts on a huge page
+ boundary, memory is committed in whole huge pages, and the operating
+ system is advised to back the region with huge pages, if it can.
+ Returns NULL if the address space cannot be reserved, including when
+ reserving address space is not supported (see VR_SUPPORTED).
+ *****************************************************************************/
+
+vmRegionP vr_New(size_t capacity, int useHugePages)
+{
+    vmRegionP theRegion = NULL;
+    size_t granularity = _vr_GetPageSize();
+    uintptr_t blockAddress = 0;
+
+#if defined(VR_SUPPORTED) && !defined(WINDOWS)
+    if (useHugePages && granularity < VR_HUGEPAGE_SIZE)
+        granularity = VR_HUGEPAGE_SIZE;
+#else
+    // Huge pages on Windows require a privilege that is not normally granted
+    (void)useHugePages;
+#endif
+
+    if (capacity == 0 || capacity > SIZE_MAX - 2 * granularity)
+        return NULL;
+
+    theRegion = (vmRegionP)malloc(sizeof(vmRegionStruct));
+    if (theRegion == NULL)
+        return NULL;
+
+    theRegion->capacity = _vr_RoundUp(capacity, granularity);
+    theRegion->committed = 0;
+    theRegion->granularity = granularity;
+
+    // The address space returned by the operating system is only aligned on
+    // a page boundary, so reserve an extra granule to be able to start the
+    // region on the next granule boundary
+    theRegion->blockSize = theRegion->capacity + granularity;
+
+#if defined(WINDOWS)
+    theRegion->block = (char *)VirtualAlloc(NULL, theRegion->blockSize, MEM_RESERVE, PAGE_NOACCESS);
+#elif defined(VR_SUPPORTED)
+    theRegion->block = (char *)mmap(NULL, theRegion->blockSize, PROT_NONE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (theRegion->block == (char *)MAP_FAILED)
+        theRegion->block = NULL;
+#else
+    theRegion->block = NULL;
+#endif
+
+    if (theRegion->block == NULL)
+    {
+        free(theRegion);
+        return NULL;
+    }
+
+    blockAddress = (uintptr_t)theRegion->block;
+    theRegion->base = theRegion->block + (_vr_RoundUp(blockAddress, granularity) - blockAddress);
+
+#if defined(VR_SUPPORTED) && !defined(WINDOWS) && defined(MADV_HUGEPAGE)
+    // The advice is only a hint, so the region is usable even if it is refused
+    if (useHugePages)
+        madvise(theRegion->base, theRegion->capacity, MADV_HUGEPAGE);
+#endif
+
+    return theRegion;
+}
+
+/*****************************************************************************
+ vr_Free()
+ Releases the address space of the region, including all committed memory,
+ then sets the caller's region pointer to NULL.
+ *****************************************************************************/
+
+void vr_Free(vmRegionP *pRegion)
+{
+    if (pRegion == NULL || *pRegion == NULL)
+        return;
+
+    if ((*pRegion)->block != NULL)
+    {
+#if defined(WINDOWS)
+        VirtualFree((*pRegion)->block, 0, MEM_RELEASE);
+#elif defined(VR_SUPPORTED)
+        munmap((*pRegion)->block, (*pRegion)->blockSize);
+#endif
+    }
+    (*pRegion)->block = (*pRegion)->base = NULL;
+    (*pRegion)->blockSize = (*pRegion)->capacity = (*pRegion)->committed = 0;
+
+    free(*pRegion);
+    *pRegion = NULL;
+}
+
+/*****************************************************************************
+ vr_Commit()
+ Ensures that at least the first size bytes of the region are committed,
+ i.e., usable for reading and writing. Newly committed memory is zeroed.
+ The committed memory is never decreased, and its content is preserved.
+ Returns OK on success, NOTOK if size exceeds the capacity of the region
+ or if the operating system cannot commit the memory.
+ *****************************************************************************/
+
+int vr_Commit(vmRegionP theRegion, size_t size)
+{
+    size_t newCommitted = 0;
+
+    if (theRegion == NULL || size > theRegion->capacity)
+        return NOTOK;
+
+    if (size <= theRegion->committed)
+        return OK;
+
+    newCommitted = _vr_RoundUp(size, theRegion->granularity);
+
+#if defined(WINDOWS)
+    if (VirtualAlloc(theRegion->base + theRegion->committed, newCommitted - theRegion->committed,
+                     MEM_COMMIT, PAGE_READWRITE) == NULL)
+        return NOTOK;
+#elif defined(VR_SUPPORTED)
+    if (mprotect(theRegion->base + theRegion->committed, newCommitted - theRegion->committed,
+                 PROT_READ | PROT_WRITE) != 0)
+        return NOTOK;
+#else
+    return NOTOK;
+#endif
+
+    theRegion->committed = newCommitted;
+    return OK;
+}
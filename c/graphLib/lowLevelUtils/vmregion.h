@@ -0,0 +1,63 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#ifndef VMREGION_H
+#define VMREGION_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// includes size_t
+#include <stddef.h>
+
+        /*
+         A virtual memory region is a range of address space that is reserved
+         up front for an array that may grow, with memory pages committed to
+         the region only as the array grows into it. Since the address of the
+         array never changes, growing it never copies the content.
+
+         vr_New() reserves the address space, and vr_Commit() makes the first
+         size bytes of the region usable. If useHugePages is TRUE, then the
+         operating system is advised to back the region with huge pages, where
+         supported, which reduces the TLB misses for large arrays.
+
+         Reserving address space requires support from the operating system,
+         which is indicated by the definition of VR_SUPPORTED. Otherwise,
+         vr_New() returns NULL, so callers can fall back to the heap.
+         */
+
+#if defined(WINDOWS) || defined(__unix__) || defined(__APPLE__)
+#define VR_SUPPORTED
+#endif
+
+// The alignment and commit granularity of a region that uses huge pages
+#define VR_HUGEPAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+        struct vmRegionStruct
+        {
+                char *block, *base;
+                size_t blockSize, capacity, committed, granularity;
+        };
+
+        typedef struct vmRegionStruct vmRegionStruct;
+        typedef vmRegionStruct *vmRegionP;
+
+        vmRegionP vr_New(size_t capacity, int useHugePages);
+        void vr_Free(vmRegionP *pRegion);
+
+        int vr_Commit(vmRegionP theRegion, size_t size);
+
+#define vr_GetBase(theRegion) ((void *)(theRegion)->base)
+#define vr_GetCapacity(theRegion) ((theRegion)->capacity)
+#define vr_GetCommitted(theRegion) ((theRegion)->committed)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
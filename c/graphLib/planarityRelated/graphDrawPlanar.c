@@ -21,19 +21,19 @@ extern void _ClearAllVisitedFlagsInGraph(graphP theGraph);
 
 /* Private functions exported to system */
 
-void _CollectDrawingData(DrawPlanarContext *context, int RootVertex, int W, int WPrevLink);
-int _BreakTie(DrawPlanarContext *context, int BicompRoot, int W, int WPrevLink);
+void _CollectDrawingData(DrawPlanarContext *context, graphInt RootVertex, graphInt W, int WPrevLink);
+int _BreakTie(DrawPlanarContext *context, graphInt BicompRoot, graphInt W, int WPrevLink);
 
 int _ComputeVisibilityRepresentation(DrawPlanarContext *context);
 int _CheckVisibilityRepresentationIntegrity(DrawPlanarContext *context);
 
 /* Private functions */
 int _ComputeVertexPositions(DrawPlanarContext *context);
-int _ComputeVertexPositionsInComponent(DrawPlanarContext *context, int root, int *pIndex);
+int _ComputeVertexPositionsInComponent(DrawPlanarContext *context, graphInt root, graphInt *pIndex);
 int _ComputeEdgePositions(DrawPlanarContext *context);
 int _ComputeVertexRanges(DrawPlanarContext *context);
 int _ComputeEdgeRanges(DrawPlanarContext *context);
-int _GetNextExternalFaceVertex(graphP theGraph, int curVertex, int *pPrevLink);
+graphInt _GetNextExternalFaceVertex(graphP theGraph, graphInt curVertex, int *pPrevLink);
 char *_RenderToString(graphP theEmbedding);
 
 #ifdef LOGGING
@@ -84,7 +84,7 @@ int _ComputeVisibilityRepresentation(DrawPlanarContext *context)
 int _ComputeVertexPositions(DrawPlanarContext *context)
 {
     graphP theEmbedding = context->theGraph;
-    int v, vertpos;
+    graphInt v, vertpos;
 
     vertpos = 0;
     for (v = gp_LowerBoundVertices(theEmbedding); v < gp_UpperBoundVertices(theEmbedding); ++v)
@@ -194,11 +194,11 @@ int _ComputeVertexPositions(DrawPlanarContext *context)
   based on the between/beyond indicator stored in W during embedding.
  ********************************************************************/
 
-int _ComputeVertexPositionsInComponent(DrawPlanarContext *context, int root, int *pVertpos)
+int _ComputeVertexPositionsInComponent(DrawPlanarContext *context, graphInt root, graphInt *pVertpos)
 {
     graphP theEmbedding = context->theGraph;
     listCollectionP theOrder = LCNew(gp_UpperBoundVertices(theEmbedding));
-    int W, P, C, V, e;
+    graphInt W, P, C, V, e;
 
     if (theOrder == NULL)
         return NOTOK;
@@ -301,7 +301,7 @@ int _ComputeVertexPositionsInComponent(DrawPlanarContext *context, int root, int
  ********************************************************************/
 void _LogEdgeList(graphP theEmbedding, listCollectionP edgeList, int edgeListHead)
 {
-    int eIndex = edgeListHead, e, eTwin;
+    graphInt eIndex = edgeListHead, e, eTwin;
 
     _gp_Log("EdgeList: [ ");
 
@@ -342,16 +342,16 @@ void _LogEdgeList(graphP theEmbedding, listCollectionP edgeList, int edgeListHea
 int _ComputeEdgePositions(DrawPlanarContext *context)
 {
     graphP theEmbedding = context->theGraph;
-    int *vertexOrder = NULL;
+    graphInt *vertexOrder = NULL;
     listCollectionP edgeList = NULL;
-    int edgeListHead, edgeListInsertPoint;
-    int e, eTwin, eCur, v, vpos, epos, eIndex;
+    graphInt edgeListHead, edgeListInsertPoint;
+    graphInt e, eTwin, eCur, v, vpos, epos, eIndex;
 
     _gp_LogLine("\ngraphDrawPlanar.c/_ComputeEdgePositions() start");
 
     // Sort the vertices by vertical position (in linear time)
 
-    if ((vertexOrder = (int *)malloc(gp_GetN(theEmbedding) * sizeof(int))) == NULL)
+    if ((vertexOrder = (graphInt *)malloc(gp_GetN(theEmbedding) * sizeof(graphInt))) == NULL)
     {
         return NOTOK;
     }
@@ -523,7 +523,7 @@ int _ComputeEdgePositions(DrawPlanarContext *context)
 int _ComputeVertexRanges(DrawPlanarContext *context)
 {
     graphP theEmbedding = context->theGraph;
-    int v = NIL, e = NIL, min = NIL, max = NIL;
+    graphInt v = NIL, e = NIL, min = NIL, max = NIL;
 
     for (v = gp_LowerBoundVertices(theEmbedding); v < gp_UpperBoundVertices(theEmbedding); ++v)
     {
@@ -569,7 +569,7 @@ int _ComputeVertexRanges(DrawPlanarContext *context)
 int _ComputeEdgeRanges(DrawPlanarContext *context)
 {
     graphP theEmbedding = context->theGraph;
-    int e, eTwin, v1, v2, pos1, pos2;
+    graphInt e, eTwin, v1, v2, pos1, pos2;
 
     // Deleted edges are not supported, nor should they be in the embedding, so
     // this is just a reality check that avoids an in-use test inside the loop
@@ -609,9 +609,9 @@ int _ComputeEdgeRanges(DrawPlanarContext *context)
  Uses the extFace links to traverse to the next vertex on the external
  face given a current vertex and the link that points to its predecessor.
  ********************************************************************/
-int _GetNextExternalFaceVertex(graphP theGraph, int curVertex, int *pPrevLink)
+graphInt _GetNextExternalFaceVertex(graphP theGraph, graphInt curVertex, int *pPrevLink)
 {
-    int nextVertex = gp_GetExtFaceVertex(theGraph, curVertex, 1 ^ *pPrevLink);
+    graphInt nextVertex = gp_GetExtFaceVertex(theGraph, curVertex, 1 ^ *pPrevLink);
 
     // If the two links in the new vertex are not equal, then only one points
     // back to the current vertex, and it is the new prev link.
@@ -641,10 +641,11 @@ int _GetNextExternalFaceVertex(graphP theGraph, int curVertex, int *pPrevLink)
  root being merged).
  ********************************************************************/
 
-void _CollectDrawingData(DrawPlanarContext *context, int RootVertex, int W, int WPrevLink)
+void _CollectDrawingData(DrawPlanarContext *context, graphInt RootVertex, graphInt W, int WPrevLink)
 {
     graphP theEmbedding = context->theGraph;
-    int K, Parent, BicompRoot, DFSChild, direction, descendant;
+    graphInt K, Parent, BicompRoot, DFSChild, descendant;
+    int direction;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)RootVertex;
@@ -725,14 +726,14 @@ void _CollectDrawingData(DrawPlanarContext *context, int RootVertex, int W, int
  optimize the post-processing calculation of vertex positions.
  ********************************************************************/
 
-int _BreakTie(DrawPlanarContext *context, int BicompRoot, int W, int WPrevLink)
+int _BreakTie(DrawPlanarContext *context, graphInt BicompRoot, graphInt W, int WPrevLink)
 {
     graphP theEmbedding = context->theGraph;
 
     /* First we get the predecessor of W. */
 
-    int WPredNextLink = 1 ^ WPrevLink,
-        WPred = _GetNextExternalFaceVertex(theEmbedding, W, &WPredNextLink);
+    int WPredNextLink = 1 ^ WPrevLink;
+    graphInt WPred = _GetNextExternalFaceVertex(theEmbedding, W, &WPredNextLink);
 
     _gp_LogLine("\ngraphDrawPlanar.c/::_BreakTie() start");
     _gp_LogLine(_gp_MakeLogStr4("_BreakTie(BicompRoot=%d, W=%d, W_in=%d) WPred=%d",
@@ -754,7 +755,7 @@ int _BreakTie(DrawPlanarContext *context, int BicompRoot, int W, int WPrevLink)
     /* If there is a tie, it can now be resolved. */
     if (gp_IsVertex(theEmbedding, context->VI[W].tie[WPrevLink]))
     {
-        int DFSChild = context->VI[W].tie[WPrevLink];
+        graphInt DFSChild = context->VI[W].tie[WPrevLink];
 
         /* Set the two ancestor variables that contextualize putting W 'between'
             or 'beyond' its parent relative to what. */
@@ -809,11 +810,11 @@ char *_RenderToString(graphP theEmbedding)
 
     if (context != NULL)
     {
-        int N = gp_GetN(theEmbedding);
-        int M = gp_GetM(theEmbedding);
+        graphInt N = gp_GetN(theEmbedding);
+        graphInt M = gp_GetM(theEmbedding);
         int zeroBasedVertexOffset = 0;
-        int n, m, v, vRange, eRange, Mid, Pos;
-        int e;
+        graphInt n, m, v, vRange, eRange, Mid, Pos;
+        graphInt e;
         char *visRep = (char *)malloc(sizeof(char) * ((M + 1) * 2 * N + 1));
         char numBuffer[32];
 
@@ -862,7 +863,7 @@ char *_RenderToString(graphP theEmbedding)
 
             // Draw vertex label
             Mid = (context->VI[v].start + context->VI[v].end) / 2;
-            sprintf(numBuffer, "%d", v - zeroBasedVertexOffset);
+            sprintf(numBuffer, "%" GRAPHINT_FMT, v - zeroBasedVertexOffset);
             if ((unsigned)(context->VI[v].end - context->VI[v].start + 1) >= strlen(numBuffer))
             {
                 memcpy((char *)visRep + (2 * Pos) * (M + 1) + Mid, (char *)numBuffer, strlen(numBuffer));
@@ -978,7 +979,7 @@ int gp_DrawPlanar_RenderToFile(graphP theEmbedding, char *theFileName)
 int _CheckVisibilityRepresentationIntegrity(DrawPlanarContext *context)
 {
     graphP theEmbedding = context->theGraph;
-    int v, e, eTwin, epos, eposIndex;
+    graphInt v, e, eTwin, epos, eposIndex;
 
     if (sp_NonEmpty(context->theGraph->edgeHoles))
         return NOTOK;
@@ -1107,7 +1108,7 @@ int _CheckVisibilityRepresentationIntegrity(DrawPlanarContext *context)
 
  Returns the vertex's vertical position or -1 on error
  ********************************************************************/
-int gp_DrawPlanar_GetVertexPosition(graphP theEmbedding, int v)
+graphInt gp_DrawPlanar_GetVertexPosition(graphP theEmbedding, int v)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -1132,7 +1133,7 @@ int gp_DrawPlanar_GetVertexPosition(graphP theEmbedding, int v)
 
  Returns the vertex's horizontal start position or -1 on error
  ********************************************************************/
-int gp_DrawPlanar_GetVertexStart(graphP theEmbedding, int v)
+graphInt gp_DrawPlanar_GetVertexStart(graphP theEmbedding, int v)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -1157,7 +1158,7 @@ int gp_DrawPlanar_GetVertexStart(graphP theEmbedding, int v)
 
  Returns the vertex's horizontal end position or -1 on error
  ********************************************************************/
-int gp_DrawPlanar_GetVertexEnd(graphP theEmbedding, int v)
+graphInt gp_DrawPlanar_GetVertexEnd(graphP theEmbedding, int v)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -1183,7 +1184,7 @@ int gp_DrawPlanar_GetVertexEnd(graphP theEmbedding, int v)
  Returns the edge's horizontal position or -1 on error
  ********************************************************************/
 
-int gp_DrawPlanar_GetEdgePosition(graphP theEmbedding, int e)
+graphInt gp_DrawPlanar_GetEdgePosition(graphP theEmbedding, int e)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -1208,7 +1209,7 @@ int gp_DrawPlanar_GetEdgePosition(graphP theEmbedding, int e)
 
  Returns the edge's vertical start position or -1 on error
  ********************************************************************/
-int gp_DrawPlanar_GetEdgeStart(graphP theEmbedding, int e)
+graphInt gp_DrawPlanar_GetEdgeStart(graphP theEmbedding, int e)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -1233,7 +1234,7 @@ int gp_DrawPlanar_GetEdgeStart(graphP theEmbedding, int e)
 
  Returns the edge's vertical end position or -1 on error
  ********************************************************************/
-int gp_DrawPlanar_GetEdgeEnd(graphP theEmbedding, int e)
+graphInt gp_DrawPlanar_GetEdgeEnd(graphP theEmbedding, int e)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theEmbedding, DRAWPLANAR_ID, (void *)&context);
@@ -22,7 +22,7 @@ extern "C"
         */
         typedef struct
         {
-                int pos, start, end;
+                graphInt pos, start, end;
         } DrawPlanar_EdgeRec;
 
         typedef DrawPlanar_EdgeRec *DrawPlanar_EdgeRecP;
@@ -52,9 +52,10 @@ extern "C"
         */
         typedef struct
         {
-                int pos, start, end;
-                int drawingFlag, ancestor, ancestorChild;
-                int tie[2];
+                graphInt pos, start, end;
+                int drawingFlag;
+                graphInt ancestor, ancestorChild;
+                graphInt tie[2];
         } DrawPlanar_VertexInfo;
 
         typedef DrawPlanar_VertexInfo *DrawPlanar_VertexInfoP;
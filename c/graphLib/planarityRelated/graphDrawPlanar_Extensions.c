@@ -14,9 +14,9 @@ See the LICENSE.TXT file for licensing information.
 
 extern void _ClearVertexVisitedFlags(graphP theGraph, int);
 
-extern void _CollectDrawingData(DrawPlanarContext *context, int RootVertex, int W, int WPrevLink);
-extern int _BreakTie(DrawPlanarContext *context, int BicompRoot, int W, int WPrevLink);
-extern int _IsolateKuratowskiSubgraph(graphP theGraph, int v, int R);
+extern void _CollectDrawingData(DrawPlanarContext *context, graphInt RootVertex, graphInt W, int WPrevLink);
+extern int _BreakTie(DrawPlanarContext *context, graphInt BicompRoot, graphInt W, int WPrevLink);
+extern int _IsolateKuratowskiSubgraph(graphP theGraph, graphInt v, graphInt R);
 extern int _CheckKuratowskiSubgraphIntegrity(graphP theGraph);
 extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
@@ -27,23 +27,24 @@ extern int _CheckVisibilityRepresentationIntegrity(DrawPlanarContext *context);
 
 void _DrawPlanar_ClearStructures(DrawPlanarContext *context);
 int _DrawPlanar_CreateStructures(DrawPlanarContext *context);
-int _DrawPlanar_InitStructures(DrawPlanarContext *context);
+int _DrawPlanar_InitStructures(DrawPlanarContext *context, graphInt edgeUpperBound);
 
-void _DrawPlanar_InitEdgeRec(DrawPlanarContext *context, int v);
+void _DrawPlanar_InitEdgeRec(DrawPlanarContext *context, graphInt v);
 void _DrawPlanar_InitVertexInfo(DrawPlanarContext *context, int v);
 
 /* Forward declarations of overloading functions */
 
-int _DrawPlanar_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink);
-int _DrawPlanar_HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevLink);
-int _DrawPlanar_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-int _DrawPlanar_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
+int _DrawPlanar_MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink);
+int _DrawPlanar_HandleInactiveVertex(graphP theGraph, graphInt BicompRoot, graphInt *pW, graphInt *pWPrevLink);
+int _DrawPlanar_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+int _DrawPlanar_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
 int _DrawPlanar_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
 int _DrawPlanar_CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 
-int _DrawPlanar_EnsureVertexCapacity(graphP theGraph, int N);
+int _DrawPlanar_EnsureVertexCapacity(graphP theGraph, graphInt N);
 void _DrawPlanar_ResetGraphStorage(graphP theGraph);
-int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity);
+int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity);
+int _DrawPlanar_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc);
 int _DrawPlanar_SortVertices(graphP theGraph);
 
 int _DrawPlanar_ReadPostprocess(graphP theGraph, char *extraData);
@@ -130,6 +131,7 @@ int gp_ExtendWith_DrawPlanar(graphP theGraph)
     context->functions.fpEnsureVertexCapacity = _DrawPlanar_EnsureVertexCapacity;
     context->functions.fpResetGraphStorage = _DrawPlanar_ResetGraphStorage;
     context->functions.fpEnsureEdgeCapacity = _DrawPlanar_EnsureEdgeCapacity;
+    context->functions.fpMoveEdge = _DrawPlanar_MoveEdge;
     context->functions.fpSortVertices = _DrawPlanar_SortVertices;
 
     context->functions.fpReadPostprocess = _DrawPlanar_ReadPostprocess;
@@ -158,7 +160,7 @@ int gp_ExtendWith_DrawPlanar(graphP theGraph)
     if (gp_GetN(theGraph) > 0)
     {
         if (_DrawPlanar_CreateStructures(context) != OK ||
-            _DrawPlanar_InitStructures(context) != OK)
+            _DrawPlanar_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         {
             _DrawPlanar_FreeContext(context);
             return NOTOK;
@@ -196,7 +198,7 @@ void _DrawPlanar_ClearStructures(DrawPlanarContext *context)
     if (!context->initialized)
     {
         // Before initialization, the pointers are stray, not NULL
-        // Once NULL or allocated, free() or LCFree() can do the job
+        // Once NULL or allocated, _gp_FreeStorage() can do the job
         context->E = NULL;
         context->VI = NULL;
 
@@ -208,12 +210,12 @@ void _DrawPlanar_ClearStructures(DrawPlanarContext *context)
     {
         if (context->E != NULL)
         {
-            free(context->E);
+            _gp_FreeStorage(context->theGraph, context->E);
             context->E = NULL;
         }
         if (context->VI != NULL)
         {
-            free(context->VI);
+            _gp_FreeStorage(context->theGraph, context->VI);
             context->VI = NULL;
         }
 
@@ -229,14 +231,14 @@ void _DrawPlanar_ClearStructures(DrawPlanarContext *context)
 int _DrawPlanar_CreateStructures(DrawPlanarContext *context)
 {
     graphP theGraph = context->theGraph;
-    int VIsize = gp_UpperBoundVertices(theGraph);
-    int Esize = gp_UpperBoundEdgeStorage(theGraph);
+    graphInt VIsize = gp_UpperBoundVertices(theGraph);
+    graphInt Esize = gp_UpperBoundEdgeStorage(theGraph);
 
     if (gp_GetN(theGraph) <= 0)
         return NOTOK;
 
-    if ((context->E = (DrawPlanar_EdgeRecP)malloc(Esize * sizeof(DrawPlanar_EdgeRec))) == NULL ||
-        (context->VI = (DrawPlanar_VertexInfoP)malloc(VIsize * sizeof(DrawPlanar_VertexInfo))) == NULL)
+    if ((context->E = (DrawPlanar_EdgeRecP)_gp_AllocStorage(context->theGraph, Esize * sizeof(DrawPlanar_EdgeRec))) == NULL ||
+        (context->VI = (DrawPlanar_VertexInfoP)_gp_AllocStorage(context->theGraph, VIsize * sizeof(DrawPlanar_VertexInfo))) == NULL)
     {
         return NOTOK;
     }
@@ -249,8 +251,11 @@ int _DrawPlanar_CreateStructures(DrawPlanarContext *context)
  Intended to be called when N>0.
  Initializes vertex and edge levels only. Graph level is
  already initialized in _CreateStructures()
+ Only the edge records below edgeUpperBound are initialized, which is
+ the edge high water mark when the graph is reset (see
+ gp_ResetGraphStorage()).
  ********************************************************************/
-int _DrawPlanar_InitStructures(DrawPlanarContext *context)
+int _DrawPlanar_InitStructures(DrawPlanarContext *context, graphInt edgeUpperBound)
 {
 #ifdef USE_1BASEDARRAYS
     memset(context->VI, NIL_CHAR, gp_UpperBoundVertices(context->theGraph) * sizeof(DrawPlanar_VertexInfo));
@@ -259,11 +264,11 @@ int _DrawPlanar_InitStructures(DrawPlanarContext *context)
     if (gp_GetN(theGraph) <= 0)
         return NOTOK;
 
-    for (int v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    for (graphInt v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
         _DrawPlanar_InitVertexInfo(context, v);
 #endif
 
-    memset(context->E, 0, gp_UpperBoundEdgeStorage(context->theGraph) * sizeof(DrawPlanar_EdgeRec));
+    memset(context->E, 0, edgeUpperBound * sizeof(DrawPlanar_EdgeRec));
 
     context->drawingDataValid = FALSE;
 
@@ -281,8 +286,8 @@ void *_DrawPlanar_DupContext(void *pContext, void *theGraph)
 
     if (newContext != NULL)
     {
-        int VIsize = gp_UpperBoundVertices((graphP)theGraph);
-        int Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
+        graphInt VIsize = gp_UpperBoundVertices((graphP)theGraph);
+        graphInt Esize = gp_UpperBoundEdgeStorage((graphP)theGraph);
 
         *newContext = *context;
 
@@ -314,7 +319,7 @@ int _DrawPlanar_CopyData(void *dstContext, void *srcContext)
 {
     DrawPlanarContext *dstDrawPlanarContext = (DrawPlanarContext *)dstContext;
     DrawPlanarContext *srcDrawPlanarContext = (DrawPlanarContext *)srcContext;
-    int dstEdgeStorage, srcEdgeStorage;
+    graphInt dstEdgeStorage, srcEdgeStorage, dstHighWaterMark, srcHighWaterMark;
 
     if (dstContext == NULL)
         return NOTOK;
@@ -323,7 +328,7 @@ int _DrawPlanar_CopyData(void *dstContext, void *srcContext)
     // structures in the dstContext to be reset/reinitialized
 
     if (srcContext == NULL)
-        return _DrawPlanar_InitStructures(dstDrawPlanarContext);
+        return _DrawPlanar_InitStructures(dstDrawPlanarContext, gp_UpperBoundEdgeStorage(dstDrawPlanarContext->theGraph));
 
     // ELSE: If there is also a srcContext, then we copy data from it
     dstDrawPlanarContext->drawingDataValid = srcDrawPlanarContext->drawingDataValid;
@@ -336,14 +341,17 @@ int _DrawPlanar_CopyData(void *dstContext, void *srcContext)
     if (dstEdgeStorage < srcEdgeStorage)
         return NOTOK;
 
-    // If the destination graph has more edge capacity, then we make sure that the
-    // extra edge capacity is reinitialized
-    if (dstEdgeStorage > srcEdgeStorage)
-    {
-        memset(dstDrawPlanarContext->E, NIL_CHAR, gp_UpperBoundEdgeStorage(dstDrawPlanarContext->theGraph) * sizeof(DrawPlanar_EdgeRec));
-    }
+    // Only the edge records below the source graph's edge high water mark
+    // can differ from their initial state, so only they are copied. Then,
+    // the destination edge records that were changed above that mark are
+    // reinitialized (gp_CopyGraph() updates the destination mark later)
+    srcHighWaterMark = theGraphEdgeHighWaterMark(srcDrawPlanarContext->theGraph);
+    dstHighWaterMark = theGraphEdgeHighWaterMark(dstDrawPlanarContext->theGraph);
+
+    memcpy(dstDrawPlanarContext->E, srcDrawPlanarContext->E, srcHighWaterMark * sizeof(DrawPlanar_EdgeRec));
 
-    memcpy(dstDrawPlanarContext->E, srcDrawPlanarContext->E, gp_UpperBoundEdgeStorage(dstDrawPlanarContext->theGraph) * sizeof(DrawPlanar_EdgeRec));
+    if (dstHighWaterMark > srcHighWaterMark)
+        memset(dstDrawPlanarContext->E + srcHighWaterMark, NIL_CHAR, (dstHighWaterMark - srcHighWaterMark) * sizeof(DrawPlanar_EdgeRec));
 
     memcpy(dstDrawPlanarContext->VI, srcDrawPlanarContext->VI, gp_UpperBoundVertices(dstDrawPlanarContext->theGraph) * sizeof(DrawPlanar_VertexInfo));
 
@@ -365,7 +373,7 @@ void _DrawPlanar_FreeContext(void *pContext)
 /********************************************************************
  ********************************************************************/
 
-int _DrawPlanar_EnsureVertexCapacity(graphP theGraph, int N)
+int _DrawPlanar_EnsureVertexCapacity(graphP theGraph, graphInt N)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
@@ -381,7 +389,7 @@ int _DrawPlanar_EnsureVertexCapacity(graphP theGraph, int N)
         theGraph->edgeCapacity = DEFAULT_EDGE_CAPACITY_FACTOR * N;
 
     if (_DrawPlanar_CreateStructures(context) != OK ||
-        _DrawPlanar_InitStructures(context) != OK)
+        _DrawPlanar_InitStructures(context, gp_UpperBoundEdgeStorage(theGraph)) != OK)
         return NOTOK;
 
     context->functions.fpEnsureVertexCapacity(theGraph, N);
@@ -399,11 +407,15 @@ void _DrawPlanar_ResetGraphStorage(graphP theGraph)
 
     if (context != NULL)
     {
+        // Only the edge records below the edge high water mark need to be
+        // reset, and resetting the base class lowers the mark
+        graphInt edgeHighWaterMark = theGraphEdgeHighWaterMark(theGraph);
+
         // Reset the graph storage in base class(es)
         context->functions.fpResetGraphStorage(theGraph);
 
         // Do the reset that is specific to this module
-        _DrawPlanar_InitStructures(context);
+        _DrawPlanar_InitStructures(context, edgeHighWaterMark);
     }
 }
 
@@ -411,11 +423,11 @@ void _DrawPlanar_ResetGraphStorage(graphP theGraph)
  _DrawPlanar_EnsureEdgeCapacity()
  ********************************************************************/
 
-int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
+int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, graphInt requiredEdgeCapacity)
 {
     DrawPlanarContext *context = NULL;
     DrawPlanar_EdgeRecP oldE = NULL, newE = NULL;
-    int oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
+    graphInt oldEsize = gp_UpperBoundEdgeStorage(theGraph), newEsize = 0;
 
     // If the requirement is already satisfied, then no work to do
     if (gp_GetEdgeCapacity(theGraph) >= requiredEdgeCapacity)
@@ -440,7 +452,7 @@ int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
     newEsize = gp_UpperBoundEdgeStorage(theGraph);
 
     // We must successfully allocate the new parallel edge array
-    newE = (DrawPlanar_EdgeRecP)malloc(newEsize * sizeof(DrawPlanar_EdgeRec));
+    newE = (DrawPlanar_EdgeRecP)_gp_AllocStorage(theGraph, newEsize * sizeof(DrawPlanar_EdgeRec));
     if (newE == NULL)
         return NOTOK;
 
@@ -452,7 +464,7 @@ int _DrawPlanar_EnsureEdgeCapacity(graphP theGraph, int requiredEdgeCapacity)
 
     // Set the new edge array into the context and free the old one
     context->E = newE;
-    free(oldE);
+    _gp_FreeStorage(theGraph, oldE);
 
     return OK;
 }
@@ -471,7 +483,7 @@ int _DrawPlanar_SortVertices(graphP theGraph)
         // and if the embedding process has already been completed
         if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_DRAWPLANAR)
         {
-            int v, vIndex;
+            graphInt v, vIndex;
             DrawPlanar_VertexInfo temp;
 
             // Relabel the context data members that indicate vertices
@@ -533,7 +545,7 @@ int _DrawPlanar_SortVertices(graphP theGraph)
           or NONEMBEDDABLE if the merge is blocked
  ********************************************************************/
 
-int _DrawPlanar_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
+int _DrawPlanar_MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
@@ -554,7 +566,7 @@ int _DrawPlanar_MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int
 /********************************************************************
  ********************************************************************/
 
-int _DrawPlanar_HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevLink)
+int _DrawPlanar_HandleInactiveVertex(graphP theGraph, graphInt BicompRoot, graphInt *pW, graphInt *pWPrevLink)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
@@ -578,7 +590,7 @@ int _DrawPlanar_HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, i
 /********************************************************************
  ********************************************************************/
 
-int _DrawPlanar_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
+int _DrawPlanar_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
@@ -606,10 +618,31 @@ int _DrawPlanar_HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int
     return NOTOK;
 }
 
+/********************************************************************
+ Moving an edge during gp_CompactEdgeStorage() is augmented by moving
+ the planar drawing-specific data members of its edge records.
+ ********************************************************************/
+
+int _DrawPlanar_MoveEdge(graphP theGraph, graphInt eDst, graphInt eSrc)
+{
+    DrawPlanarContext *context = NULL;
+    gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
+
+    if (context == NULL)
+        return NOTOK;
+
+    context->E[eDst] = context->E[eSrc];
+    context->E[gp_GetTwin(theGraph, eDst)] = context->E[gp_GetTwin(theGraph, eSrc)];
+    _DrawPlanar_InitEdgeRec(context, eSrc);
+    _DrawPlanar_InitEdgeRec(context, gp_GetTwin(theGraph, eSrc));
+
+    return context->functions.fpMoveEdge(theGraph, eDst, eSrc);
+}
+
 /********************************************************************
  ********************************************************************/
 
-void _DrawPlanar_InitEdgeRec(DrawPlanarContext *context, int e)
+void _DrawPlanar_InitEdgeRec(DrawPlanarContext *context, graphInt e)
 {
     context->E[e].pos = 0;
     context->E[e].start = 0;
@@ -635,7 +668,7 @@ void _DrawPlanar_InitVertexInfo(DrawPlanarContext *context, int v)
 /********************************************************************
  ********************************************************************/
 
-int _DrawPlanar_EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
+int _DrawPlanar_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
 {
     DrawPlanarContext *context = NULL;
     gp_FindExtension(theGraph, DRAWPLANAR_ID, (void *)&context);
@@ -720,7 +753,8 @@ int _DrawPlanar_ReadPostprocess(graphP theGraph, char *extraData)
 
         else if (extraData != NULL && strlen(extraData) > 0)
         {
-            int v, tempInt, e;
+            graphInt v, e;
+            int tempInt;
             char line[64], tempChar;
 
             sprintf(line, "<%s>", DRAWPLANAR_NAME);
@@ -736,7 +770,7 @@ int _DrawPlanar_ReadPostprocess(graphP theGraph, char *extraData)
             // Read the N lines of vertex information
             for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
             {
-                sscanf(extraData, " %d%c %d %d %d", &tempInt, &tempChar,
+                sscanf(extraData, " %d%c %" GRAPHINT_SCN " %" GRAPHINT_SCN " %" GRAPHINT_SCN, &tempInt, &tempChar,
                        &context->VI[v].pos,
                        &context->VI[v].start,
                        &context->VI[v].end);
@@ -747,7 +781,7 @@ int _DrawPlanar_ReadPostprocess(graphP theGraph, char *extraData)
             // Read the lines that contain edge information
             for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); ++e)
             {
-                sscanf(extraData, " %d%c %d %d %d", &tempInt, &tempChar,
+                sscanf(extraData, " %d%c %" GRAPHINT_SCN " %" GRAPHINT_SCN " %" GRAPHINT_SCN, &tempInt, &tempChar,
                        &context->E[e].pos,
                        &context->E[e].start,
                        &context->E[e].end);
@@ -788,7 +822,7 @@ int _DrawPlanar_WritePostprocess(graphP theGraph, char **pExtraData)
         }
         else
         {
-            int v, e;
+            graphInt v, e;
             char line[64];
             int maxLineSize = 64, extraDataPos = 0;
             char *extraData = NULL;
@@ -829,7 +863,7 @@ int _DrawPlanar_WritePostprocess(graphP theGraph, char **pExtraData)
 
             for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
             {
-                sprintf(line, "%d: %d %d %d\n", v - zeroBasedVertexOffset,
+                sprintf(line, "%" GRAPHINT_FMT ": %" GRAPHINT_FMT " %" GRAPHINT_FMT " %" GRAPHINT_FMT "\n", v - zeroBasedVertexOffset,
                         context->VI[v].pos,
                         context->VI[v].start,
                         context->VI[v].end);
@@ -841,7 +875,7 @@ int _DrawPlanar_WritePostprocess(graphP theGraph, char **pExtraData)
             {
                 if (gp_EdgeInUse(theGraph, e))
                 {
-                    sprintf(line, "%d: %d %d %d\n", e - zeroBasedEdgeOffset,
+                    sprintf(line, "%" GRAPHINT_FMT ": %" GRAPHINT_FMT " %" GRAPHINT_FMT " %" GRAPHINT_FMT "\n", e - zeroBasedEdgeOffset,
                             context->E[e].pos,
                             context->E[e].start,
                             context->E[e].end);
@@ -6,6 +6,15 @@ See the LICENSE.TXT file for licensing information.
 
 #include <stdlib.h>
 
+#ifdef USE_EMBED_STATS
+#include <string.h>
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif
+
 // This source file implements the main graph planarity/outerplanarity method, gp_Embed()
 #include "../planarityRelated/graphPlanarity.h"
 #include "../planarityRelated/graphPlanarity.private.h"
@@ -14,6 +23,7 @@ See the LICENSE.TXT file for licensing information.
 
 // Includes needed by _gp_EmbedFlagsValid()
 #include "graphDrawPlanar.private.h"
+#include "graphMaximalPlanarSubgraph.private.h"
 #include "../homeomorphSearch/graphK23Search.private.h"
 #include "../homeomorphSearch/graphK33Search.private.h"
 #include "../homeomorphSearch/graphK4Search.private.h"
@@ -24,14 +34,14 @@ See the LICENSE.TXT file for licensing information.
 /* Imported functions */
 
 extern void _ClearVertexVisitedFlags(graphP theGraph, int);
-extern int _FillVertexVisitedIndexes(graphP theGraph, int FillValue);
+extern int _FillVertexVisitedIndexes(graphP theGraph, graphInt FillValue);
 
-extern int _IsolateKuratowskiSubgraph(graphP theGraph, int v, int R);
-extern int _IsolateOuterplanarObstruction(graphP theGraph, int v, int R);
+extern int _IsolateKuratowskiSubgraph(graphP theGraph, graphInt v, graphInt R);
+extern int _IsolateOuterplanarObstruction(graphP theGraph, graphInt v, graphInt R);
 
-extern void _InitVertexRec(graphP theGraph, int v);
+extern void _InitVertexRec(graphP theGraph, graphInt v);
 
-extern int _gp_FindEdge(graphP theGraph, int u, int v);
+extern int _gp_FindEdge(graphP theGraph, graphInt u, graphInt v);
 
 /* Private functions (some are exported to system only) */
 
@@ -40,26 +50,57 @@ int _EmbeddingInitialize(graphP theGraph);
 int _EmbeddingInitialize_Optimized(graphP theGraph);
 int _EmbeddingInitialize_Incremental(graphP theGraph);
 
-void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, int W, int WPrevLink);
+void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink);
 
-void _InvertVertex(graphP theGraph, int V);
-void _MergeVertex(graphP theGraph, int W, int WPrevLink, int R);
-int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink);
+void _InvertVertex(graphP theGraph, graphInt V);
+void _MergeVertex(graphP theGraph, graphInt W, int WPrevLink, graphInt R);
+int _MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink);
 
-void _WalkUp(graphP theGraph, int v, int e);
-int _WalkDown(graphP theGraph, int v, int RootVertex);
+void _WalkUp(graphP theGraph, graphInt v, graphInt e);
+int _WalkDown(graphP theGraph, graphInt v, graphInt RootVertex);
 
-int _HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevLink);
+int _HandleInactiveVertex(graphP theGraph, graphInt BicompRoot, graphInt *pW, graphInt *pWPrevLink);
 
-int _HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R);
-void _AdvanceFwdEdgeList(graphP theGraph, int v, int child, int nextChild);
+int _HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+void _AdvanceFwdEdgeList(graphP theGraph, graphInt v, graphInt child, graphInt nextChild);
 
-int _EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult);
+int _EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
 int _OrientVerticesInEmbedding(graphP theGraph);
-int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns);
-int _OrientExternalFacePath(graphP theGraph, int u, int v, int w, int x);
+int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns);
+int _OrientExternalFacePath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x);
 int _JoinBicomps(graphP theGraph);
 
+int _gp_UsesBaseEmbedFunctions(graphP theGraph);
+graphInt _CountSimpleEdges(graphP theGraph);
+
+/* Inlinable bodies of the core functions used by the embedding loop. Each
+   function table entry is a wrapper of one of them, and the embedding loop
+   calls them directly when baseFunctions is TRUE (see gp_Embed()). */
+
+GP_FORCEINLINE int _EmbeddingLoop(graphP theGraph, graphInt *pv, int baseFunctions);
+GP_FORCEINLINE void _EmbedBackEdgeToDescendant_Inline(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink);
+GP_FORCEINLINE void _MergeVertex_Inline(graphP theGraph, graphInt W, int WPrevLink, graphInt R);
+GP_FORCEINLINE int _MergeBicomps_Inline(graphP theGraph, int baseFunctions);
+GP_FORCEINLINE void _WalkUp_Inline(graphP theGraph, graphInt v, graphInt e);
+GP_FORCEINLINE int _WalkDown_Inline(graphP theGraph, graphInt v, graphInt RootVertex, int baseFunctions);
+GP_FORCEINLINE int _HandleInactiveVertex_Inline(graphP theGraph, graphInt *pW, graphInt *pWPrevLink);
+
+// The phase timings of gp_Embed() in the embedStats, if USE_EMBED_STATS is
+// defined. A timing member holds the start time of its phase until the phase
+// is stopped, when it receives the elapsed time.
+#ifdef USE_EMBED_STATS
+unsigned long long _GetNanoseconds(void);
+
+#define _ClearEmbedStats(theGraph) memset(&theGraphEmbedStats(theGraph), 0, sizeof(embedStatsStruct))
+#define _StartEmbedStatsPhase(theGraph, member) (theGraphEmbedStats(theGraph).member = _GetNanoseconds())
+#define _StopEmbedStatsPhase(theGraph, member) \
+    (theGraphEmbedStats(theGraph).member = _GetNanoseconds() - theGraphEmbedStats(theGraph).member)
+#else
+#define _ClearEmbedStats(theGraph)
+#define _StartEmbedStatsPhase(theGraph, member)
+#define _StopEmbedStatsPhase(theGraph, member)
+#endif
+
 /********************************************************************
  gp_Embed()
 
@@ -97,17 +138,39 @@ int _JoinBicomps(graphP theGraph);
   The algorithm extension for gp_Embed() is encoded in the embedFlags,
   and the details of the return value can be found in the extension
   module that defines the embedding flag.
+
+  If EMBEDFLAGS_TESTONLY is added to EMBEDFLAGS_PLANAR or
+  EMBEDFLAGS_OUTERPLANAR, then only the return value is computed. A
+  graph that has too many edges to be (outer)planar is rejected before
+  the depth first search, and otherwise the embedding loop stops at the
+  first blocked bicomp without isolating an obstruction, and the
+  embedding is not oriented nor its bicomps joined. The embedFlags of
+  the graph are then set without EMBEDFLAGS_TESTONLY.
+
+  If EMBEDFLAGS_DEFERISOLATION is added to EMBEDFLAGS_PLANAR or
+  EMBEDFLAGS_OUTERPLANAR, then NONEMBEDDABLE is returned as soon as the
+  Walkdown is blocked, without isolating an obstruction, and the graph
+  is left as it was at that point so that gp_IsolateObstruction() can
+  isolate the obstruction later, if it is needed. The embedFlags of the
+  graph are then set without EMBEDFLAGS_DEFERISOLATION.
  ********************************************************************/
 
 int gp_Embed(graphP theGraph, unsigned embedFlags)
 {
-    int v, e, c;
-    int RetVal = OK;
+    graphInt v;
+    int RetVal = OK, useAdjacencyIndex, testOnly = (embedFlags & EMBEDFLAGS_TESTONLY) ? TRUE : FALSE;
+    int deferIsolation = (embedFlags & EMBEDFLAGS_DEFERISOLATION) ? TRUE : FALSE;
+
+    embedFlags &= ~(EMBEDFLAGS_TESTONLY | EMBEDFLAGS_DEFERISOLATION);
 
     // Basic safety checks
     if (theGraph == NULL || embedFlags == 0 || gp_GetEmbedFlags(theGraph) != 0)
         return NOTOK;
 
+    // Only the core algorithms can stop early without an extension's result
+    if ((testOnly || deferIsolation) && embedFlags != EMBEDFLAGS_PLANAR && embedFlags != EMBEDFLAGS_OUTERPLANAR)
+        return NOTOK;
+
     // Preprocessing
     if (!_gp_EmbedFlagsValid(theGraph, embedFlags))
     {
@@ -131,13 +194,186 @@ int gp_Embed(graphP theGraph, unsigned embedFlags)
     }
 
     theGraph->embedFlags = embedFlags;
+    theGraphTestOnly(theGraph) = testOnly;
+    theGraphDeferIsolation(theGraph) = deferIsolation;
+    theGraphIsolationPending(theGraph) = FALSE;
+    _ClearEmbedStats(theGraph);
+
+    // A simple graph with more edges than a maximal (outer)planar graph of
+    // the same order cannot be embedded, and the test can stop right here.
+    // The bound does not hold for graphs with duplicate or loop edges, so
+    // those are embedded to get the same result as without EMBEDFLAGS_TESTONLY.
+    if (testOnly && gp_GetN(theGraph) > 2)
+    {
+        graphInt maxM = embedFlags == EMBEDFLAGS_PLANAR ? 3 * gp_GetN(theGraph) - 6 : 2 * gp_GetN(theGraph) - 3;
+
+        if (gp_GetM(theGraph) > maxM && _CountSimpleEdges(theGraph) == gp_GetM(theGraph))
+            return NONEMBEDDABLE;
+    }
+
+    // The embedder rearranges adjacency lists without maintaining the
+    // adjacency index, so it is discarded and not rebuilt until afterward
+    useAdjacencyIndex = ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex;
+    gp_DisableAdjacencyIndex(theGraph);
 
     // Initialize embedding data structures and allow extension algorithms
     // that overload the function to postprocess the DFS
+    _StartEmbedStatsPhase(theGraph, initializeNanoseconds);
     if (theGraph->functions->fpEmbeddingInitialize(theGraph) != OK)
+    {
+        ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = useAdjacencyIndex;
         return NOTOK;
+    }
+    _StopEmbedStatsPhase(theGraph, initializeNanoseconds);
 
     // In reverse DFI order, embed the back edges from each vertex to its DFS descendants.
+    // The loop is specialized to call the core functions directly, so that they can be
+    // inlined, unless an extension has overloaded any of them in the function table.
+    _StartEmbedStatsPhase(theGraph, mainLoopNanoseconds);
+    if (_gp_UsesBaseEmbedFunctions(theGraph))
+        RetVal = _EmbeddingLoop(theGraph, &v, TRUE);
+    else
+        RetVal = _EmbeddingLoop(theGraph, &v, FALSE);
+    _StopEmbedStatsPhase(theGraph, mainLoopNanoseconds);
+
+    // Postprocessing to orient the embedding and merge any remaining separated bicomps.
+    // Some extension algorithms may overload this function, e.g. to do nothing if they
+    // have no need of an embedding. None is needed if only the result was requested,
+    // and a deferred obstruction is postprocessed by gp_IsolateObstruction().
+    _StartEmbedStatsPhase(theGraph, postprocessNanoseconds);
+    if (!testOnly && !theGraphIsolationPending(theGraph))
+        RetVal = theGraph->functions->fpEmbedPostprocess(theGraph, v, RetVal);
+    _StopEmbedStatsPhase(theGraph, postprocessNanoseconds);
+
+    ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = useAdjacencyIndex;
+    return RetVal;
+}
+
+/********************************************************************
+ gp_IsolateObstruction()
+
+ After gp_Embed() with EMBEDFLAGS_DEFERISOLATION has returned
+ NONEMBEDDABLE, isolates the obstruction that gp_Embed() would have
+ isolated without the flag, i.e., a subgraph homeomorphic to K5 or
+ K3,3 for EMBEDFLAGS_PLANAR, or to K2,3 or K4 for
+ EMBEDFLAGS_OUTERPLANAR, and sets the obstruction minor type. The
+ graph is then as gp_Embed() would have left it, so the result can be
+ checked by gp_TestEmbedResultIntegrity() with NONEMBEDDABLE.
+
+ Returns OK if the obstruction was isolated, or NOTOK if theGraph is
+ NULL, if no isolation is pending, or on internal failure.
+ ********************************************************************/
+
+int gp_IsolateObstruction(graphP theGraph)
+{
+    graphInt v, R;
+    int RetVal = OK, useAdjacencyIndex;
+
+    if (theGraph == NULL || !theGraphIsolationPending(theGraph))
+        return NOTOK;
+
+    theGraphIsolationPending(theGraph) = FALSE;
+    v = theGraphIC(theGraph)->v;
+    R = theGraphIC(theGraph)->r;
+
+    // As in gp_Embed(), the adjacency index is not maintained by the isolator
+    useAdjacencyIndex = ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex;
+    gp_DisableAdjacencyIndex(theGraph);
+
+    if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_PLANAR)
+        RetVal = _IsolateKuratowskiSubgraph(theGraph, v, R);
+    else if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_OUTERPLANAR)
+        RetVal = _IsolateOuterplanarObstruction(theGraph, v, R);
+    else
+        RetVal = NOTOK;
+
+    if (RetVal == OK && theGraph->functions->fpEmbedPostprocess(theGraph, v, NONEMBEDDABLE) != NONEMBEDDABLE)
+        RetVal = NOTOK;
+
+    ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = useAdjacencyIndex;
+    return RetVal;
+}
+
+/********************************************************************
+ _gp_UsesBaseEmbedFunctions()
+
+ Returns TRUE if none of the functions called by the embedding loop of
+ gp_Embed() is overloaded in the function table of theGraph, in which
+ case the loop can call the core functions directly. Returns FALSE if
+ an extension overloads any of them.
+ ********************************************************************/
+
+int _gp_UsesBaseEmbedFunctions(graphP theGraph)
+{
+    graphFunctionTableP functions = theGraph->functions;
+
+    return functions->fpWalkUp == _WalkUp &&
+           functions->fpWalkDown == _WalkDown &&
+           functions->fpMergeBicomps == _MergeBicomps &&
+           functions->fpMergeVertex == _MergeVertex &&
+           functions->fpEmbedBackEdgeToDescendant == _EmbedBackEdgeToDescendant &&
+           functions->fpHandleInactiveVertex == _HandleInactiveVertex;
+}
+
+/********************************************************************
+ _CountSimpleEdges()
+
+ Returns the number of edges of theGraph that remain once the loops
+ are removed and each set of duplicate edges is reduced to one edge.
+ Each vertex marks its neighbors as visited while counting those of
+ greater index that it has not yet seen, then unmarks them.
+ ********************************************************************/
+
+graphInt _CountSimpleEdges(graphP theGraph)
+{
+    graphInt v, w, e, numSimpleEdges = 0;
+
+    _ClearVertexVisitedFlags(theGraph, FALSE);
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        for (e = gp_GetFirstEdge(theGraph, v); gp_IsEdge(theGraph, e); e = gp_GetNextEdge(theGraph, e))
+        {
+            w = gp_GetNeighbor(theGraph, e);
+            if (w > v && !gp_GetVisited(theGraph, w))
+            {
+                gp_SetVisited(theGraph, w);
+                numSimpleEdges++;
+            }
+        }
+
+        for (e = gp_GetFirstEdge(theGraph, v); gp_IsEdge(theGraph, e); e = gp_GetNextEdge(theGraph, e))
+            gp_ClearVisited(theGraph, gp_GetNeighbor(theGraph, e));
+    }
+
+    return numSimpleEdges;
+}
+
+/********************************************************************
+ _EmbeddingLoop()
+
+ The loop of gp_Embed() that embeds, in reverse DFI order, the back
+ edges from each vertex v to its DFS descendants. On return, *pv is
+ the vertex at which the loop stopped.
+
+ If baseFunctions is TRUE, then the core Walkup, Walkdown and the
+ functions they call are invoked directly rather than through the
+ function table. Since this function and those are forcibly inlined,
+ gp_Embed() gets a specialized copy of the loop without the indirect
+ calls, and with the core functions inlined into it, that it uses
+ when _gp_UsesBaseEmbedFunctions() is TRUE. If baseFunctions is FALSE,
+ then every call goes through the function table so that extensions
+ work as before.
+
+ Returns OK if all back edges were embedded, or the first result of a
+ Walkdown that was not OK.
+ ********************************************************************/
+
+GP_FORCEINLINE int _EmbeddingLoop(graphP theGraph, graphInt *pv, int baseFunctions)
+{
+    graphInt v, e, c;
+    int RetVal = OK;
+
     for (v = gp_UpperBoundVertices(theGraph) - 1; v >= gp_LowerBoundVertices(theGraph); --v)
     {
         RetVal = OK;
@@ -147,7 +383,10 @@ int gp_Embed(graphP theGraph, unsigned embedFlags)
         e = gp_GetVertexFwdEdgeList(theGraph, v);
         while (gp_IsEdge(theGraph, e))
         {
-            theGraph->functions->fpWalkUp(theGraph, v, e);
+            if (baseFunctions)
+                _WalkUp_Inline(theGraph, v, e);
+            else
+                theGraph->functions->fpWalkUp(theGraph, v, e);
 
             e = gp_GetNextEdge(theGraph, e);
             if (e == gp_GetVertexFwdEdgeList(theGraph, v))
@@ -162,7 +401,10 @@ int gp_Embed(graphP theGraph, unsigned embedFlags)
         {
             if (gp_IsVertex(theGraph, gp_GetVertexPertinentRootsList(theGraph, c)))
             {
-                RetVal = theGraph->functions->fpWalkDown(theGraph, v, gp_GetBicompRootFromDFSChild(theGraph, c));
+                if (baseFunctions)
+                    RetVal = _WalkDown_Inline(theGraph, v, gp_GetBicompRootFromDFSChild(theGraph, c), TRUE);
+                else
+                    RetVal = theGraph->functions->fpWalkDown(theGraph, v, gp_GetBicompRootFromDFSChild(theGraph, c));
                 // If Walkdown returns OK, then it is OK to proceed with edge addition.
                 // Otherwise, if Walkdown returns NONEMBEDDABLE then we stop edge addition.
                 if (RetVal != OK)
@@ -177,12 +419,61 @@ int gp_Embed(graphP theGraph, unsigned embedFlags)
             break;
     }
 
-    // Postprocessing to orient the embedding and merge any remaining separated bicomps.
-    // Some extension algorithms may overload this function, e.g. to do nothing if they
-    // have no need of an embedding.
-    return theGraph->functions->fpEmbedPostprocess(theGraph, v, RetVal);
+    *pv = v;
+    return RetVal;
 }
 
+/********************************************************************
+ gp_GetEmbedStats()
+
+ Copies into stats the counts and timings gathered by the last gp_Embed()
+ of theGraph (see embedStatsStruct in graphPlanarity.h). They are all
+ zero if gp_Embed() has not been called since the graph was created, or
+ if it gave its result before the embedding initialization, as it does
+ for a graph with too many edges and EMBEDFLAGS_TESTONLY.
+
+ Returns OK on success, NOTOK if theGraph or stats is NULL or if the
+ library was not built with USE_EMBED_STATS.
+ ********************************************************************/
+
+int gp_GetEmbedStats(graphP theGraph, embedStatsP stats)
+{
+    if (theGraph == NULL || stats == NULL)
+        return NOTOK;
+
+#ifdef USE_EMBED_STATS
+    *stats = theGraphEmbedStats(theGraph);
+    return OK;
+#else
+    return NOTOK;
+#endif
+}
+
+#ifdef USE_EMBED_STATS
+/********************************************************************
+ _GetNanoseconds()
+
+ Returns the time in nanoseconds from an arbitrary starting point,
+ by a monotonic clock, for the phase timings of gp_Embed().
+ ********************************************************************/
+
+unsigned long long _GetNanoseconds(void)
+{
+#ifdef WINDOWS
+    LARGE_INTEGER count, frequency;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (unsigned long long)((double)count.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec * 1000000000ULL + (unsigned long long)t.tv_nsec;
+#endif
+}
+#endif
+
 /********************************************************************
  _gp_EmbedFlagsValid()
 
@@ -221,6 +512,13 @@ int _gp_EmbedFlagsValid(graphP theGraph, int embedFlags)
         if (context != NULL)
             return TRUE;
     }
+    else if (embedFlags == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+    {
+        MaximalPlanarSubgraphContext *context = NULL;
+        gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+        if (context != NULL)
+            return TRUE;
+    }
     else if (embedFlags == EMBEDFLAGS_SEARCHFORK23)
     {
         K23SearchContext *context = NULL;
@@ -285,7 +583,7 @@ int _EmbeddingInitialize_Incremental(graphP theGraph)
 {
     stackP theStack;
     unsigned graphFlags;
-    int v, R, uparent, u, uneighbor, e, f, eTwin, ePrev, eNext;
+    graphInt v, R, uparent, u, uneighbor, e, f, eTwin, ePrev, eNext;
 
     _gp_LogLine("graphEmbed.c/_EmbeddingInitialize_Incremental() start\n");
 
@@ -346,9 +644,12 @@ int _EmbeddingInitialize_Incremental(graphP theGraph)
     // and to remove the back edges from being embedded in the graph and instead put
     // their forward edge records in the forward edge lists of the ancestor endpoints
     // (so back edges from a vertex to its descendants can be easily processed).
+    // As in gp_DepthFirstSearch(), the stack holds a vertex and its cursor,
+    // i.e., the tree edge record to the DFS child being explored, for each
+    // vertex on the current DFS tree path.
     theStack = theGraph->theStack;
 
-    if (sp_GetCapacity(theStack) < 2 * 2 * gp_GetM(theGraph) + 2)
+    if (sp_GetCapacity(theStack) < 2 * gp_GetN(theGraph))
         return NOTOK;
 
     sp_ClearStack(theStack);
@@ -363,81 +664,87 @@ int _EmbeddingInitialize_Incremental(graphP theGraph)
         while (sp_NonEmpty(theStack))
         {
             sp_Pop2(theStack, uparent, e);
-            u = gp_IsNotVertex(theGraph, uparent) ? v : gp_GetNeighbor(theGraph, e);
 
-            if (!gp_GetVisited(theGraph, u))
+            if (gp_IsNotVertex(theGraph, uparent))
+                u = v;
+            else
             {
-                gp_SetVisited(theGraph, u);
-
-                if (gp_IsEdge(theGraph, e))
-                {
-                    // If we are visiting a previously unvisited vertex via an existing edge,
-                    // then of course we are arriving via a DFS tree edge from its parent.
-                    if (gp_GetEdgeType(theGraph, e) != EDGE_TYPE_CHILD)
-                        return NOTOK;
+                // Advance the cursor of uparent, from last to first, to its next
+                // tree edge record to a DFS child, which is unvisited. The DFS
+                // resumes from the cursor of the parent of uparent if there is none.
+                e = gp_IsEdge(theGraph, e) ? gp_GetPrevEdge(theGraph, e) : gp_GetLastEdge(theGraph, uparent);
+                while (gp_IsEdge(theGraph, e) &&
+                       (gp_GetEdgeType(theGraph, e) != EDGE_TYPE_CHILD || gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e))))
+                    e = gp_GetPrevEdge(theGraph, e);
+
+                if (gp_IsNotEdge(theGraph, e))
+                    continue;
+
+                sp_Push2(theStack, uparent, e);
+                u = gp_GetNeighbor(theGraph, e);
+            }
 
-                    // Build up the sorted DFS child lists of each vertex (by appending
-                    // the vertex being visited to the sorted DFS child list of its parent)
-                    gp_SetVertexSortedDFSChildList(theGraph, uparent,
-                                                   gp_AppendDFSChild(theGraph, uparent, u));
+            gp_SetVisited(theGraph, u);
 
-                    // Associate each tree edge with the bicomp root associated with the child endpoint
-                    R = gp_GetBicompRootFromDFSChild(theGraph, u);
-                    gp_SetFirstEdge(theGraph, R, e);
-                    gp_SetLastEdge(theGraph, R, e);
-                }
+            if (gp_IsEdge(theGraph, e))
+            {
+                // Build up the sorted DFS child lists of each vertex (by appending
+                // the vertex being visited to the sorted DFS child list of its parent)
+                gp_SetVertexSortedDFSChildList(theGraph, uparent,
+                                               gp_AppendDFSChild(theGraph, uparent, u));
+
+                // Associate each tree edge with the bicomp root associated with the child endpoint
+                R = gp_GetBicompRootFromDFSChild(theGraph, u);
+                gp_SetFirstEdge(theGraph, R, e);
+                gp_SetLastEdge(theGraph, R, e);
+            }
 
-                // Iterate the adjacency list of vertex u
-                e = gp_GetFirstEdge(theGraph, u);
-                while (gp_IsEdge(theGraph, e))
+            // Iterate the adjacency list of vertex u. The DFS children are
+            // reached later, by advancing the cursor of u.
+            e = gp_GetFirstEdge(theGraph, u);
+            while (gp_IsEdge(theGraph, e))
+            {
+                if (gp_GetEdgeType(theGraph, e) == EDGE_TYPE_BACK)
                 {
-                    if (gp_GetEdgeType(theGraph, e) == EDGE_TYPE_CHILD)
+                    // For each back edge record, we get the associated forward
+                    // edge record (into eTwin) and info about it.
+                    eTwin = gp_GetTwin(theGraph, e);
+                    uneighbor = gp_GetNeighbor(theGraph, e);
+                    ePrev = gp_GetPrevEdge(theGraph, eTwin);
+                    eNext = gp_GetNextEdge(theGraph, eTwin);
+
+                    // The forward edge record is then removed from the adjacency list
+                    // of the ancestor (uneighbor), and...
+                    if (gp_IsEdge(theGraph, ePrev))
+                        gp_SetNextEdge(theGraph, ePrev, eNext);
+                    else
+                        gp_SetFirstEdge(theGraph, uneighbor, eNext);
+                    if (gp_IsEdge(theGraph, eNext))
+                        gp_SetPrevEdge(theGraph, eNext, ePrev);
+                    else
+                        gp_SetLastEdge(theGraph, uneighbor, ePrev);
+
+                    // ... placed into the forward edge list of the ancestor (uneighbor)
+                    if (gp_IsEdge(theGraph, f = gp_GetVertexFwdEdgeList(theGraph, uneighbor)))
                     {
-                        // If the edge record points to an unvisited DFS child, then
-                        // that is a new vertex to add to the navigation stack
-                        if (!gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e)))
-                            sp_Push2(theStack, u, e);
+                        ePrev = gp_GetPrevEdge(theGraph, f);
+                        gp_SetPrevEdge(theGraph, eTwin, ePrev);
+                        gp_SetNextEdge(theGraph, eTwin, f);
+                        gp_SetPrevEdge(theGraph, f, eTwin);
+                        gp_SetNextEdge(theGraph, ePrev, eTwin);
                     }
-                    else if (gp_GetEdgeType(theGraph, e) == EDGE_TYPE_BACK)
+                    else
                     {
-                        // For each back edge record, we get the associated forward
-                        // edge record (into eTwin) and info about it.
-                        eTwin = gp_GetTwin(theGraph, e);
-                        uneighbor = gp_GetNeighbor(theGraph, e);
-                        ePrev = gp_GetPrevEdge(theGraph, eTwin);
-                        eNext = gp_GetNextEdge(theGraph, eTwin);
-
-                        // The forward edge record is then removed from the adjacency list
-                        // of the ancestor (uneighbor), and...
-                        if (gp_IsEdge(theGraph, ePrev))
-                            gp_SetNextEdge(theGraph, ePrev, eNext);
-                        else
-                            gp_SetFirstEdge(theGraph, uneighbor, eNext);
-                        if (gp_IsEdge(theGraph, eNext))
-                            gp_SetPrevEdge(theGraph, eNext, ePrev);
-                        else
-                            gp_SetLastEdge(theGraph, uneighbor, ePrev);
-
-                        // ... placed into the forward edge list of the ancestor (uneighbor)
-                        if (gp_IsEdge(theGraph, f = gp_GetVertexFwdEdgeList(theGraph, uneighbor)))
-                        {
-                            ePrev = gp_GetPrevEdge(theGraph, f);
-                            gp_SetPrevEdge(theGraph, eTwin, ePrev);
-                            gp_SetNextEdge(theGraph, eTwin, f);
-                            gp_SetPrevEdge(theGraph, f, eTwin);
-                            gp_SetNextEdge(theGraph, ePrev, eTwin);
-                        }
-                        else
-                        {
-                            gp_SetVertexFwdEdgeList(theGraph, uneighbor, eTwin);
-                            gp_SetPrevEdge(theGraph, eTwin, eTwin);
-                            gp_SetNextEdge(theGraph, eTwin, eTwin);
-                        }
+                        gp_SetVertexFwdEdgeList(theGraph, uneighbor, eTwin);
+                        gp_SetPrevEdge(theGraph, eTwin, eTwin);
+                        gp_SetNextEdge(theGraph, eTwin, eTwin);
                     }
-
-                    e = gp_GetNextEdge(theGraph, e);
                 }
+
+                e = gp_GetNextEdge(theGraph, e);
             }
+
+            sp_Push2(theStack, u, NIL);
         }
     }
 
@@ -542,19 +849,20 @@ int _EmbeddingInitialize_Incremental(graphP theGraph)
 int _EmbeddingInitialize_Optimized(graphP theGraph)
 {
     stackP theStack;
-    int DFI, v, R, uparent, u, uneighbor, e, f, eTwin, ePrev, eNext;
-    int leastValue, child;
+    graphInt DFI, v, R, uparent, u, uneighbor, e, f, eTwin, ePrev, eNext;
+    graphInt leastValue, child;
 
     _gp_LogLine("graphEmbed.c/_EmbeddingInitialize_Optimized() start\n");
 
     theStack = theGraph->theStack;
 
-    // At most we push 2 integers per edge from a vertex to each *unvisited* neighbor
-    // plus one extra (NIL, NIL) at the beginning to represent arriving at a DFS tree
-    // root. We ensure that theGraph's stack has this capacity and, if so, we clear
-    // the stack for use in the depth-first search (DFS).
+    // For each vertex on the current DFS tree path, we push 2 integers, the vertex
+    // and its cursor, i.e., the edge record to the DFS child being explored (or NIL
+    // before the vertex's adjacency list has been examined). We ensure that theGraph's
+    // stack has this capacity and, if so, we clear the stack for use in the depth-first
+    // search (DFS).
 
-    if (sp_GetCapacity(theStack) < 2 * 2 * gp_GetM(theGraph) + 2)
+    if (sp_GetCapacity(theStack) < 2 * gp_GetN(theGraph))
         return NOTOK;
 
     sp_ClearStack(theStack);
@@ -579,98 +887,118 @@ int _EmbeddingInitialize_Optimized(graphP theGraph)
         {
             sp_Pop2(theStack, uparent, e);
 
-            // For vertex uparent and edge e, obtain the opposing endpoint u of e
             // If uparent is NIL, then e is also NIL and we have encountered the
             // false edge to the DFS tree root as pushed above.
-            u = gp_IsNotVertex(theGraph, uparent) ? v : gp_GetNeighbor(theGraph, e);
+            if (gp_IsNotVertex(theGraph, uparent))
+                u = v;
+
+            // Otherwise, we advance the cursor e of uparent to its next edge record
+            // that leads to an unvisited vertex u. The adjacency list is advanced from
+            // last to first, so the DFIs are the same as if all edges to unvisited
+            // neighbors had been pushed at once. The back edge records passed along
+            // the way were processed when uparent was visited, and the forward edge
+            // records to visited descendants have been moved to the fwdEdgeList.
+            else
+            {
+                e = gp_IsEdge(theGraph, e) ? gp_GetPrevEdge(theGraph, e) : gp_GetLastEdge(theGraph, uparent);
+                while (gp_IsEdge(theGraph, e) && gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e)))
+                    e = gp_GetPrevEdge(theGraph, e);
+
+                // If there is no such edge, then the DFS resumes from the cursor of
+                // the DFS parent of uparent
+                if (gp_IsNotEdge(theGraph, e))
+                    continue;
+
+                // Otherwise, the cursor is saved and e is a DFS tree edge to u
+                sp_Push2(theStack, uparent, e);
+                u = gp_GetNeighbor(theGraph, e);
+            }
 
-            // We popped an edge to an unvisited vertex, so it is either a DFS tree edge
+            // We have an edge to an unvisited vertex, so it is either a DFS tree edge
             // or a false edge to the DFS tree root (u).
-            if (!gp_GetVisited(theGraph, u))
-            {
-                _gp_LogLine(_gp_MakeLogStr3("v=%d, DFI=%d, parent=%d", u, DFI, uparent));
+            _gp_LogLine(_gp_MakeLogStr3("v=%d, DFI=%d, parent=%d", u, DFI, uparent));
 
-                // (1) Set the DFI and DFS parent
-                gp_SetVisited(theGraph, u);
-                gp_SetIndex(theGraph, u, DFI++);
-                gp_SetVertexParent(theGraph, u, uparent);
+            // (1) Set the DFI and DFS parent
+            gp_SetVisited(theGraph, u);
+            gp_SetIndex(theGraph, u, DFI++);
+            gp_SetVertexParent(theGraph, u, uparent);
 
-                if (gp_IsEdge(theGraph, e))
-                {
-                    // (2) Set the edge type values for tree edges
-                    gp_SetEdgeType(theGraph, e, EDGE_TYPE_CHILD);
-                    gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_PARENT);
-
-                    // (3) Record u in the sortedDFSChildList of uparent
-                    gp_SetVertexSortedDFSChildList(theGraph, uparent,
-                                                   gp_AppendDFSChild(theGraph, uparent, gp_GetIndex(theGraph, u)));
-
-                    // (8) Record e as the first and last edges of the virtual vertex R,
-                    //     a root copy of uparent uniquely associated with child u
-                    R = gp_GetBicompRootFromDFSChild(theGraph, gp_GetIndex(theGraph, u));
-                    gp_SetFirstEdge(theGraph, R, e);
-                    gp_SetLastEdge(theGraph, R, e);
-                }
+            if (gp_IsEdge(theGraph, e))
+            {
+                // (2) Set the edge type values for tree edges
+                gp_SetEdgeType(theGraph, e, EDGE_TYPE_CHILD);
+                gp_SetEdgeType(theGraph, gp_GetTwin(theGraph, e), EDGE_TYPE_PARENT);
+
+                // (3) Record u in the sortedDFSChildList of uparent
+                gp_SetVertexSortedDFSChildList(theGraph, uparent,
+                                               gp_AppendDFSChild(theGraph, uparent, gp_GetIndex(theGraph, u)));
+
+                // (8) Record e as the first and last edges of the virtual vertex R,
+                //     a root copy of uparent uniquely associated with child u
+                R = gp_GetBicompRootFromDFSChild(theGraph, gp_GetIndex(theGraph, u));
+                gp_SetFirstEdge(theGraph, R, e);
+                gp_SetLastEdge(theGraph, R, e);
+            }
 
-                // (5) Initialize the least ancestor value
-                gp_SetVertexLeastAncestor(theGraph, u, gp_GetIndex(theGraph, u));
+            // (5) Initialize the least ancestor value
+            gp_SetVertexLeastAncestor(theGraph, u, gp_GetIndex(theGraph, u));
 
-                // Push edges to all unvisited neighbors. These will be either
-                // tree edges to children or forward edge records to descendants
-                // Edges that are not pushed are either marked as back edges or as
-                // a tree edge if it leads back to the immediate DFS parent.
-                e = gp_GetFirstEdge(theGraph, u);
-                while (gp_IsEdge(theGraph, e))
+            // The edges to visited neighbors are either marked as back edges or
+            // are the tree edge that leads back to the immediate DFS parent. The
+            // edges to unvisited neighbors are explored later by advancing the
+            // cursor of u, and they will be either tree edges to children or
+            // forward edge records to descendants.
+            e = gp_GetFirstEdge(theGraph, u);
+            while (gp_IsEdge(theGraph, e))
+            {
+                if (gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e)) &&
+                    gp_GetEdgeType(theGraph, e) != EDGE_TYPE_PARENT)
                 {
-                    if (!gp_GetVisited(theGraph, gp_GetNeighbor(theGraph, e)))
+                    // (2) Set the edge type values for back edges
+                    gp_SetEdgeType(theGraph, e, EDGE_TYPE_BACK);
+                    eTwin = gp_GetTwin(theGraph, e);
+                    gp_SetEdgeType(theGraph, eTwin, EDGE_TYPE_FORWARD);
+
+                    // (4) Move the twin of back edge record e to the sorted FwdEdgeList of the ancestor
+                    uneighbor = gp_GetNeighbor(theGraph, e);
+                    ePrev = gp_GetPrevEdge(theGraph, eTwin);
+                    eNext = gp_GetNextEdge(theGraph, eTwin);
+
+                    if (gp_IsEdge(theGraph, ePrev))
+                        gp_SetNextEdge(theGraph, ePrev, eNext);
+                    else
+                        gp_SetFirstEdge(theGraph, uneighbor, eNext);
+                    if (gp_IsEdge(theGraph, eNext))
+                        gp_SetPrevEdge(theGraph, eNext, ePrev);
+                    else
+                        gp_SetLastEdge(theGraph, uneighbor, ePrev);
+
+                    if (gp_IsEdge(theGraph, f = gp_GetVertexFwdEdgeList(theGraph, uneighbor)))
                     {
-                        sp_Push2(theStack, u, e);
+                        ePrev = gp_GetPrevEdge(theGraph, f);
+                        gp_SetPrevEdge(theGraph, eTwin, ePrev);
+                        gp_SetNextEdge(theGraph, eTwin, f);
+                        gp_SetPrevEdge(theGraph, f, eTwin);
+                        gp_SetNextEdge(theGraph, ePrev, eTwin);
                     }
-                    else if (gp_GetEdgeType(theGraph, e) != EDGE_TYPE_PARENT)
+                    else
                     {
-                        // (2) Set the edge type values for back edges
-                        gp_SetEdgeType(theGraph, e, EDGE_TYPE_BACK);
-                        eTwin = gp_GetTwin(theGraph, e);
-                        gp_SetEdgeType(theGraph, eTwin, EDGE_TYPE_FORWARD);
-
-                        // (4) Move the twin of back edge record e to the sorted FwdEdgeList of the ancestor
-                        uneighbor = gp_GetNeighbor(theGraph, e);
-                        ePrev = gp_GetPrevEdge(theGraph, eTwin);
-                        eNext = gp_GetNextEdge(theGraph, eTwin);
-
-                        if (gp_IsEdge(theGraph, ePrev))
-                            gp_SetNextEdge(theGraph, ePrev, eNext);
-                        else
-                            gp_SetFirstEdge(theGraph, uneighbor, eNext);
-                        if (gp_IsEdge(theGraph, eNext))
-                            gp_SetPrevEdge(theGraph, eNext, ePrev);
-                        else
-                            gp_SetLastEdge(theGraph, uneighbor, ePrev);
-
-                        if (gp_IsEdge(theGraph, f = gp_GetVertexFwdEdgeList(theGraph, uneighbor)))
-                        {
-                            ePrev = gp_GetPrevEdge(theGraph, f);
-                            gp_SetPrevEdge(theGraph, eTwin, ePrev);
-                            gp_SetNextEdge(theGraph, eTwin, f);
-                            gp_SetPrevEdge(theGraph, f, eTwin);
-                            gp_SetNextEdge(theGraph, ePrev, eTwin);
-                        }
-                        else
-                        {
-                            gp_SetVertexFwdEdgeList(theGraph, uneighbor, eTwin);
-                            gp_SetPrevEdge(theGraph, eTwin, eTwin);
-                            gp_SetNextEdge(theGraph, eTwin, eTwin);
-                        }
-
-                        // (5) Update the leastAncestor value for the vertex u
-                        uneighbor = gp_GetIndex(theGraph, uneighbor);
-                        if (uneighbor < gp_GetVertexLeastAncestor(theGraph, u))
-                            gp_SetVertexLeastAncestor(theGraph, u, uneighbor);
+                        gp_SetVertexFwdEdgeList(theGraph, uneighbor, eTwin);
+                        gp_SetPrevEdge(theGraph, eTwin, eTwin);
+                        gp_SetNextEdge(theGraph, eTwin, eTwin);
                     }
 
-                    e = gp_GetNextEdge(theGraph, e);
+                    // (5) Update the leastAncestor value for the vertex u
+                    uneighbor = gp_GetIndex(theGraph, uneighbor);
+                    if (uneighbor < gp_GetVertexLeastAncestor(theGraph, u))
+                        gp_SetVertexLeastAncestor(theGraph, u, uneighbor);
                 }
+
+                e = gp_GetNextEdge(theGraph, e);
             }
+
+            // Push u with a NIL cursor, so its adjacency list is explored next
+            sp_Push2(theStack, u, NIL);
         }
     }
 
@@ -750,9 +1078,14 @@ int _EmbeddingInitialize_Optimized(graphP theGraph)
  that will be replaced at each endpoint of the back edge.
  ********************************************************************/
 
-void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, int W, int WPrevLink)
+void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink)
 {
-    int fwdEdgeRec, backEdgeRec, parentCopy;
+    _EmbedBackEdgeToDescendant_Inline(theGraph, RootSide, RootVertex, W, WPrevLink);
+}
+
+GP_FORCEINLINE void _EmbedBackEdgeToDescendant_Inline(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink)
+{
+    graphInt fwdEdgeRec, backEdgeRec, parentCopy;
 
     /* We get the two edge records of the back edge (v, W) to embed.
         The Walkup recorded in W's adjacentTo the index of the forward edge record
@@ -808,11 +1141,12 @@ void _EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, int RootVertex, i
  around a vertex's adjacency list, link predecessors would be used.
  ********************************************************************/
 
-void _InvertVertex(graphP theGraph, int W)
+void _InvertVertex(graphP theGraph, graphInt W)
 {
-    int e, temp;
+    graphInt e, temp;
 
     _gp_LogLine(_gp_MakeLogStr1("graphEmbed.c/_InvertVertex() W=%d", W));
+    _gp_CountEmbedStat(theGraph, invertVertexFlips);
 
     // Swap the links in all of the edge records of the adjacency list
     e = gp_GetFirstEdge(theGraph, W);
@@ -861,12 +1195,18 @@ void _InvertVertex(graphP theGraph, int W)
  edges that attach W to the external face cycle of the containing bicomp.
  ********************************************************************/
 
-void _MergeVertex(graphP theGraph, int W, int WPrevLink, int R)
+void _MergeVertex(graphP theGraph, graphInt W, int WPrevLink, graphInt R)
 {
-    int e, eTwin, e_w, e_r, e_ext;
+    _MergeVertex_Inline(theGraph, W, WPrevLink, R);
+}
+
+GP_FORCEINLINE void _MergeVertex_Inline(graphP theGraph, graphInt W, int WPrevLink, graphInt R)
+{
+    graphInt e, eTwin, e_w, e_r, e_ext;
 
     _gp_LogLine(_gp_MakeLogStr4("graphEmbed.c/_MergeVertex() W=%d, W_in=%d, R=%d, R_out=%d",
                                 W, WPrevLink, R, 1 ^ WPrevLink));
+    _gp_CountEmbedStat(theGraph, mergeVertexCalls);
 
     // All edge records leading _into_ R _from_ its neighbors must be changed
     // to say that they are leading into W.
@@ -931,10 +1271,8 @@ void _MergeVertex(graphP theGraph, int W, int WPrevLink, int R)
          OK in order to cause Walkdown to terminate immediately.
 ********************************************************************/
 
-int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
+int _MergeBicomps(graphP theGraph, graphInt v, graphInt RootVertex, graphInt W, int WPrevLink)
 {
-    int R, Rout, Z, ZPrevLink, e, extFaceVertex;
-
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)v;
     // Suppresses an unused-parameter warning for a parameter we intend to keep
@@ -944,6 +1282,15 @@ int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)WPrevLink;
 
+    return _MergeBicomps_Inline(theGraph, FALSE);
+}
+
+GP_FORCEINLINE int _MergeBicomps_Inline(graphP theGraph, int baseFunctions)
+{
+    graphInt R, Rout, Z, ZPrevLink, e, extFaceVertex;
+
+    _gp_CountEmbedStat(theGraph, mergeBicompsCalls);
+
     while (sp_NonEmpty(theGraph->theStack))
     {
         sp_Pop2(theGraph->theStack, R, Rout);
@@ -1015,7 +1362,10 @@ int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
         }
 
         // Now we push R into Z, eliminating R
-        theGraph->functions->fpMergeVertex(theGraph, Z, ZPrevLink, R);
+        if (baseFunctions)
+            _MergeVertex_Inline(theGraph, Z, ZPrevLink, R);
+        else
+            theGraph->functions->fpMergeVertex(theGraph, Z, ZPrevLink, R);
     }
 
     return OK;
@@ -1058,11 +1408,17 @@ int _MergeBicomps(graphP theGraph, int v, int RootVertex, int W, int WPrevLink)
  Walkup is done.
  ********************************************************************/
 
-void _WalkUp(graphP theGraph, int v, int e)
+void _WalkUp(graphP theGraph, graphInt v, graphInt e)
 {
-    int W = gp_GetNeighbor(theGraph, e);
-    int Zig = W, Zag = W, ZigPrevLink = 1, ZagPrevLink = 0;
-    int nextZig, nextZag, R;
+    _WalkUp_Inline(theGraph, v, e);
+}
+
+GP_FORCEINLINE void _WalkUp_Inline(graphP theGraph, graphInt v, graphInt e)
+{
+    graphInt W = gp_GetNeighbor(theGraph, e);
+    graphInt Zig = W, Zag = W;
+    int ZigPrevLink = 1, ZagPrevLink = 0;
+    graphInt nextZig, nextZag, R;
 
     // Start by marking W as being directly pertinent
     gp_SetVertexPertinentEdge(theGraph, W, e);
@@ -1072,6 +1428,8 @@ void _WalkUp(graphP theGraph, int v, int e)
     // (or until the visited info optimization breaks the loop)
     while (Zig != v)
     {
+        _gp_CountEmbedStat(theGraph, walkUpSteps);
+
         // Obtain the next vertex in a first direction and determine if it is a bicomp root
         if (gp_IsVirtualVertex(theGraph, (nextZig = gp_GetExtFaceVertex(theGraph, Zig, 1 ^ ZigPrevLink))))
         {
@@ -1229,10 +1587,16 @@ void _WalkUp(graphP theGraph, int v, int e)
           NOTOK for an internal code failure
  ********************************************************************/
 
-int _WalkDown(graphP theGraph, int v, int RootVertex)
+int _WalkDown(graphP theGraph, graphInt v, graphInt RootVertex)
+{
+    return _WalkDown_Inline(theGraph, v, RootVertex, FALSE);
+}
+
+GP_FORCEINLINE int _WalkDown_Inline(graphP theGraph, graphInt v, graphInt RootVertex, int baseFunctions)
 {
-    int RetVal, W, WPrevLink, R, X, XPrevLink, Y, YPrevLink, RootSide, e;
-    int RootEdgeChild = gp_GetDFSChildFromBicompRoot(theGraph, RootVertex);
+    graphInt W, WPrevLink, R, X, Y, e;
+    int RetVal, XPrevLink, YPrevLink, RootSide;
+    graphInt RootEdgeChild = gp_GetDFSChildFromBicompRoot(theGraph, RootVertex);
 
     sp_ClearStack(theGraph->theStack);
 
@@ -1249,6 +1613,8 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
 
         while (W != RootVertex)
         {
+            _gp_CountEmbedStat(theGraph, walkDownIterations);
+
             // Detect unembedded back edge descendant endpoint W
             if (gp_IsEdge(theGraph, gp_GetVertexPertinentEdge(theGraph, W)))
             {
@@ -1256,10 +1622,17 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
                 // edge to W to form a new proper face in the embedding.
                 if (sp_NonEmpty(theGraph->theStack))
                 {
-                    if ((RetVal = theGraph->functions->fpMergeBicomps(theGraph, v, RootVertex, W, WPrevLink)) != OK)
+                    if (baseFunctions)
+                        RetVal = _MergeBicomps_Inline(theGraph, TRUE);
+                    else
+                        RetVal = theGraph->functions->fpMergeBicomps(theGraph, v, RootVertex, W, WPrevLink);
+                    if (RetVal != OK)
                         return RetVal;
                 }
-                theGraph->functions->fpEmbedBackEdgeToDescendant(theGraph, RootSide, RootVertex, W, WPrevLink);
+                if (baseFunctions)
+                    _EmbedBackEdgeToDescendant_Inline(theGraph, RootSide, RootVertex, W, WPrevLink);
+                else
+                    theGraph->functions->fpEmbedBackEdgeToDescendant(theGraph, RootSide, RootVertex, W, WPrevLink);
 
                 // Clear W's pertinentEdge since the forward edge record it contained has been embedded
                 gp_SetVertexPertinentEdge(theGraph, W, NIL);
@@ -1346,6 +1719,7 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
                     }
                     gp_SetExtFaceVertex(theGraph, RootVertex, RootSide, W);
                     gp_SetExtFaceVertex(theGraph, W, WPrevLink, RootVertex);
+                    _gp_CountEmbedStat(theGraph, extFaceShortCircuits);
 
                     // Terminate the Walkdown traversal since it encountered the stopping vertex
                     break;
@@ -1358,7 +1732,11 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
                 // inactive vertices, but the extFace links above achieve the same result with less work.
                 else
                 {
-                    if (theGraph->functions->fpHandleInactiveVertex(theGraph, RootVertex, &W, &WPrevLink) != OK)
+                    if (baseFunctions)
+                        RetVal = _HandleInactiveVertex_Inline(theGraph, &W, &WPrevLink);
+                    else
+                        RetVal = theGraph->functions->fpHandleInactiveVertex(theGraph, RootVertex, &W, &WPrevLink);
+                    if (RetVal != OK)
                         return NOTOK;
                 }
             }
@@ -1369,7 +1747,7 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
     // to descendants in the subtree of the child of v associated with the bicomp RootVertex.
     if (gp_IsEdge(theGraph, e = gp_GetVertexFwdEdgeList(theGraph, v)) && RootEdgeChild < gp_GetNeighbor(theGraph, e))
     {
-        int nextChild = gp_GetVertexNextDFSChild(theGraph, v, RootEdgeChild);
+        graphInt nextChild = gp_GetVertexNextDFSChild(theGraph, v, RootEdgeChild);
 
         // We finish detecting  that the Walkdown was blocked from embedding all forward edge records into
         // the RootEdgeChild subtree if there the next child's DFI is greater than the descendant endpoint
@@ -1398,8 +1776,11 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
  The core planarity/outerplanarity algorithm handles the blockage
  by isolating an embedding obstruction (a subgraph homeomorphic to
  K_{3,3} or K_5 for planarity, or a subgraph homeomorphic to K_{2,3}
- or K_4 for outerplanarity). Then NONEMBEDDABLE is returned so that
- the WalkDown can terminate.
+ or K_4 for outerplanarity), unless gp_Embed() was given
+ EMBEDFLAGS_TESTONLY. Then NONEMBEDDABLE is returned so that the
+ WalkDown can terminate. With EMBEDFLAGS_DEFERISOLATION, v and the
+ RootVertex are only saved in the isolator context, for a later
+ gp_IsolateObstruction().
 
  Extension algorithms are able to clear some of the blockages, in
  which case OK is returned to indicate that the WalkDown can proceed.
@@ -1409,13 +1790,25 @@ int _WalkDown(graphP theGraph, int v, int RootVertex)
          NOTOK for internal error
  ********************************************************************/
 
-int _HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
+int _HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
 {
     int RetVal = NONEMBEDDABLE;
 
+    if (theGraphTestOnly(theGraph))
+        return RetVal;
+
     if (R != RootVertex)
         sp_Push2(theGraph->theStack, R, 0);
 
+    // The stack and the rest of the embedding state are left as they are
+    if (theGraphDeferIsolation(theGraph))
+    {
+        theGraphIC(theGraph)->v = v;
+        theGraphIC(theGraph)->r = RootVertex;
+        theGraphIsolationPending(theGraph) = TRUE;
+        return RetVal;
+    }
+
     if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_PLANAR)
     {
         if (_IsolateKuratowskiSubgraph(theGraph, v, RootVertex) != OK)
@@ -1480,9 +1873,9 @@ int _HandleBlockedBicomp(graphP theGraph, int v, int RootVertex, int R)
  forward edge, or to NIL.
  ********************************************************************/
 
-void _AdvanceFwdEdgeList(graphP theGraph, int v, int child, int nextChild)
+void _AdvanceFwdEdgeList(graphP theGraph, graphInt v, graphInt child, graphInt nextChild)
 {
-    int e = gp_GetVertexFwdEdgeList(theGraph, v);
+    graphInt e = gp_GetVertexFwdEdgeList(theGraph, v);
 
     while (gp_IsEdge(theGraph, e))
     {
@@ -1523,13 +1916,20 @@ void _AdvanceFwdEdgeList(graphP theGraph, int v, int child, int nextChild)
  on the external face.
  ********************************************************************/
 
-int _HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevLink)
+int _HandleInactiveVertex(graphP theGraph, graphInt BicompRoot, graphInt *pW, graphInt *pWPrevLink)
 {
-    int X;
-
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)BicompRoot;
 
+    return _HandleInactiveVertex_Inline(theGraph, pW, pWPrevLink);
+}
+
+GP_FORCEINLINE int _HandleInactiveVertex_Inline(graphP theGraph, graphInt *pW, graphInt *pWPrevLink)
+{
+    graphInt X;
+
+    _gp_CountEmbedStat(theGraph, inactiveVertexSkips);
+
     X = gp_GetExtFaceVertex(theGraph, *pW, 1 ^ *pWPrevLink);
     *pWPrevLink = gp_GetExtFaceVertex(theGraph, X, 0) == *pW ? 0 : 1;
     *pW = X;
@@ -1562,7 +1962,7 @@ int _HandleInactiveVertex(graphP theGraph, int BicompRoot, int *pW, int *pWPrevL
           OK otherwise (e.g. if the graph contains an embedding)
  *****************************************************************/
 
-int _EmbedPostprocess(graphP theGraph, int v, int edgeEmbeddingResult)
+int _EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
 {
     int RetVal = edgeEmbeddingResult;
 
@@ -1599,7 +1999,7 @@ int _OrientVerticesInEmbedding(graphP theGraph)
 
     // For each vertex, obtain the associated bicomp root location and,
     // if it is still in use as a bicomp root, orient the vertices in the bicomp
-    for (int R = gp_LowerBoundVirtualVertices(theGraph); R < gp_UpperBoundVirtualVertices(theGraph); ++R)
+    for (graphInt R = gp_LowerBoundVirtualVertices(theGraph); R < gp_UpperBoundVirtualVertices(theGraph); ++R)
     {
         if (gp_VirtualVertexInUse(theGraph, R))
         {
@@ -1642,10 +2042,10 @@ int _OrientVerticesInEmbedding(graphP theGraph)
  Returns OK on success, NOTOK on implementation failure.
  ********************************************************************/
 
-int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns)
+int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns)
 {
-    int W, e, invertedFlag;
-    int stackBottom = sp_GetCurrentSize(theGraph->theStack);
+    graphInt W, e, invertedFlag;
+    graphInt stackBottom = sp_GetCurrentSize(theGraph->theStack);
 
     sp_Push2(theGraph->theStack, BicompRoot, 0);
 
@@ -1688,7 +2088,7 @@ int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns)
 
 int _JoinBicomps(graphP theGraph)
 {
-    for (int R = gp_LowerBoundVirtualVertices(theGraph); R < gp_UpperBoundVirtualVertices(theGraph); ++R)
+    for (graphInt R = gp_LowerBoundVirtualVertices(theGraph); R < gp_UpperBoundVirtualVertices(theGraph); ++R)
     {
         // If the bicomp root is still active (i.e. an in-use virtual vertex)
         // then merge it with its parent copy vertex (non-virtual)
@@ -1711,9 +2111,10 @@ int _JoinBicomps(graphP theGraph)
  external face).
  ****************************************************************************/
 
-int _OrientExternalFacePath(graphP theGraph, int u, int v, int w, int x)
+int _OrientExternalFacePath(graphP theGraph, graphInt u, graphInt v, graphInt w, graphInt x)
 {
-    int e_u, e_v, e_ulink, e_vlink;
+    graphInt e_u, e_v;
+    int e_ulink, e_vlink;
 
     // Suppresses an unused-parameter warning for a parameter we intend to keep
     (void)w;
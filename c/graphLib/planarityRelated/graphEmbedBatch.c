@@ -0,0 +1,190 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include <stdlib.h>
+
+// This source file implements gp_EmbedBatch(), which embeds many graphs of
+// the same order, one after another, in one reused graph
+#include "graphPlanarity.h"
+#include "graphOuterplanarity.h"
+#include "graphDrawPlanar.h"
+#include "graphMaximalPlanarSubgraph.h"
+#include "../homeomorphSearch/graphK23Search.h"
+#include "../homeomorphSearch/graphK33Search.h"
+#include "../homeomorphSearch/graphK4Search.h"
+
+/* Private functions */
+
+int _ValidateEmbedBatch(graphP theGraph, const graphInt *edgeLists, int numGraphs, graphInt order, graphInt *pMaxM);
+int _ExtendForEmbedBatch(graphP theGraph, unsigned embedFlags);
+
+/********************************************************************
+ gp_EmbedBatch()
+
+ Embeds each of numGraphs graphs of the given order, as gp_Embed() would
+ with the embedFlags, and writes its result (OK or NONEMBEDDABLE) to
+ results[i] and, if minorTypes is not NULL, its obstruction minor type
+ (see gp_GetObstructionMinorType()) to minorTypes[i].
+
+ The graphs are given one after another in edgeLists. Each graph starts
+ with its number of edges m, followed by the 2m endpoints of its edges,
+ so that the i-th edge joins the next two endpoints, as in the pairs of
+ gp_AddEdgesBulk(). The vertices are numbered from
+ gp_LowerBoundVertices() to gp_LowerBoundVertices() + order - 1. Loops
+ are not accepted.
+
+ All of the graphs are loaded, in turn, straight from edgeLists into one
+ working graph that is created, given the edge capacity of the largest
+ graph and extended for the embedFlags only once. Between graphs, the
+ working graph is reset with gp_ResetGraphStorage(), whose cost is
+ proportional to the part of the graph that was used, so no graph or
+ extension is allocated or copied per graph. The embeddings and
+ obstructions are not kept.
+
+ The embedFlags may be those of any algorithm of the library, e.g.,
+ EMBEDFLAGS_SEARCHFORK33, and the working graph is extended accordingly.
+ Since only the results are kept, EMBEDFLAGS_TESTONLY can be added to
+ EMBEDFLAGS_PLANAR or EMBEDFLAGS_OUTERPLANAR to skip the work of
+ producing each embedding or obstruction.
+
+ Returns OK if all graphs were embedded, or NOTOK if the parameters or
+ edgeLists are not valid, on allocation failure, or if gp_Embed() fails
+ on a graph, in which case the results of the graphs before it are
+ written and its result is NOTOK.
+ ********************************************************************/
+
+int gp_EmbedBatch(const graphInt *edgeLists, int numGraphs, graphInt order, unsigned embedFlags,
+                  int *results, unsigned *minorTypes)
+{
+    graphP theGraph = NULL;
+    graphInt maxM = 0, m, v;
+    int i, Result = OK;
+
+    if (edgeLists == NULL || numGraphs < 0 || order < 1 || embedFlags == 0 || results == NULL)
+        return NOTOK;
+
+    if ((theGraph = gp_New()) == NULL ||
+        _ValidateEmbedBatch(theGraph, edgeLists, numGraphs, order, &maxM) != OK ||
+        gp_EnsureEdgeCapacity(theGraph, maxM > 0 ? maxM : 1) != OK ||
+        gp_EnsureVertexCapacity(theGraph, order) != OK ||
+        _ExtendForEmbedBatch(theGraph, embedFlags) != OK)
+    {
+        gp_Free(&theGraph);
+        return NOTOK;
+    }
+
+    for (i = 0; i < numGraphs && Result == OK; i++)
+    {
+        m = *edgeLists++;
+
+        // The vertex indexes are set as when a graph is read, since
+        // gp_Embed() leaves the original vertex numbers in them
+        if (i > 0)
+            gp_ResetGraphStorage(theGraph);
+        for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+            gp_SetIndex(theGraph, v, v);
+
+        if (gp_AddEdgesBulk(theGraph, edgeLists, m) != OK)
+            Result = NOTOK;
+        else
+            Result = gp_Embed(theGraph, embedFlags);
+
+        edgeLists += 2 * m;
+
+        results[i] = Result;
+        if (minorTypes != NULL)
+            minorTypes[i] = Result == NONEMBEDDABLE ? gp_GetObstructionMinorType(theGraph) : MINORTYPE_NONE;
+
+        if (Result == NONEMBEDDABLE)
+            Result = OK;
+    }
+
+    gp_Free(&theGraph);
+
+    return Result;
+}
+
+/********************************************************************
+ _ValidateEmbedBatch()
+
+ Checks that each of the numGraphs graphs in edgeLists has a valid
+ number of edges and that all of its endpoints are vertices of a graph
+ of the given order, other than loops, so that no graph of the
+ batch is embedded unless all of them can be. The greatest number of
+ edges of any graph is returned in *pMaxM.
+
+ Returns OK if edgeLists is valid, NOTOK otherwise.
+ ********************************************************************/
+
+int _ValidateEmbedBatch(graphP theGraph, const graphInt *edgeLists, int numGraphs, graphInt order, graphInt *pMaxM)
+{
+    graphInt m, j, lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt upperBound = lowerBound + order;
+    int i;
+
+    // The vertex lower bound is a constant that does not depend on theGraph
+    (void)theGraph;
+
+    *pMaxM = 0;
+
+    for (i = 0; i < numGraphs; i++)
+    {
+        m = *edgeLists++;
+        if (m < 0 || m > GRAPHINT_MAX / 2)
+            return NOTOK;
+
+        for (j = 0; j < 2 * m; j += 2)
+        {
+            if (edgeLists[j] < lowerBound || edgeLists[j] >= upperBound ||
+                edgeLists[j + 1] < lowerBound || edgeLists[j + 1] >= upperBound ||
+                edgeLists[j] == edgeLists[j + 1])
+                return NOTOK;
+        }
+
+        edgeLists += 2 * m;
+
+        if (*pMaxM < m)
+            *pMaxM = m;
+    }
+
+    return OK;
+}
+
+/********************************************************************
+ _ExtendForEmbedBatch()
+
+ Extends theGraph with the algorithm that gp_Embed() runs for the
+ embedFlags. The planarity and outerplanarity extensions would be
+ added by gp_Embed() itself, but only for the first graph, since
+ gp_ResetGraphStorage() keeps the extensions.
+
+ Returns OK on success, NOTOK for unsupported embedFlags or on failure.
+ ********************************************************************/
+
+int _ExtendForEmbedBatch(graphP theGraph, unsigned embedFlags)
+{
+    switch (embedFlags & ~EMBEDFLAGS_TESTONLY)
+    {
+    case EMBEDFLAGS_PLANAR:
+        return gp_ExtendWith_Planarity(theGraph);
+    case EMBEDFLAGS_OUTERPLANAR:
+        return gp_ExtendWith_Outerplanarity(theGraph);
+    case EMBEDFLAGS_DRAWPLANAR:
+        return gp_ExtendWith_DrawPlanar(theGraph);
+    case EMBEDFLAGS_MAXIMALPLANARSUBGRAPH:
+        return gp_ExtendWith_MaximalPlanarSubgraph(theGraph);
+    case EMBEDFLAGS_SEARCHFORK23:
+        return gp_ExtendWith_K23Search(theGraph);
+    case EMBEDFLAGS_SEARCHFORK33:
+        return gp_ExtendWith_K33Search(theGraph);
+    case EMBEDFLAGS_SEARCHFORK4:
+        return gp_ExtendWith_K4Search(theGraph);
+    default:
+        break;
+    }
+
+    return NOTOK;
+}
@@ -0,0 +1,334 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include <stdlib.h>
+
+// This source file implements gp_AddEdgeToEmbedding(), which adds edges
+// one at a time to a planar embedding made by gp_Embed()
+#include "graphPlanarity.h"
+#include "graphPlanarity.private.h"
+
+/* Imported functions */
+
+extern void _InitIsolatorContext(graphP theGraph);
+
+/* Private functions */
+
+int _IsEmbeddedForIncremental(graphP theGraph);
+int _FindCommonFace(graphP theGraph, graphInt u, graphInt v, graphInt *pArcOfU, graphInt *pArcOfV);
+int _ReembedWithEdge(graphP theGraph, graphInt u, graphInt v);
+int _ReembedEdgeList(graphP theGraph, graphInt *pairs, graphInt m);
+int _SaveIncrementalBackup(graphP theGraph);
+int _RestoreIncrementalBackup(graphP theGraph);
+
+/********************************************************************
+ gp_AddEdgeToEmbedding()
+
+ Adds the edge (u, v) to theGraph, which must hold a planar embedding,
+ i.e., gp_Embed() must have returned OK for EMBEDFLAGS_PLANAR, and any
+ edges added since then must have been added by this method. The
+ vertices are given in the current numbering of theGraph, so callers
+ that add edges by their original vertex numbers typically call
+ gp_SortVertices() once after gp_Embed(), and the numbering is then
+ kept by this method.
+
+ If the edge can be embedded without changing the embedding of the
+ rest of the graph, then it is inserted in place, in time proportional
+ to the sizes of the faces around u (or v, if it has fewer edges). This
+ is the case if u or v has no edges or if they lie on a common face.
+
+ Otherwise, theGraph is copied into a backup graph, and the graph with
+ the new edge is embedded again from scratch in theGraph itself, reusing
+ its storage and extensions, with EMBEDFLAGS_DEFERISOLATION so that no
+ obstruction is isolated if it is not planar. So, each such edge costs
+ one embedding. If the graph is not planar, then theGraph is restored
+ from the backup, so the edge is not added and theGraph is not changed.
+ If it is planar, then the vertices are left in the same order as
+ before, i.e., in the original numbering unless theGraph was sorted by
+ DFI, in which case it is sorted by the DFIs of the new embedding, and
+ the vertex indexes still give the original numbers.
+
+ The backup graph is made by gp_DupGraph() when it is first needed, and
+ it is kept, along with its storage, until theGraph is freed or its
+ vertex capacity is changed, so later copies into it allocate nothing.
+
+ The DFS information of an embedding (DFIs, lowpoints and so on) is
+ only made again by a new embedding, so after an edge is added in place
+ it describes a DFS of the graph without the edge, except that the DFS
+ tree roots still give one vertex per connected component.
+
+ If u and v are already adjacent, then theGraph is not changed.
+
+ Returns OK if the edge is in the embedding,
+         NONEMBEDDABLE if adding the edge would make the graph nonplanar,
+         NOTOK on error, or if theGraph does not hold a planar embedding
+ ********************************************************************/
+
+int gp_AddEdgeToEmbedding(graphP theGraph, graphInt u, graphInt v)
+{
+    graphInt arcOfU = NIL, arcOfV = NIL, t;
+
+    if (theGraph == NULL || !_IsEmbeddedForIncremental(theGraph) ||
+        u < gp_LowerBoundVertices(theGraph) || u >= gp_UpperBoundVertices(theGraph) ||
+        v < gp_LowerBoundVertices(theGraph) || v >= gp_UpperBoundVertices(theGraph) ||
+        u == v)
+        return NOTOK;
+
+    if (gp_IsNeighbor(theGraph, u, v))
+        return OK;
+
+    if (gp_GetM(theGraph) >= gp_GetEdgeCapacity(theGraph) &&
+        gp_EnsureEdgeCapacity(theGraph, 2 * gp_GetEdgeCapacity(theGraph)) != OK)
+        return NOTOK;
+
+    // The face search starts from the endpoint with fewer edges
+    if (gp_GetVertexDegree(theGraph, u) > gp_GetVertexDegree(theGraph, v))
+    {
+        t = u;
+        u = v;
+        v = t;
+    }
+
+    // A vertex with no edges can be placed in any face around the other.
+    // It is a DFS tree root, so it is made a child of the other vertex to
+    // keep one root per connected component, as gp_CountEmbeddingFaces()
+    // and the other face walks of an embedding expect
+    if (gp_IsNotEdge(theGraph, gp_GetFirstEdge(theGraph, u)))
+    {
+        if (gp_InsertEdge(theGraph, u, NIL, 0, v, gp_GetFirstEdge(theGraph, v), 1) != OK)
+            return NOTOK;
+
+        gp_SetVertexParent(theGraph, u, v);
+        return OK;
+    }
+
+    if (_FindCommonFace(theGraph, u, v, &arcOfU, &arcOfV) == TRUE)
+        return gp_InsertEdge(theGraph, u, arcOfU, 1, v, arcOfV, 1) == OK ? OK : NOTOK;
+
+    return _ReembedWithEdge(theGraph, u, v);
+}
+
+/********************************************************************
+ _IsEmbeddedForIncremental()
+
+ Returns TRUE if theGraph holds a planar embedding made by gp_Embed()
+ with EMBEDFLAGS_PLANAR, rather than an obstruction or the partial
+ state left by EMBEDFLAGS_TESTONLY or EMBEDFLAGS_DEFERISOLATION, and
+ FALSE otherwise.
+ ********************************************************************/
+
+int _IsEmbeddedForIncremental(graphP theGraph)
+{
+    if (gp_GetEmbedFlags(theGraph) != EMBEDFLAGS_PLANAR || theGraphTestOnly(theGraph) ||
+        theGraphIsolationPending(theGraph) ||
+        theGraphIC(theGraph) == NULL || theGraphIC(theGraph)->minorType != MINORTYPE_NONE)
+        return FALSE;
+
+    return TRUE;
+}
+
+/********************************************************************
+ _FindCommonFace()
+
+ Walks each face around vertex u of the embedding, once, looking for
+ vertex v. Each edge record is in the boundary walk of one face, which
+ follows the edge record e to its neighbor and leaves it by the edge
+ record after the twin of e, circularly. So, a face lies between an
+ edge record and the one after it in the adjacency list of a vertex.
+
+ If v is found, then *pArcOfU and *pArcOfV receive the edge records of
+ u and v after which the face lies, so that the edge (u, v) can be
+ inserted before them to split the face.
+
+ Only the edge records of u are marked visited, as their faces are
+ walked, and they are cleared again before returning.
+
+ Returns TRUE if u and v lie on a common face, FALSE otherwise.
+ ********************************************************************/
+
+int _FindCommonFace(graphP theGraph, graphInt u, graphInt v, graphInt *pArcOfU, graphInt *pArcOfV)
+{
+    graphInt eStart, e, eNext;
+    int found = FALSE;
+
+    eStart = gp_GetFirstEdge(theGraph, u);
+    while (gp_IsEdge(theGraph, eStart))
+    {
+        gp_ClearEdgeVisited(theGraph, eStart);
+        eStart = gp_GetNextEdge(theGraph, eStart);
+    }
+
+    eStart = gp_GetFirstEdge(theGraph, u);
+    while (gp_IsEdge(theGraph, eStart) && !found)
+    {
+        if (!gp_GetEdgeVisited(theGraph, eStart))
+        {
+            gp_SetEdgeVisited(theGraph, eStart);
+            e = eStart;
+            do
+            {
+                // The face walk arrives at v by e and leaves it by eNext
+                eNext = gp_GetNextEdgeCircular(theGraph, gp_GetTwin(theGraph, e));
+                if (gp_GetNeighbor(theGraph, e) == v)
+                {
+                    *pArcOfU = eStart;
+                    *pArcOfV = eNext;
+                    found = TRUE;
+                    break;
+                }
+
+                // Other edge records of u on this face need not start a walk
+                e = eNext;
+                if (gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e)) == u)
+                    gp_SetEdgeVisited(theGraph, e);
+            } while (e != eStart);
+        }
+
+        eStart = gp_GetNextEdge(theGraph, eStart);
+    }
+
+    eStart = gp_GetFirstEdge(theGraph, u);
+    while (gp_IsEdge(theGraph, eStart))
+    {
+        gp_ClearEdgeVisited(theGraph, eStart);
+        eStart = gp_GetNextEdge(theGraph, eStart);
+    }
+
+    return found;
+}
+
+/********************************************************************
+ _ReembedWithEdge()
+
+ Embeds theGraph again from scratch with the edge (u, v) added, if that
+ is planar.
+
+ The edges are listed by the original vertex numbers, which are the
+ current numbers unless theGraph is sorted by DFI, in which case they
+ are in the vertex indexes. The new embedding is then left sorted by
+ DFI as gp_Embed() leaves it, or else it is sorted back to the original
+ numbering, so the caller's numbering is kept either way.
+
+ Returns OK if the edge was added, NONEMBEDDABLE if it would make the
+ graph nonplanar, or NOTOK on error.
+ ********************************************************************/
+
+int _ReembedWithEdge(graphP theGraph, graphInt u, graphInt v)
+{
+    graphInt *pairs = NULL, m = 0, w, e;
+    int wasSortedByDFI = (gp_GetGraphFlags(theGraph) & GRAPHFLAGS_SORTEDBYDFI) ? TRUE : FALSE;
+    int Result = OK;
+
+    if ((pairs = (graphInt *)malloc(2 * (gp_GetM(theGraph) + 1) * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    // Each edge is listed once, from the endpoint with the lesser number
+    for (w = gp_LowerBoundVertices(theGraph); w < gp_UpperBoundVertices(theGraph); ++w)
+    {
+        e = gp_GetFirstEdge(theGraph, w);
+        while (gp_IsEdge(theGraph, e))
+        {
+            if (w < gp_GetNeighbor(theGraph, e))
+            {
+                pairs[2 * m] = wasSortedByDFI ? gp_GetIndex(theGraph, w) : w;
+                pairs[2 * m + 1] = wasSortedByDFI ? gp_GetIndex(theGraph, gp_GetNeighbor(theGraph, e))
+                                                  : gp_GetNeighbor(theGraph, e);
+                m++;
+            }
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    pairs[2 * m] = wasSortedByDFI ? gp_GetIndex(theGraph, u) : u;
+    pairs[2 * m + 1] = wasSortedByDFI ? gp_GetIndex(theGraph, v) : v;
+
+    // A rejected edge leaves theGraph and its embedding as they were, by
+    // restoring the backup, which is also tried if the embedding fails
+    if (_SaveIncrementalBackup(theGraph) != OK)
+        Result = NOTOK;
+    else if ((Result = _ReembedEdgeList(theGraph, pairs, m + 1)) == OK)
+    {
+        if (!wasSortedByDFI && gp_SortVertices(theGraph) != OK)
+            Result = NOTOK;
+    }
+    else if (_RestoreIncrementalBackup(theGraph) != OK)
+        Result = NOTOK;
+
+    free(pairs);
+
+    return Result;
+}
+
+/********************************************************************
+ _ReembedEdgeList()
+
+ Resets theGraph, keeping its storage and extensions, loads the m edges
+ given by pairs, as for gp_AddEdgesBulk(), and embeds it. If it is not
+ planar, then the obstruction is not isolated, since the caller restores
+ the graph that theGraph had before.
+
+ Returns the result of gp_Embed(), or NOTOK on error.
+ ********************************************************************/
+
+int _ReembedEdgeList(graphP theGraph, graphInt *pairs, graphInt m)
+{
+    graphInt v;
+
+    gp_ResetGraphStorage(theGraph);
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+        gp_SetIndex(theGraph, v, v);
+
+    if (gp_AddEdgesBulk(theGraph, pairs, m) != OK)
+        return NOTOK;
+
+    return gp_Embed(theGraph, EMBEDFLAGS_PLANAR | EMBEDFLAGS_DEFERISOLATION);
+}
+
+/********************************************************************
+ _SaveIncrementalBackup()
+
+ Copies theGraph into its backup graph, first making the backup graph
+ with gp_DupGraph() if there is none, or if the copy fails because the
+ backup graph no longer matches theGraph (e.g., in its extensions or
+ arena capacity).
+
+ Returns OK on success, NOTOK on allocation failure.
+ ********************************************************************/
+
+int _SaveIncrementalBackup(graphP theGraph)
+{
+    if (theGraphIncrementalBackup(theGraph) != NULL &&
+        gp_CopyGraph(theGraphIncrementalBackup(theGraph), theGraph) == OK)
+        return OK;
+
+    gp_Free(&theGraphIncrementalBackup(theGraph));
+    return (theGraphIncrementalBackup(theGraph) = gp_DupGraph(theGraph)) != NULL ? OK : NOTOK;
+}
+
+/********************************************************************
+ _RestoreIncrementalBackup()
+
+ Copies the backup graph saved by _SaveIncrementalBackup() back into
+ theGraph. The state that gp_Embed() keeps outside of the graph
+ structures that gp_CopyGraph() copies, i.e., the isolator context and
+ the embedding modifiers, is set back to that of a planar embedding.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _RestoreIncrementalBackup(graphP theGraph)
+{
+    if (gp_CopyGraph(theGraph, theGraphIncrementalBackup(theGraph)) != OK)
+        return NOTOK;
+
+    _InitIsolatorContext(theGraph);
+    theGraphTestOnly(theGraph) = FALSE;
+    theGraphDeferIsolation(theGraph) = FALSE;
+    theGraphIsolationPending(theGraph) = FALSE;
+
+    return OK;
+}
@@ -0,0 +1,1239 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+// This source file implements gp_EmbedParallel(), which embeds the connected
+// components of a disconnected graph on more than one thread, and
+// gp_EmbedBlocksParallel(), which does the same for the blocks of a graph
+#include "graphPlanarity.h"
+#include "graphPlanarity.private.h"
+#include "graphOuterplanarity.h"
+
+// For LOGGING-related declarations and the atomic operations
+#include "../lowLevelUtils/apiutils.private.h"
+
+#include "../lowLevelUtils/platformThread.h"
+
+/* The schedule of the items (components or blocks) to embed, which is
+   shared by the threads. The items are embedded in the order of the
+   schedule, each by the thread that takes it next, and fpEmbedItem()
+   gives the result of each item.
+ */
+typedef struct
+{
+    void *context;
+    int (*fpEmbedItem)(void *context, graphInt item);
+
+    graphInt *items;
+    int numItems, nextItem;
+    int *results;
+} EmbedSchedule;
+
+typedef EmbedSchedule *EmbedScheduleP;
+
+/* The state shared by the threads that embed the components of a graph.
+
+   The components are numbered as by gp_LabelConnectedComponents(), so
+   component c contains vertexList[vertexStart[c]] to
+   vertexList[vertexStart[c+1] - 1], in ascending order. The vertex v is
+   vertex localOf[v] of the graph of its component, and since the DFS of
+   gp_Embed() numbers the components in the same order, the DFI of each
+   vertex is its DFI in the graph of its component plus vertexStart[c].
+
+   The edges of component c are numbered from edgeStart[c] to
+   edgeStart[c+1] - 1, so edge record e of theGraph is edge record
+   subArcOf[e] of the graph of its component, and edge record s of the
+   graph of component c is edge record origArcOf[2*edgeStart[c] + s] of
+   theGraph (both offset by gp_LowerBoundEdges()).
+
+   The components with more than one vertex are embedded in the order of
+   the schedule, largest first.
+ */
+typedef struct
+{
+    graphP theGraph;
+    unsigned embedFlags;
+
+    graphInt numComponents;
+    graphInt *componentOf, *localOf;
+    graphInt *vertexStart, *vertexList;
+    graphInt *edgeStart, *subArcOf, *origArcOf;
+
+    // The result of each component, and its graph if it is NONEMBEDDABLE
+    EmbedSchedule schedule;
+    graphP *subGraphs;
+} EmbedParallelContext;
+
+typedef EmbedParallelContext *EmbedParallelContextP;
+
+/* The state shared by the threads that embed the blocks of a graph.
+
+   The blocks are numbered as by gp_ComputeBiconnectedComponents(), and
+   the k-th vertex of block B is vertex k of the graph of the block (offset
+   by gp_LowerBoundVertices()). Edge record e of theGraph is in the graph
+   of its block, where its neighbor is localNeighborOf[e], and the j-th
+   edge of the block is edge record 2j of the graph of the block, which
+   is in the adjacency list of the endpoint that owns blockEdges[j].
+
+   When a block is embedded, the edge records of each vertex of the block
+   are linked in the order of its rotation in the embedding, and the
+   first and last of them are recorded at the position of the vertex in
+   the block, in firstArcOf[] and lastArcOf[], so that only the lists of
+   the cut vertices remain to be joined when all blocks are embedded.
+ */
+typedef struct
+{
+    graphP theGraph;
+    unsigned embedFlags;
+
+    blockCutTreeP theTree;
+    graphInt *localNeighborOf;
+    graphInt *firstArcOf, *lastArcOf;
+
+    // The result of each block, and its graph if it is NONEMBEDDABLE
+    EmbedSchedule schedule;
+    graphP *subGraphs;
+} EmbedBlocksContext;
+
+typedef EmbedBlocksContext *EmbedBlocksContextP;
+
+/* Imported functions */
+
+extern int _gp_EmbedFlagsValid(graphP theGraph, int embedFlags);
+
+/* Private functions */
+
+int _CanEmbedInParallel(graphP theGraph, unsigned embedFlags);
+int _ExtendForEmbedParallel(graphP theGraph, unsigned embedFlags);
+
+int _InitEmbedSchedule(EmbedScheduleP schedule, void *context, int (*fpEmbedItem)(void *, graphInt),
+                       graphInt numItems, graphInt *itemSizes);
+void _FreeEmbedSchedule(EmbedScheduleP schedule);
+int _CompareScheduledItems(void const *a, void const *b);
+int _RunEmbedSchedule(EmbedScheduleP schedule, int numThreads);
+platform_ThreadFunction(_EmbedScheduleThread, arg);
+void _EmbedScheduledItems(EmbedScheduleP schedule);
+
+int _InitEmbedParallelContext(EmbedParallelContextP context, graphP theGraph, unsigned embedFlags);
+void _FreeEmbedParallelContext(EmbedParallelContextP context);
+int _EmbedComponent(void *theContext, graphInt c);
+
+void _CopyComponentVertices(EmbedParallelContextP context, graphInt c, graphP subGraph);
+void _CopyComponentEdges(EmbedParallelContextP context, graphInt c, graphP subGraph);
+int _MergeComponents(EmbedParallelContextP context);
+
+int _InitEmbedBlocksContext(EmbedBlocksContextP context, graphP theGraph, unsigned embedFlags);
+void _FreeEmbedBlocksContext(EmbedBlocksContextP context);
+int _EmbedBlock(void *theContext, graphInt B);
+graphInt _GetBlockArc(EmbedBlocksContextP context, graphInt B, graphInt s);
+int _FindOuterFaceArcs(graphP subGraph, graphInt *firstArcOf);
+void _CopyBlockEmbedding(EmbedBlocksContextP context, graphInt B, graphP subGraph, graphInt *firstArcOf);
+int _MergeBlocks(EmbedBlocksContextP context);
+void _AppendArcs(graphP theGraph, graphInt v, graphInt eFirst, graphInt eLast);
+
+/********************************************************************
+ gp_EmbedParallel()
+
+ Produces the same result as gp_Embed(), i.e., the same embedding or
+ the same obstruction, but if theGraph is disconnected, then its
+ connected components are embedded by up to numThreads threads at once,
+ including the calling thread.
+
+ Each component is copied into a graph of its own, with the vertices
+ in the same relative order and the same adjacency lists, so gp_Embed()
+ produces the same embedding of it as it does in theGraph. Then, the
+ embeddings are copied back into theGraph, which is left sorted by DFI
+ with the DFIs that gp_Embed() would have given, much as the bicomps
+ are joined at the end of gp_Embed(). If any component is not
+ embeddable, then the result is the obstruction that gp_Embed() would
+ have isolated, i.e., the one in the nonembeddable component with the
+ highest DFIs, and the edges of the other components are deleted.
+
+ The embeddings of the components are made in parallel only for
+ EMBEDFLAGS_PLANAR and EMBEDFLAGS_OUTERPLANAR, in a graph that has no
+ extensions attached (e.g. by gp_ExtendWith_DrawPlanar()), no DFS tree
+ and no directed edges. Otherwise, or if theGraph is connected or
+ numThreads is 1, this method just calls gp_Embed(). The graph
+ library must be thread-safe (see GP_THREADSAFE in appconst.h), or
+ else only one thread is used.
+
+ Besides the embedding or obstruction, only the DFS tree, the least
+ ancestors and the lowpoints of the vertices are the same as after
+ gp_Embed(). Other vertex state of the embedder is not reproduced;
+ e.g., the visited indexes keep the initial value given by the embedder.
+
+ Returns OK, NONEMBEDDABLE or NOTOK as gp_Embed() does, and NOTOK if
+ numThreads is less than 1.
+ ********************************************************************/
+
+int gp_EmbedParallel(graphP theGraph, unsigned embedFlags, int numThreads)
+{
+    EmbedParallelContext context;
+    int RetVal = OK, useAdjacencyIndex;
+
+    if (theGraph == NULL || embedFlags == 0 || gp_GetEmbedFlags(theGraph) != 0 || numThreads < 1)
+        return NOTOK;
+
+#ifndef GP_THREADSAFE
+    numThreads = 1;
+#endif
+
+    if (numThreads == 1 || !_CanEmbedInParallel(theGraph, embedFlags))
+        return gp_Embed(theGraph, embedFlags);
+
+    if (_ExtendForEmbedParallel(theGraph, embedFlags) != OK)
+        return NOTOK;
+
+    RetVal = _InitEmbedParallelContext(&context, theGraph, embedFlags);
+
+    // A connected graph is embedded by the calling thread alone
+    if (RetVal == OK && context.numComponents < 2)
+    {
+        _FreeEmbedParallelContext(&context);
+        return gp_Embed(theGraph, embedFlags);
+    }
+
+    if (RetVal == OK)
+    {
+        theGraph->embedFlags = embedFlags;
+
+        // The adjacency lists are replaced without maintaining the adjacency
+        // index, so it is discarded and not rebuilt until afterward
+        useAdjacencyIndex = ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex;
+        gp_DisableAdjacencyIndex(theGraph);
+
+        if ((RetVal = _RunEmbedSchedule(&context.schedule, numThreads)) == OK)
+            RetVal = _MergeComponents(&context);
+
+        ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = useAdjacencyIndex;
+    }
+
+    _FreeEmbedParallelContext(&context);
+
+    return RetVal;
+}
+
+/********************************************************************
+ _CanEmbedInParallel()
+
+ Returns TRUE if the embedding of theGraph can be divided among many
+ threads, i.e., if the embedFlags are EMBEDFLAGS_PLANAR or
+ EMBEDFLAGS_OUTERPLANAR, and theGraph has at least two vertices, no
+ extensions attached (e.g. by gp_ExtendWith_DrawPlanar()), no DFS tree
+ and no directed edges. Returns FALSE otherwise.
+ ********************************************************************/
+
+int _CanEmbedInParallel(graphP theGraph, unsigned embedFlags)
+{
+    if (gp_GetN(theGraph) < 2 ||
+        (embedFlags != EMBEDFLAGS_PLANAR && embedFlags != EMBEDFLAGS_OUTERPLANAR) ||
+        theGraph->extensions != NULL ||
+        (gp_GetGraphFlags(theGraph) & (GRAPHFLAGS_DFSNUMBERED | GRAPHFLAGS_DIRECTEDEDGEDETECTED)))
+        return FALSE;
+
+    return TRUE;
+}
+
+/********************************************************************
+ _ExtendForEmbedParallel()
+
+ Extends theGraph for the embedFlags, as gp_Embed() does beforehand.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _ExtendForEmbedParallel(graphP theGraph, unsigned embedFlags)
+{
+    if (_gp_EmbedFlagsValid(theGraph, embedFlags))
+        return OK;
+
+    if (embedFlags == EMBEDFLAGS_PLANAR)
+        return gp_ExtendWith_Planarity(theGraph);
+
+    return gp_ExtendWith_Outerplanarity(theGraph);
+}
+
+/********************************************************************
+ _InitEmbedParallelContext()
+
+ Labels the connected components of theGraph, then lists the vertices
+ and numbers the edges of each component, as described above. The edge
+ records of each component are numbered in the order of the adjacency
+ lists of its vertices. The schedule is made only if there are at least
+ two components.
+
+ Returns OK on success, NOTOK on failure. Either way, the context must
+ be freed with _FreeEmbedParallelContext().
+ ********************************************************************/
+
+int _InitEmbedParallelContext(EmbedParallelContextP context, graphP theGraph, unsigned embedFlags)
+{
+    graphInt N = gp_GetN(theGraph), lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt v, e, c, k, numComponents;
+    graphInt *cursor = NULL, *componentSizes = NULL;
+    int Result = OK;
+
+    memset(context, 0, sizeof(EmbedParallelContext));
+    context->theGraph = theGraph;
+    context->embedFlags = embedFlags;
+
+    if ((context->componentOf = (graphInt *)malloc(N * sizeof(graphInt))) == NULL ||
+        (numComponents = gp_LabelConnectedComponents(theGraph, context->componentOf)) < 0)
+        return NOTOK;
+
+    context->numComponents = numComponents;
+    if (numComponents < 2)
+        return OK;
+
+    if ((context->localOf = (graphInt *)malloc(N * sizeof(graphInt))) == NULL ||
+        (context->vertexList = (graphInt *)malloc(N * sizeof(graphInt))) == NULL ||
+        (context->vertexStart = (graphInt *)calloc(numComponents + 1, sizeof(graphInt))) == NULL ||
+        (context->edgeStart = (graphInt *)calloc(numComponents + 1, sizeof(graphInt))) == NULL ||
+        (context->subArcOf = (graphInt *)malloc((gp_UpperBoundEdges(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (context->subGraphs = (graphP *)calloc(numComponents, sizeof(graphP))) == NULL ||
+        (cursor = (graphInt *)malloc(numComponents * sizeof(graphInt))) == NULL)
+    {
+        free(cursor);
+        return NOTOK;
+    }
+
+    // List the vertices of each component in ascending order, and number the
+    // edges of each component as they are found in the adjacency lists
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+        context->vertexStart[context->componentOf[v - lowerBound] + 1]++;
+
+    for (c = 0; c < numComponents; c++)
+    {
+        context->vertexStart[c + 1] += context->vertexStart[c];
+        cursor[c] = context->vertexStart[c];
+    }
+
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        c = context->componentOf[v - lowerBound];
+        context->localOf[v - lowerBound] = cursor[c] - context->vertexStart[c] + lowerBound;
+        context->vertexList[cursor[c]++] = v;
+
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            if (e < gp_GetTwin(theGraph, e))
+            {
+                k = gp_LowerBoundEdges(theGraph) + 2 * context->edgeStart[c + 1]++;
+                context->subArcOf[e] = k;
+                context->subArcOf[gp_GetTwin(theGraph, e)] = gp_GetTwin(theGraph, k);
+            }
+
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    free(cursor);
+
+    for (c = 0; c < numComponents; c++)
+        context->edgeStart[c + 1] += context->edgeStart[c];
+
+    if ((context->origArcOf = (graphInt *)malloc((2 * context->edgeStart[numComponents] + 1) * sizeof(graphInt))) == NULL ||
+        (componentSizes = (graphInt *)malloc(numComponents * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    // Only the components that have edges are embedded
+    for (c = 0; c < numComponents; c++)
+    {
+        k = context->vertexStart[c + 1] - context->vertexStart[c];
+        componentSizes[c] = k > 1 ? k + context->edgeStart[c + 1] - context->edgeStart[c] : 0;
+    }
+
+    Result = _InitEmbedSchedule(&context->schedule, context, _EmbedComponent, numComponents, componentSizes);
+
+    free(componentSizes);
+
+    return Result;
+}
+
+/********************************************************************
+ _FreeEmbedParallelContext()
+ ********************************************************************/
+
+void _FreeEmbedParallelContext(EmbedParallelContextP context)
+{
+    graphInt c;
+
+    if (context->subGraphs != NULL)
+    {
+        for (c = 0; c < context->numComponents; c++)
+            gp_Free(&context->subGraphs[c]);
+    }
+
+    free(context->componentOf);
+    free(context->localOf);
+    free(context->vertexStart);
+    free(context->vertexList);
+    free(context->edgeStart);
+    free(context->subArcOf);
+    free(context->origArcOf);
+    free(context->subGraphs);
+    _FreeEmbedSchedule(&context->schedule);
+
+    memset(context, 0, sizeof(EmbedParallelContext));
+}
+
+/********************************************************************
+ _EmbedComponent()
+
+ Copies component c into a graph of its own and embeds it. If it is
+ embedded, then the embedding is copied into the vertices and edges of
+ the component in theGraph, which no other thread changes. Otherwise,
+ only the vertices are copied, and the graph of the component is kept
+ until _MergeComponents() decides whether its obstruction is needed.
+
+ Returns the result of gp_Embed() on the component.
+ ********************************************************************/
+
+int _EmbedComponent(void *theContext, graphInt c)
+{
+    EmbedParallelContextP context = (EmbedParallelContextP)theContext;
+    graphP theGraph = context->theGraph, subGraph = NULL;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph), lowerBoundEdges = gp_LowerBoundEdges(theGraph);
+    graphInt N = context->vertexStart[c + 1] - context->vertexStart[c];
+    graphInt M = context->edgeStart[c + 1] - context->edgeStart[c];
+    graphInt *vertices = context->vertexList + context->vertexStart[c];
+    graphInt *origArcs = context->origArcOf + 2 * context->edgeStart[c];
+    graphInt k, u, e, s, sPrev;
+    int Result;
+
+    if ((subGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(subGraph, M) != OK ||
+        gp_EnsureVertexCapacity(subGraph, N) != OK)
+    {
+        gp_Free(&subGraph);
+        return NOTOK;
+    }
+
+    // Each vertex gets the adjacency list of the vertex of theGraph that it
+    // copies, in the same order, so the DFS and the embedding are the same
+    for (k = 0; k < N; k++)
+    {
+        u = lowerBound + k;
+        gp_SetIndex(subGraph, u, u);
+
+        sPrev = NIL;
+        e = gp_GetFirstEdge(theGraph, vertices[k]);
+        while (gp_IsEdge(theGraph, e))
+        {
+            s = context->subArcOf[e];
+            origArcs[s - lowerBoundEdges] = e;
+
+            gp_SetNeighbor(subGraph, s, context->localOf[gp_GetNeighbor(theGraph, e) - lowerBound]);
+            gp_SetPrevEdge(subGraph, s, sPrev);
+            if (gp_IsEdge(subGraph, sPrev))
+                gp_SetNextEdge(subGraph, sPrev, s);
+            else
+                gp_SetFirstEdge(subGraph, u, s);
+            sPrev = s;
+
+            e = gp_GetNextEdge(theGraph, e);
+        }
+
+        if (gp_IsEdge(subGraph, sPrev))
+            gp_SetNextEdge(subGraph, sPrev, NIL);
+        gp_SetLastEdge(subGraph, u, sPrev);
+    }
+
+    subGraph->M = M;
+    _gp_UpdateEdgeHighWaterMark(subGraph);
+
+    Result = gp_Embed(subGraph, context->embedFlags);
+
+    if (Result == OK || Result == NONEMBEDDABLE)
+        _CopyComponentVertices(context, c, subGraph);
+
+    if (Result == OK)
+        _CopyComponentEdges(context, c, subGraph);
+
+    if (Result == NONEMBEDDABLE)
+        context->subGraphs[c] = subGraph;
+    else
+        gp_Free(&subGraph);
+
+    return Result;
+}
+
+/********************************************************************
+ _CopyComponentVertices()
+
+ Gives the vertices of component c in theGraph, which is not sorted by
+ DFI, the DFI, DFS parent, least ancestor and lowpoint that they have
+ in the embedded graph of the component, which is sorted by DFI. As
+ in an unsorted graph after a DFS, the DFS parent is a vertex, and the
+ other values are DFIs.
+ ********************************************************************/
+
+void _CopyComponentVertices(EmbedParallelContextP context, graphInt c, graphP subGraph)
+{
+    graphP theGraph = context->theGraph;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph), offset = context->vertexStart[c];
+    graphInt *vertices = context->vertexList + offset;
+    graphInt d, v, parent;
+
+    for (d = lowerBound; d < gp_UpperBoundVertices(subGraph); ++d)
+    {
+        v = vertices[gp_GetIndex(subGraph, d) - lowerBound];
+        gp_SetIndex(theGraph, v, d + offset);
+
+        parent = gp_GetVertexParent(subGraph, d);
+        gp_SetVertexParent(theGraph, v, gp_IsVertex(subGraph, parent) ? vertices[gp_GetIndex(subGraph, parent) - lowerBound] : NIL);
+        gp_SetVertexLeastAncestor(theGraph, v, gp_GetVertexLeastAncestor(subGraph, d) + offset);
+        gp_SetVertexLowpoint(theGraph, v, gp_GetVertexLowpoint(subGraph, d) + offset);
+        gp_SetVertexVisitedIndex(theGraph, v, gp_UpperBoundVertices(theGraph));
+    }
+}
+
+/********************************************************************
+ _CopyComponentEdges()
+
+ Replaces the adjacency lists of the vertices of component c in
+ theGraph with those of the embedded graph of the component, using the
+ corresponding edge records of theGraph, which keep their neighbors.
+ The edge records that are no longer in use in the graph of the
+ component must have been deleted from theGraph beforehand.
+ ********************************************************************/
+
+void _CopyComponentEdges(EmbedParallelContextP context, graphInt c, graphP subGraph)
+{
+    graphP theGraph = context->theGraph;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph), lowerBoundEdges = gp_LowerBoundEdges(theGraph);
+    graphInt *vertices = context->vertexList + context->vertexStart[c];
+    graphInt *origArcs = context->origArcOf + 2 * context->edgeStart[c];
+    graphInt d, v, s, e, sLink;
+
+    for (d = lowerBound; d < gp_UpperBoundVertices(subGraph); ++d)
+    {
+        v = vertices[gp_GetIndex(subGraph, d) - lowerBound];
+
+        sLink = gp_GetFirstEdge(subGraph, d);
+        gp_SetFirstEdge(theGraph, v, gp_IsEdge(subGraph, sLink) ? origArcs[sLink - lowerBoundEdges] : NIL);
+        sLink = gp_GetLastEdge(subGraph, d);
+        gp_SetLastEdge(theGraph, v, gp_IsEdge(subGraph, sLink) ? origArcs[sLink - lowerBoundEdges] : NIL);
+    }
+
+    for (s = lowerBoundEdges; s < gp_UpperBoundEdges(subGraph); ++s)
+    {
+        if (gp_EdgeNotInUse(subGraph, s))
+            continue;
+
+        e = origArcs[s - lowerBoundEdges];
+
+        sLink = gp_GetNextEdge(subGraph, s);
+        gp_SetNextEdge(theGraph, e, gp_IsEdge(subGraph, sLink) ? origArcs[sLink - lowerBoundEdges] : NIL);
+        sLink = gp_GetPrevEdge(subGraph, s);
+        gp_SetPrevEdge(theGraph, e, gp_IsEdge(subGraph, sLink) ? origArcs[sLink - lowerBoundEdges] : NIL);
+
+        _gp_EdgeFlags(theGraph, e) = _gp_EdgeFlags(subGraph, s);
+    }
+}
+
+/********************************************************************
+ _MergeComponents()
+
+ Once all of the components have been embedded, the isolated vertices
+ are given their DFS values, and if any component is not embeddable,
+ then the obstruction of the last such component, which has the highest
+ DFIs, is copied into theGraph, and all other edges are deleted, as
+ gp_Embed() would have done. Then, theGraph is sorted by DFI.
+
+ Returns OK or NONEMBEDDABLE, or NOTOK if any component failed.
+ ********************************************************************/
+
+int _MergeComponents(EmbedParallelContextP context)
+{
+    graphP theGraph = context->theGraph, subGraph = NULL;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt c, v, e, eNext, DFI, obstructedComponent = -1;
+
+    for (c = 0; c < context->numComponents; c++)
+    {
+        if (context->schedule.results[c] == NONEMBEDDABLE)
+            obstructedComponent = c;
+        else if (context->schedule.results[c] != OK)
+            return NOTOK;
+
+        if (context->vertexStart[c + 1] - context->vertexStart[c] == 1)
+        {
+            v = context->vertexList[context->vertexStart[c]];
+            DFI = context->vertexStart[c] + lowerBound;
+
+            gp_SetIndex(theGraph, v, DFI);
+            gp_SetVertexParent(theGraph, v, NIL);
+            gp_SetVertexLeastAncestor(theGraph, v, DFI);
+            gp_SetVertexLowpoint(theGraph, v, DFI);
+            gp_SetVertexVisitedIndex(theGraph, v, gp_UpperBoundVertices(theGraph));
+        }
+    }
+
+    if (obstructedComponent != -1)
+    {
+        subGraph = context->subGraphs[obstructedComponent];
+
+        for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+        {
+            e = gp_GetFirstEdge(theGraph, v);
+            while (gp_IsEdge(theGraph, e))
+            {
+                eNext = gp_GetNextEdge(theGraph, e);
+
+                if (context->componentOf[v - lowerBound] != obstructedComponent ||
+                    gp_EdgeNotInUse(subGraph, context->subArcOf[e]))
+                {
+                    if (gp_DeleteEdge(theGraph, e) != OK)
+                        return NOTOK;
+                }
+
+                e = eNext;
+            }
+        }
+
+        _CopyComponentEdges(context, obstructedComponent, subGraph);
+        theGraphIC(theGraph)->minorType = theGraphIC(subGraph)->minorType;
+    }
+
+    // The graph now has the DFS numbering of gp_Embed(), and it is
+    // left sorted by DFI, with the lowpoints computed
+    theGraph->graphFlags |= GRAPHFLAGS_DFSNUMBERED;
+    if (gp_SortVertices(theGraph) != OK)
+        return NOTOK;
+    theGraph->graphFlags |= GRAPHFLAGS_LOWPOINTSCOMPUTED;
+
+    return obstructedComponent != -1 ? NONEMBEDDABLE : OK;
+}
+
+/********************************************************************
+ gp_EmbedBlocksParallel()
+
+ Embeds theGraph, or isolates an obstruction in it, by embedding each of
+ its blocks (biconnected components) independently, on up to numThreads
+ threads, including the calling thread. A graph is planar, or
+ outerplanar, if and only if all of its blocks are, so the embeddings
+ of the blocks are joined at the cut vertices, as found by
+ gp_ComputeBiconnectedComponents(), by listing the edges of each cut
+ vertex block by block. For an outerplanar embedding, each block is
+ listed starting from the edge that follows the external face, so that
+ all vertices remain on the external face of the result.
+
+ If any block is not embeddable, then the result is the obstruction in
+ the nonembeddable block with the least number, which is the same for
+ any number of threads but need not be the one that gp_Embed() would
+ have isolated, and all other edges are deleted. Either way, theGraph
+ is given a new DFS tree and is left sorted by DFI, with the lowpoints
+ computed, as after gp_Embed().
+
+ The blocks are embedded separately only for EMBEDFLAGS_PLANAR and
+ EMBEDFLAGS_OUTERPLANAR, in a graph that has no extensions attached, no
+ DFS tree and no directed edges, and only if at least two blocks have
+ more than one edge. Otherwise, this method just calls gp_Embed(). The
+ graph library must be thread-safe (see GP_THREADSAFE in appconst.h),
+ or else only one thread is used.
+
+ Returns OK, NONEMBEDDABLE or NOTOK as gp_Embed() does, and NOTOK if
+ numThreads is less than 1.
+ ********************************************************************/
+
+int gp_EmbedBlocksParallel(graphP theGraph, unsigned embedFlags, int numThreads)
+{
+    EmbedBlocksContext context;
+    int RetVal = OK, useAdjacencyIndex;
+
+    if (theGraph == NULL || embedFlags == 0 || gp_GetEmbedFlags(theGraph) != 0 || numThreads < 1)
+        return NOTOK;
+
+#ifndef GP_THREADSAFE
+    numThreads = 1;
+#endif
+
+    if (!_CanEmbedInParallel(theGraph, embedFlags))
+        return gp_Embed(theGraph, embedFlags);
+
+    if (_ExtendForEmbedParallel(theGraph, embedFlags) != OK)
+        return NOTOK;
+
+    RetVal = _InitEmbedBlocksContext(&context, theGraph, embedFlags);
+
+    // A graph with one nontrivial block is embedded by the calling thread alone
+    if (RetVal == OK && context.schedule.numItems < 2)
+    {
+        _FreeEmbedBlocksContext(&context);
+        return gp_Embed(theGraph, embedFlags);
+    }
+
+    if (RetVal == OK)
+    {
+        theGraph->embedFlags = embedFlags;
+
+        useAdjacencyIndex = ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex;
+        gp_DisableAdjacencyIndex(theGraph);
+
+        if ((RetVal = _RunEmbedSchedule(&context.schedule, numThreads)) == OK)
+            RetVal = _MergeBlocks(&context);
+
+        ((graphPrivateDataP)theGraph->privateData)->useAdjacencyIndex = useAdjacencyIndex;
+    }
+
+    _FreeEmbedBlocksContext(&context);
+
+    return RetVal;
+}
+
+/********************************************************************
+ _InitEmbedBlocksContext()
+
+ Finds the blocks of theGraph, gives each edge record its neighbor in
+ the graph of its block, and schedules the blocks that have more than
+ one edge. A block with one edge has only one embedding.
+
+ Returns OK on success, NOTOK on failure. Either way, the context must
+ be freed with _FreeEmbedBlocksContext().
+ ********************************************************************/
+
+int _InitEmbedBlocksContext(EmbedBlocksContextP context, graphP theGraph, unsigned embedFlags)
+{
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt B, k, j, e, numBlocks, numEdges;
+    graphInt *localOf = NULL, *blockSizes = NULL;
+    blockCutTreeP theTree = NULL;
+    int Result = OK;
+
+    memset(context, 0, sizeof(EmbedBlocksContext));
+    context->theGraph = theGraph;
+    context->embedFlags = embedFlags;
+
+    if ((numBlocks = gp_ComputeBiconnectedComponents(theGraph, &context->theTree)) < 0)
+        return NOTOK;
+
+    theTree = context->theTree;
+
+    if ((context->localNeighborOf = (graphInt *)malloc((gp_UpperBoundEdges(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (context->firstArcOf = (graphInt *)malloc((theTree->blockStart[numBlocks] + 1) * sizeof(graphInt))) == NULL ||
+        (context->lastArcOf = (graphInt *)malloc((theTree->blockStart[numBlocks] + 1) * sizeof(graphInt))) == NULL ||
+        (context->subGraphs = (graphP *)calloc(numBlocks + 1, sizeof(graphP))) == NULL ||
+        (localOf = (graphInt *)malloc((gp_GetN(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (blockSizes = (graphInt *)malloc((numBlocks + 1) * sizeof(graphInt))) == NULL)
+    {
+        free(localOf);
+        return NOTOK;
+    }
+
+    for (B = 0; B < numBlocks; B++)
+    {
+        for (k = theTree->blockStart[B]; k < theTree->blockStart[B + 1]; k++)
+            localOf[theTree->blockVertices[k]] = lowerBound + k - theTree->blockStart[B];
+
+        for (j = theTree->edgeStart[B]; j < theTree->edgeStart[B + 1]; j++)
+        {
+            e = theTree->blockEdges[j];
+            context->localNeighborOf[e] = localOf[gp_GetNeighbor(theGraph, e) - lowerBound];
+            e = gp_GetTwin(theGraph, e);
+            context->localNeighborOf[e] = localOf[gp_GetNeighbor(theGraph, e) - lowerBound];
+        }
+
+        numEdges = theTree->edgeStart[B + 1] - theTree->edgeStart[B];
+        blockSizes[B] = numEdges > 1 ? theTree->blockStart[B + 1] - theTree->blockStart[B] + numEdges : 0;
+    }
+
+    free(localOf);
+
+    Result = _InitEmbedSchedule(&context->schedule, context, _EmbedBlock, numBlocks, blockSizes);
+
+    free(blockSizes);
+
+    return Result;
+}
+
+/********************************************************************
+ _FreeEmbedBlocksContext()
+ ********************************************************************/
+
+void _FreeEmbedBlocksContext(EmbedBlocksContextP context)
+{
+    graphInt B;
+
+    if (context->subGraphs != NULL)
+    {
+        for (B = 0; B < context->theTree->numBlocks; B++)
+            gp_Free(&context->subGraphs[B]);
+    }
+
+    free(context->localNeighborOf);
+    free(context->firstArcOf);
+    free(context->lastArcOf);
+    free(context->subGraphs);
+    _FreeEmbedSchedule(&context->schedule);
+    gp_FreeBlockCutTree(&context->theTree);
+
+    memset(context, 0, sizeof(EmbedBlocksContext));
+}
+
+/********************************************************************
+ _EmbedBlock()
+
+ Copies block B into a graph of its own and embeds it. If it is
+ embedded, then the edge records of theGraph that are in the block,
+ which no other thread changes, are linked in the order of the
+ embedding. Otherwise, the graph of the block is kept until
+ _MergeBlocks() decides whether its obstruction is needed.
+
+ Returns the result of gp_Embed() on the block.
+ ********************************************************************/
+
+int _EmbedBlock(void *theContext, graphInt B)
+{
+    EmbedBlocksContextP context = (EmbedBlocksContextP)theContext;
+    graphP subGraph = NULL;
+    blockCutTreeP theTree = context->theTree;
+    graphInt lowerBound = gp_LowerBoundVertices(context->theGraph), lowerBoundEdges = gp_LowerBoundEdges(context->theGraph);
+    graphInt N = theTree->blockStart[B + 1] - theTree->blockStart[B];
+    graphInt M = theTree->edgeStart[B + 1] - theTree->edgeStart[B];
+    graphInt *firstArcOf = NULL;
+    graphInt j, e, s, u, w;
+    int Result;
+
+    if ((subGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(subGraph, M) != OK ||
+        gp_EnsureVertexCapacity(subGraph, N) != OK ||
+        (firstArcOf = (graphInt *)malloc((N + 1) * sizeof(graphInt))) == NULL)
+    {
+        gp_Free(&subGraph);
+        return NOTOK;
+    }
+
+    for (u = lowerBound; u < gp_UpperBoundVertices(subGraph); ++u)
+        gp_SetIndex(subGraph, u, u);
+
+    for (j = 0; j < M; j++)
+    {
+        e = theTree->blockEdges[theTree->edgeStart[B] + j];
+        s = lowerBoundEdges + 2 * j;
+        u = context->localNeighborOf[gp_GetTwin(context->theGraph, e)];
+        w = context->localNeighborOf[e];
+
+        gp_SetNeighbor(subGraph, s, w);
+        _AppendArcs(subGraph, u, s, s);
+        gp_SetNeighbor(subGraph, gp_GetTwin(subGraph, s), u);
+        _AppendArcs(subGraph, w, gp_GetTwin(subGraph, s), gp_GetTwin(subGraph, s));
+    }
+
+    subGraph->M = M;
+    _gp_UpdateEdgeHighWaterMark(subGraph);
+
+    Result = gp_Embed(subGraph, context->embedFlags);
+
+    // An outerplanar embedding is listed from the external face, which
+    // contains all of the vertices of the block
+    if (Result == OK)
+    {
+        if (context->embedFlags != EMBEDFLAGS_OUTERPLANAR)
+        {
+            for (u = lowerBound; u < gp_UpperBoundVertices(subGraph); ++u)
+                firstArcOf[u - lowerBound] = gp_GetFirstEdge(subGraph, u);
+        }
+        else if (_FindOuterFaceArcs(subGraph, firstArcOf) != OK)
+            Result = NOTOK;
+    }
+
+    if (Result == OK)
+        _CopyBlockEmbedding(context, B, subGraph, firstArcOf);
+
+    if (Result == NONEMBEDDABLE)
+        context->subGraphs[B] = subGraph;
+    else
+        gp_Free(&subGraph);
+
+    free(firstArcOf);
+
+    return Result;
+}
+
+/********************************************************************
+ _GetBlockArc()
+
+ Returns the edge record of theGraph that is edge record s of the graph
+ of block B.
+ ********************************************************************/
+
+graphInt _GetBlockArc(EmbedBlocksContextP context, graphInt B, graphInt s)
+{
+    graphInt j = (s - gp_LowerBoundEdges(context->theGraph)) >> 1;
+    graphInt e = context->theTree->blockEdges[context->theTree->edgeStart[B] + j];
+
+    return ((s - gp_LowerBoundEdges(context->theGraph)) & 1) ? gp_GetTwin(context->theGraph, e) : e;
+}
+
+/********************************************************************
+ _FindOuterFaceArcs()
+
+ Finds a face of the embedded, biconnected subGraph that contains all
+ of its vertices, which is the external face of an outerplanar
+ embedding. For each vertex u, firstArcOf[u - gp_LowerBoundVertices()]
+ receives the edge record that leaves u along that face, so that the
+ face lies between the last and first edges of u when its adjacency
+ list is listed circularly from that edge record.
+
+ Returns OK on success, NOTOK if there is no such face.
+ ********************************************************************/
+
+int _FindOuterFaceArcs(graphP subGraph, graphInt *firstArcOf)
+{
+    graphInt e, eStart, eNext, faceLength;
+
+    for (e = gp_LowerBoundEdges(subGraph); e < gp_UpperBoundEdges(subGraph); ++e)
+        gp_ClearEdgeVisited(subGraph, e);
+
+    for (eStart = gp_LowerBoundEdges(subGraph); eStart < gp_UpperBoundEdges(subGraph); ++eStart)
+    {
+        if (gp_EdgeNotInUse(subGraph, eStart) || gp_GetEdgeVisited(subGraph, eStart))
+            continue;
+
+        faceLength = 0;
+        e = eStart;
+        do
+        {
+            gp_SetEdgeVisited(subGraph, e);
+            faceLength++;
+            e = gp_GetNextEdgeCircular(subGraph, gp_GetTwin(subGraph, e));
+        } while (e != eStart);
+
+        // In a biconnected graph, each face is bounded by a simple cycle
+        if (faceLength != gp_GetN(subGraph))
+            continue;
+
+        do
+        {
+            eNext = gp_GetNextEdgeCircular(subGraph, gp_GetTwin(subGraph, e));
+            firstArcOf[gp_GetNeighbor(subGraph, e) - gp_LowerBoundVertices(subGraph)] = eNext;
+            e = eNext;
+        } while (e != eStart);
+
+        return OK;
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _CopyBlockEmbedding()
+
+ Links the edge records of theGraph that are in block B in the order of
+ the adjacency lists of the embedded subGraph of the block, listing
+ each vertex u circularly from the edge record given by
+ firstArcOf[u - gp_LowerBoundVertices()], and records the first and
+ last edge record of each vertex of the block. A vertex with no edges
+ in subGraph, as in an obstruction, gets an empty list.
+ ********************************************************************/
+
+void _CopyBlockEmbedding(EmbedBlocksContextP context, graphInt B, graphP subGraph, graphInt *firstArcOf)
+{
+    graphP theGraph = context->theGraph;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt d, slot, s, sStart, e, ePrev;
+
+    for (d = lowerBound; d < gp_UpperBoundVertices(subGraph); ++d)
+    {
+        slot = context->theTree->blockStart[B] + gp_GetIndex(subGraph, d) - lowerBound;
+        context->firstArcOf[slot] = context->lastArcOf[slot] = NIL;
+
+        ePrev = NIL;
+        s = sStart = firstArcOf[d - lowerBound];
+        while (gp_IsEdge(subGraph, s))
+        {
+            e = _GetBlockArc(context, B, s);
+
+            gp_SetPrevEdge(theGraph, e, ePrev);
+            if (gp_IsEdge(theGraph, ePrev))
+                gp_SetNextEdge(theGraph, ePrev, e);
+            else
+                context->firstArcOf[slot] = e;
+            ePrev = e;
+
+            if ((s = gp_GetNextEdgeCircular(subGraph, s)) == sStart)
+                break;
+        }
+
+        if (gp_IsEdge(theGraph, ePrev))
+            gp_SetNextEdge(theGraph, ePrev, NIL);
+        context->lastArcOf[slot] = ePrev;
+    }
+}
+
+/********************************************************************
+ _MergeBlocks()
+
+ Once all of the blocks have been embedded, the adjacency list of each
+ vertex is made by appending the edges of its blocks, in order of block
+ number. If any block is not embeddable, then the edges of the other
+ blocks, and of the obstruction of the least such block, are listed
+ in any order and then deleted, and the obstruction is copied into
+ theGraph. Then, a DFS tree is made, and theGraph is sorted by DFI.
+
+ Returns OK or NONEMBEDDABLE, or NOTOK if any block failed.
+ ********************************************************************/
+
+int _MergeBlocks(EmbedBlocksContextP context)
+{
+    graphP theGraph = context->theGraph, subGraph = NULL;
+    blockCutTreeP theTree = context->theTree;
+    graphInt lowerBound = gp_LowerBoundVertices(theGraph), lowerBoundEdges = gp_LowerBoundEdges(theGraph);
+    graphInt B, v, j, e, slot, obstructedBlock = -1;
+    graphInt *firstArcOf = NULL;
+
+    for (B = 0; B < theTree->numBlocks; B++)
+    {
+        if (context->schedule.results[B] == NONEMBEDDABLE)
+        {
+            if (obstructedBlock == -1)
+                obstructedBlock = B;
+        }
+        else if (context->schedule.results[B] != OK)
+            return NOTOK;
+    }
+
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        gp_SetFirstEdge(theGraph, v, NIL);
+        gp_SetLastEdge(theGraph, v, NIL);
+    }
+
+    // The edges of a block that was not embedded are appended one by one
+    for (B = 0; B < theTree->numBlocks; B++)
+    {
+        if (context->schedule.results[B] == OK && theTree->edgeStart[B + 1] - theTree->edgeStart[B] > 1)
+        {
+            for (slot = theTree->blockStart[B]; slot < theTree->blockStart[B + 1]; slot++)
+                _AppendArcs(theGraph, theTree->blockVertices[slot] + lowerBound,
+                            context->firstArcOf[slot], context->lastArcOf[slot]);
+            continue;
+        }
+
+        for (j = theTree->edgeStart[B]; j < theTree->edgeStart[B + 1]; j++)
+        {
+            e = theTree->blockEdges[j];
+            _AppendArcs(theGraph, gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e)), e, e);
+            _AppendArcs(theGraph, gp_GetNeighbor(theGraph, e), gp_GetTwin(theGraph, e), gp_GetTwin(theGraph, e));
+        }
+    }
+
+    if (obstructedBlock != -1)
+    {
+        subGraph = context->subGraphs[obstructedBlock];
+
+        for (B = 0; B < theTree->numBlocks; B++)
+        {
+            for (j = theTree->edgeStart[B]; j < theTree->edgeStart[B + 1]; j++)
+            {
+                if (B != obstructedBlock ||
+                    gp_EdgeNotInUse(subGraph, lowerBoundEdges + 2 * (j - theTree->edgeStart[B])))
+                {
+                    if (gp_DeleteEdge(theGraph, theTree->blockEdges[j]) != OK)
+                        return NOTOK;
+                }
+            }
+        }
+
+        // Only the edges of the obstruction remain in the lists of its vertices
+        if ((firstArcOf = (graphInt *)malloc((gp_GetN(subGraph) + 1) * sizeof(graphInt))) == NULL)
+            return NOTOK;
+
+        for (v = lowerBound; v < gp_UpperBoundVertices(subGraph); ++v)
+            firstArcOf[v - lowerBound] = gp_GetFirstEdge(subGraph, v);
+
+        _CopyBlockEmbedding(context, obstructedBlock, subGraph, firstArcOf);
+        free(firstArcOf);
+
+        for (slot = theTree->blockStart[obstructedBlock]; slot < theTree->blockStart[obstructedBlock + 1]; slot++)
+        {
+            v = theTree->blockVertices[slot] + lowerBound;
+            gp_SetFirstEdge(theGraph, v, context->firstArcOf[slot]);
+            gp_SetLastEdge(theGraph, v, context->lastArcOf[slot]);
+        }
+
+        theGraphIC(theGraph)->minorType = theGraphIC(subGraph)->minorType;
+    }
+
+    if (gp_ComputeDFSInfo(theGraph, DFSINFO_ALL) != OK)
+        return NOTOK;
+
+    return obstructedBlock != -1 ? NONEMBEDDABLE : OK;
+}
+
+/********************************************************************
+ _AppendArcs()
+
+ Appends the edge records from eFirst to eLast, which are already
+ linked to each other, to the adjacency list of vertex v. Nothing is
+ appended if eFirst is NIL.
+ ********************************************************************/
+
+void _AppendArcs(graphP theGraph, graphInt v, graphInt eFirst, graphInt eLast)
+{
+    graphInt eLastOfV = gp_GetLastEdge(theGraph, v);
+
+    if (gp_IsNotEdge(theGraph, eFirst))
+        return;
+
+    gp_SetPrevEdge(theGraph, eFirst, eLastOfV);
+    if (gp_IsEdge(theGraph, eLastOfV))
+        gp_SetNextEdge(theGraph, eLastOfV, eFirst);
+    else
+        gp_SetFirstEdge(theGraph, v, eFirst);
+
+    gp_SetNextEdge(theGraph, eLast, NIL);
+    gp_SetLastEdge(theGraph, v, eLast);
+}
+
+/********************************************************************
+ _InitEmbedSchedule()
+
+ Schedules each item i for which itemSizes[i] is positive, in order of
+ descending size, then ascending item number, so that one large item
+ is not left to be embedded after all of the others. The results of
+ the items that are not scheduled are OK.
+
+ Returns OK on success, NOTOK on failure. Either way, the schedule must
+ be freed with _FreeEmbedSchedule().
+ ********************************************************************/
+
+int _InitEmbedSchedule(EmbedScheduleP schedule, void *context, int (*fpEmbedItem)(void *, graphInt),
+                       graphInt numItems, graphInt *itemSizes)
+{
+    graphInt i, k, *pairs = NULL;
+
+    memset(schedule, 0, sizeof(EmbedSchedule));
+    schedule->context = context;
+    schedule->fpEmbedItem = fpEmbedItem;
+
+    if ((schedule->items = (graphInt *)malloc((numItems + 1) * sizeof(graphInt))) == NULL ||
+        (schedule->results = (int *)malloc((numItems + 1) * sizeof(int))) == NULL ||
+        (pairs = (graphInt *)malloc(2 * (numItems + 1) * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    for (i = 0; i < numItems; i++)
+    {
+        schedule->results[i] = OK;
+
+        if (itemSizes[i] > 0)
+        {
+            k = schedule->numItems++;
+            pairs[2 * k] = itemSizes[i];
+            pairs[2 * k + 1] = i;
+        }
+    }
+
+    qsort(pairs, schedule->numItems, 2 * sizeof(graphInt), _CompareScheduledItems);
+
+    for (k = 0; k < schedule->numItems; k++)
+        schedule->items[k] = pairs[2 * k + 1];
+
+    free(pairs);
+
+    return OK;
+}
+
+/********************************************************************
+ _FreeEmbedSchedule()
+ ********************************************************************/
+
+void _FreeEmbedSchedule(EmbedScheduleP schedule)
+{
+    free(schedule->items);
+    free(schedule->results);
+
+    memset(schedule, 0, sizeof(EmbedSchedule));
+}
+
+/********************************************************************
+ _CompareScheduledItems()
+
+ Orders the (size, item) pairs of a schedule by descending size, then
+ ascending item.
+ ********************************************************************/
+
+int _CompareScheduledItems(void const *a, void const *b)
+{
+    graphInt const *pairA = (graphInt const *)a, *pairB = (graphInt const *)b;
+
+    if (pairA[0] != pairB[0])
+        return pairA[0] > pairB[0] ? -1 : 1;
+
+    return pairA[1] < pairB[1] ? -1 : (pairA[1] > pairB[1] ? 1 : 0);
+}
+
+/********************************************************************
+ _RunEmbedSchedule()
+
+ Starts up to numThreads - 1 threads, but not more than there are
+ scheduled items to keep busy, and embeds items on the calling thread
+ too until all of them have been taken. If a thread cannot be started,
+ then the threads already started do its share.
+
+ Returns OK when all of the threads have finished, NOTOK if the
+ threads could not be tracked.
+ ********************************************************************/
+
+int _RunEmbedSchedule(EmbedScheduleP schedule, int numThreads)
+{
+    platform_thread *threads = NULL;
+    int numStarted = 0;
+
+    if (numThreads > schedule->numItems)
+        numThreads = schedule->numItems;
+
+    if (numThreads > 1 &&
+        (threads = (platform_thread *)malloc((numThreads - 1) * sizeof(platform_thread))) == NULL)
+        return NOTOK;
+
+    while (numStarted < numThreads - 1 &&
+           platform_CreateThread(threads[numStarted], _EmbedScheduleThread, schedule) == OK)
+        numStarted++;
+
+    _EmbedScheduledItems(schedule);
+
+    while (numStarted > 0)
+        platform_JoinThread(threads[--numStarted]);
+
+    free(threads);
+
+    return OK;
+}
+
+/********************************************************************
+ _EmbedScheduleThread()
+ ********************************************************************/
+
+platform_ThreadFunction(_EmbedScheduleThread, arg)
+{
+    _EmbedScheduledItems((EmbedScheduleP)arg);
+
+    return platform_ThreadReturn;
+}
+
+/********************************************************************
+ _EmbedScheduledItems()
+
+ Takes the next item from the schedule and embeds it, until the
+ schedule is exhausted. Each item is taken by exactly one thread.
+ ********************************************************************/
+
+void _EmbedScheduledItems(EmbedScheduleP schedule)
+{
+    int k;
+
+    while ((k = _gp_AtomicIncrement(&schedule->nextItem) - 1) < schedule->numItems)
+    {
+        graphInt item = schedule->items[k];
+
+        schedule->results[item] = schedule->fpEmbedItem(schedule->context, item);
+    }
+}
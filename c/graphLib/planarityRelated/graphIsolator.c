@@ -14,27 +14,27 @@ See the LICENSE.TXT file for licensing information.
 
 extern void _ClearAllVisitedFlagsInGraph(graphP);
 
-extern int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink);
+extern int _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink);
 extern int _JoinBicomps(graphP theGraph);
 
-extern int _ChooseTypeOfNonplanarityMinor(graphP theGraph, int v, int R);
+extern int _ChooseTypeOfNonplanarityMinor(graphP theGraph, graphInt v, graphInt R);
 
 /* Private function declarations (exported within system) */
 
-int _IsolateKuratowskiSubgraph(graphP theGraph, int v, int R);
+int _IsolateKuratowskiSubgraph(graphP theGraph, graphInt v, graphInt R);
 
-int _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex,
-                                  int *pAncestor, int *pDescendant);
-int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex,
-                                   int *pDescendant);
-int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor,
-                                 int SubtreeRoot, int *pDescendant);
+int _FindUnembeddedEdgeToAncestor(graphP theGraph, graphInt cutVertex,
+                                  graphInt *pAncestor, graphInt *pDescendant);
+int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex,
+                                   graphInt *pDescendant);
+int _FindUnembeddedEdgeToSubtree(graphP theGraph, graphInt ancestor,
+                                 graphInt SubtreeRoot, graphInt *pDescendant);
 
-int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert);
-int _MarkDFSPath(graphP theGraph, int ancestor, int descendant);
+int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert);
+int _MarkDFSPath(graphP theGraph, graphInt ancestor, graphInt descendant);
 
-int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant);
-void _AddBackEdge(graphP theGraph, int ancestor, int descendant);
+int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
+void _AddBackEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
 int _DeleteUnmarkedVerticesAndEdges(graphP theGraph);
 
 int _InitializeIsolatorContext(graphP theGraph);
@@ -50,7 +50,7 @@ int _IsolateMinorE2(graphP theGraph);
 int _IsolateMinorE3(graphP theGraph);
 int _IsolateMinorE4(graphP theGraph);
 
-int _GetLeastAncestorConnection(graphP theGraph, int cutVertex);
+graphInt _GetLeastAncestorConnection(graphP theGraph, graphInt cutVertex);
 int _MarkDFSPathsToDescendants(graphP theGraph);
 int _AddAndMarkUnembeddedEdges(graphP theGraph);
 
@@ -58,7 +58,7 @@ int _AddAndMarkUnembeddedEdges(graphP theGraph);
  gp_IsolateKuratowskiSubgraph()
  ****************************************************************************/
 
-int _IsolateKuratowskiSubgraph(graphP theGraph, int v, int R)
+int _IsolateKuratowskiSubgraph(graphP theGraph, graphInt v, graphInt R)
 {
     int RetVal;
 
@@ -121,7 +121,7 @@ int _InitializeIsolatorContext(graphP theGraph)
 
     if (theGraphIC(theGraph)->minorType & MINORTYPE_B)
     {
-        int SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
+        graphInt SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
 
         IC->uz = gp_GetVertexLowpoint(theGraph, SubtreeRoot);
 
@@ -194,7 +194,7 @@ int _IsolateMinorC(graphP theGraph)
 
     if (gp_GetObstructionMark(theGraph, IC->px) == ANYVERTEX_OBSTRUCTIONMARK_HIGH_RXW)
     {
-        int highY = gp_GetObstructionMark(theGraph, IC->py) == ANYVERTEX_OBSTRUCTIONMARK_HIGH_RYW
+        graphInt highY = gp_GetObstructionMark(theGraph, IC->py) == ANYVERTEX_OBSTRUCTIONMARK_HIGH_RYW
                         ? IC->py
                         : IC->y;
         if (_MarkPathAlongBicompExtFace(theGraph, IC->r, highY) != OK)
@@ -414,10 +414,10 @@ int _IsolateMinorE4(graphP theGraph)
  to an ancestor of v.
  ****************************************************************************/
 
-int _GetLeastAncestorConnection(graphP theGraph, int cutVertex)
+graphInt _GetLeastAncestorConnection(graphP theGraph, graphInt cutVertex)
 {
-    int child;
-    int ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
+    graphInt child;
+    graphInt ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
 
     child = gp_GetVertexFuturePertinentChild(theGraph, cutVertex);
     while (gp_IsVertex(theGraph, child))
@@ -447,11 +447,11 @@ int _GetLeastAncestorConnection(graphP theGraph, int cutVertex)
  Returns TRUE if found, FALSE otherwise.
  ****************************************************************************/
 
-int _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex,
-                                  int *pAncestor, int *pDescendant)
+int _FindUnembeddedEdgeToAncestor(graphP theGraph, graphInt cutVertex,
+                                  graphInt *pAncestor, graphInt *pDescendant)
 {
-    int child, foundChild;
-    int ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
+    graphInt child, foundChild;
+    graphInt ancestor = gp_GetVertexLeastAncestor(theGraph, cutVertex);
 
     child = gp_GetVertexFuturePertinentChild(theGraph, cutVertex);
     foundChild = NIL;
@@ -488,7 +488,7 @@ int _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex,
  Returns TRUE if founds, FALSE otherwise.
  ****************************************************************************/
 
-int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescendant)
+int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex, graphInt *pDescendant)
 {
     if (gp_IsEdge(theGraph, gp_GetVertexPertinentEdge(theGraph, cutVertex)))
     {
@@ -497,7 +497,7 @@ int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescend
     }
     else
     {
-        int subtreeRoot = gp_GetVertexFirstPertinentRootChild(theGraph, cutVertex);
+        graphInt subtreeRoot = gp_GetVertexFirstPertinentRootChild(theGraph, cutVertex);
 
         return _FindUnembeddedEdgeToSubtree(theGraph, theGraphIC(theGraph)->v,
                                             subtreeRoot, pDescendant);
@@ -513,10 +513,10 @@ int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescend
  Returns TRUE if found, FALSE if not found.
  ****************************************************************************/
 
-int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor,
-                                 int SubtreeRoot, int *pDescendant)
+int _FindUnembeddedEdgeToSubtree(graphP theGraph, graphInt ancestor,
+                                 graphInt SubtreeRoot, graphInt *pDescendant)
 {
-    int e, Z, ZNew;
+    graphInt e, Z, ZNew;
 
     *pDescendant = NIL;
 
@@ -570,9 +570,10 @@ int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor,
  edge link out of each visited vertex.
  ****************************************************************************/
 
-int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert)
+int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert)
 {
-    int Z, ZPrevLink, ZPrevEdge;
+    graphInt Z, ZPrevEdge;
+    int ZPrevLink;
 
     /* Mark the start vertex (and if it is a root copy, mark the parent copy too. */
 
@@ -612,9 +613,9 @@ int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert)
  DFS paths to single DFS tree edges, in which case the edge record with type
  EDGE_TYPE_PARENT may indicate the DFS paent or an ancestor.
  ****************************************************************************/
-int _MarkDFSPath(graphP theGraph, int ancestor, int descendant)
+int _MarkDFSPath(graphP theGraph, graphInt ancestor, graphInt descendant)
 {
-    int e, parent;
+    graphInt e, parent;
 
     // If we are marking from a root (virtual) vertex upward, then go up to the
     // non-virtual parent copy before starting the loop
@@ -730,7 +731,7 @@ int _AddAndMarkUnembeddedEdges(graphP theGraph)
  records and vertex structures that represent the edge.
  ****************************************************************************/
 
-int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant)
+int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant)
 {
     _AddBackEdge(theGraph, ancestor, descendant);
 
@@ -752,9 +753,9 @@ int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant)
  lists of the ancestor and descendant.
  ****************************************************************************/
 
-void _AddBackEdge(graphP theGraph, int ancestor, int descendant)
+void _AddBackEdge(graphP theGraph, graphInt ancestor, graphInt descendant)
 {
-    int fwdEdgeRec, backEdgeRec;
+    graphInt fwdEdgeRec, backEdgeRec;
 
     /* We get the two edge records of the back edge to embed. */
 
@@ -814,7 +815,7 @@ void _AddBackEdge(graphP theGraph, int ancestor, int descendant)
 
 int _DeleteUnmarkedVerticesAndEdges(graphP theGraph)
 {
-    int v, e, eNext;
+    graphInt v, e, eNext;
 
     /* All of the forward and back edge records of all of the "back" edges
        were removed from the adjacency lists in the planarity algorithm
@@ -0,0 +1,885 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include <stdlib.h>
+
+// This source file implements the maximal planar subgraph algorithm, which
+// embeds the edges that the Walkdown can embed and rejects the rest, or, if
+// maximality is ensured, only those that would make the subgraph nonplanar
+#include "graphMaximalPlanarSubgraph.h"
+#include "graphMaximalPlanarSubgraph.private.h"
+
+/* Imported functions */
+
+extern void _AttachEdgeRecord(graphP theGraph, graphInt v, graphInt e, int link, graphInt newEdge);
+extern void _ClearVertexVisitedFlags(graphP theGraph, int);
+
+/* Private functions exported to the extension */
+
+int _MaximalPlanarSubgraph_SetAsideParallelEdges(MaximalPlanarSubgraphContext *context);
+void _MaximalPlanarSubgraph_InitVertexInfo(MaximalPlanarSubgraphContext *context);
+int _MaximalPlanarSubgraph_IsDeadEnd(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W);
+void _MaximalPlanarSubgraph_AddPendingEdge(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W);
+int _MaximalPlanarSubgraph_PassStoppingVertices(MaximalPlanarSubgraphContext *context, graphInt R);
+int _MaximalPlanarSubgraph_RejectUnembeddedEdges(MaximalPlanarSubgraphContext *context);
+int _MaximalPlanarSubgraph_CheckRejectedEdges(MaximalPlanarSubgraphContext *context, graphP origGraph);
+
+/* Private functions */
+
+int _MaximalPlanarSubgraph_ScanParallelEdges(MaximalPlanarSubgraphContext *context, int setAside, graphInt *pNumParallelEdges);
+int _MaximalPlanarSubgraph_WalkUpToDeadVertex(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W, int killPath);
+void _MaximalPlanarSubgraph_KillVertex(MaximalPlanarSubgraphContext *context, graphInt W);
+int _MaximalPlanarSubgraph_DeleteFwdEdgeLists(graphP theGraph, graphInt *rejectedEdges);
+int _MaximalPlanarSubgraph_ReinsertRejectedEdges(graphP theGraph, graphInt *rejectedEdges, graphInt *pNumRejectedEdges);
+int _MaximalPlanarSubgraph_LoadTestGraph(graphP testGraph, graphInt *pairs, graphInt m);
+int _MaximalPlanarSubgraph_TakeEmbedding(graphP theGraph, graphP testGraph);
+int _MaximalPlanarSubgraph_RestoreParallelEdges(MaximalPlanarSubgraphContext *context, graphInt *pNumRejectedEdges);
+
+/********************************************************************
+ gp_MaximalPlanarSubgraph_GetNumRejectedEdges()
+
+ Returns the number of edges of the input graph that gp_Embed() left
+ out of the planar subgraph for EMBEDFLAGS_MAXIMALPLANARSUBGRAPH, or
+ 0 if theGraph has not been embedded that way or has not been extended
+ with the feature.
+ ********************************************************************/
+
+graphInt gp_MaximalPlanarSubgraph_GetNumRejectedEdges(graphP theGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+
+    if (theGraph == NULL)
+        return 0;
+
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+    if (context == NULL)
+        return 0;
+
+    return context->numRejectedEdges;
+}
+
+/********************************************************************
+ gp_MaximalPlanarSubgraph_GetRejectedEdge()
+
+ Gives in *pu and *pv the endpoints of the i-th rejected edge, for i
+ from 0 to gp_MaximalPlanarSubgraph_GetNumRejectedEdges() - 1. The
+ endpoints are given by their vertex numbers in the input graph, i.e.
+ the numbering that gp_SortVertices() restores after gp_Embed(), so
+ they do not change as the embedding is sorted.
+
+ Returns OK on success, NOTOK if theGraph is not extended with the
+ feature or if i is not the number of a rejected edge.
+ ********************************************************************/
+
+int gp_MaximalPlanarSubgraph_GetRejectedEdge(graphP theGraph, graphInt i, graphInt *pu, graphInt *pv)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+
+    if (theGraph == NULL || pu == NULL || pv == NULL)
+        return NOTOK;
+
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+    if (context == NULL || i < 0 || i >= context->numRejectedEdges)
+        return NOTOK;
+
+    *pu = context->rejectedEdges[2 * i];
+    *pv = context->rejectedEdges[2 * i + 1];
+
+    return OK;
+}
+
+/********************************************************************
+ gp_MaximalPlanarSubgraph_SetEnsureMaximal()
+
+ By default, gp_Embed() with EMBEDFLAGS_MAXIMALPLANARSUBGRAPH rejects
+ the edges that the Walkdown cannot embed, which takes linear time, but
+ the planar subgraph may then not be maximal. If ensureMaximal is TRUE,
+ then each of those edges is tested again afterward, and put back if the
+ subgraph stays planar, so that adding any rejected edge makes the
+ subgraph nonplanar. Each test is a planarity test of the subgraph, so
+ this takes time in O(M) for each edge that the Walkdown left out. The
+ setting applies to later calls of gp_Embed() until it is changed.
+
+ Returns OK on success, NOTOK if theGraph is not extended with the
+ feature.
+ ********************************************************************/
+
+int gp_MaximalPlanarSubgraph_SetEnsureMaximal(graphP theGraph, int ensureMaximal)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+
+    if (theGraph == NULL)
+        return NOTOK;
+
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+    if (context == NULL)
+        return NOTOK;
+
+    context->ensureMaximal = ensureMaximal ? TRUE : FALSE;
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_SetAsideParallelEdges()
+
+ Before the depth first search, each edge that duplicates an edge of
+ theGraph is deleted and recorded in the parallelEdges of the context,
+ since the Walkdown does not embed parallel edges. The edges are put
+ back beside their twins after the embedding (see
+ _MaximalPlanarSubgraph_RestoreParallelEdges()). The parallel edges are
+ counted first, so that the array is only allocated if there are any.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_SetAsideParallelEdges(MaximalPlanarSubgraphContext *context)
+{
+    graphInt numParallelEdges = 0;
+
+    if (_MaximalPlanarSubgraph_ScanParallelEdges(context, FALSE, &numParallelEdges) != OK)
+        return NOTOK;
+
+    if (numParallelEdges == 0)
+        return OK;
+
+    if ((context->parallelEdges = (graphInt *)malloc(2 * numParallelEdges * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    return _MaximalPlanarSubgraph_ScanParallelEdges(context, TRUE, &context->numParallelEdges);
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_ScanParallelEdges()
+
+ Counts in *pNumParallelEdges the edges that each vertex v has to a
+ neighbor W of greater number to which v has an edge earlier in its
+ adjacency list, i.e., all but one edge of each set of parallel edges.
+ If setAside is TRUE, then each of these edges is also deleted from
+ theGraph and its endpoints are recorded in parallelEdges.
+
+ The neighbors of v are marked visited as they are passed, and then
+ unmarked, so the work is linear in the size of theGraph.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_ScanParallelEdges(MaximalPlanarSubgraphContext *context, int setAside, graphInt *pNumParallelEdges)
+{
+    graphP theGraph = context->theGraph;
+    graphInt v, e, eNext, W, numParallelEdges = 0;
+
+    _ClearVertexVisitedFlags(theGraph, FALSE);
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            eNext = gp_GetNextEdge(theGraph, e);
+
+            W = gp_GetNeighbor(theGraph, e);
+            if (W > v)
+            {
+                if (!gp_GetVisited(theGraph, W))
+                    gp_SetVisited(theGraph, W);
+
+                else
+                {
+                    if (setAside)
+                    {
+                        context->parallelEdges[2 * numParallelEdges] = v;
+                        context->parallelEdges[2 * numParallelEdges + 1] = W;
+                        if (gp_DeleteEdge(theGraph, e) != OK)
+                            return NOTOK;
+                    }
+                    numParallelEdges++;
+                }
+            }
+
+            e = eNext;
+        }
+
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            gp_ClearVisited(theGraph, gp_GetNeighbor(theGraph, e));
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    *pNumParallelEdges = numParallelEdges;
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_InitVertexInfo()
+
+ Initializes the vertex level structure once the vertices are numbered
+ by DFI. The descendants of a vertex have greater DFIs than it does,
+ so the extent of each DFS subtree is found by passing the subtreeEnd
+ of each vertex to its parent, in reverse DFI order.
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_InitVertexInfo(MaximalPlanarSubgraphContext *context)
+{
+    graphP theGraph = context->theGraph;
+    MaximalPlanarSubgraph_VertexInfoP VI = context->VI;
+    graphInt v, parent;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        VI[v].subtreeEnd = v + 1;
+        VI[v].pendingEdges = 0;
+        VI[v].dead = FALSE;
+    }
+
+    for (v = gp_UpperBoundVertices(theGraph) - 1; v >= gp_LowerBoundVertices(theGraph); --v)
+    {
+        parent = gp_GetVertexParent(theGraph, v);
+        if (gp_IsVertex(theGraph, parent) && VI[parent].subtreeEnd < VI[v].subtreeEnd)
+            VI[parent].subtreeEnd = VI[v].subtreeEnd;
+    }
+
+    context->walkUpChild = NIL;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_IsDeadEnd()
+
+ Walks up from W toward v as the Walkup does, without marking anything,
+ to learn whether the back edge from v to W can still be embedded. It
+ cannot if the walk meets a dead vertex, one that the Walkdown has put
+ off the external face (see _MaximalPlanarSubgraph_KillVertex()), since
+ W is then either that vertex or in a bicomp that hangs off of it.
+ The walk stops early at v or at a vertex that a Walkup has visited in
+ step v, since the path from there up was found not to be dead.
+
+ If the walk meets a dead vertex, then the walk is repeated to kill the
+ vertices on it, which are just as unreachable, so that a later walk
+ from the same bicomps stops as soon as it starts. Hence each vertex is
+ passed by at most one walk that ends at a dead vertex, and the other
+ walks cost no more than the Walkups that follow them.
+
+ Returns TRUE if the back edge from v to W cannot be embedded,
+         FALSE otherwise.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_IsDeadEnd(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W)
+{
+    if (!_MaximalPlanarSubgraph_WalkUpToDeadVertex(context, v, W, FALSE))
+        return FALSE;
+
+    _MaximalPlanarSubgraph_WalkUpToDeadVertex(context, v, W, TRUE);
+    return TRUE;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_WalkUpToDeadVertex()
+
+ The walk for _MaximalPlanarSubgraph_IsDeadEnd(), which is a parallel
+ traversal of the two external face paths from each vertex up to the
+ root of its bicomp, as in the Walkup, followed by a hop to the parent
+ copy of the root. If killPath is TRUE, then the vertices passed are
+ killed.
+
+ Returns TRUE if the walk met a dead vertex, FALSE otherwise.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_WalkUpToDeadVertex(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W, int killPath)
+{
+    graphP theGraph = context->theGraph;
+    graphInt Zig = W, Zag = W, nextZig, nextZag;
+    int ZigPrevLink = 1, ZagPrevLink = 0;
+
+    for (;;)
+    {
+        if (context->VI[Zig].dead || context->VI[Zag].dead)
+            return TRUE;
+
+        if (gp_GetVertexVisitedIndex(theGraph, Zig) == v || gp_GetVertexVisitedIndex(theGraph, Zag) == v)
+            return FALSE;
+
+        if (killPath)
+        {
+            _MaximalPlanarSubgraph_KillVertex(context, Zig);
+            _MaximalPlanarSubgraph_KillVertex(context, Zag);
+        }
+
+        nextZig = gp_GetExtFaceVertex(theGraph, Zig, 1 ^ ZigPrevLink);
+        nextZag = gp_GetExtFaceVertex(theGraph, Zag, 1 ^ ZagPrevLink);
+
+        if (gp_IsVirtualVertex(theGraph, nextZig) || gp_IsVirtualVertex(theGraph, nextZag))
+        {
+            // Hop from the bicomp root to its parent copy
+            Zig = Zag = _gp_GetVertexFromBicompRoot(theGraph, gp_IsVirtualVertex(theGraph, nextZig) ? nextZig : nextZag);
+            if (Zig == v)
+                return FALSE;
+
+            ZigPrevLink = 1;
+            ZagPrevLink = 0;
+        }
+        else
+        {
+            ZigPrevLink = gp_GetExtFaceVertex(theGraph, nextZig, 0) == Zig ? 0 : 1;
+            Zig = nextZig;
+            ZagPrevLink = gp_GetExtFaceVertex(theGraph, nextZag, 0) == Zag ? 0 : 1;
+            Zag = nextZag;
+        }
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_KillVertex()
+
+ Marks W as dead, which means that no more edges will be embedded at W,
+ and makes W inactive for the rest of the embedding by clearing its
+ least ancestor and future pertinent child, so that the Walkdown passes
+ over W as it does any inactive vertex. The back edges from ancestors
+ to W and to the bicomps that hang off of W are rejected instead.
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_KillVertex(MaximalPlanarSubgraphContext *context, graphInt W)
+{
+    context->VI[W].dead = TRUE;
+    gp_SetVertexLeastAncestor(context->theGraph, W, W);
+    gp_SetVertexFuturePertinentChild(context->theGraph, W, NIL);
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_AddPendingEdge()
+
+ Counts the back edge from v to W, for which a Walkup was done, in the
+ pendingEdges of the child c of v whose DFS subtree contains W, so that
+ the Walkdown of the root copy of v for c can tell whether it has
+ embedded all of them.
+
+ The Walkups of step v are done in the order of the forward edge list of
+ v, which is sorted by DFI, and so are the children of v, so the child
+ of the previous Walkup is kept in walkUpChild and advanced from there.
+ It is found again from the first child of v if the step has changed,
+ or if W is before it.
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_AddPendingEdge(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W)
+{
+    graphP theGraph = context->theGraph;
+    graphInt c = context->walkUpChild;
+
+    if (gp_IsNotVertex(theGraph, c) || gp_GetVertexParent(theGraph, c) != v || W < c)
+        c = gp_GetVertexSortedDFSChildList(theGraph, v);
+
+    while (W >= context->VI[c].subtreeEnd)
+        c = gp_GetVertexNextDFSChild(theGraph, v, c);
+
+    context->VI[c].pendingEdges++;
+    context->walkUpChild = c;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_PassStoppingVertices()
+
+ The Walkdown of step v cannot reach the pertinent vertices of the bicomp
+ rooted by R, because a stopping vertex is in the way on both sides of
+ R, i.e., a vertex that is not pertinent but is future pertinent. R is
+ either the root of a blocked descendant bicomp or the RootVertex of a
+ Walkdown that has finished with back edges left to embed.
+
+ Rather than leave out all of the back edges from v into the bicomp,
+ which would leave the paths that the Walkups took up from them to be
+ walked again in later steps, the vertices on one side of R up to the
+ first pertinent vertex P are killed (see _MaximalPlanarSubgraph_KillVertex()),
+ since the back edge that the Walkdown embeds to P puts them off the
+ external face. The external face of the bicomp is short-circuited from
+ R to P, so the Walkdown goes straight to P.
+
+ The side is chosen by a parallel traversal of the two external face
+ paths from R, which stops at the first pertinent vertex on either
+ side, so the work is commensurate with the number of vertices killed.
+
+ Returns OK on success, NOTOK if there is no vertex to kill before
+ a pertinent vertex, which would mean that R is not blocked.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_PassStoppingVertices(MaximalPlanarSubgraphContext *context, graphInt R)
+{
+    graphP theGraph = context->theGraph;
+    graphInt Z[2], ZPrevLink[2], X, XPrevLink, nextX, P = NIL, PPrevLink = 0;
+    int side, RootSide = 0;
+
+    for (side = 0; side < 2; side++)
+    {
+        Z[side] = gp_GetExtFaceVertex(theGraph, R, side);
+        ZPrevLink[side] = gp_GetExtFaceVertex(theGraph, Z[side], 1 ^ side) == R ? 1 ^ side : side;
+        if (PERTINENT(theGraph, Z[side]))
+            return NOTOK;
+    }
+
+    while (gp_IsNotVertex(theGraph, P) && Z[0] != R && Z[1] != R)
+    {
+        for (side = 0; side < 2 && gp_IsNotVertex(theGraph, P); side++)
+        {
+            nextX = gp_GetExtFaceVertex(theGraph, Z[side], 1 ^ ZPrevLink[side]);
+            ZPrevLink[side] = gp_GetExtFaceVertex(theGraph, nextX, 0) == Z[side] ? 0 : 1;
+            Z[side] = nextX;
+
+            if (Z[side] != R && PERTINENT(theGraph, Z[side]))
+            {
+                P = Z[side];
+                PPrevLink = ZPrevLink[side];
+                RootSide = side;
+            }
+        }
+    }
+
+    if (gp_IsNotVertex(theGraph, P))
+        return NOTOK;
+
+    // Kill the vertices from R up to P on the chosen side
+    X = gp_GetExtFaceVertex(theGraph, R, RootSide);
+    XPrevLink = gp_GetExtFaceVertex(theGraph, X, 1 ^ RootSide) == R ? 1 ^ RootSide : RootSide;
+    while (X != P)
+    {
+        _MaximalPlanarSubgraph_KillVertex(context, X);
+        nextX = gp_GetExtFaceVertex(theGraph, X, 1 ^ XPrevLink);
+        XPrevLink = gp_GetExtFaceVertex(theGraph, nextX, 0) == X ? 0 : 1;
+        X = nextX;
+    }
+
+    gp_SetExtFaceVertex(theGraph, R, RootSide, P);
+    gp_SetExtFaceVertex(theGraph, P, PPrevLink, R);
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_RejectUnembeddedEdges()
+
+ After the embedding is postprocessed, the forward edge list of each
+ vertex holds exactly the forward edge records of the back edges that
+ were not embedded. These edges are deleted from theGraph and recorded
+ as the rejected edges of the context, by the original numbers of their
+ endpoints. If ensureMaximal is set, then each of them is first put
+ back into the embedding if the planar subgraph stays planar with it
+ (see _MaximalPlanarSubgraph_ReinsertRejectedEdges()).
+
+ Then the parallel edges that were set aside are put back beside their
+ twins, and those whose twins were rejected are rejected too.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_RejectUnembeddedEdges(MaximalPlanarSubgraphContext *context)
+{
+    graphP theGraph = context->theGraph;
+    graphInt v, e, i, numRejectedEdges = 0;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        e = gp_GetVertexFwdEdgeList(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            numRejectedEdges++;
+
+            e = gp_GetNextEdge(theGraph, e);
+            if (e == gp_GetVertexFwdEdgeList(theGraph, v))
+                e = NIL;
+        }
+    }
+
+    if (numRejectedEdges + context->numParallelEdges == 0)
+        return OK;
+
+    if ((context->rejectedEdges = (graphInt *)malloc(2 * (numRejectedEdges + context->numParallelEdges) * sizeof(graphInt))) == NULL ||
+        _MaximalPlanarSubgraph_DeleteFwdEdgeLists(theGraph, context->rejectedEdges) != OK)
+        return NOTOK;
+
+    if (context->ensureMaximal && numRejectedEdges > 0 &&
+        _MaximalPlanarSubgraph_ReinsertRejectedEdges(theGraph, context->rejectedEdges, &numRejectedEdges) != OK)
+        return NOTOK;
+
+    for (i = 0; i < 2 * numRejectedEdges; i++)
+        context->rejectedEdges[i] = gp_GetIndex(theGraph, context->rejectedEdges[i]);
+
+    if (_MaximalPlanarSubgraph_RestoreParallelEdges(context, &numRejectedEdges) != OK)
+        return NOTOK;
+
+    context->numRejectedEdges = numRejectedEdges;
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_DeleteFwdEdgeLists()
+
+ The forward edge record of each unembedded edge is in the forward
+ edge list of its ancestor endpoint, and its twin is in no adjacency
+ list. Each edge record is attached to the adjacency list of its
+ vertex so that the edge can be deleted in the usual way, and the
+ endpoints of the edge are written to rejectedEdges, which must have
+ room for all of them.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_DeleteFwdEdgeLists(graphP theGraph, graphInt *rejectedEdges)
+{
+    graphInt v, e, eNext, eFirst, W, numDeleted = 0;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        e = eFirst = gp_GetVertexFwdEdgeList(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            // The next edge record is obtained before e's links are reused
+            eNext = gp_GetNextEdge(theGraph, e);
+            if (eNext == eFirst)
+                eNext = NIL;
+
+            W = gp_GetNeighbor(theGraph, e);
+            _AttachEdgeRecord(theGraph, v, NIL, 0, e);
+            _AttachEdgeRecord(theGraph, W, NIL, 0, gp_GetTwin(theGraph, e));
+            if (gp_DeleteEdge(theGraph, e) != OK)
+                return NOTOK;
+
+            rejectedEdges[2 * numDeleted] = v;
+            rejectedEdges[2 * numDeleted + 1] = W;
+            numDeleted++;
+
+            e = eNext;
+        }
+
+        gp_SetVertexFwdEdgeList(theGraph, v, NIL);
+    }
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_ReinsertRejectedEdges()
+
+ Puts back into the embedding each of the *pNumRejectedEdges edges in
+ rejectedEdges that can be added to the planar subgraph, and compacts
+ the rest of the edges to the front of rejectedEdges, giving their
+ number in *pNumRejectedEdges.
+
+ The Walkdown leaves out the back edges that it cannot embed in the
+ step of their ancestor endpoint, but an edge left out in one step may
+ still be addable once all of the steps are done, e.g. because a later
+ step left out the back edges that made a stopping vertex block it.
+ So, each edge is tested in turn by embedding, with EMBEDFLAGS_TESTONLY,
+ a test graph that has the edges of the planar subgraph, the edges put
+ back before it, and the edge itself. An edge that makes the subgraph
+ nonplanar also makes it nonplanar with any more edges, so the edges
+ that stay rejected are exactly the ones that each make the result
+ nonplanar, i.e. the planar subgraph is maximal.
+
+ If any edges are put back, then the test graph is embedded once more,
+ with all of them, and theGraph is given its embedding, since the planar
+ subgraph may only have an embedding with them if some of its other
+ edges are embedded differently.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_ReinsertRejectedEdges(graphP theGraph, graphInt *rejectedEdges, graphInt *pNumRejectedEdges)
+{
+    graphP testGraph = NULL;
+    graphInt *pairs = NULL, m = 0, i, u, v, e, numKept = 0;
+    int Result = OK, embedResult;
+
+    if ((pairs = (graphInt *)malloc(2 * (gp_GetM(theGraph) + *pNumRejectedEdges) * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    // Each edge of the planar subgraph is listed once, from the endpoint with the lesser number
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            if (v < gp_GetNeighbor(theGraph, e))
+            {
+                pairs[2 * m] = v;
+                pairs[2 * m + 1] = gp_GetNeighbor(theGraph, e);
+                m++;
+            }
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    if ((testGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(testGraph, gp_GetN(theGraph)) != OK ||
+        gp_EnsureEdgeCapacity(testGraph, m + *pNumRejectedEdges) != OK)
+        Result = NOTOK;
+
+    for (i = 0; i < *pNumRejectedEdges && Result == OK; i++)
+    {
+        u = pairs[2 * m] = rejectedEdges[2 * i];
+        v = pairs[2 * m + 1] = rejectedEdges[2 * i + 1];
+
+        if (_MaximalPlanarSubgraph_LoadTestGraph(testGraph, pairs, m + 1) != OK)
+            Result = NOTOK;
+
+        else if ((embedResult = gp_Embed(testGraph, EMBEDFLAGS_PLANAR | EMBEDFLAGS_TESTONLY)) == OK)
+        {
+            m++;
+            if (gp_InsertEdge(theGraph, u, NIL, 0, v, NIL, 0) != OK)
+                Result = NOTOK;
+        }
+        else if (embedResult == NONEMBEDDABLE)
+        {
+            rejectedEdges[2 * numKept] = u;
+            rejectedEdges[2 * numKept + 1] = v;
+            numKept++;
+        }
+        else
+            Result = NOTOK;
+    }
+
+    if (Result == OK && numKept < *pNumRejectedEdges)
+    {
+        if (_MaximalPlanarSubgraph_LoadTestGraph(testGraph, pairs, m) != OK ||
+            gp_Embed(testGraph, EMBEDFLAGS_PLANAR) != OK ||
+            gp_SortVertices(testGraph) != OK ||
+            _MaximalPlanarSubgraph_TakeEmbedding(theGraph, testGraph) != OK)
+            Result = NOTOK;
+    }
+
+    *pNumRejectedEdges = numKept;
+
+    gp_Free(&testGraph);
+    free(pairs);
+
+    return Result;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_LoadTestGraph()
+
+ Resets testGraph, keeping its storage, and loads the m edges given by
+ pairs, as for gp_AddEdgesBulk(). The vertex indexes are set so that
+ gp_SortVertices() restores this numbering after gp_Embed().
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_LoadTestGraph(graphP testGraph, graphInt *pairs, graphInt m)
+{
+    graphInt v;
+
+    gp_ResetGraphStorage(testGraph);
+
+    for (v = gp_LowerBoundVertices(testGraph); v < gp_UpperBoundVertices(testGraph); ++v)
+        gp_SetIndex(testGraph, v, v);
+
+    return gp_AddEdgesBulk(testGraph, pairs, m);
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_TakeEmbedding()
+
+ Gives theGraph the embedding of testGraph, which must have the same
+ edges, with the vertices numbered the same way. The edge records of
+ each vertex of theGraph are relinked in the order of the edge records
+ of the same vertex in testGraph, which are matched by their neighbors.
+ Neither graph has parallel edges, since those of theGraph are set
+ aside until the rejected edges are final.
+
+ Returns OK on success, NOTOK if the graphs do not have the same edges.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_TakeEmbedding(graphP theGraph, graphP testGraph)
+{
+    graphInt *arcOf = NULL, v, e, ePrev, eTest, degree;
+    int Result = OK;
+
+    if ((arcOf = (graphInt *)malloc(gp_UpperBoundVertices(theGraph) * sizeof(graphInt))) == NULL)
+        return NOTOK;
+
+    for (v = 0; v < gp_UpperBoundVertices(theGraph); ++v)
+        arcOf[v] = NIL;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph) && Result == OK; ++v)
+    {
+        // Index the edge records of v by their neighbors
+        degree = 0;
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            arcOf[gp_GetNeighbor(theGraph, e)] = e;
+            degree++;
+            e = gp_GetNextEdge(theGraph, e);
+        }
+
+        // Relink them in the order of the neighbors in testGraph
+        ePrev = NIL;
+        eTest = gp_GetFirstEdge(testGraph, v);
+        while (gp_IsEdge(testGraph, eTest))
+        {
+            if (gp_IsNotEdge(theGraph, e = arcOf[gp_GetNeighbor(testGraph, eTest)]))
+            {
+                Result = NOTOK;
+                break;
+            }
+            arcOf[gp_GetNeighbor(testGraph, eTest)] = NIL;
+
+            if (gp_IsEdge(theGraph, ePrev))
+                gp_SetNextEdge(theGraph, ePrev, e);
+            else
+                gp_SetFirstEdge(theGraph, v, e);
+            gp_SetPrevEdge(theGraph, e, ePrev);
+
+            ePrev = e;
+            degree--;
+            eTest = gp_GetNextEdge(testGraph, eTest);
+        }
+
+        if (Result == OK && degree != 0)
+            Result = NOTOK;
+
+        if (Result == OK && gp_IsEdge(theGraph, ePrev))
+        {
+            gp_SetNextEdge(theGraph, ePrev, NIL);
+            gp_SetLastEdge(theGraph, v, ePrev);
+        }
+    }
+
+    free(arcOf);
+
+    return Result;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_RestoreParallelEdges()
+
+ Puts each parallel edge that was set aside before the depth first
+ search back into the embedding, beside its twin, if the twin is in
+ the planar subgraph, so that the two edges bound a face of their own.
+ The new edge record is inserted after the twin's edge record in the
+ adjacency list of the lesser endpoint, and before the twin's other
+ edge record at the greater endpoint. The other parallel edges are
+ appended to the rejected edges, after the first *pNumRejectedEdges,
+ and *pNumRejectedEdges is increased by their number.
+
+ The parallel edges are grouped by their lesser endpoint u, so the edge
+ records of u are indexed by their neighbors once for all of the
+ parallel edges of u, and the work is linear in the size of theGraph.
+
+ Returns OK on success, NOTOK on failure.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_RestoreParallelEdges(MaximalPlanarSubgraphContext *context, graphInt *pNumRejectedEdges)
+{
+    graphP theGraph = context->theGraph;
+    graphInt *parallelEdges = context->parallelEdges, *dfiOf = NULL, *arcOf = NULL;
+    graphInt i, first, u, v, W, e;
+    int Result = OK;
+
+    if (context->numParallelEdges == 0)
+        return OK;
+
+    if ((dfiOf = (graphInt *)malloc(gp_UpperBoundVertices(theGraph) * sizeof(graphInt))) == NULL ||
+        (arcOf = (graphInt *)malloc(gp_UpperBoundVertices(theGraph) * sizeof(graphInt))) == NULL)
+    {
+        free(dfiOf);
+        return NOTOK;
+    }
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        dfiOf[gp_GetIndex(theGraph, v)] = v;
+        arcOf[v] = NIL;
+    }
+
+    for (first = 0; first < context->numParallelEdges && Result == OK; first = i)
+    {
+        u = dfiOf[parallelEdges[2 * first]];
+
+        for (e = gp_GetFirstEdge(theGraph, u); gp_IsEdge(theGraph, e); e = gp_GetNextEdge(theGraph, e))
+            arcOf[gp_GetNeighbor(theGraph, e)] = e;
+
+        for (i = first; i < context->numParallelEdges && parallelEdges[2 * i] == parallelEdges[2 * first]; i++)
+        {
+            W = dfiOf[parallelEdges[2 * i + 1]];
+            e = arcOf[W];
+
+            if (gp_IsEdge(theGraph, e))
+            {
+                if (gp_InsertEdge(theGraph, u, e, 0, W, gp_GetTwin(theGraph, e), 1) != OK)
+                {
+                    Result = NOTOK;
+                    break;
+                }
+            }
+            else
+            {
+                context->rejectedEdges[2 * *pNumRejectedEdges] = parallelEdges[2 * i];
+                context->rejectedEdges[2 * *pNumRejectedEdges + 1] = parallelEdges[2 * i + 1];
+                (*pNumRejectedEdges)++;
+            }
+        }
+
+        for (e = gp_GetFirstEdge(theGraph, u); gp_IsEdge(theGraph, e); e = gp_GetNextEdge(theGraph, e))
+            arcOf[gp_GetNeighbor(theGraph, e)] = NIL;
+    }
+
+    free(dfiOf);
+    free(arcOf);
+
+    return Result;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_CheckRejectedEdges()
+
+ Checks that the rejected edges and the edges of theGraph together are
+ the edges of origGraph, given that theGraph is a subgraph of origGraph,
+ i.e., that there are as many edges in total as in origGraph, that each
+ rejected edge is in origGraph and that none is in theGraph.
+
+ The rejected edges are given by original vertex numbers, so they are
+ only looked up in origGraph if it is in its original numbering, and
+ they are mapped to the DFIs of theGraph if it is sorted by DFI.
+
+ Returns OK if the rejected edges are correct, NOTOK otherwise.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_CheckRejectedEdges(MaximalPlanarSubgraphContext *context, graphP origGraph)
+{
+    graphP theGraph = context->theGraph;
+    graphInt *dfi = NULL, i, u, v;
+    int Result = OK;
+
+    if (gp_GetM(theGraph) + context->numRejectedEdges != gp_GetM(origGraph))
+        return NOTOK;
+
+    if (gp_GetGraphFlags(theGraph) & GRAPHFLAGS_SORTEDBYDFI)
+    {
+        if ((dfi = (graphInt *)malloc(gp_UpperBoundVertices(theGraph) * sizeof(graphInt))) == NULL)
+            return NOTOK;
+
+        for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+            dfi[gp_GetIndex(theGraph, v)] = v;
+    }
+
+    for (i = 0; i < context->numRejectedEdges && Result == OK; i++)
+    {
+        u = context->rejectedEdges[2 * i];
+        v = context->rejectedEdges[2 * i + 1];
+
+        if (!(gp_GetGraphFlags(origGraph) & GRAPHFLAGS_SORTEDBYDFI) && !gp_IsNeighbor(origGraph, u, v))
+            Result = NOTOK;
+
+        else if (dfi != NULL ? gp_IsNeighbor(theGraph, dfi[u], dfi[v]) : gp_IsNeighbor(theGraph, u, v))
+            Result = NOTOK;
+    }
+
+    if (dfi != NULL)
+        free(dfi);
+
+    return Result;
+}
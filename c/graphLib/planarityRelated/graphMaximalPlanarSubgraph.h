@@ -0,0 +1,35 @@
+#ifndef GRAPH_MAXIMALPLANARSUBGRAPH_H
+#define GRAPH_MAXIMALPLANARSUBGRAPH_H
+
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "graphPlanarity.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Create a MaximalPlanarSubgraph Graph, i.e., subclass a Planarity Graph by
+// extending it with the ability to embed a planar subgraph of a nonplanar
+// graph, rejecting the edges that the Walkdown cannot embed, or only the
+// edges that would make it nonplanar if maximality is ensured.
+#define MAXIMALPLANARSUBGRAPH_NAME "MaximalPlanarSubgraph"
+
+    int gp_ExtendWith_MaximalPlanarSubgraph(graphP theGraph);
+    int gp_Detach_MaximalPlanarSubgraph(graphP theGraph);
+
+    int gp_MaximalPlanarSubgraph_SetEnsureMaximal(graphP theGraph, int ensureMaximal);
+
+    graphInt gp_MaximalPlanarSubgraph_GetNumRejectedEdges(graphP theGraph);
+    int gp_MaximalPlanarSubgraph_GetRejectedEdge(graphP theGraph, graphInt i, graphInt *pu, graphInt *pv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
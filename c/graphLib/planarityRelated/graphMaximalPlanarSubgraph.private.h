@@ -0,0 +1,98 @@
+#ifndef GRAPH_MAXIMALPLANARSUBGRAPH_PRIVATE_H
+#define GRAPH_MAXIMALPLANARSUBGRAPH_PRIVATE_H
+
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "../planarityRelated/graphPlanarity.private.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /* Additional equipment for each EdgeRec: None */
+
+    /* Additional equipment for each vertex, used only during gp_Embed()
+
+       subtreeEnd:
+          One more than the greatest DFI in the DFS subtree rooted by the
+          vertex, so the subtree is the vertices from the vertex up to,
+          but not including, subtreeEnd.
+       pendingEdges:
+          For a DFS child c of the vertex v being processed, the number of
+          back edges from v into the DFS subtree of c that had a Walkup
+          and have not yet been embedded by the Walkdown.
+       dead:
+          Whether the Walkdown has put the vertex off the external face,
+          or the vertex is in a bicomp that hangs off of such a vertex, so
+          that no more edges can be embedded at it.
+     */
+    typedef struct
+    {
+        graphInt subtreeEnd, pendingEdges;
+        int dead;
+    } MaximalPlanarSubgraph_VertexInfo;
+
+    typedef MaximalPlanarSubgraph_VertexInfo *MaximalPlanarSubgraph_VertexInfoP;
+
+    /* Additional equipment for the graph
+
+       ensureMaximal:
+          Whether the edges left out by the Walkdown are tested again so
+          that the planar subgraph is maximal, as set by
+          gp_MaximalPlanarSubgraph_SetEnsureMaximal(). FALSE by default.
+       parallelEdges:
+          The endpoints of the edges that duplicate an edge of the graph,
+          which are set aside before the depth first search, since the
+          Walkdown does not embed parallel edges, and are put back beside
+          their twins after the embedding. There are numParallelEdges pairs
+          of vertices in the original numbering of the graph, grouped by
+          their lesser endpoint. The array only exists during gp_Embed().
+       rejectedEdges:
+          The endpoints of the edges that were dropped from the embedding,
+          as numRejectedEdges pairs of vertices in the original numbering
+          of the graph (i.e. the numbering restored by gp_SortVertices()).
+          The array is allocated by the postprocessing of gp_Embed(), with
+          exactly the number of pairs needed, and freed by a reset.
+     */
+    typedef struct
+    {
+        // Helps distinguish initialize from re-initialize
+        int initialized;
+
+        // The graph that this context augments
+        graphP theGraph;
+
+        // Parallel array for additional vertex level equipment
+        MaximalPlanarSubgraph_VertexInfoP VI;
+
+        // The DFS child whose subtree had the last Walkup
+        graphInt walkUpChild;
+
+        // Whether the planar subgraph is made maximal
+        int ensureMaximal;
+
+        // The duplicate edges set aside during gp_Embed()
+        graphInt *parallelEdges;
+        graphInt numParallelEdges;
+
+        // The edges that are not in the planar subgraph
+        graphInt *rejectedEdges;
+        graphInt numRejectedEdges;
+
+        // Overloaded function pointers
+        graphFunctionTableStruct functions;
+
+    } MaximalPlanarSubgraphContext;
+
+    extern int MAXIMALPLANARSUBGRAPH_ID;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
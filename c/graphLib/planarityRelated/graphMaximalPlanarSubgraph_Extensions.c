@@ -0,0 +1,596 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include <stdlib.h>
+
+#include "graphMaximalPlanarSubgraph.h"
+#include "graphMaximalPlanarSubgraph.private.h"
+
+/* Imported functions */
+
+extern void _MaximalPlanarSubgraph_InitVertexInfo(MaximalPlanarSubgraphContext *context);
+extern int _MaximalPlanarSubgraph_IsDeadEnd(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W);
+extern void _MaximalPlanarSubgraph_AddPendingEdge(MaximalPlanarSubgraphContext *context, graphInt v, graphInt W);
+extern int _MaximalPlanarSubgraph_PassStoppingVertices(MaximalPlanarSubgraphContext *context, graphInt R);
+extern int _MaximalPlanarSubgraph_SetAsideParallelEdges(MaximalPlanarSubgraphContext *context);
+extern int _MaximalPlanarSubgraph_RejectUnembeddedEdges(MaximalPlanarSubgraphContext *context);
+extern int _MaximalPlanarSubgraph_CheckRejectedEdges(MaximalPlanarSubgraphContext *context, graphP origGraph);
+
+extern int _TestSubgraph(graphP theSubgraph, graphP theGraph);
+extern int _CheckEmbeddingFacialIntegrity(graphP theGraph);
+
+/* Forward declarations of local functions */
+
+void _MaximalPlanarSubgraph_ClearStructures(MaximalPlanarSubgraphContext *context);
+int _MaximalPlanarSubgraph_CreateStructures(MaximalPlanarSubgraphContext *context);
+void _MaximalPlanarSubgraph_FreeVertexInfo(MaximalPlanarSubgraphContext *context);
+void _MaximalPlanarSubgraph_FreeParallelEdges(MaximalPlanarSubgraphContext *context);
+
+/* Forward declarations of overloading functions */
+
+int _MaximalPlanarSubgraph_EmbeddingInitialize(graphP theGraph);
+void _MaximalPlanarSubgraph_WalkUp(graphP theGraph, graphInt v, graphInt e);
+void _MaximalPlanarSubgraph_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink);
+int _MaximalPlanarSubgraph_WalkDown(graphP theGraph, graphInt v, graphInt RootVertex);
+int _MaximalPlanarSubgraph_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R);
+int _MaximalPlanarSubgraph_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult);
+int _MaximalPlanarSubgraph_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
+int _MaximalPlanarSubgraph_CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
+
+void _MaximalPlanarSubgraph_ResetGraphStorage(graphP theGraph);
+
+/* Forward declarations of functions used by the extension system */
+
+void *_MaximalPlanarSubgraph_DupContext(void *pContext, void *theGraph);
+int _MaximalPlanarSubgraph_CopyData(void *dstContext, void *srcContext);
+void _MaximalPlanarSubgraph_FreeContext(void *);
+
+/****************************************************************************
+ * MAXIMALPLANARSUBGRAPH_ID - the variable used to hold the integer identifier
+ * for this extension, enabling this feature's extension context to be
+ * distinguished from other features' extension contexts that may be attached
+ * to a graph.
+ ****************************************************************************/
+
+int MAXIMALPLANARSUBGRAPH_ID = 0;
+
+/****************************************************************************
+ gp_ExtendWith_MaximalPlanarSubgraph()
+
+ This function adjusts the graph data structure to attach the maximal
+ planar subgraph feature.
+
+ To activate this feature during gp_Embed(), use
+ EMBEDFLAGS_MAXIMALPLANARSUBGRAPH. Then gp_Embed() returns OK with a planar
+ embedding of a spanning subgraph of theGraph, and the edges that were left
+ out of it are given by gp_MaximalPlanarSubgraph_GetRejectedEdge().
+
+ When the Walkdown is blocked at a bicomp, it passes the stopping vertices
+ on one side of the bicomp and carries on, and the back edges that later
+ steps would embed at those vertices are left out instead. The work stays
+ linear in the size of theGraph, but the planar subgraph need not be
+ maximal. If that is required, gp_MaximalPlanarSubgraph_SetEnsureMaximal()
+ makes gp_Embed() test each edge that was left out again, and put it back
+ if the subgraph stays planar with it. Each edge costs a planarity test of
+ the subgraph, so this second pass dominates the work for graphs with many
+ more edges than a planar graph can have.
+
+ Parallel edges are set aside before the depth first search and put
+ back beside their twins afterward, so a parallel edge is rejected only
+ if its twin is rejected.
+
+ The feature keeps data per vertex only while gp_Embed() runs, so this
+ method may be called before or after gp_EnsureVertexCapacity() or
+ gp_Read().
+
+ Returns OK for success, NOTOK for failure.
+ ****************************************************************************/
+
+int gp_ExtendWith_MaximalPlanarSubgraph(graphP theGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+
+    if (theGraph == NULL)
+        return NOTOK;
+
+    // If the feature has already been attached to the graph,
+    // then there is no need to attach it again
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+    if (context != NULL)
+    {
+        return OK;
+    }
+
+    // Ensure theGraph is a Planarity Graph
+    if (gp_ExtendWith_Planarity(theGraph) != OK)
+        return NOTOK;
+
+    // Allocate a new extension context
+    context = (MaximalPlanarSubgraphContext *)malloc(sizeof(MaximalPlanarSubgraphContext));
+    if (context == NULL)
+    {
+        return NOTOK;
+    }
+
+    // First, tell the context that it is not initialized
+    context->initialized = 0;
+
+    // Save a pointer to theGraph in the context
+    context->theGraph = theGraph;
+
+    // Put the overload functions into the context function table.
+    // gp_AddExtension will overload the graph's functions with these, and
+    // return the base function pointers in the context function table
+    memset(&context->functions, 0, sizeof(graphFunctionTableStruct));
+
+    context->functions.fpEmbeddingInitialize = _MaximalPlanarSubgraph_EmbeddingInitialize;
+    context->functions.fpEmbedBackEdgeToDescendant = _MaximalPlanarSubgraph_EmbedBackEdgeToDescendant;
+    context->functions.fpWalkUp = _MaximalPlanarSubgraph_WalkUp;
+    context->functions.fpWalkDown = _MaximalPlanarSubgraph_WalkDown;
+    context->functions.fpHandleBlockedBicomp = _MaximalPlanarSubgraph_HandleBlockedBicomp;
+    context->functions.fpEmbedPostprocess = _MaximalPlanarSubgraph_EmbedPostprocess;
+    context->functions.fpCheckEmbeddingIntegrity = _MaximalPlanarSubgraph_CheckEmbeddingIntegrity;
+    context->functions.fpCheckObstructionIntegrity = _MaximalPlanarSubgraph_CheckObstructionIntegrity;
+
+    context->functions.fpResetGraphStorage = _MaximalPlanarSubgraph_ResetGraphStorage;
+
+    _MaximalPlanarSubgraph_ClearStructures(context);
+    context->ensureMaximal = FALSE;
+
+    // Store the context, including the data structure and the
+    // function pointers, as an extension of the graph
+    if (gp_AddExtension(theGraph, &MAXIMALPLANARSUBGRAPH_ID, (void *)context,
+                        _MaximalPlanarSubgraph_DupContext,
+                        _MaximalPlanarSubgraph_CopyData,
+                        _MaximalPlanarSubgraph_FreeContext,
+                        &context->functions) != OK)
+    {
+        _MaximalPlanarSubgraph_FreeContext(context);
+        return NOTOK;
+    }
+
+    return OK;
+}
+
+/********************************************************************
+ gp_Detach_MaximalPlanarSubgraph()
+ ********************************************************************/
+
+int gp_Detach_MaximalPlanarSubgraph(graphP theGraph)
+{
+    return gp_RemoveExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID);
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_ClearStructures()
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_ClearStructures(MaximalPlanarSubgraphContext *context)
+{
+    if (!context->initialized)
+    {
+        // Before initialization, the pointers are stray, not NULL
+        context->VI = NULL;
+        context->rejectedEdges = NULL;
+        context->numRejectedEdges = 0;
+        context->parallelEdges = NULL;
+        context->numParallelEdges = 0;
+
+        context->initialized = 1;
+    }
+    else
+    {
+        _MaximalPlanarSubgraph_FreeVertexInfo(context);
+        _MaximalPlanarSubgraph_FreeParallelEdges(context);
+
+        if (context->rejectedEdges != NULL)
+        {
+            free(context->rejectedEdges);
+            context->rejectedEdges = NULL;
+        }
+        context->numRejectedEdges = 0;
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_CreateStructures()
+ Creates the uninitialized vertex level structure for an embedding,
+ replacing the one left by a prior embedding, if any.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_CreateStructures(MaximalPlanarSubgraphContext *context)
+{
+    graphInt VIsize = gp_UpperBoundVertices(context->theGraph);
+
+    _MaximalPlanarSubgraph_FreeVertexInfo(context);
+
+    if ((context->VI = (MaximalPlanarSubgraph_VertexInfoP)_gp_AllocStorage(context->theGraph, VIsize * sizeof(MaximalPlanarSubgraph_VertexInfo))) == NULL)
+        return NOTOK;
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_FreeVertexInfo()
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_FreeVertexInfo(MaximalPlanarSubgraphContext *context)
+{
+    if (context->VI != NULL)
+    {
+        _gp_FreeStorage(context->theGraph, context->VI);
+        context->VI = NULL;
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_FreeParallelEdges()
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_FreeParallelEdges(MaximalPlanarSubgraphContext *context)
+{
+    if (context->parallelEdges != NULL)
+    {
+        free(context->parallelEdges);
+        context->parallelEdges = NULL;
+    }
+    context->numParallelEdges = 0;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_DupContext()
+ ********************************************************************/
+
+void *_MaximalPlanarSubgraph_DupContext(void *pContext, void *theGraph)
+{
+    MaximalPlanarSubgraphContext *context = (MaximalPlanarSubgraphContext *)pContext;
+    MaximalPlanarSubgraphContext *newContext = (MaximalPlanarSubgraphContext *)malloc(sizeof(MaximalPlanarSubgraphContext));
+
+    if (newContext != NULL)
+    {
+        *newContext = *context;
+
+        // The vertex level structure is not duplicated because it
+        // is only used while gp_Embed() runs
+        newContext->theGraph = (graphP)theGraph;
+
+        newContext->initialized = 0;
+        _MaximalPlanarSubgraph_ClearStructures(newContext);
+
+        if (_MaximalPlanarSubgraph_CopyData(newContext, context) != OK)
+        {
+            _MaximalPlanarSubgraph_FreeContext(newContext);
+            return NULL;
+        }
+    }
+
+    return newContext;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_CopyData()
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_CopyData(void *dstContext, void *srcContext)
+{
+    MaximalPlanarSubgraphContext *dstMPSContext = (MaximalPlanarSubgraphContext *)dstContext;
+    MaximalPlanarSubgraphContext *srcMPSContext = (MaximalPlanarSubgraphContext *)srcContext;
+
+    if (dstContext == NULL)
+        return NOTOK;
+
+    // If the srcContext is NULL, then the caller wants the data
+    // structures in the dstContext to be reset/reinitialized
+    _MaximalPlanarSubgraph_ClearStructures(dstMPSContext);
+
+    if (srcContext == NULL)
+        return OK;
+
+    dstMPSContext->ensureMaximal = srcMPSContext->ensureMaximal;
+
+    if (srcMPSContext->numRejectedEdges == 0)
+        return OK;
+
+    // ELSE: If there is also a srcContext, then we copy the rejected edges
+    dstMPSContext->rejectedEdges = (graphInt *)malloc(2 * srcMPSContext->numRejectedEdges * sizeof(graphInt));
+    if (dstMPSContext->rejectedEdges == NULL)
+        return NOTOK;
+
+    memcpy(dstMPSContext->rejectedEdges, srcMPSContext->rejectedEdges,
+           2 * srcMPSContext->numRejectedEdges * sizeof(graphInt));
+    dstMPSContext->numRejectedEdges = srcMPSContext->numRejectedEdges;
+
+    return OK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_FreeContext()
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_FreeContext(void *pContext)
+{
+    MaximalPlanarSubgraphContext *context = (MaximalPlanarSubgraphContext *)pContext;
+
+    _MaximalPlanarSubgraph_ClearStructures(context);
+    free(pContext);
+}
+
+/********************************************************************
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_ResetGraphStorage(graphP theGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        // Reset the graph storage in base class(es)
+        context->functions.fpResetGraphStorage(theGraph);
+
+        // The rejected edges belong to the embedding that was reset
+        _MaximalPlanarSubgraph_ClearStructures(context);
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_EmbeddingInitialize()
+
+ Parallel edges are set aside before the base class makes the DFS
+ tree, and then the vertex level structure is created and initialized
+ with the extent of each DFS subtree.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_EmbeddingInitialize(graphP theGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            _MaximalPlanarSubgraph_FreeParallelEdges(context);
+            if (_MaximalPlanarSubgraph_SetAsideParallelEdges(context) != OK)
+                return NOTOK;
+        }
+
+        if (context->functions.fpEmbeddingInitialize(theGraph) != OK)
+            return NOTOK;
+
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            if (_MaximalPlanarSubgraph_CreateStructures(context) != OK)
+                return NOTOK;
+
+            _MaximalPlanarSubgraph_InitVertexInfo(context);
+        }
+
+        return OK;
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_WalkUp()
+
+ The Walkup for the back edge from v to W is skipped if the edge cannot
+ be embedded because W is dead or hangs off of a dead vertex (see
+ _MaximalPlanarSubgraph_IsDeadEnd()). The edge is then left in the
+ forward edge list of v to be rejected during postprocessing. Otherwise,
+ the base Walkup is done and the edge is counted as pending in the DFS
+ child of v whose subtree contains W.
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_WalkUp(graphP theGraph, graphInt v, graphInt e)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            if (_MaximalPlanarSubgraph_IsDeadEnd(context, v, gp_GetNeighbor(theGraph, e)))
+                return;
+
+            _MaximalPlanarSubgraph_AddPendingEdge(context, v, gp_GetNeighbor(theGraph, e));
+        }
+
+        context->functions.fpWalkUp(theGraph, v, e);
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_EmbedBackEdgeToDescendant()
+
+ After the base class embeds the back edge, it is no longer pending in
+ the DFS child in the root edge of RootVertex.
+ ********************************************************************/
+
+void _MaximalPlanarSubgraph_EmbedBackEdgeToDescendant(graphP theGraph, int RootSide, graphInt RootVertex, graphInt W, int WPrevLink)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        context->functions.fpEmbedBackEdgeToDescendant(theGraph, RootSide, RootVertex, W, WPrevLink);
+
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+            context->VI[gp_GetDFSChildFromBicompRoot(theGraph, RootVertex)].pendingEdges--;
+    }
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_WalkDown()
+
+ The Walkdown of RootVertex finishes at a stopping vertex on each side
+ of RootVertex, so it may leave back edges pending behind them. Then the
+ vertices on one side are passed (see _MaximalPlanarSubgraph_PassStoppingVertices())
+ and the Walkdown is done again, until no back edge from v into the DFS
+ subtree of the child in the root edge is pending. Each repetition first
+ reaches the vertices that the short-circuit edges of the last one led
+ to, so the extra work is commensurate with the vertices passed.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_WalkDown(graphP theGraph, graphInt v, graphInt RootVertex)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        int RetVal = context->functions.fpWalkDown(theGraph, v, RootVertex);
+
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            graphInt c = gp_GetDFSChildFromBicompRoot(theGraph, RootVertex);
+
+            while (RetVal == OK && context->VI[c].pendingEdges > 0)
+            {
+                if (_MaximalPlanarSubgraph_PassStoppingVertices(context, RootVertex) != OK)
+                    return NOTOK;
+
+                RetVal = context->functions.fpWalkDown(theGraph, v, RootVertex);
+            }
+        }
+
+        return RetVal;
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_HandleBlockedBicomp()
+
+ When the Walkdown is blocked, the vertices on one side of the blocked
+ bicomp are passed rather than isolating an obstruction, and OK is
+ returned so that the Walkdown carries on.
+
+ If R is the root of a blocked descendant bicomp, then the external
+ face of the bicomp is short-circuited to its first pertinent vertex
+ on one side (see _MaximalPlanarSubgraph_PassStoppingVertices()), so the
+ Walkdown descends to that vertex when it tries R again.
+
+ If R is RootVertex, then the Walkdown has finished without embedding
+ all of the back edges from v into the subtree of the DFS child in the
+ root edge. Those for which there was no Walkup are left in the forward
+ edge list of v to be rejected during postprocessing, and the others are
+ embedded by _MaximalPlanarSubgraph_WalkDown().
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_HandleBlockedBicomp(graphP theGraph, graphInt v, graphInt RootVertex, graphInt R)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            if (R != RootVertex)
+                return _MaximalPlanarSubgraph_PassStoppingVertices(context, R);
+
+            return OK;
+        }
+
+        return context->functions.fpHandleBlockedBicomp(theGraph, v, RootVertex, R);
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_EmbedPostprocess()
+
+ The embedding of the planar subgraph is oriented and its bicomps are
+ joined by the base class, and then the edges that were not embedded
+ are deleted from theGraph and recorded as rejected edges, and the
+ parallel edges that were set aside are put back or rejected. The
+ vertex level structure is no longer needed after that.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_EmbedPostprocess(graphP theGraph, graphInt v, int edgeEmbeddingResult)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        int RetVal = context->functions.fpEmbedPostprocess(theGraph, v, edgeEmbeddingResult);
+
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH && RetVal == OK)
+        {
+            if (_MaximalPlanarSubgraph_RejectUnembeddedEdges(context) != OK)
+                RetVal = NOTOK;
+        }
+
+        _MaximalPlanarSubgraph_FreeVertexInfo(context);
+        _MaximalPlanarSubgraph_FreeParallelEdges(context);
+
+        return RetVal;
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_CheckEmbeddingIntegrity()
+
+ The embedding must be a planar embedding of a subgraph of origGraph,
+ and the rejected edges must be the rest of the edges of origGraph.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+        {
+            if (origGraph == NULL ||
+                _TestSubgraph(theGraph, origGraph) != TRUE ||
+                _CheckEmbeddingFacialIntegrity(theGraph) != OK ||
+                _MaximalPlanarSubgraph_CheckRejectedEdges(context, origGraph) != OK)
+                return NOTOK;
+
+            return OK;
+        }
+
+        // When not making a planar subgraph, we let the superclass do the work
+        return context->functions.fpCheckEmbeddingIntegrity(theGraph, origGraph);
+    }
+
+    return NOTOK;
+}
+
+/********************************************************************
+ _MaximalPlanarSubgraph_CheckObstructionIntegrity()
+
+ No obstruction is isolated when making a planar subgraph.
+ ********************************************************************/
+
+int _MaximalPlanarSubgraph_CheckObstructionIntegrity(graphP theGraph, graphP origGraph)
+{
+    MaximalPlanarSubgraphContext *context = NULL;
+    gp_FindExtension(theGraph, MAXIMALPLANARSUBGRAPH_ID, (void *)&context);
+
+    if (context != NULL)
+    {
+        if (gp_GetEmbedFlags(theGraph) == EMBEDFLAGS_MAXIMALPLANARSUBGRAPH)
+            return NOTOK;
+
+        // When not making a planar subgraph, we let the superclass do the work
+        return context->functions.fpCheckObstructionIntegrity(theGraph, origGraph);
+    }
+
+    return NOTOK;
+}
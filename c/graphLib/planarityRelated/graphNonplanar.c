@@ -13,31 +13,31 @@ See the LICENSE.TXT file for licensing information.
 /* Imported functions */
 
 extern void _InitIsolatorContext(graphP theGraph);
-extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, int BicompRoot);
-extern int _ClearObstructionMarksInBicomp(graphP theGraph, int BicompRoot);
-extern int _HideInternalEdges(graphP theGraph, int vertex);
-extern int _RestoreInternalEdges(graphP theGraph, int stackBottom);
+extern int _ClearAllVisitedFlagsInBicomp(graphP theGraph, graphInt BicompRoot);
+extern int _ClearObstructionMarksInBicomp(graphP theGraph, graphInt BicompRoot);
+extern int _HideInternalEdges(graphP theGraph, graphInt vertex);
+extern int _RestoreInternalEdges(graphP theGraph, graphInt stackBottom);
 
 // extern int  _OrientVerticesInEmbedding(graphP theGraph);
-extern int _OrientVerticesInBicomp(graphP theGraph, int BicompRoot, int PreserveSigns);
+extern int _OrientVerticesInBicomp(graphP theGraph, graphInt BicompRoot, int PreserveSigns);
 
 /* Private functions (exported to system) */
 
-int _ChooseTypeOfNonplanarityMinor(graphP theGraph, int v, int R);
-int _InitializeNonplanarityContext(graphP theGraph, int v, int R);
+int _ChooseTypeOfNonplanarityMinor(graphP theGraph, graphInt v, graphInt R);
+int _InitializeNonplanarityContext(graphP theGraph, graphInt v, graphInt R);
 
-int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink);
-void _FindActiveVertices(graphP theGraph, int R, int *pX, int *pY);
-int _FindPertinentVertex(graphP theGraph);
+graphInt _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink);
+void _FindActiveVertices(graphP theGraph, graphInt R, graphInt *pX, graphInt *pY);
+graphInt _FindPertinentVertex(graphP theGraph);
 int _SetVertexTypesForMarkingXYPath(graphP theGraph);
 
-int _PopAndUnmarkVerticesAndEdges(graphP theGraph, int Z, int stackBottom);
+int _PopAndUnmarkVerticesAndEdges(graphP theGraph, graphInt Z, graphInt stackBottom);
 
 int _MarkHighestXYPath(graphP theGraph);
 int _MarkLowestXYPath(graphP theGraph);
-int _MarkClosestXYPath(graphP theGraph, int targetVertex);
+int _MarkClosestXYPath(graphP theGraph, graphInt targetVertex);
 int _MarkZtoRPath(graphP theGraph);
-int _FindFuturePertinenceBelowXYPath(graphP theGraph);
+graphInt _FindFuturePertinenceBelowXYPath(graphP theGraph);
 
 /****************************************************************************
  _gp_GetObstructionMinorType()
@@ -55,9 +55,9 @@ unsigned gp_GetObstructionMinorType(graphP theGraph)
  _ChooseTypeOfNonplanarityMinor()
  ****************************************************************************/
 
-int _ChooseTypeOfNonplanarityMinor(graphP theGraph, int v, int R)
+int _ChooseTypeOfNonplanarityMinor(graphP theGraph, graphInt v, graphInt R)
 {
-    int W, Px, Py, Z;
+    graphInt W, Px, Py, Z;
 
     /* Create the initial non-planarity minor state in the isolator context */
 
@@ -160,7 +160,7 @@ int _ChooseTypeOfNonplanarityMinor(graphP theGraph, int v, int R)
  the root R than X and Y along the external face paths (R X W) and (R Y W).
  ****************************************************************************/
 
-int _InitializeNonplanarityContext(graphP theGraph, int v, int R)
+int _InitializeNonplanarityContext(graphP theGraph, graphInt v, graphInt R)
 {
     // Blank out the isolator context, then assign the input graph reference
     // and the current vertext v into the context.
@@ -241,12 +241,12 @@ int _InitializeNonplanarityContext(graphP theGraph, int v, int R)
        face path emanating from the bicomp root.
  ********************************************************************/
 
-int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink)
+graphInt _GetNeighborOnExtFace(graphP theGraph, graphInt curVertex, int *pPrevLink)
 {
     /* Exit curVertex from whichever link was not previously used to enter it */
 
-    int e = gp_GetEdgeByLink(theGraph, curVertex, 1 ^ (*pPrevLink));
-    int nextVertex = gp_GetNeighbor(theGraph, e);
+    graphInt e = gp_GetEdgeByLink(theGraph, curVertex, 1 ^ (*pPrevLink));
+    graphInt nextVertex = gp_GetNeighbor(theGraph, e);
 
     /* This if stmt assigns the new prev link that tells us which edge
        record was used to enter nextVertex (so that we exit from the
@@ -275,9 +275,10 @@ int _GetNeighborOnExtFace(graphP theGraph, int curVertex, int *pPrevLink)
  returning the first active vertex appearing in each direction.
  ****************************************************************************/
 
-void _FindActiveVertices(graphP theGraph, int R, int *pX, int *pY)
+void _FindActiveVertices(graphP theGraph, graphInt R, graphInt *pX, graphInt *pY)
 {
-    int XPrevLink = 1, YPrevLink = 0, v = theGraphIC(theGraph)->v;
+    graphInt v = theGraphIC(theGraph)->v;
+    int XPrevLink = 1, YPrevLink = 0;
 
     *pX = _GetNeighborOnExtFace(theGraph, R, &XPrevLink);
     *pY = _GetNeighborOnExtFace(theGraph, R, &YPrevLink);
@@ -312,9 +313,10 @@ void _FindActiveVertices(graphP theGraph, int R, int *pX, int *pY)
  has pertinent child bicomps or is directly adjacent to the current vertex v.
  ****************************************************************************/
 
-int _FindPertinentVertex(graphP theGraph)
+graphInt _FindPertinentVertex(graphP theGraph)
 {
-    int W = theGraphIC(theGraph)->x, WPrevLink = 1;
+    graphInt W = theGraphIC(theGraph)->x;
+    int WPrevLink = 1;
 
     W = _GetNeighborOnExtFace(theGraph, W, &WPrevLink);
 
@@ -338,7 +340,8 @@ int _FindPertinentVertex(graphP theGraph)
 
 int _SetVertexTypesForMarkingXYPath(graphP theGraph)
 {
-    int R, X, Y, W, Z, ZPrevLink, ZType;
+    graphInt R, X, Y, W, Z;
+    int ZPrevLink, ZType;
 
     // Unpack the context for efficiency of loops
     R = theGraphIC(theGraph)->r;
@@ -394,9 +397,9 @@ int _SetVertexTypesForMarkingXYPath(graphP theGraph)
  pairs may appear.
  ****************************************************************************/
 
-int _PopAndUnmarkVerticesAndEdges(graphP theGraph, int Z, int stackBottom)
+int _PopAndUnmarkVerticesAndEdges(graphP theGraph, graphInt Z, graphInt stackBottom)
 {
-    int V, e;
+    graphInt V, e;
 
     // Pop vertex/edge pairs until all have been popped from the stack,
     // and all that's left is what was under the pairs, or until...
@@ -572,11 +575,11 @@ int _MarkLowestXYPath(graphP theGraph)
  in the X-Y path will have been marked visited.
  ****************************************************************************/
 
-int _MarkClosestXYPath(graphP theGraph, int targetVertex)
+int _MarkClosestXYPath(graphP theGraph, graphInt targetVertex)
 {
-    int e, Z;
-    int R, W, antipodalVertex;
-    int stackBottom1, stackBottom2;
+    graphInt e, Z;
+    graphInt R, W, antipodalVertex;
+    graphInt stackBottom1, stackBottom2;
 
     /* Initialization */
 
@@ -755,7 +758,7 @@ int _MarkClosestXYPath(graphP theGraph, int targetVertex)
 
 int _MarkZtoRPath(graphP theGraph)
 {
-    int ZPrevEdge, ZNextEdge, Z, R, Px, Py;
+    graphInt ZPrevEdge, ZNextEdge, Z, R, Px, Py;
 
     /* Initialize */
 
@@ -841,10 +844,11 @@ int _MarkZtoRPath(graphP theGraph)
         to be at or below X and Y.
  ****************************************************************************/
 
-int _FindFuturePertinenceBelowXYPath(graphP theGraph)
+graphInt _FindFuturePertinenceBelowXYPath(graphP theGraph)
 {
-    int Z = theGraphIC(theGraph)->px, ZPrevLink = 1,
-        Py = theGraphIC(theGraph)->py, v = theGraphIC(theGraph)->v;
+    graphInt Z = theGraphIC(theGraph)->px,
+             Py = theGraphIC(theGraph)->py, v = theGraphIC(theGraph)->v;
+    int ZPrevLink = 1;
 
     Z = _GetNeighborOnExtFace(theGraph, Z, &ZPrevLink);
 
@@ -13,24 +13,24 @@ extern void _ClearAllVisitedFlagsInGraph(graphP);
 
 extern int _JoinBicomps(graphP theGraph);
 
-extern int _InitializeNonplanarityContext(graphP theGraph, int v, int R);
+extern int _InitializeNonplanarityContext(graphP theGraph, graphInt v, graphInt R);
 extern int _MarkHighestXYPath(graphP theGraph);
 
 // extern int  _FindUnembeddedEdgeToAncestor(graphP theGraph, int cutVertex, int *pAncestor, int *pDescendant);
-extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, int cutVertex, int *pDescendant);
-extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, int ancestor, int SubtreeRoot, int *pDescendant);
+extern int _FindUnembeddedEdgeToCurVertex(graphP theGraph, graphInt cutVertex, graphInt *pDescendant);
+extern int _FindUnembeddedEdgeToSubtree(graphP theGraph, graphInt ancestor, graphInt SubtreeRoot, graphInt *pDescendant);
 
-extern int _MarkPathAlongBicompExtFace(graphP theGraph, int startVert, int endVert);
+extern int _MarkPathAlongBicompExtFace(graphP theGraph, graphInt startVert, graphInt endVert);
 
-extern int _AddAndMarkEdge(graphP theGraph, int ancestor, int descendant);
+extern int _AddAndMarkEdge(graphP theGraph, graphInt ancestor, graphInt descendant);
 
 extern int _DeleteUnmarkedVerticesAndEdges(graphP theGraph);
 
 /* Private function declarations (exported to system) */
 
-int _IsolateOuterplanarObstruction(graphP theGraph, int v, int R);
+int _IsolateOuterplanarObstruction(graphP theGraph, graphInt v, graphInt R);
 
-int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R);
+int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, graphInt v, graphInt R);
 
 int _IsolateOuterplanarityObstructionA(graphP theGraph);
 int _IsolateOuterplanarityObstructionB(graphP theGraph);
@@ -46,9 +46,9 @@ int _IsolateOuterplanarityObstructionE(graphP theGraph);
  the bicomp.
  ****************************************************************************/
 
-int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R)
+int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, graphInt v, graphInt R)
 {
-    int W;
+    graphInt W;
 
     // Create the initial non-outerplanarity obstruction isolator state.
     if (_InitializeNonplanarityContext(theGraph, v, R) != OK)
@@ -85,7 +85,7 @@ int _ChooseTypeOfNonOuterplanarityMinor(graphP theGraph, int v, int R)
  _IsolateOuterplanarObstruction()
  ****************************************************************************/
 
-int _IsolateOuterplanarObstruction(graphP theGraph, int v, int R)
+int _IsolateOuterplanarObstruction(graphP theGraph, graphInt v, graphInt R)
 {
     int RetVal;
 
@@ -106,7 +106,7 @@ int _IsolateOuterplanarObstruction(graphP theGraph, int v, int R)
     if (theGraphIC(theGraph)->minorType & MINORTYPE_B)
     {
         isolatorContextP IC = theGraphIC(theGraph);
-        int SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
+        graphInt SubtreeRoot = gp_GetVertexLastPertinentRootChild(theGraph, IC->w);
 
         if (_FindUnembeddedEdgeToSubtree(theGraph, IC->v, SubtreeRoot, &IC->dw) != TRUE)
             return NOTOK;
@@ -32,10 +32,47 @@ extern "C"
     // can be OK if the graph is embedded or embeddable, NONEMBEDDABLE if a minimal
     // subgraph obstructing embedding has been isolated, or NOTOK on error
     int gp_Embed(graphP theGraph, unsigned embedFlags);
+    int gp_EmbedParallel(graphP theGraph, unsigned embedFlags, int numThreads);
+    int gp_EmbedBlocksParallel(graphP theGraph, unsigned embedFlags, int numThreads);
+    int gp_EmbedBatch(const graphInt *edgeLists, int numGraphs, graphInt order, unsigned embedFlags,
+                      int *results, unsigned *minorTypes);
+    int gp_AddEdgeToEmbedding(graphP theGraph, graphInt u, graphInt v);
+    int gp_IsolateObstruction(graphP theGraph);
     int gp_TestEmbedResultIntegrity(graphP theGraph, graphP origGraph, int embedResult);
 
+    // Counts of the hot path operations and the phase timings of the last
+    // gp_Embed() of a graph. They are only gathered if the library is built
+    // with USE_EMBED_STATS (or configured with --enable-embed-stats), since
+    // counting costs time in the inner loops of the embedder. Otherwise,
+    // gp_GetEmbedStats() returns NOTOK.
+    //    walkUpSteps: iterations of the parallel external face traversals of Walkup
+    //    walkDownIterations: vertices visited by the Walkdown traversals
+    //    mergeBicompsCalls: calls of fpMergeBicomps, each merging one or more bicomps
+    //    mergeVertexCalls: calls of fpMergeVertex, one per bicomp merged
+    //    inactiveVertexSkips: inactive vertices passed over by fpHandleInactiveVertex
+    //    invertVertexFlips: vertices whose orientation was inverted
+    //    extFaceShortCircuits: external face short-circuits to stopping vertices
+    //    futurePertinentChildAdvances: DFS children passed over by the relaxed
+    //            advancement of each vertex's future pertinent child
+    //    initializeNanoseconds: elapsed time of the embedding initialization
+    //    mainLoopNanoseconds: elapsed time of the Walkup and Walkdown loop
+    //    postprocessNanoseconds: elapsed time of the embedding postprocessing
+    typedef struct embedStatsStruct embedStatsStruct;
+    typedef embedStatsStruct *embedStatsP;
+
+    struct embedStatsStruct
+    {
+        unsigned long long walkUpSteps, walkDownIterations,
+            mergeBicompsCalls, mergeVertexCalls,
+            inactiveVertexSkips, invertVertexFlips,
+            extFaceShortCircuits, futurePertinentChildAdvances;
+        unsigned long long initializeNanoseconds, mainLoopNanoseconds, postprocessNanoseconds;
+    };
+
+    int gp_GetEmbedStats(graphP theGraph, embedStatsP stats);
+
     // Graph embedding face enumeration and listing methods
-    int gp_CountEmbeddingFaces(graphP theGraph);
+    graphInt gp_CountEmbeddingFaces(graphP theGraph);
     int gp_CreateEmbeddingFaceList(graphP theGraph, char **pFaceList);
 
 // A return result value for gp_Embed() to indicate success prior to embedding completion,
@@ -62,6 +99,25 @@ extern "C"
 #define EMBEDFLAGS_PROJECTIVEPLANAR 512
 #define EMBEDFLAGS_TOROIDAL 1024
 
+// A modifier that can be added to EMBEDFLAGS_PLANAR or EMBEDFLAGS_OUTERPLANAR
+// when only the result of gp_Embed() is needed. Embedding stops as soon as the
+// result is known, so neither an embedding nor an obstruction is produced, and
+// the graph is left in an unspecified state until it is reset. A simple graph
+// with more edges than the planar (3N-6) or outerplanar (2N-3) bound is
+// reported as NONEMBEDDABLE before any depth first search. A graph with
+// duplicate or loop edges is always embedded, so the result is the same as
+// without the flag. The obstruction minor type is MINORTYPE_NONE.
+#define EMBEDFLAGS_TESTONLY 2048
+
+// A modifier that can be added to EMBEDFLAGS_PLANAR or EMBEDFLAGS_OUTERPLANAR
+// when the obstruction of a nonembeddable graph may not be needed. When the
+// Walkdown is blocked, gp_Embed() returns NONEMBEDDABLE right away, leaving the
+// partial embedding and the vertex and bicomp root at which it was blocked in
+// the graph. Then gp_IsolateObstruction() can be called to isolate the
+// obstruction that gp_Embed() would otherwise have isolated. Until then, the
+// graph must not be changed, and the obstruction minor type is MINORTYPE_NONE.
+#define EMBEDFLAGS_DEFERISOLATION 4096
+
     // After gp_Embed(), if the result is NONEMBEDDABLE, then this method
     // returns the obstructing minor type from the list below.
     // It is best to compare using a bitwise-and operation.
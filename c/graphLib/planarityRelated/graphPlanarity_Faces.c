@@ -12,7 +12,7 @@ See the LICENSE.TXT file for licensing information.
 
 static int _ClearEmbeddingFaceEdgeVisitedFlags(graphP theGraph)
 {
-    int e, eTwin;
+    graphInt e, eTwin;
 
     if (theGraph == NULL)
         return NOTOK;
@@ -30,7 +30,7 @@ static int _ClearEmbeddingFaceEdgeVisitedFlags(graphP theGraph)
     return OK;
 }
 
-static int _AppendEmbeddingFaceListHeader(strBufP faceList, int componentNumber)
+static int _AppendEmbeddingFaceListHeader(strBufP faceList, graphInt componentNumber)
 {
     return sb_ConcatString(faceList, "Component_") == OK &&
                    sb_ConcatInt(faceList, componentNumber) == OK &&
@@ -39,9 +39,10 @@ static int _AppendEmbeddingFaceListHeader(strBufP faceList, int componentNumber)
                : NOTOK;
 }
 
-static int _AppendEmbeddingFace(strBufP faceList, graphP theGraph, int eStart)
+static int _AppendEmbeddingFace(strBufP faceList, graphP theGraph, graphInt eStart)
 {
-    int e = eStart, eNext, faceVertex, firstVertex = NIL, firstInFace = TRUE;
+    graphInt e = eStart, eNext, faceVertex, firstVertex = NIL;
+    int firstInFace = TRUE;
 
     if (sb_ConcatString(faceList, "    ") != OK)
         return NOTOK;
@@ -84,10 +85,10 @@ static int _AppendEmbeddingFace(strBufP faceList, graphP theGraph, int eStart)
  count agrees with the extended Euler formula. Returns -1 on error.
  ********************************************************************/
 
-int gp_CountEmbeddingFaces(graphP theGraph)
+graphInt gp_CountEmbeddingFaces(graphP theGraph)
 {
     stackP theStack;
-    int v, e, eTwin, eStart, eNext, NumFaces, connectedComponents;
+    graphInt v, e, eTwin, eStart, eNext, NumFaces, connectedComponents;
 
     if (theGraph == NULL || !(gp_GetGraphFlags(theGraph) & GRAPHFLAGS_DFSNUMBERED))
         return -1;
@@ -165,9 +166,11 @@ int gp_CreateEmbeddingFaceList(graphP theGraph, char **pFaceList)
 {
     stackP theStack;
     strBufP faceList = NULL;
-    int *visitedVertices = NULL, *componentEdges = NULL;
-    int componentEdgesCapacity, componentNumber = 0, Result = OK;
-    int lowerVertex, upperVertex, v;
+    int *visitedVertices = NULL;
+    graphInt *componentEdges = NULL;
+    graphInt componentEdgesCapacity, componentNumber = 0;
+    int Result = OK;
+    graphInt lowerVertex, upperVertex, v;
 
     if (theGraph == NULL || pFaceList == NULL || *pFaceList != NULL)
         return NOTOK;
@@ -188,7 +191,7 @@ int gp_CreateEmbeddingFaceList(graphP theGraph, char **pFaceList)
 
     faceList = sb_New(0);
     visitedVertices = (int *)calloc((size_t)gp_UpperBoundVertexStorage(theGraph), sizeof(int));
-    componentEdges = (int *)calloc((size_t)componentEdgesCapacity, sizeof(int));
+    componentEdges = (graphInt *)calloc((size_t)componentEdgesCapacity, sizeof(graphInt));
 
     if (faceList == NULL || visitedVertices == NULL || componentEdges == NULL)
     {
@@ -198,7 +201,7 @@ int gp_CreateEmbeddingFaceList(graphP theGraph, char **pFaceList)
 
     for (v = lowerVertex; v < upperVertex; ++v)
     {
-        int componentEdgeCount = 0, i;
+        graphInt componentEdgeCount = 0, i;
 
         if (visitedVertices[v])
             continue;
@@ -215,7 +218,7 @@ int gp_CreateEmbeddingFaceList(graphP theGraph, char **pFaceList)
 
         while (sp_NonEmpty(theStack))
         {
-            int u, e;
+            graphInt u, e;
 
             sp_Pop(theStack, u);
             if (visitedVertices[u])
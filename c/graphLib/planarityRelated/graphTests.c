@@ -17,9 +17,9 @@ extern void _ClearVertexVisitedFlags(graphP theGraph, int);
 
 /* Private function declarations (some exported to system) */
 
-int _TestPath(graphP theGraph, int U, int V);
-int _TryPath(graphP theGraph, int e, int V);
-void _MarkPath(graphP theGraph, int e);
+int _TestPath(graphP theGraph, graphInt U, graphInt V);
+int _TryPath(graphP theGraph, graphInt e, graphInt V);
+void _MarkPath(graphP theGraph, graphInt e);
 int _TestSubgraph(graphP theSubgraph, graphP theGraph);
 
 int _CheckEmbeddingIntegrity(graphP theGraph, graphP origGraph);
@@ -27,17 +27,17 @@ int _CheckEmbeddingFacialIntegrity(graphP theGraph);
 int _CheckObstructionIntegrity(graphP theGraph, graphP origGraph);
 
 int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
-                      int *imageVerts, int maxNumImageVerts);
+                      graphInt *imageVerts, int maxNumImageVerts);
 int _TestForCompleteGraphObstruction(graphP theGraph, int numVerts,
-                                     int *degrees, int *imageVerts);
-int _TestForK33GraphObstruction(graphP theGraph, int *degrees, int *imageVerts);
-int _TestForK23GraphObstruction(graphP theGraph, int *degrees, int *imageVerts);
+                                     int *degrees, graphInt *imageVerts);
+int _TestForK33GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts);
+int _TestForK23GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts);
 
 int _CheckKuratowskiSubgraphIntegrity(graphP theGraph);
 int _CheckOuterplanarObstructionIntegrity(graphP theGraph);
 
 int _CheckAllVerticesOnExternalFace(graphP theGraph);
-void _MarkExternalFaceVertices(graphP theGraph, int startVertex);
+void _MarkExternalFaceVertices(graphP theGraph, graphInt startVertex);
 
 /********************************************************************
  gp_TestEmbedResultIntegrity()
@@ -188,7 +188,7 @@ int _CheckEmbeddingFacialIntegrity(graphP theGraph)
 
 int _CheckAllVerticesOnExternalFace(graphP theGraph)
 {
-    int v;
+    graphInt v;
 
     // Mark all vertices unvisited
     _ClearVertexVisitedFlags(theGraph, FALSE);
@@ -226,11 +226,11 @@ int _CheckAllVerticesOnExternalFace(graphP theGraph)
   single face that starts with startVertex.
  ********************************************************************/
 
-void _MarkExternalFaceVertices(graphP theGraph, int startVertex)
+void _MarkExternalFaceVertices(graphP theGraph, graphInt startVertex)
 {
-    int nextVertex = startVertex;
-    int e = gp_GetFirstEdge(theGraph, nextVertex);
-    int eTwin;
+    graphInt nextVertex = startVertex;
+    graphInt e = gp_GetFirstEdge(theGraph, nextVertex);
+    graphInt eTwin;
 
     // Handle the case of an isolated vertex
     if (gp_IsNotEdge(theGraph, e))
@@ -335,9 +335,10 @@ int _CheckObstructionIntegrity(graphP theGraph, graphP origGraph)
  ********************************************************************/
 
 int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
-                      int *imageVerts, int maxNumImageVerts)
+                      graphInt *imageVerts, int maxNumImageVerts)
 {
-    int K, v, imageVertPos, degree;
+    graphInt v, imageVertPos, degree;
+    int K;
 
     for (degree = 0; degree <= maxDegree; degree++)
         degrees[degree] = 0;
@@ -389,9 +390,9 @@ int _getImageVertices(graphP theGraph, int *degrees, int maxDegree,
  ********************************************************************/
 
 int _TestForCompleteGraphObstruction(graphP theGraph, int numVerts,
-                                     int *degrees, int *imageVerts)
+                                     int *degrees, graphInt *imageVerts)
 {
-    int v, w;
+    graphInt v, w;
 
     // We need to make sure we have numVerts vertices of degree numVerts-1
     // For example, if numVerts==5, then we're looking for a K5, so we
@@ -447,9 +448,10 @@ int _TestForCompleteGraphObstruction(graphP theGraph, int numVerts,
  returns TRUE if so, FALSE if not
  ********************************************************************/
 
-int _TestForK33GraphObstruction(graphP theGraph, int *degrees, int *imageVerts)
+int _TestForK33GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts)
 {
-    int v, K, imageVertPos, temp, success;
+    graphInt v, imageVertPos, temp;
+    int K, success;
 
     if (degrees[4] != 0)
         return FALSE;
@@ -539,7 +541,8 @@ int _TestForK33GraphObstruction(graphP theGraph, int *degrees, int *imageVerts)
 
 int _CheckKuratowskiSubgraphIntegrity(graphP theGraph)
 {
-    int degrees[5], imageVerts[6];
+    int degrees[5];
+    graphInt imageVerts[6];
 
     if (_getImageVertices(theGraph, degrees, 4, imageVerts, 6) != OK)
         return NOTOK;
@@ -571,9 +574,9 @@ int _CheckKuratowskiSubgraphIntegrity(graphP theGraph)
  returns TRUE if so, FALSE if not
  ********************************************************************/
 
-int _TestForK23GraphObstruction(graphP theGraph, int *degrees, int *imageVerts)
+int _TestForK23GraphObstruction(graphP theGraph, int *degrees, graphInt *imageVerts)
 {
-    int v, e, imageVertPos;
+    graphInt v, e, imageVertPos;
 
     // This function operates over the imageVerts results produced by
     // getImageVertices, which only finds vertices of degree 3 or higher.
@@ -666,7 +669,8 @@ int _TestForK23GraphObstruction(graphP theGraph, int *degrees, int *imageVerts)
 
 int _CheckOuterplanarObstructionIntegrity(graphP theGraph)
 {
-    int degrees[4], imageVerts[5];
+    int degrees[4];
+    graphInt imageVerts[5];
 
     if (_getImageVertices(theGraph, degrees, 3, imageVerts, 5) != OK)
         return NOTOK;
@@ -696,9 +700,9 @@ int _CheckOuterplanarObstructionIntegrity(graphP theGraph)
  path and FALSE otherwise.
  ********************************************************************/
 
-int _TestPath(graphP theGraph, int U, int V)
+int _TestPath(graphP theGraph, graphInt U, graphInt V)
 {
-    int e = gp_GetFirstEdge(theGraph, U);
+    graphInt e = gp_GetFirstEdge(theGraph, U);
 
     while (gp_IsEdge(theGraph, e))
     {
@@ -725,9 +729,9 @@ int _TestPath(graphP theGraph, int U, int V)
  boolean false otherwise.
  ********************************************************************/
 
-int _TryPath(graphP theGraph, int e, int V)
+int _TryPath(graphP theGraph, graphInt e, graphInt V)
 {
-    int eTwin, nextVertex;
+    graphInt eTwin, nextVertex;
 
     nextVertex = gp_GetNeighbor(theGraph, e);
 
@@ -755,9 +759,9 @@ int _TryPath(graphP theGraph, int e, int V)
  a starting vertex U.
  ********************************************************************/
 
-void _MarkPath(graphP theGraph, int e)
+void _MarkPath(graphP theGraph, graphInt e)
 {
-    int eTwin, nextVertex;
+    graphInt eTwin, nextVertex;
 
     nextVertex = gp_GetNeighbor(theGraph, e);
     // while nextVertex is strictly degree 2
@@ -792,7 +796,7 @@ void _MarkPath(graphP theGraph, int e)
 
 int _TestSubgraph(graphP theSubgraph, graphP theGraph)
 {
-    int v, e, degreeCount;
+    graphInt v, e, degreeCount;
     int Result = TRUE;
     int invokeSortOnGraph = FALSE;
     int invokeSortOnSubgraph = FALSE;
@@ -15,12 +15,21 @@ extern "C"
 #include "../graphLib/graphLib.h"
 
 #include "platformTime.h"
+#include "../graphLib/lowLevelUtils/platformThread.h"
 
 #define FILENAMEMAXLENGTH 128
 #define ALGORITHMNAMEMAXLENGTH 32
 #define SUFFIXMAXLENGTH 32
 #define COMMANDSTRINGMAXLENGTH 2
 
+// The largest number of vertices accepted for a random graph; the 64-bit
+// index build accepts graphs with more than 2^31 edge records
+#ifdef USE_64BIT_INDICES
+#define MAXRANDOMGRAPHSIZE 1000000000
+#else
+#define MAXRANDOMGRAPHSIZE 10000000
+#endif
+
 #define MODECHOICECHARS "rsmn"
 #define YESNOCHOICECHARS "yYnN"
 #define RANDOMGRAPHSOUTPUTCHOICECHARS "aAgG"
@@ -45,6 +54,10 @@ extern "C"
     int RandomGraphs(char const *const commandString, int NumGraphs, int SizeOfGraphs, char *outfileName, int forceQuiet, int useExGenerator);
     int TransformGraph(char const *const commandString, char const *const infileName, char *inputStr, int *outputBase, char const *outfileName, char **pOutputStr);
     int TestAllGraphs(char const *const commandString, char const *const infileName, char *outfileName, char **pOutputStr);
+    int Benchmark(char const *const commandString, int NumIterations, int SizeOfGraphs, char const *storageName);
+    int BenchmarkParallel(char const *const commandString, int NumComponents, int SizeOfComponents, int joinComponents);
+    int BenchmarkTestOnly(char const *const commandString, int NumGraphs, int SizeOfGraphs);
+    int BenchmarkIncremental(char const *const commandString, int NumCheckpoints, int SizeOfGraphs);
 
     /* Command line, Menu, and Configuration */
     int menu(void);
@@ -56,7 +69,8 @@ extern "C"
         OrigOutFormat,
         EmbeddableOut,
         ObstructedOut,
-        AdjListsForEmbeddingsOut;
+        AdjListsForEmbeddingsOut,
+        EmbedStatsOut;
 
     int Reconfigure(void);
 
@@ -87,6 +101,7 @@ extern "C"
 
     int ConstructTransformationExpectedResultFileName(char const *infileName, char **outfileName, char command, int actualOrExpectedFlag);
     void WriteAlgorithmResults(graphP theGraph, int Result, char command, platform_time start, platform_time end, char const *infileName);
+    void WriteEmbedStats(graphP theGraph);
 
     int GetNumCharsToReprInt(int theNum, int *numCharsRequired);
 
@@ -0,0 +1,717 @@
+/*
+Copyright (c) 1997-2026, John M. Boyer
+All rights reserved.
+See the LICENSE.TXT file for licensing information.
+*/
+
+#include "planarity.h"
+
+#define NUM_BENCHMARK_PHASES 5
+#define MAX_BENCHMARK_THREADS 64
+
+char const *GetEdgeStorageLayoutName(void);
+int CreateComponentsBenchmarkGraph(graphP theGraph, int NumComponents, int SizeOfComponents, int joinComponents);
+int CreateMixedBenchmarkGraph(graphP theGraph, int K);
+
+/****************************************************************************
+ * Benchmark()
+ *
+ * Times the phases of the algorithm given by the command parameter on a
+ * random graph of SizeOfGraphs vertices. One maximal planar graph is
+ * generated, then the copy, depth first search, sort, lowpoint and embed
+ * phases are run on a fresh copy of it NumIterations times, and the total
+ * time spent in each phase is reported.
+ *
+ * Afterward, the depth first search, sort and lowpoint phases are timed
+ * again as one call to gp_ComputeDFSInfo() on a fresh copy of the graph
+ * NumIterations times, for comparison with the separate calls.
+ *
+ * The random number generator is seeded with a constant so that the same
+ * graph is benchmarked by every build of the library. This makes it
+ * possible to compare builds that differ only in compile-time options,
+ * such as the edge storage layout (see USE_EDGE_SOA in graph.h).
+ *
+ * If storageName is NULL, then the edge records are kept on the heap and
+ * the graph that is copied into has all the edge capacity it needs, as in
+ * earlier versions, so that timings remain comparable. Otherwise, the
+ * storageName selects where the edge records of both graphs are kept:
+ * "heap", "reserve" for address space reserved by gp_ReserveEdgeStorage(),
+ * or "hugepages" for reserved address space that is backed by huge pages.
+ * Then the graph that is copied into starts with less edge capacity than
+ * it needs, so the first copy grows its edge storage, as happens when
+ * reading a graph whose number of edges is not known in advance, and the
+ * backends can be compared on that growth.
+ *
+ * Returns OK on success, NOTOK on any failure.
+ ****************************************************************************/
+
+int Benchmark(char const *const commandString, int NumIterations, int SizeOfGraphs, char const *storageName)
+{
+    int Result = OK;
+    int K = 0, embedFlags = 0, numEmbedded = 0;
+    int reserveEdgeStorage = FALSE, growEdgeStorage = storageName != NULL;
+    unsigned reserveFlags = 0;
+    char command = '\0', modifier = '\0';
+    graphP theGraph = NULL, origGraph = NULL;
+    platform_time start, end, phaseStart, phaseEnd;
+    double phaseTimes[NUM_BENCHMARK_PHASES], fusedTime = 0.0;
+    char const *phaseNames[NUM_BENCHMARK_PHASES] = {"Copy", "DFS", "Sort", "Lowpoints", "Embed"};
+
+    memset(phaseTimes, 0, NUM_BENCHMARK_PHASES * sizeof(double));
+
+    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK ||
+        GetEmbedFlags(command, modifier, &embedFlags) != OK)
+    {
+        gp_ErrorMessage("Unable to derive embedFlags from command string.");
+        return NOTOK;
+    }
+
+    if (NumIterations < 1 || SizeOfGraphs < 3)
+    {
+        gp_ErrorMessage("Benchmark requires at least one iteration and at least 3 vertices.");
+        return NOTOK;
+    }
+
+    if (storageName == NULL || strcmp(storageName, "heap") == 0)
+        storageName = "heap";
+    else if (strcmp(storageName, "reserve") == 0)
+        reserveEdgeStorage = TRUE;
+    else if (strcmp(storageName, "hugepages") == 0)
+    {
+        reserveEdgeStorage = TRUE;
+        reserveFlags = RESERVEFLAGS_HUGEPAGES;
+    }
+    else
+    {
+        gp_ErrorMessage("Benchmark storage must be heap, reserve or hugepages.");
+        return NOTOK;
+    }
+
+    if ((origGraph = gp_New()) == NULL ||
+        (reserveEdgeStorage && gp_ReserveEdgeStorage(origGraph, 3 * (graphInt)SizeOfGraphs, reserveFlags) != OK) ||
+        gp_EnsureVertexCapacity(origGraph, SizeOfGraphs) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        (reserveEdgeStorage && gp_ReserveEdgeStorage(theGraph, 3 * (graphInt)SizeOfGraphs, reserveFlags) != OK) ||
+        (growEdgeStorage && gp_EnsureEdgeCapacity(theGraph, SizeOfGraphs) != OK) ||
+        gp_EnsureVertexCapacity(theGraph, SizeOfGraphs) != OK ||
+        ExtendGraph(theGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to allocate and initialize graphs for benchmark.");
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_SetRandomSeed(1);
+    if (gp_CreateRandomGraphEx(origGraph, 3 * (graphInt)SizeOfGraphs - 6) != OK)
+    {
+        gp_ErrorMessage("Unable to create the random graph for benchmark.");
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    if (growEdgeStorage)
+        gp_Message("Benchmarking %s on N=%" GRAPHINT_FMT ", M=%" GRAPHINT_FMT " for %d iterations (edge storage: %s, %s, grown by the first copy).",
+                   GetAlgorithmName(command), gp_GetN(origGraph), gp_GetM(origGraph),
+                   NumIterations, GetEdgeStorageLayoutName(), storageName);
+    else
+        gp_Message("Benchmarking %s on N=%" GRAPHINT_FMT ", M=%" GRAPHINT_FMT " for %d iterations (edge storage: %s).",
+                   GetAlgorithmName(command), gp_GetN(origGraph), gp_GetM(origGraph),
+                   NumIterations, GetEdgeStorageLayoutName());
+
+    platform_GetTime(start);
+
+    for (K = 0; K < NumIterations && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        platform_GetTime(phaseStart);
+        Result = gp_CopyAdjacencyLists(theGraph, origGraph);
+        platform_GetTime(phaseEnd);
+        phaseTimes[0] += platform_GetDuration(phaseStart, phaseEnd);
+
+        if (Result == OK)
+        {
+            platform_GetTime(phaseStart);
+            Result = gp_DepthFirstSearch(theGraph);
+            platform_GetTime(phaseEnd);
+            phaseTimes[1] += platform_GetDuration(phaseStart, phaseEnd);
+        }
+
+        if (Result == OK)
+        {
+            platform_GetTime(phaseStart);
+            Result = gp_SortVertices(theGraph);
+            platform_GetTime(phaseEnd);
+            phaseTimes[2] += platform_GetDuration(phaseStart, phaseEnd);
+        }
+
+        if (Result == OK)
+        {
+            platform_GetTime(phaseStart);
+            Result = gp_ComputeLowpoints(theGraph);
+            platform_GetTime(phaseEnd);
+            phaseTimes[3] += platform_GetDuration(phaseStart, phaseEnd);
+        }
+
+        if (Result == OK)
+        {
+            platform_GetTime(phaseStart);
+            Result = gp_Embed(theGraph, embedFlags);
+            platform_GetTime(phaseEnd);
+            phaseTimes[4] += platform_GetDuration(phaseStart, phaseEnd);
+
+            if (Result == OK)
+                numEmbedded++;
+            else if (Result == NONEMBEDDABLE)
+                Result = OK;
+            else
+                gp_ErrorMessage("Embed operation failed on iteration %d.", K);
+        }
+    }
+
+    platform_GetTime(end);
+
+    for (K = 0; K < NumIterations && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        if ((Result = gp_CopyAdjacencyLists(theGraph, origGraph)) == OK)
+        {
+            platform_GetTime(phaseStart);
+            Result = gp_ComputeDFSInfo(theGraph, DFSINFO_ALL);
+            platform_GetTime(phaseEnd);
+            fusedTime += platform_GetDuration(phaseStart, phaseEnd);
+        }
+    }
+
+    if (Result == OK)
+    {
+        for (K = 0; K < NUM_BENCHMARK_PHASES; K++)
+            gp_Message("%-10s %.3lf seconds", phaseNames[K], phaseTimes[K]);
+
+        gp_Message("Num Embedded=%d.", numEmbedded);
+        gp_Message("Done (%.3lf seconds).", platform_GetDuration(start, end));
+
+        gp_Message("DFS, Sort and Lowpoints in one gp_ComputeDFSInfo() call: %.3lf seconds (separately: %.3lf seconds).",
+                   fusedTime, phaseTimes[1] + phaseTimes[2] + phaseTimes[3]);
+    }
+    else
+        gp_ErrorMessage("Benchmark failed.");
+
+    FlushConsole(stdout);
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ * BenchmarkParallel()
+ *
+ * Times gp_EmbedParallel() for the algorithm given by the command parameter
+ * on a random graph made of NumComponents connected components, each of
+ * which is a random maximal planar graph of SizeOfComponents vertices. The
+ * graph is embedded with 1, 2, 4, and so on up to MAX_BENCHMARK_THREADS
+ * threads, each time on a fresh copy of it, and the elapsed (wall clock)
+ * time of each is reported with its speedup over one thread, which is the
+ * same as calling gp_Embed().
+ *
+ * If joinComponents is nonzero, then each component shares one vertex with
+ * the next, so the graph is connected and the components are its blocks,
+ * and gp_EmbedBlocksParallel() is timed instead.
+ *
+ * Only the planarity and outerplanarity commands are embedded in parallel
+ * (see gp_EmbedParallel()), so the other commands show no speedup.
+ *
+ * Returns OK on success, NOTOK on any failure.
+ ****************************************************************************/
+
+int BenchmarkParallel(char const *const commandString, int NumComponents, int SizeOfComponents, int joinComponents)
+{
+    int Result = OK, serialResult = OK;
+    int embedFlags = 0, numThreads = 0;
+    char command = '\0', modifier = '\0';
+    graphP theGraph = NULL, origGraph = NULL;
+    platform_walltime start, end;
+    double serialTime = 0.0, elapsedTime = 0.0;
+    graphInt N = 0;
+
+    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK ||
+        GetEmbedFlags(command, modifier, &embedFlags) != OK)
+    {
+        gp_ErrorMessage("Unable to derive embedFlags from command string.");
+        return NOTOK;
+    }
+
+    if (NumComponents < 1 || SizeOfComponents < 3)
+    {
+        gp_ErrorMessage("Parallel benchmark requires at least one component of at least 3 vertices.");
+        return NOTOK;
+    }
+
+    N = joinComponents ? ((graphInt)SizeOfComponents - 1) * NumComponents + 1
+                       : (graphInt)SizeOfComponents * NumComponents;
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(origGraph, (3 * (graphInt)SizeOfComponents - 6) * NumComponents) != OK ||
+        gp_EnsureVertexCapacity(origGraph, N) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, (3 * (graphInt)SizeOfComponents - 6) * NumComponents) != OK ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK ||
+        ExtendGraph(theGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to allocate and initialize graphs for parallel benchmark.");
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_SetRandomSeed(1);
+    if (CreateComponentsBenchmarkGraph(origGraph, NumComponents, SizeOfComponents, joinComponents) != OK)
+    {
+        gp_ErrorMessage("Unable to create the random graph for parallel benchmark.");
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_Message("Benchmarking %s on %d %s, N=%" GRAPHINT_FMT ", M=%" GRAPHINT_FMT ".",
+               GetAlgorithmName(command), NumComponents, joinComponents ? "blocks" : "components",
+               gp_GetN(origGraph), gp_GetM(origGraph));
+
+    for (numThreads = 1; numThreads <= MAX_BENCHMARK_THREADS && Result == OK; numThreads *= 2)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        if ((Result = gp_CopyAdjacencyLists(theGraph, origGraph)) != OK)
+            break;
+
+        platform_GetWallTime(start);
+        if (joinComponents)
+            Result = gp_EmbedBlocksParallel(theGraph, embedFlags, numThreads);
+        else
+            Result = gp_EmbedParallel(theGraph, embedFlags, numThreads);
+        platform_GetWallTime(end);
+        elapsedTime = platform_GetWallDuration(start, end);
+
+        if (Result == NOTOK)
+        {
+            gp_ErrorMessage("Embed operation failed with %d threads.", numThreads);
+            break;
+        }
+
+        if (numThreads == 1)
+        {
+            serialResult = Result;
+            serialTime = elapsedTime;
+        }
+        else if (Result != serialResult)
+        {
+            gp_ErrorMessage("Embed result with %d threads differs from the result with one thread.", numThreads);
+            Result = NOTOK;
+            break;
+        }
+
+        gp_Message("Threads=%-3d %.3lf seconds (speedup %.2lf)", numThreads, elapsedTime,
+                   elapsedTime > 0.0 ? serialTime / elapsedTime : 1.0);
+
+        Result = OK;
+    }
+
+    if (Result != OK)
+        gp_ErrorMessage("Parallel benchmark failed.");
+
+    FlushConsole(stdout);
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ * CreateComponentsBenchmarkGraph()
+ *
+ * Makes theGraph, which must have no edges and room for NumComponents
+ * times SizeOfComponents vertices, into the disjoint union of
+ * NumComponents random maximal planar graphs of SizeOfComponents vertices.
+ * If joinComponents is nonzero, then the last vertex of each component is
+ * also the first vertex of the next, so that theGraph is a chain of blocks
+ * and needs room for only NumComponents times (SizeOfComponents - 1) + 1
+ * vertices.
+ ****************************************************************************/
+
+int CreateComponentsBenchmarkGraph(graphP theGraph, int NumComponents, int SizeOfComponents, int joinComponents)
+{
+    graphP componentGraph = NULL;
+    graphInt offset = 0, v, w, e;
+    int K, Result = OK;
+
+    if ((componentGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(componentGraph, SizeOfComponents) != OK)
+    {
+        gp_Free(&componentGraph);
+        return NOTOK;
+    }
+
+    for (K = 0; K < NumComponents && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(componentGraph);
+
+        if ((Result = gp_CreateRandomGraphEx(componentGraph, 3 * (graphInt)SizeOfComponents - 6)) != OK)
+            break;
+
+        for (v = gp_LowerBoundVertices(componentGraph); v < gp_UpperBoundVertices(componentGraph) && Result == OK; ++v)
+        {
+            e = gp_GetFirstEdge(componentGraph, v);
+            while (gp_IsEdge(componentGraph, e) && Result == OK)
+            {
+                w = gp_GetNeighbor(componentGraph, e);
+                if (v < w)
+                    Result = gp_AddEdge(theGraph, v + offset, 0, w + offset, 0);
+
+                e = gp_GetNextEdge(componentGraph, e);
+            }
+        }
+
+        offset += joinComponents ? SizeOfComponents - 1 : SizeOfComponents;
+    }
+
+    gp_Free(&componentGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ * BenchmarkTestOnly()
+ *
+ * Compares the time gp_Embed() takes to embed or isolate an obstruction
+ * with the time it takes when only the result is requested, by adding
+ * EMBEDFLAGS_TESTONLY, for the planarity or outerplanarity command given
+ * by the command parameter. NumGraphs random graphs of SizeOfGraphs
+ * vertices are made in turn by CreateMixedBenchmarkGraph(), so that the
+ * set mixes planar graphs with nonplanar graphs that are and are not
+ * above the edge count bound. Each graph is embedded both ways, each time
+ * on a fresh copy of it, and the two results must agree.
+ *
+ * Returns OK on success, NOTOK on any failure.
+ ****************************************************************************/
+
+int BenchmarkTestOnly(char const *const commandString, int NumGraphs, int SizeOfGraphs)
+{
+    int Result = OK, testOnlyResult = OK;
+    int K = 0, embedFlags = 0, numEmbedded = 0;
+    char command = '\0', modifier = '\0';
+    graphP theGraph = NULL, origGraph = NULL;
+    platform_time start, end;
+    double embedTime = 0.0, testOnlyTime = 0.0;
+
+    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK ||
+        GetEmbedFlags(command, modifier, &embedFlags) != OK)
+    {
+        gp_ErrorMessage("Unable to derive embedFlags from command string.");
+        return NOTOK;
+    }
+
+    if (embedFlags != EMBEDFLAGS_PLANAR && embedFlags != EMBEDFLAGS_OUTERPLANAR)
+    {
+        gp_ErrorMessage("Test only benchmark supports only the planarity and outerplanarity commands.");
+        return NOTOK;
+    }
+
+    if (NumGraphs < 1 || SizeOfGraphs < 10)
+    {
+        gp_ErrorMessage("Test only benchmark requires at least one graph of at least 10 vertices.");
+        return NOTOK;
+    }
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(origGraph, 4 * (graphInt)SizeOfGraphs) != OK ||
+        gp_EnsureVertexCapacity(origGraph, SizeOfGraphs) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, 4 * (graphInt)SizeOfGraphs) != OK ||
+        gp_EnsureVertexCapacity(theGraph, SizeOfGraphs) != OK ||
+        ExtendGraph(theGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to allocate and initialize graphs for test only benchmark.");
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_Message("Benchmarking %s on %d mixed graphs of N=%d, with and without EMBEDFLAGS_TESTONLY.",
+               GetAlgorithmName(command), NumGraphs, SizeOfGraphs);
+
+    gp_SetRandomSeed(1);
+    for (K = 0; K < NumGraphs && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(origGraph);
+        gp_ResetGraphStorage(theGraph);
+
+        if ((Result = CreateMixedBenchmarkGraph(origGraph, K)) != OK ||
+            (Result = gp_CopyAdjacencyLists(theGraph, origGraph)) != OK)
+            break;
+
+        platform_GetTime(start);
+        Result = gp_Embed(theGraph, embedFlags);
+        platform_GetTime(end);
+        embedTime += platform_GetDuration(start, end);
+
+        gp_ResetGraphStorage(theGraph);
+        if (Result == NOTOK || gp_CopyAdjacencyLists(theGraph, origGraph) != OK)
+        {
+            Result = NOTOK;
+            break;
+        }
+
+        platform_GetTime(start);
+        testOnlyResult = gp_Embed(theGraph, embedFlags | EMBEDFLAGS_TESTONLY);
+        platform_GetTime(end);
+        testOnlyTime += platform_GetDuration(start, end);
+
+        if (testOnlyResult != Result)
+        {
+            gp_ErrorMessage("Test only result differs from the embed result on graph %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        if (Result == OK)
+            numEmbedded++;
+
+        Result = OK;
+    }
+
+    if (Result == OK)
+    {
+        gp_Message("Embed      %.3lf seconds", embedTime);
+        gp_Message("Test only  %.3lf seconds (speedup %.2lf)", testOnlyTime,
+                   testOnlyTime > 0.0 ? embedTime / testOnlyTime : 1.0);
+        gp_Message("Num Embedded=%d of %d.", numEmbedded, NumGraphs);
+    }
+    else
+        gp_ErrorMessage("Test only benchmark failed.");
+
+    FlushConsole(stdout);
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ * CreateMixedBenchmarkGraph()
+ *
+ * Makes theGraph, which must have no edges and room for 4N edges, into
+ * the K-th graph of a mixed set: a random maximal planar graph if K mod 3
+ * is 0, the same plus N/10 random edges if K mod 3 is 1, or, if K mod 3
+ * is 2, the same less N/10 random edges, which has 3N-6 edges and is
+ * almost always nonplanar, so that the edge count bound does not decide.
+ ****************************************************************************/
+
+int CreateMixedBenchmarkGraph(graphP theGraph, int K)
+{
+    graphInt N = gp_GetN(theGraph), numExtraEdges = N / 10, v, e;
+
+    if (gp_CreateRandomGraphEx(theGraph, 3 * N - 6 + (K % 3 != 0 ? numExtraEdges : 0)) != OK)
+        return NOTOK;
+
+    while (K % 3 == 2 && gp_GetM(theGraph) > 3 * N - 6)
+    {
+        v = gp_GetRandomNumber(gp_LowerBoundVertices(theGraph), gp_UpperBoundVertices(theGraph) - 1);
+        e = gp_GetFirstEdge(theGraph, v);
+
+        if (gp_IsEdge(theGraph, e) && gp_DeleteEdge(theGraph, e) != OK)
+            return NOTOK;
+    }
+
+    return OK;
+}
+
+/****************************************************************************
+ * BenchmarkIncremental()
+ *
+ * Times gp_AddEdgeToEmbedding() on a stream of edges, for the planarity
+ * command only. The stream is the edges of a random maximal planar graph
+ * of SizeOfGraphs vertices plus N/10 random edges, in random order, and
+ * they are added one at a time to an embedding that starts with no edges,
+ * so the edges that would make it nonplanar are rejected as they come.
+ *
+ * For comparison, the accepted edges are embedded from scratch with
+ * gp_Embed() at NumCheckpoints evenly spaced points of the stream, and the
+ * average time of those embeddings estimates the cost per edge of keeping
+ * the embedding by embedding again after each edge. The final incremental
+ * embedding must pass gp_TestEmbedResultIntegrity().
+ *
+ * Returns OK on success, NOTOK on any failure.
+ ****************************************************************************/
+
+int BenchmarkIncremental(char const *const commandString, int NumCheckpoints, int SizeOfGraphs)
+{
+    int Result = OK;
+    int K = 0, embedFlags = 0;
+    char command = '\0', modifier = '\0';
+    graphP theGraph = NULL, origGraph = NULL;
+    graphInt N = SizeOfGraphs, *pairs = NULL, m = 0, numAccepted = 0, i, j, t, v, e;
+    platform_time start, end;
+    double incrementalTime = 0.0, embedTime = 0.0;
+
+    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK ||
+        GetEmbedFlags(command, modifier, &embedFlags) != OK)
+    {
+        gp_ErrorMessage("Unable to derive embedFlags from command string.");
+        return NOTOK;
+    }
+
+    if (embedFlags != EMBEDFLAGS_PLANAR)
+    {
+        gp_ErrorMessage("Incremental benchmark supports only the planarity command.");
+        return NOTOK;
+    }
+
+    if (NumCheckpoints < 1 || SizeOfGraphs < 10)
+    {
+        gp_ErrorMessage("Incremental benchmark requires at least one checkpoint and at least 10 vertices.");
+        return NOTOK;
+    }
+
+    if ((pairs = (graphInt *)malloc(2 * 4 * N * sizeof(graphInt))) == NULL ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(origGraph, 4 * N) != OK ||
+        gp_EnsureVertexCapacity(origGraph, N) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, 4 * N) != OK ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK)
+    {
+        gp_ErrorMessage("Unable to allocate and initialize graphs for incremental benchmark.");
+        free(pairs);
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_Message("Benchmarking incremental %s on a stream of edges with N=%d.",
+               GetAlgorithmName(command), SizeOfGraphs);
+
+    gp_SetRandomSeed(1);
+    if (gp_CreateRandomGraphEx(origGraph, 3 * N - 6 + N / 10) != OK)
+        Result = NOTOK;
+
+    for (v = gp_LowerBoundVertices(origGraph); v < gp_UpperBoundVertices(origGraph) && Result == OK; ++v)
+    {
+        e = gp_GetFirstEdge(origGraph, v);
+        while (gp_IsEdge(origGraph, e))
+        {
+            if (v < gp_GetNeighbor(origGraph, e))
+            {
+                pairs[2 * m] = v;
+                pairs[2 * m + 1] = gp_GetNeighbor(origGraph, e);
+                m++;
+            }
+            e = gp_GetNextEdge(origGraph, e);
+        }
+    }
+
+    // Shuffle the stream, then start from an embedding with no edges in
+    // the original numbering, so the stream needs no translation
+    for (i = m - 1; i > 0 && Result == OK; i--)
+    {
+        j = gp_GetRandomNumber(0, i);
+        t = pairs[2 * i];
+        pairs[2 * i] = pairs[2 * j];
+        pairs[2 * j] = t;
+        t = pairs[2 * i + 1];
+        pairs[2 * i + 1] = pairs[2 * j + 1];
+        pairs[2 * j + 1] = t;
+    }
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+        gp_SetIndex(theGraph, v, v);
+
+    if (Result == OK &&
+        (gp_Embed(theGraph, EMBEDFLAGS_PLANAR) != OK || gp_SortVertices(theGraph) != OK))
+        Result = NOTOK;
+
+    platform_GetTime(start);
+    for (i = 0; i < m && Result == OK; i++)
+    {
+        if ((Result = gp_AddEdgeToEmbedding(theGraph, pairs[2 * i], pairs[2 * i + 1])) == OK)
+        {
+            // The accepted edges are kept at the front of the stream
+            pairs[2 * numAccepted] = pairs[2 * i];
+            pairs[2 * numAccepted + 1] = pairs[2 * i + 1];
+            numAccepted++;
+        }
+        else if (Result == NONEMBEDDABLE)
+            Result = OK;
+    }
+    platform_GetTime(end);
+    incrementalTime = platform_GetDuration(start, end);
+
+    for (K = 1; K <= NumCheckpoints && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(origGraph);
+        for (v = gp_LowerBoundVertices(origGraph); v < gp_UpperBoundVertices(origGraph); ++v)
+            gp_SetIndex(origGraph, v, v);
+
+        if (gp_AddEdgesBulk(origGraph, pairs, (numAccepted * K) / NumCheckpoints) != OK)
+        {
+            Result = NOTOK;
+            break;
+        }
+
+        platform_GetTime(start);
+        Result = gp_Embed(origGraph, EMBEDFLAGS_PLANAR);
+        platform_GetTime(end);
+        embedTime += platform_GetDuration(start, end);
+    }
+
+    // The last checkpoint is all of the accepted edges
+    if (Result == OK)
+    {
+        gp_ResetGraphStorage(origGraph);
+        for (v = gp_LowerBoundVertices(origGraph); v < gp_UpperBoundVertices(origGraph); ++v)
+            gp_SetIndex(origGraph, v, v);
+
+        if (gp_AddEdgesBulk(origGraph, pairs, numAccepted) != OK ||
+            gp_TestEmbedResultIntegrity(theGraph, origGraph, OK) != OK)
+            Result = NOTOK;
+    }
+
+    if (Result == OK)
+    {
+        gp_Message("Edges streamed=%d, accepted=%d, rejected=%d.", (int)m, (int)numAccepted, (int)(m - numAccepted));
+        gp_Message("Incremental  %.3lf seconds, %.3lf microseconds per edge", incrementalTime,
+                   m > 0 ? 1e6 * incrementalTime / m : 0.0);
+        gp_Message("Re-embed     %.3lf microseconds per edge (average of %d embeddings)",
+                   1e6 * embedTime / NumCheckpoints, NumCheckpoints);
+        gp_Message("Speedup      %.2lf", incrementalTime > 0.0 ? (embedTime / NumCheckpoints) / (incrementalTime / m) : 1.0);
+    }
+    else
+        gp_ErrorMessage("Incremental benchmark failed.");
+
+    FlushConsole(stdout);
+
+    free(pairs);
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ * GetEdgeStorageLayoutName()
+ ****************************************************************************/
+
+char const *GetEdgeStorageLayoutName(void)
+{
+#ifdef USE_EDGE_SOA
+    return "structure of arrays";
+#else
+    return "array of structures";
+#endif
+}
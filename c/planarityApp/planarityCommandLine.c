@@ -13,8 +13,16 @@ See the LICENSE.TXT file for licensing information.
 #define chdir _chdir
 #else
 #include <unistd.h>
+
+// The -t command can re-execute itself as planarity16, which needs the
+// POSIX exec functions (see execNarrowIndexBuildIfSmallOrder())
+#if !defined(USE_16BIT_INDICES) && !defined(WINDOWS)
+#define NARROWINDEX_REEXEC
+#endif
 #endif
 
+#include <limits.h>
+
 int runQuickRegressionTests(int argc, char *argv[]);
 int callRandomGraphs(int argc, char *argv[]);
 int callSpecificGraph(int argc, char *argv[]);
@@ -22,6 +30,14 @@ int callRandomMaxPlanarGraph(int argc, char *argv[]);
 int callRandomNonplanarGraph(int argc, char *argv[]);
 int callTestAllGraphs(int argc, char *argv[]);
 int callTransformGraph(int argc, char *argv[]);
+int callBenchmark(int argc, char *argv[]);
+int callBenchmarkParallel(int argc, char *argv[]);
+int callBenchmarkTestOnly(int argc, char *argv[]);
+int callBenchmarkIncremental(int argc, char *argv[]);
+
+#ifdef NARROWINDEX_REEXEC
+void execNarrowIndexBuildIfSmallOrder(char *argv[], char const *infileName);
+#endif
 
 int runSpecificGraphTests(void);
 int runRandomGraphsTests(void);
@@ -30,6 +46,48 @@ int runTestAllGraphsTests(void);
 int runFaceListTest(void);
 int runHideRestoreTests(void);
 int runIdentifyContractTests(void);
+int runArenaGraphTests(void);
+int runArenaGraphTest(char command);
+int embedArenaTestGraph(graphP theGraph, graphP origGraph, int embedFlags);
+int runAdjacencyIndexTests(void);
+int runAdjacencyIndexTest(graphP origGraph);
+int compareAdjacencyQueries(graphP theGraph, graphP refGraph);
+int runBulkEdgeTests(void);
+int runBulkEdgeTest(graphP origGraph);
+int runCompactEdgeStorageTests(void);
+int runCompactEdgeStorageTest(graphP origGraph, char command);
+int runReservedEdgeStorageTests(void);
+int runReservedEdgeStorageTest(char command, unsigned reserveFlags);
+int runResetGraphStorageTests(void);
+int runResetGraphStorageTest(char command);
+int runThreadSafetyTests(void);
+platform_ThreadFunction(runThreadSafetyTestThread, arg);
+int runCSRTests(void);
+int runCSRTest(char command);
+int compareCSRRoundTrip(graphP theGraph, graphP csrGraph, int useCallerBuffers);
+int runDFSInfoTests(void);
+int runDFSInfoTest(graphP refGraph, graphP theGraph, int disconnect);
+int compareDFSInfo(graphP theGraph, graphP refGraph, int compareLeastAncestors);
+int runEmbedParallelTests(void);
+int runEmbedParallelTest(char command);
+int createComponentsTestGraph(graphP theGraph, int numComponents, graphInt numEdges);
+int runEmbedBlocksTests(void);
+int runEmbedBlocksTest(char command);
+int createBlocksTestGraph(graphP theGraph, int chordPercent, graphInt *pNumBlocks);
+int checkBlockCutTree(graphP theGraph, graphInt expectedNumBlocks);
+int runEmbedBatchTests(void);
+int runEmbedBatchTest(char command);
+int runTestOnlyMultigraphTest(char command);
+int runIncrementalEmbedTests(void);
+int runIncrementalEmbedTest(int sortedByDFI);
+int runMaximalPlanarSubgraphTests(void);
+int runMaximalPlanarSubgraphTest(graphInt numEdges, int ensureMaximal, int multigraph);
+int runEmbedStatsTests(void);
+int runDeferredIsolationTests(void);
+int runDeferredIsolationTest(unsigned embedFlags, graphInt numEdges);
+int checkIncrementalEmbedding(graphP theGraph, graphP refGraph, graphInt *pairs, graphInt m);
+int checkMaximalPlanarSubgraph(graphP theGraph, graphP refGraph);
+int runThreadSafetyTest(char **embedStrs, int *embedResults, int recordResults);
 int runSpecificGraphTest(char const *command, char const *infileName, int inputInMemFlag);
 int runGraphTransformationTest(char const *command, char const *infileName, int inputInMemFlag);
 int runTestAllGraphsTest(char const *commandString, char const *infileName);
@@ -82,6 +140,17 @@ int commandLine(int argc, char *argv[])
     else if (strcmp(argv[1], "-rn") == 0)
         Result = callRandomNonplanarGraph(argc, argv);
 
+    else if (strcmp(argv[1], "-b") == 0)
+        Result = callBenchmark(argc, argv);
+
+    else if (strcmp(argv[1], "-bp") == 0 || strcmp(argv[1], "-bb") == 0)
+        Result = callBenchmarkParallel(argc, argv);
+
+    else if (strcmp(argv[1], "-bt") == 0)
+        Result = callBenchmarkTestOnly(argc, argv);
+    else if (strcmp(argv[1], "-bi") == 0)
+        Result = callBenchmarkIncremental(argc, argv);
+
     else if (strncmp(argv[1], "-x", 2) == 0)
         Result = callTransformGraph(argc, argv);
 
@@ -244,6 +313,38 @@ int runQuickRegressionTests(int argc, char *argv[])
         retVal = NOTOK;
     else if (runIdentifyContractTests() != OK)
         retVal = NOTOK;
+    else if (runArenaGraphTests() != OK)
+        retVal = NOTOK;
+    else if (runAdjacencyIndexTests() != OK)
+        retVal = NOTOK;
+    else if (runBulkEdgeTests() != OK)
+        retVal = NOTOK;
+    else if (runCompactEdgeStorageTests() != OK)
+        retVal = NOTOK;
+    else if (runReservedEdgeStorageTests() != OK)
+        retVal = NOTOK;
+    else if (runResetGraphStorageTests() != OK)
+        retVal = NOTOK;
+    else if (runThreadSafetyTests() != OK)
+        retVal = NOTOK;
+    else if (runCSRTests() != OK)
+        retVal = NOTOK;
+    else if (runDFSInfoTests() != OK)
+        retVal = NOTOK;
+    else if (runEmbedParallelTests() != OK)
+        retVal = NOTOK;
+    else if (runEmbedBlocksTests() != OK)
+        retVal = NOTOK;
+    else if (runEmbedBatchTests() != OK)
+        retVal = NOTOK;
+    else if (runIncrementalEmbedTests() != OK)
+        retVal = NOTOK;
+    else if (runMaximalPlanarSubgraphTests() != OK)
+        retVal = NOTOK;
+    else if (runEmbedStatsTests() != OK)
+        retVal = NOTOK;
+    else if (runDeferredIsolationTests() != OK)
+        retVal = NOTOK;
     else if (runDigraphTests() != OK)
         retVal = NOTOK;
     else if (runGraphMLTests() != OK)
@@ -780,240 +881,2626 @@ int runHideRestoreTests(void)
     return Result;
 }
 
-int runHideRestoreTest(graphP theGraph)
+/****************************************************************************
+ runArenaGraphTests()
+
+ Embeds random graphs in graphs created by gp_NewWithArena() for each
+ algorithm, so that the storage of the graph and of each extension is
+ allocated in the arena. Halfway through, the edge capacity is doubled,
+ which moves the edge storage out of the arena. Each graph is also
+ embedded in a duplicate of the unextended copy made by gp_DupGraph(),
+ which gets its own arena, and the two embedding results must match.
+ With USE_VISITED_EPOCHS, the visited epochs of the duplicate are also
+ started just short of wrapping around, so the embedding of the duplicate
+ exercises the resetting of the visited stamps.
+ ****************************************************************************/
+
+#define ARENATEST_NUMGRAPHS 200
+#define ARENATEST_ORDER 40
+
+int runArenaGraphTests(void)
 {
-    char *beforeStr = NULL, *afterStr = NULL;
+    char const *commands = "pdo234";
+    platform_time start, end;
     int Result = OK;
-    int v;
 
-    if (theGraph == NULL)
+    gp_Message("Starting Arena Graph Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
     {
-        gp_ErrorMessage("runHideRestoreTest() received NULL graph.");
-        return NOTOK;
+        if ((Result = runArenaGraphTest(*c)) != OK)
+            gp_ErrorMessage("Arena graph test failed for command -%c.", *c);
     }
 
-    if (gp_WriteToString(theGraph, &beforeStr, WRITE_ADJLIST) != OK || beforeStr == NULL)
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Arena Graph Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runArenaGraphTest(char command)
+{
+    graphP theGraph = NULL, origGraph = NULL, dupGraph = NULL;
+    int embedFlags = 0, embedResult = OK, dupEmbedResult = OK, Result = OK;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (theGraph = gp_NewWithArena(ARENATEST_ORDER, 0)) == NULL ||
+        ExtendGraph(theGraph, command) != OK ||
+        (origGraph = gp_NewWithArena(ARENATEST_ORDER, 0)) == NULL)
     {
-        gp_ErrorMessage("Unable to write graph to string before hide/restore test.");
-        Result = NOTOK;
+        gp_ErrorMessage("Unable to create arena graphs for command -%c.", command);
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
     }
 
-    for (v = gp_LowerBoundVertices(theGraph); Result == OK && v < gp_UpperBoundVertices(theGraph); ++v)
+    for (int K = 0; K < ARENATEST_NUMGRAPHS && Result == OK; K++)
     {
-        if (gp_HideVertex(theGraph, v) != OK)
+        gp_ResetGraphStorage(theGraph);
+
+        if (K == ARENATEST_NUMGRAPHS / 2 &&
+            gp_EnsureEdgeCapacity(theGraph, 2 * gp_GetEdgeCapacity(theGraph)) != OK)
         {
-            gp_ErrorMessage("gp_HideVertex() failed during hide/restore test.");
+            gp_ErrorMessage("Unable to increase the edge capacity of the arena graph.");
             Result = NOTOK;
+            break;
         }
-    }
-
-    if (Result == OK && gp_RestoreVertices(theGraph) != OK)
-    {
-        gp_ErrorMessage("gp_RestoreVertices() failed during hide/restore test.");
-        Result = NOTOK;
-    }
 
-    if (Result == OK)
-    {
-        if (gp_WriteToString(theGraph, &afterStr, WRITE_ADJLIST) != OK || afterStr == NULL)
+        if (gp_CreateRandomGraph(theGraph) != OK ||
+            gp_CopyGraph(origGraph, theGraph) != OK ||
+            (dupGraph = gp_DupGraph(origGraph)) == NULL ||
+            ExtendGraph(dupGraph, command) != OK)
         {
-            gp_ErrorMessage("Unable to write graph to string after hide/restore test.");
+            gp_ErrorMessage("Unable to create, copy or duplicate random graph number %d.", K);
             Result = NOTOK;
+            break;
         }
-    }
 
-    if (Result == OK && strcmp(beforeStr, afterStr) != 0)
-    {
-        gp_ErrorMessage("Graph changed after hide/restore test.");
-        Result = NOTOK;
-    }
+#ifdef USE_VISITED_EPOCHS
+        dupGraph->vertexVisitedEpoch = dupGraph->virtualVertexVisitedEpoch =
+            dupGraph->edgeVisitedEpoch = UINT_MAX - 1 - (unsigned)(K % 4);
+#endif
 
-    if (beforeStr != NULL)
-    {
-        free(beforeStr);
-        beforeStr = NULL;
-    }
+        embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+        dupEmbedResult = embedArenaTestGraph(dupGraph, origGraph, embedFlags);
 
-    if (afterStr != NULL)
-    {
-        free(afterStr);
-        afterStr = NULL;
+        if ((embedResult != OK && embedResult != NONEMBEDDABLE) || dupEmbedResult != embedResult)
+        {
+            gp_ErrorMessage("Embedding failed or differed for random graph number %d.", K);
+            Result = NOTOK;
+        }
+
+        gp_Free(&dupGraph);
     }
 
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
     return Result;
 }
 
-int runIdentifyContractTests(void)
+// Returns the result of embedding theGraph if it passes the integrity
+// check against origGraph, or NOTOK on any failure
+int embedArenaTestGraph(graphP theGraph, graphP origGraph, int embedFlags)
 {
-    graphP theGraph = NULL;
-    G6ReadIteratorP theG6ReadIterator = NULL;
+    int embedResult = OK;
+
+    if (gp_DepthFirstSearch(theGraph) != OK ||
+        gp_SortVertices(theGraph) != OK ||
+        gp_ComputeLowpoints(theGraph) != OK)
+        return NOTOK;
+
+    embedResult = gp_Embed(theGraph, embedFlags);
+    if (embedResult != OK && embedResult != NONEMBEDDABLE)
+        return NOTOK;
+
+    return gp_TestEmbedResultIntegrity(theGraph, origGraph, embedResult) == embedResult ? embedResult : NOTOK;
+}
+
+/****************************************************************************
+ runAdjacencyIndexTests()
+
+ Applies the same sequence of edge hiding and restoring, vertex
+ identification and restoration, edge deletion and addition, sorting and embedding
+ to two duplicates of each random graph, one of which has the adjacency
+ index enabled. After each step, the adjacency queries of the two graphs
+ must agree for every pair of vertices, which checks that the index is
+ maintained or rebuilt as needed.
+ ****************************************************************************/
+
+#define ADJINDEXTEST_NUMGRAPHS 100
+#define ADJINDEXTEST_ORDER 30
+
+int runAdjacencyIndexTests(void)
+{
+    graphP origGraph = NULL;
     platform_time start, end;
     int Result = OK;
-    int lineNum = 0;
 
-    gp_Message("Starting Identify/Contract Tests");
+    gp_Message("Starting Adjacency Index Tests");
     platform_GetTime(start);
 
-    if ((theGraph = gp_New()) == NULL)
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, ADJINDEXTEST_ORDER) != OK)
     {
-        gp_ErrorMessage("Unable to allocate graph for identify/contract tests.");
+        gp_ErrorMessage("Unable to allocate graph for adjacency index tests.");
+        gp_Free(&origGraph);
         return NOTOK;
     }
 
-    if (g6_NewReader((&theG6ReadIterator), theGraph) != OK ||
-        g6_InitReaderWithFileName(theG6ReadIterator, "n8.mALL.g6") != OK)
-    {
-        gp_ErrorMessage("Unable to allocate or initialize G6 read iterator for identify/contract tests.");
-        Result = NOTOK;
-    }
-
-    while (Result == OK)
+    gp_SetRandomSeed(1);
+    for (int K = 0; K < ADJINDEXTEST_NUMGRAPHS && Result == OK; K++)
     {
-        if (g6_ReadGraph(theG6ReadIterator) != OK)
-        {
-            gp_ErrorMessage("Unable to read graph on line %d for identify/contract tests.", lineNum + 1);
-            Result = NOTOK;
-            break;
-        }
-
-        if (g6_EndReached(theG6ReadIterator))
-            break;
-
-        lineNum++;
+        gp_ResetGraphStorage(origGraph);
 
-        if (runIdentifyContractTest(theGraph) != OK)
+        if (gp_CreateRandomGraph(origGraph) != OK)
         {
-            gp_ErrorMessage("Identify/contract test failed for graph on line %d.", lineNum);
+            gp_ErrorMessage("Unable to create random graph number %d.", K);
             Result = NOTOK;
-            break;
         }
+        else if ((Result = runAdjacencyIndexTest(origGraph)) != OK)
+            gp_ErrorMessage("Adjacency index test failed for random graph number %d.", K);
     }
 
     platform_GetTime(end);
 
     if (Result == OK)
-        gp_Message("Done running Identify/Contract Tests (%.3lf seconds).", platform_GetDuration(start, end));
+        gp_Message("Done running Adjacency Index Tests (%.3lf seconds).", platform_GetDuration(start, end));
 
     gp_Message(" ");
 
-    g6_FreeReader((&theG6ReadIterator));
-    gp_Free(&theGraph);
+    gp_Free(&origGraph);
 
     return Result;
 }
 
-int runIdentifyContractTest(graphP theGraph)
+int runAdjacencyIndexTest(graphP origGraph)
 {
-    char *beforeStr = NULL, *afterStr = NULL;
-    int Result = OK;
-    int vertexOffset;
-    int pairs[7][2];
-    int i;
+    graphP theGraph = gp_DupGraph(origGraph), refGraph = gp_DupGraph(origGraph);
+    graphInt u, v, e;
+    int embedResult, Result = OK;
 
-    if (theGraph == NULL)
+    if (theGraph == NULL || refGraph == NULL || gp_EnableAdjacencyIndex(theGraph) != OK)
     {
-        gp_ErrorMessage("runIdentifyContractTest() received NULL graph.");
-        return NOTOK;
+        gp_ErrorMessage("Unable to duplicate graph for adjacency index test.");
+        Result = NOTOK;
     }
 
-    vertexOffset = gp_LowerBoundVertices(theGraph);
-
-    pairs[0][0] = vertexOffset;
-    pairs[0][1] = vertexOffset + 1;
-    pairs[1][0] = vertexOffset + 2;
-    pairs[1][1] = vertexOffset + 3;
-    pairs[2][0] = vertexOffset + 4;
-    pairs[2][1] = vertexOffset + 5;
-    pairs[3][0] = vertexOffset + 6;
-    pairs[3][1] = vertexOffset + 7;
-    pairs[4][0] = vertexOffset;
-    pairs[4][1] = vertexOffset + 2;
-    pairs[5][0] = vertexOffset + 4;
-    pairs[5][1] = vertexOffset + 6;
-    pairs[6][0] = vertexOffset;
-    pairs[6][1] = vertexOffset + 4;
-
-    if (gp_WriteToString(theGraph, &beforeStr, WRITE_ADJLIST) != OK || beforeStr == NULL)
+    // Hide every third edge, then restore them in the reverse order
+    if (Result == OK && (Result = compareAdjacencyQueries(theGraph, refGraph)) == OK)
     {
-        gp_ErrorMessage("Unable to write graph to string before identify/contract test.");
-        Result = NOTOK;
+        for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph); e += 6)
+        {
+            gp_HideEdge(theGraph, e);
+            gp_HideEdge(refGraph, e);
+        }
+
+        if ((Result = compareAdjacencyQueries(theGraph, refGraph)) == OK)
+        {
+            for (e -= 6; e >= gp_LowerBoundEdges(theGraph); e -= 6)
+            {
+                gp_RestoreEdge(theGraph, e);
+                gp_RestoreEdge(refGraph, e);
+            }
+            Result = compareAdjacencyQueries(theGraph, refGraph);
+        }
     }
 
-    for (i = 0; Result == OK && i < 7; i++)
+    // Identify the first vertex with a few of its neighbors, which
+    // contracts the edges between them, then restore
+    for (int i = 0; i < 3 && Result == OK; i++)
     {
-        if (gp_IdentifyVertices(theGraph, pairs[i][0], pairs[i][1], NIL) != OK)
+        u = gp_LowerBoundVertices(theGraph);
+        if (gp_IsEdge(theGraph, e = gp_GetFirstEdge(theGraph, u)))
         {
-            gp_ErrorMessage("gp_IdentifyVertices() failed during identify/contract test.");
-            Result = NOTOK;
+            v = gp_GetNeighbor(theGraph, e);
+            if (gp_IdentifyVertices(theGraph, u, v, NIL) != OK ||
+                gp_IdentifyVertices(refGraph, u, v, NIL) != OK)
+                Result = NOTOK;
+            else
+                Result = compareAdjacencyQueries(theGraph, refGraph);
         }
     }
 
-    if (Result == OK && gp_RestoreVertices(theGraph) != OK)
+    if (Result == OK)
     {
-        gp_ErrorMessage("gp_RestoreVertices() failed during identify/contract test.");
-        Result = NOTOK;
+        if (gp_RestoreVertices(theGraph) != OK || gp_RestoreVertices(refGraph) != OK)
+            Result = NOTOK;
+        else
+            Result = compareAdjacencyQueries(theGraph, refGraph);
     }
 
+    // Delete the first edge of each vertex, then add edges between
+    // vertices that are not adjacent
     if (Result == OK)
     {
-        if (gp_WriteToString(theGraph, &afterStr, WRITE_ADJLIST) != OK || afterStr == NULL)
+        for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph) && Result == OK; v += 2)
         {
-            gp_ErrorMessage("Unable to write graph to string after identify/contract test.");
-            Result = NOTOK;
+            if (gp_IsEdge(theGraph, e = gp_GetFirstEdge(theGraph, v)))
+            {
+                gp_DeleteEdge(theGraph, e);
+                gp_DeleteEdge(refGraph, e);
+            }
+        }
+
+        if ((Result = compareAdjacencyQueries(theGraph, refGraph)) == OK)
+        {
+            for (int i = 0; i < ADJINDEXTEST_ORDER && Result == OK; i++)
+            {
+                u = gp_LowerBoundVertices(theGraph) + gp_GetRandomNumber(0, ADJINDEXTEST_ORDER - 1);
+                v = gp_LowerBoundVertices(theGraph) + gp_GetRandomNumber(0, ADJINDEXTEST_ORDER - 1);
+                if (u != v && !gp_IsNeighbor(refGraph, u, v) &&
+                    gp_GetM(refGraph) < gp_GetEdgeCapacity(refGraph))
+                {
+                    if (gp_AddEdge(theGraph, u, 0, v, 0) != OK || gp_AddEdge(refGraph, u, 0, v, 0) != OK)
+                        Result = NOTOK;
+                }
+            }
+
+            if (Result == OK)
+                Result = compareAdjacencyQueries(theGraph, refGraph);
         }
     }
 
-    if (Result == OK && strcmp(beforeStr, afterStr) != 0)
+    // Sorting renumbers the vertices, and embedding rearranges the edges
+    if (Result == OK)
     {
-        gp_ErrorMessage("Graph changed after identify/contract test.");
-        Result = NOTOK;
+        if (gp_DepthFirstSearch(theGraph) != OK || gp_SortVertices(theGraph) != OK ||
+            gp_DepthFirstSearch(refGraph) != OK || gp_SortVertices(refGraph) != OK)
+            Result = NOTOK;
+        else
+            Result = compareAdjacencyQueries(theGraph, refGraph);
     }
 
-    if (beforeStr != NULL)
+    if (Result == OK)
     {
-        free(beforeStr);
-        beforeStr = NULL;
+        if (gp_ComputeLowpoints(theGraph) != OK || gp_ComputeLowpoints(refGraph) != OK)
+            embedResult = NOTOK;
+        else
+            embedResult = gp_Embed(theGraph, EMBEDFLAGS_PLANAR);
+        if ((embedResult != OK && embedResult != NONEMBEDDABLE) ||
+            gp_Embed(refGraph, EMBEDFLAGS_PLANAR) != embedResult)
+            Result = NOTOK;
+        else
+            Result = compareAdjacencyQueries(theGraph, refGraph);
     }
 
-    if (afterStr != NULL)
+    gp_Free(&theGraph);
+    gp_Free(&refGraph);
+
+    return Result;
+}
+
+// Returns OK if the two graphs agree on the adjacency of every pair of
+// vertices, and the edges found in theGraph join the queried vertices
+int compareAdjacencyQueries(graphP theGraph, graphP refGraph)
+{
+    graphInt e;
+
+    for (graphInt u = gp_LowerBoundVertices(theGraph); u < gp_UpperBoundVertices(theGraph); u++)
     {
-        free(afterStr);
-        afterStr = NULL;
+        for (graphInt v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); v++)
+        {
+            e = gp_FindEdge(theGraph, u, v);
+
+            if (gp_IsNeighbor(theGraph, u, v) != gp_IsNeighbor(refGraph, u, v) ||
+                gp_IsNotEdge(theGraph, e) != gp_IsNotEdge(refGraph, gp_FindEdge(refGraph, u, v)) ||
+                (gp_IsEdge(theGraph, e) &&
+                 (gp_GetNeighbor(theGraph, e) != v ||
+                  gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e)) != u)))
+            {
+                gp_ErrorMessage("Adjacency queries differ for vertices %" GRAPHINT_FMT " and %" GRAPHINT_FMT ".", u, v);
+                return NOTOK;
+            }
+        }
     }
 
-    return Result;
+    return OK;
 }
 
-int runTestAllGraphsTest(char const *commandString, char const *infileName)
+/****************************************************************************
+ runBulkEdgeTests()
+
+ Deletes some edges of each random graph, to make edge holes, then adds
+ the same random edges to two duplicates of the graph, one edge at a time
+ with gp_DynamicAddEdge() and all at once with gp_AddEdgesBulk(). There
+ are enough edges to fill the holes and exceed the edge capacity, and the
+ two results must be identical. An invalid vertex must be rejected by
+ gp_AddEdgesBulk() without adding any edges.
+ ****************************************************************************/
+
+#define BULKEDGETEST_NUMGRAPHS 100
+#define BULKEDGETEST_ORDER 30
+#define BULKEDGETEST_NUMEDGES (2 * BULKEDGETEST_ORDER)
+
+int runBulkEdgeTests(void)
 {
-    char *outputStr = NULL;
+    graphP origGraph = NULL;
+    platform_time start, end;
     int Result = OK;
-    char command = '\0', modifier = '\0';
 
-    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK)
+    gp_Message("Starting Bulk Edge Tests");
+    platform_GetTime(start);
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, BULKEDGETEST_ORDER) != OK)
     {
-        gp_ErrorMessage("Unable to extract command (or optional modifier) from "
-                        "command string.");
+        gp_ErrorMessage("Unable to allocate graph for bulk edge tests.");
+        gp_Free(&origGraph);
         return NOTOK;
     }
 
-    Result = TestAllGraphs(commandString, infileName, NULL, &outputStr);
-
-    if (Result == OK)
+    gp_SetRandomSeed(1);
+    for (int K = 0; K < BULKEDGETEST_NUMGRAPHS && Result == OK; K++)
     {
-        const char *planarityValidationStr = "-p 12346 6966 5380 SUCCESS";
-        const char *drawPlanarValidationStr = "-d 12346 6966 5380 SUCCESS";
-        const char *outerplanarityValidationStr = "-o 12346 1150 11196 SUCCESS";
-        const char *K23SearchValidationStr = "-2 12346 1251 11095 SUCCESS";
-        const char *K33SearchValidationStr = "-3 12346 7200 5146 SUCCESS";
-        const char *K4SearchValidationStr = "-4 12346 1715 10631 SUCCESS";
-        const char *theValidationStr = NULL;
+        gp_ResetGraphStorage(origGraph);
 
-        switch (command)
+        if (gp_CreateRandomGraph(origGraph) != OK)
         {
-        case 'p':
-            theValidationStr = planarityValidationStr;
-            break;
+            gp_ErrorMessage("Unable to create random graph number %d.", K);
+            Result = NOTOK;
+        }
+        else if ((Result = runBulkEdgeTest(origGraph)) != OK)
+            gp_ErrorMessage("Bulk edge test failed for random graph number %d.", K);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Bulk Edge Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+int runBulkEdgeTest(graphP origGraph)
+{
+    graphP seqGraph = NULL, bulkGraph = NULL;
+    char *seqStr = NULL, *bulkStr = NULL;
+    graphInt pairs[2 * BULKEDGETEST_NUMEDGES];
+    graphInt v, e, M;
+    int Result = OK;
+
+    for (v = gp_LowerBoundVertices(origGraph); v < gp_UpperBoundVertices(origGraph); v += 3)
+    {
+        if (gp_IsEdge(origGraph, e = gp_GetFirstEdge(origGraph, v)))
+            gp_DeleteEdge(origGraph, e);
+    }
+
+    for (int i = 0; i < 2 * BULKEDGETEST_NUMEDGES; i++)
+        pairs[i] = gp_LowerBoundVertices(origGraph) + gp_GetRandomNumber(0, BULKEDGETEST_ORDER - 1);
+
+    if ((seqGraph = gp_DupGraph(origGraph)) == NULL || (bulkGraph = gp_DupGraph(origGraph)) == NULL)
+    {
+        gp_ErrorMessage("Unable to duplicate graph for bulk edge test.");
+        Result = NOTOK;
+    }
+
+    for (int i = 0; i < BULKEDGETEST_NUMEDGES && Result == OK; i++)
+        Result = gp_DynamicAddEdge(seqGraph, pairs[2 * i], 0, pairs[2 * i + 1], 0);
+
+    if (Result == OK)
+    {
+        // An invalid vertex in the last pair must prevent adding any edges
+        M = gp_GetM(bulkGraph);
+        v = pairs[2 * BULKEDGETEST_NUMEDGES - 1];
+        pairs[2 * BULKEDGETEST_NUMEDGES - 1] = gp_UpperBoundVertexStorage(bulkGraph);
+
+        if (gp_AddEdgesBulk(bulkGraph, pairs, BULKEDGETEST_NUMEDGES) == OK || gp_GetM(bulkGraph) != M)
+        {
+            gp_ErrorMessage("gp_AddEdgesBulk() did not reject an invalid vertex.");
+            Result = NOTOK;
+        }
+
+        pairs[2 * BULKEDGETEST_NUMEDGES - 1] = v;
+    }
+
+    if (Result == OK && gp_AddEdgesBulk(bulkGraph, pairs, BULKEDGETEST_NUMEDGES) != OK)
+    {
+        gp_ErrorMessage("gp_AddEdgesBulk() failed.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK &&
+        (gp_WriteToString(seqGraph, &seqStr, WRITE_ADJLIST) != OK ||
+         gp_WriteToString(bulkGraph, &bulkStr, WRITE_ADJLIST) != OK ||
+         strcmp(seqStr, bulkStr) != 0))
+    {
+        gp_ErrorMessage("Graph with edges added in bulk differs from graph with edges added singly.");
+        Result = NOTOK;
+    }
+
+    if (seqStr != NULL)
+        free(seqStr);
+    if (bulkStr != NULL)
+        free(bulkStr);
+
+    gp_Free(&seqGraph);
+    gp_Free(&bulkGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runCompactEdgeStorageTests()
+
+ Deletes about a third of the edges of each random graph, then compacts
+ the edge storage of a duplicate that is extended for one of the
+ algorithms. The compacted graph must have no edge holes, all of its
+ edge records below gp_UpperBoundEdges() must be in use, its adjacency
+ lists must be the same as before, and embedding it must give the same
+ result. Compaction must be refused while an edge is hidden.
+ ****************************************************************************/
+
+#define COMPACTTEST_NUMGRAPHS 60
+#define COMPACTTEST_ORDER 40
+
+int runCompactEdgeStorageTests(void)
+{
+    char const *commands = "pdo234";
+    graphP origGraph = NULL;
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Compact Edge Storage Tests");
+    platform_GetTime(start);
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, COMPACTTEST_ORDER) != OK)
+    {
+        gp_ErrorMessage("Unable to allocate graph for compact edge storage tests.");
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    gp_SetRandomSeed(1);
+    for (int K = 0; K < COMPACTTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(origGraph);
+
+        if (gp_CreateRandomGraph(origGraph) != OK)
+        {
+            gp_ErrorMessage("Unable to create random graph number %d.", K);
+            Result = NOTOK;
+        }
+        else if ((Result = runCompactEdgeStorageTest(origGraph, commands[K % strlen(commands)])) != OK)
+            gp_ErrorMessage("Compact edge storage test failed for random graph number %d.", K);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Compact Edge Storage Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+int runCompactEdgeStorageTest(graphP origGraph, char command)
+{
+    graphP theGraph = NULL;
+    char *beforeStr = NULL, *afterStr = NULL;
+    graphInt e;
+    int embedFlags = 0, embedResult, Result = OK;
+
+    for (e = gp_LowerBoundEdges(origGraph); e < gp_UpperBoundEdges(origGraph); e += 2)
+    {
+        if (gp_EdgeInUse(origGraph, e) && gp_GetRandomNumber(0, 2) == 0)
+            gp_DeleteEdge(origGraph, e);
+    }
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (theGraph = gp_DupGraph(origGraph)) == NULL ||
+        ExtendGraph(theGraph, command) != OK ||
+        gp_WriteToString(theGraph, &beforeStr, WRITE_ADJLIST) != OK)
+    {
+        gp_ErrorMessage("Unable to duplicate and extend graph for compact edge storage test.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && gp_IsEdge(theGraph, e = gp_GetFirstEdge(theGraph, gp_LowerBoundVertices(theGraph))))
+    {
+        gp_HideEdge(theGraph, e);
+        if (theGraph->numEdgeHoles > 0 && gp_CompactEdgeStorage(theGraph) == OK)
+        {
+            gp_ErrorMessage("gp_CompactEdgeStorage() did not refuse a graph with a hidden edge.");
+            Result = NOTOK;
+        }
+        gp_RestoreEdge(theGraph, e);
+    }
+
+    if (Result == OK && gp_CompactEdgeStorage(theGraph) != OK)
+    {
+        gp_ErrorMessage("gp_CompactEdgeStorage() failed.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && theGraph->numEdgeHoles != 0)
+    {
+        gp_ErrorMessage("Edge holes remain after gp_CompactEdgeStorage().");
+        Result = NOTOK;
+    }
+
+    for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdges(theGraph) && Result == OK; e++)
+    {
+        if (gp_EdgeNotInUse(theGraph, e))
+        {
+            gp_ErrorMessage("Edge record %" GRAPHINT_FMT " is not in use after gp_CompactEdgeStorage().", e);
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK &&
+        (gp_WriteToString(theGraph, &afterStr, WRITE_ADJLIST) != OK || strcmp(beforeStr, afterStr) != 0))
+    {
+        gp_ErrorMessage("Adjacency lists changed after gp_CompactEdgeStorage().");
+        Result = NOTOK;
+    }
+
+    if (Result == OK)
+    {
+        embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+        if (embedResult != OK && embedResult != NONEMBEDDABLE)
+        {
+            gp_ErrorMessage("Embedding failed after gp_CompactEdgeStorage().");
+            Result = NOTOK;
+        }
+    }
+
+    if (beforeStr != NULL)
+        free(beforeStr);
+    if (afterStr != NULL)
+        free(afterStr);
+
+    gp_Free(&theGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runReservedEdgeStorageTests()
+
+ Embeds random graphs in a graph whose edge storage is in address space
+ reserved by gp_ReserveEdgeStorage(), with and without huge pages. The
+ edge capacity of the graph is first grown within the reservation, then
+ beyond it, each time after the random graph is created, so that the
+ embedding and its integrity check show that the growth preserved the
+ edge records both in place and when they move to the heap.
+ ****************************************************************************/
+
+#define RESERVETEST_NUMGRAPHS 60
+#define RESERVETEST_ORDER 40
+
+int runReservedEdgeStorageTests(void)
+{
+    char const *commands = "pdo234";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Reserved Edge Storage Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runReservedEdgeStorageTest(*c, 0)) != OK ||
+            (Result = runReservedEdgeStorageTest(*c, RESERVEFLAGS_HUGEPAGES)) != OK)
+            gp_ErrorMessage("Reserved edge storage test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Reserved Edge Storage Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runReservedEdgeStorageTest(char command, unsigned reserveFlags)
+{
+    graphP theGraph = NULL, origGraph = NULL;
+    graphInt reservedEdgeCapacity = 2 * DEFAULT_EDGE_CAPACITY_FACTOR * RESERVETEST_ORDER;
+    int embedFlags = 0, embedResult = OK, Result = OK;
+
+    if ((theGraph = gp_New()) == NULL)
+        return NOTOK;
+
+    if (gp_ReserveEdgeStorage(theGraph, reservedEdgeCapacity, reserveFlags) != OK)
+    {
+        gp_Message("Reserved edge storage is not supported on this platform.");
+        gp_Free(&theGraph);
+        return OK;
+    }
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        gp_EnsureVertexCapacity(theGraph, RESERVETEST_ORDER) != OK ||
+        ExtendGraph(theGraph, command) != OK ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, RESERVETEST_ORDER) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs with reserved edge storage for command -%c.", command);
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    for (int K = 0; K < RESERVETEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        if (gp_CreateRandomGraph(theGraph) != OK ||
+            gp_CopyGraph(origGraph, theGraph) != OK)
+        {
+            gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        // Grow the edge capacity within the reservation, then beyond it
+        if ((K == RESERVETEST_NUMGRAPHS / 3 || K == 2 * RESERVETEST_NUMGRAPHS / 3) &&
+            gp_EnsureEdgeCapacity(theGraph, K == RESERVETEST_NUMGRAPHS / 3 ? reservedEdgeCapacity : 2 * reservedEdgeCapacity) != OK)
+        {
+            gp_ErrorMessage("Unable to increase the edge capacity of the graph with reserved edge storage.");
+            Result = NOTOK;
+            break;
+        }
+
+        embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+        if (embedResult != OK && embedResult != NONEMBEDDABLE)
+        {
+            gp_ErrorMessage("Embedding failed for random graph number %d.", K);
+            Result = NOTOK;
+        }
+    }
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runResetGraphStorageTests()
+
+ Reuses a graph with a large edge capacity for many random graphs with
+ fewer edges, as in a reuse loop. Since gp_ResetGraphStorage() resets
+ only the edge records that were used, each reset is followed by a check
+ that every edge record of the full edge capacity is in its initial state,
+ and each random graph is embedded and checked for integrity.
+ ****************************************************************************/
+
+#define RESETTEST_NUMGRAPHS 100
+#define RESETTEST_ORDER 40
+
+int runResetGraphStorageTests(void)
+{
+    char const *commands = "pdo234";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Reset Graph Storage Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runResetGraphStorageTest(*c)) != OK)
+            gp_ErrorMessage("Reset graph storage test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Reset Graph Storage Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runResetGraphStorageTest(char command)
+{
+    graphP theGraph = NULL, origGraph = NULL;
+    graphInt e, numEdges;
+    int embedFlags = 0, embedResult = OK, Result = OK;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, 4 * DEFAULT_EDGE_CAPACITY_FACTOR * RESETTEST_ORDER) != OK ||
+        gp_EnsureVertexCapacity(theGraph, RESETTEST_ORDER) != OK ||
+        ExtendGraph(theGraph, command) != OK ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, RESETTEST_ORDER) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for reset graph storage test for command -%c.", command);
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        return NOTOK;
+    }
+
+    for (int K = 0; K < RESETTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        for (e = gp_LowerBoundEdges(theGraph); e < gp_UpperBoundEdgeStorage(theGraph); e++)
+        {
+            if (gp_GetNeighbor(theGraph, e) != NIL || gp_GetNextEdge(theGraph, e) != NIL ||
+                gp_GetPrevEdge(theGraph, e) != NIL || gp_GetEdgeVisited(theGraph, e))
+            {
+                gp_ErrorMessage("Edge record %" GRAPHINT_FMT " was not reset before random graph number %d.", e, K);
+                Result = NOTOK;
+                break;
+            }
+        }
+
+        numEdges = RESETTEST_ORDER - 1 + gp_GetRandomNumber(0, 2 * RESETTEST_ORDER - 1);
+        if (Result == OK &&
+            (gp_CreateRandomGraphEx(theGraph, numEdges) != OK ||
+             gp_CopyGraph(origGraph, theGraph) != OK))
+        {
+            gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+            Result = NOTOK;
+        }
+
+        if (Result == OK)
+        {
+            embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+            if (embedResult != OK && embedResult != NONEMBEDDABLE)
+            {
+                gp_ErrorMessage("Embedding failed for random graph number %d.", K);
+                Result = NOTOK;
+            }
+        }
+    }
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runThreadSafetyTests()
+
+ Embeds random graphs with each algorithm, first in this thread to record
+ the results, then in THREADTEST_NUMTHREADS threads at the same time. Each
+ thread creates the graphs from the same seeds with its own random number
+ generator, extends its own graphs, and must get the same result and write
+ the same embedding or obstruction as the single-threaded run.
+ ****************************************************************************/
+
+#define THREADTEST_NUMTHREADS 8
+#define THREADTEST_NUMGRAPHS 20
+#define THREADTEST_ORDER 50
+#define THREADTEST_COMMANDS "pdo234"
+#define THREADTEST_NUMRUNS ((int)(sizeof(THREADTEST_COMMANDS) - 1) * THREADTEST_NUMGRAPHS)
+
+typedef struct
+{
+    char **embedStrs;
+    int *embedResults;
+    unsigned quietMode;
+    int Result;
+} threadSafetyTestStruct;
+
+platform_ThreadFunction(runThreadSafetyTestThread, arg)
+{
+    threadSafetyTestStruct *testInfo = (threadSafetyTestStruct *)arg;
+
+    // The quiet mode is per thread, so this thread takes that of the test
+    gp_SetQuietMode(testInfo->quietMode);
+    testInfo->Result = runThreadSafetyTest(testInfo->embedStrs, testInfo->embedResults, FALSE);
+
+    return platform_ThreadReturn;
+}
+
+int runThreadSafetyTests(void)
+{
+    char *embedStrs[THREADTEST_NUMRUNS];
+    int embedResults[THREADTEST_NUMRUNS];
+    platform_thread threads[THREADTEST_NUMTHREADS];
+    threadSafetyTestStruct testInfo[THREADTEST_NUMTHREADS];
+    platform_time start, end;
+    int numThreads = 0, Result = OK;
+
+    gp_Message("Starting Thread Safety Tests");
+    platform_GetTime(start);
+
+    memset(embedStrs, 0, sizeof(embedStrs));
+
+    if (runThreadSafetyTest(embedStrs, embedResults, TRUE) != OK)
+    {
+        gp_ErrorMessage("Unable to record the single-threaded results for thread safety test.");
+        Result = NOTOK;
+    }
+
+    for (numThreads = 0; numThreads < THREADTEST_NUMTHREADS && Result == OK; numThreads++)
+    {
+        testInfo[numThreads].embedStrs = embedStrs;
+        testInfo[numThreads].embedResults = embedResults;
+        testInfo[numThreads].quietMode = gp_GetQuietMode();
+        testInfo[numThreads].Result = NOTOK;
+
+        if (platform_CreateThread(threads[numThreads], runThreadSafetyTestThread, &testInfo[numThreads]) != OK)
+        {
+            gp_ErrorMessage("Unable to start thread %d of thread safety test.", numThreads);
+            Result = NOTOK;
+            break;
+        }
+    }
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        platform_JoinThread(threads[i]);
+
+        if (testInfo[i].Result != OK)
+        {
+            gp_ErrorMessage("Thread %d of thread safety test did not match the single-threaded run.", i);
+            Result = NOTOK;
+        }
+    }
+
+    for (int i = 0; i < THREADTEST_NUMRUNS; i++)
+        free(embedStrs[i]);
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Thread Safety Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runThreadSafetyTest(char **embedStrs, int *embedResults, int recordResults)
+{
+    char const *commands = THREADTEST_COMMANDS;
+    graphP theGraph = NULL, origGraph = NULL;
+    char *embedStr = NULL;
+    int embedFlags = 0, embedResult = OK, Result = OK;
+    int run = 0;
+
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if (GetEmbedFlags(*c, '\0', &embedFlags) != OK ||
+            (theGraph = gp_New()) == NULL ||
+            gp_EnsureEdgeCapacity(theGraph, 2 * DEFAULT_EDGE_CAPACITY_FACTOR * THREADTEST_ORDER) != OK ||
+            gp_EnsureVertexCapacity(theGraph, THREADTEST_ORDER) != OK ||
+            ExtendGraph(theGraph, *c) != OK ||
+            (origGraph = gp_New()) == NULL ||
+            gp_EnsureVertexCapacity(origGraph, THREADTEST_ORDER) != OK)
+        {
+            gp_ErrorMessage("Unable to create graphs for thread safety test for command -%c.", *c);
+            Result = NOTOK;
+        }
+
+        for (int K = 0; K < THREADTEST_NUMGRAPHS && Result == OK; K++, run++)
+        {
+            gp_ResetGraphStorage(theGraph);
+
+            gp_SetRandomSeed((unsigned)run + 1);
+            if (gp_CreateRandomGraphEx(theGraph, gp_GetRandomNumber(THREADTEST_ORDER - 1, 3 * THREADTEST_ORDER)) != OK ||
+                gp_CopyGraph(origGraph, theGraph) != OK)
+            {
+                gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+                Result = NOTOK;
+                break;
+            }
+
+            embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+            if ((embedResult != OK && embedResult != NONEMBEDDABLE) ||
+                gp_WriteToString(theGraph, &embedStr, WRITE_ADJLIST) != OK || embedStr == NULL)
+            {
+                gp_ErrorMessage("Embedding failed for random graph number %d for command -%c.", K, *c);
+                Result = NOTOK;
+                break;
+            }
+
+            if (recordResults)
+            {
+                embedStrs[run] = embedStr;
+                embedResults[run] = embedResult;
+                embedStr = NULL;
+            }
+            else
+            {
+                if (embedResult != embedResults[run] || strcmp(embedStr, embedStrs[run]) != 0)
+                {
+                    gp_ErrorMessage("Random graph number %d for command -%c differs from the single-threaded run.", K, *c);
+                    Result = NOTOK;
+                }
+
+                free(embedStr);
+                embedStr = NULL;
+            }
+        }
+
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+    }
+
+    return Result;
+}
+
+/****************************************************************************
+ runCSRTests()
+
+ Exports random graphs in CSR form, both before and after embedding them
+ with each algorithm, and imports each CSR form into another graph, which
+ must then have the same adjacency lists, in the same order, as the graph
+ that was exported. The import is done into a new graph and into a graph
+ that was reset, and the export is done into both library-allocated and
+ caller-provided arrays. An asymmetric CSR form must be rejected.
+ ****************************************************************************/
+
+#define CSRTEST_NUMGRAPHS 50
+#define CSRTEST_ORDER 40
+
+int runCSRTests(void)
+{
+    char const *commands = "pdo234";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting CSR Export and Import Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runCSRTest(*c)) != OK)
+            gp_ErrorMessage("CSR export and import test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running CSR Export and Import Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runCSRTest(char command)
+{
+    graphP theGraph = NULL, origGraph = NULL, csrGraph = NULL;
+    graphInt offsets[4] = {0, 1, 1, 1}, neighbors[1] = {1};
+    int embedFlags = 0, embedResult = OK, Result = OK;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, 2 * DEFAULT_EDGE_CAPACITY_FACTOR * CSRTEST_ORDER) != OK ||
+        gp_EnsureVertexCapacity(theGraph, CSRTEST_ORDER) != OK ||
+        ExtendGraph(theGraph, command) != OK ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, CSRTEST_ORDER) != OK ||
+        (csrGraph = gp_New()) == NULL)
+    {
+        gp_ErrorMessage("Unable to create graphs for CSR test for command -%c.", command);
+        gp_Free(&theGraph);
+        gp_Free(&origGraph);
+        gp_Free(&csrGraph);
+        return NOTOK;
+    }
+
+    // Vertex 0 lists neighbor 1, but vertex 1 does not list neighbor 0
+    if (gp_ImportCSR(csrGraph, 3, offsets, neighbors) != NOTOK || gp_GetM(csrGraph) != 0)
+    {
+        gp_ErrorMessage("An asymmetric CSR form was not rejected.");
+        Result = NOTOK;
+    }
+    gp_Free(&csrGraph);
+
+    for (int K = 0; K < CSRTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+
+        if (gp_CreateRandomGraphEx(theGraph, gp_GetRandomNumber(CSRTEST_ORDER - 1, 3 * CSRTEST_ORDER)) != OK ||
+            gp_CopyGraph(origGraph, theGraph) != OK)
+        {
+            gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        if (compareCSRRoundTrip(theGraph, NULL, FALSE) != OK)
+        {
+            gp_ErrorMessage("CSR round trip of random graph number %d failed.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        embedResult = embedArenaTestGraph(theGraph, origGraph, embedFlags);
+        if (embedResult != OK && embedResult != NONEMBEDDABLE)
+        {
+            gp_ErrorMessage("Embedding failed for random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        // The graph reset is imported into again after the first graph
+        if ((K == 0 && (csrGraph = gp_New()) == NULL) ||
+            compareCSRRoundTrip(theGraph, csrGraph, TRUE) != OK)
+        {
+            gp_ErrorMessage("CSR round trip of the result for random graph number %d failed.", K);
+            Result = NOTOK;
+        }
+        gp_ResetGraphStorage(csrGraph);
+    }
+
+    gp_Free(&theGraph);
+    gp_Free(&origGraph);
+    gp_Free(&csrGraph);
+
+    return Result;
+}
+
+int compareCSRRoundTrip(graphP theGraph, graphP csrGraph, int useCallerBuffers)
+{
+    graphInt *offsets = NULL, *neighbors = NULL;
+    graphInt v, e, eCSR;
+    graphP newGraph = NULL;
+    int Result = OK;
+
+    if (useCallerBuffers)
+    {
+        offsets = (graphInt *)malloc((gp_GetN(theGraph) + 1) * sizeof(graphInt));
+        neighbors = (graphInt *)malloc((2 * gp_GetM(theGraph) + 1) * sizeof(graphInt));
+    }
+
+    if (csrGraph == NULL)
+        csrGraph = newGraph = gp_New();
+
+    if (csrGraph == NULL || (useCallerBuffers && (offsets == NULL || neighbors == NULL)) ||
+        gp_ExportCSR(theGraph, &offsets, &neighbors) != OK ||
+        offsets[gp_GetN(theGraph)] != 2 * gp_GetM(theGraph) ||
+        gp_ImportCSR(csrGraph, gp_GetN(theGraph), offsets, neighbors) != OK ||
+        gp_GetM(csrGraph) != gp_GetM(theGraph))
+        Result = NOTOK;
+
+    // The written graphs would also differ in any extension data, so the
+    // adjacency lists are compared directly
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph) && Result == OK; ++v)
+    {
+        e = gp_GetFirstEdge(theGraph, v);
+        eCSR = gp_GetFirstEdge(csrGraph, v);
+        while (gp_IsEdge(theGraph, e) && gp_IsEdge(csrGraph, eCSR) &&
+               gp_GetNeighbor(theGraph, e) == gp_GetNeighbor(csrGraph, eCSR))
+        {
+            e = gp_GetNextEdge(theGraph, e);
+            eCSR = gp_GetNextEdge(csrGraph, eCSR);
+        }
+
+        if (gp_IsEdge(theGraph, e) || gp_IsEdge(csrGraph, eCSR))
+            Result = NOTOK;
+    }
+
+    free(offsets);
+    free(neighbors);
+    gp_Free(&newGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runDFSInfoTests()
+
+ Computes the DFS information of random graphs, some of them made
+ disconnected by deleting edges, both with gp_ComputeDFSInfo() and with
+ the separate calls to gp_DepthFirstSearch(), gp_SortVertices() and
+ gp_ComputeLowpoints(), which must give the same graph flags, vertex
+ order, DFS parents, least ancestors, lowpoints and edge types. The DFS
+ information is also requested in parts, each of which must leave the
+ same graph flags as the corresponding separate calls.
+ ****************************************************************************/
+
+#define DFSINFOTEST_NUMGRAPHS 100
+#define DFSINFOTEST_ORDER 60
+
+int runDFSInfoTests(void)
+{
+    graphP refGraph = NULL, theGraph = NULL;
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting DFS Info Tests");
+    platform_GetTime(start);
+
+    if ((refGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(refGraph, DFSINFOTEST_ORDER) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(theGraph, DFSINFOTEST_ORDER) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for DFS info test.");
+        Result = NOTOK;
+    }
+
+    else if (gp_ComputeDFSInfo(theGraph, DFSINFO_ALL + 1) != NOTOK)
+    {
+        gp_ErrorMessage("gp_ComputeDFSInfo() accepted an unknown request.");
+        Result = NOTOK;
+    }
+
+    gp_SetRandomSeed(1);
+    for (int K = 0; K < DFSINFOTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        if ((Result = runDFSInfoTest(refGraph, theGraph, K % 2 == 0)) != OK)
+            gp_ErrorMessage("DFS info test failed for random graph number %d.", K);
+    }
+
+    gp_Free(&refGraph);
+    gp_Free(&theGraph);
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running DFS Info Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runDFSInfoTest(graphP refGraph, graphP theGraph, int disconnect)
+{
+    graphInt v, e;
+
+    gp_ResetGraphStorage(refGraph);
+
+    if (gp_CreateRandomGraphEx(refGraph, gp_GetRandomNumber(DFSINFOTEST_ORDER - 1, 2 * DFSINFOTEST_ORDER)) != OK)
+        return NOTOK;
+
+    // Deleting the first edges of random vertices makes edge holes, and
+    // most likely more than one connected component
+    for (int i = 0; disconnect && i < DFSINFOTEST_ORDER / 4; i++)
+    {
+        v = gp_GetRandomNumber(gp_LowerBoundVertices(refGraph), gp_UpperBoundVertices(refGraph) - 1);
+        if (gp_IsEdge(refGraph, e = gp_GetFirstEdge(refGraph, v)))
+            gp_DeleteEdge(refGraph, e);
+    }
+
+    // All at once, compared with the separate calls
+    if (gp_CopyGraph(theGraph, refGraph) != OK ||
+        gp_DepthFirstSearch(refGraph) != OK ||
+        gp_SortVertices(refGraph) != OK ||
+        gp_ComputeLowpoints(refGraph) != OK ||
+        gp_ComputeDFSInfo(theGraph, DFSINFO_ALL) != OK ||
+        compareDFSInfo(theGraph, refGraph, TRUE) != OK)
+        return NOTOK;
+
+    // Sorting back to the original order keeps only the DFS numbering
+    if (gp_SortVertices(refGraph) != OK ||
+        gp_SortVertices(theGraph) != OK ||
+        gp_ComputeDFSInfo(theGraph, DFSINFO_DFSNUMBERING) != OK ||
+        compareDFSInfo(theGraph, refGraph, FALSE) != OK)
+        return NOTOK;
+
+    // Least ancestors from an existing DFS, then lowpoints from those
+    if (gp_ComputeLeastAncestors(refGraph) != OK ||
+        gp_ComputeDFSInfo(theGraph, DFSINFO_LEASTANCESTORS) != OK ||
+        compareDFSInfo(theGraph, refGraph, TRUE) != OK ||
+        gp_ComputeLowpoints(refGraph) != OK ||
+        gp_ComputeDFSInfo(theGraph, DFSINFO_LOWPOINTS) != OK ||
+        compareDFSInfo(theGraph, refGraph, TRUE) != OK)
+        return NOTOK;
+
+    return OK;
+}
+
+int compareDFSInfo(graphP theGraph, graphP refGraph, int compareLeastAncestors)
+{
+    graphInt v, e, eRef;
+
+    if (gp_GetGraphFlags(theGraph) != gp_GetGraphFlags(refGraph) ||
+        gp_GetN(theGraph) != gp_GetN(refGraph))
+        return NOTOK;
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        if (gp_GetIndex(theGraph, v) != gp_GetIndex(refGraph, v) ||
+            gp_GetParent(theGraph, v) != gp_GetParent(refGraph, v))
+            return NOTOK;
+
+        if (compareLeastAncestors &&
+            gp_GetLeastAncestor(theGraph, v) != gp_GetLeastAncestor(refGraph, v))
+            return NOTOK;
+
+        if ((gp_GetGraphFlags(refGraph) & GRAPHFLAGS_LOWPOINTSCOMPUTED) &&
+            gp_GetLowpoint(theGraph, v) != gp_GetLowpoint(refGraph, v))
+            return NOTOK;
+
+        e = gp_GetFirstEdge(theGraph, v);
+        eRef = gp_GetFirstEdge(refGraph, v);
+        while (gp_IsEdge(theGraph, e) && gp_IsEdge(refGraph, eRef))
+        {
+            if (gp_GetNeighbor(theGraph, e) != gp_GetNeighbor(refGraph, eRef) ||
+                gp_GetEdgeType(theGraph, e) != gp_GetEdgeType(refGraph, eRef))
+                return NOTOK;
+
+            e = gp_GetNextEdge(theGraph, e);
+            eRef = gp_GetNextEdge(refGraph, eRef);
+        }
+
+        if (gp_IsEdge(theGraph, e) || gp_IsEdge(refGraph, eRef))
+            return NOTOK;
+    }
+
+    return OK;
+}
+
+/****************************************************************************
+ runEmbedParallelTests()
+
+ Embeds random graphs of several connected components with gp_Embed() and
+ with gp_EmbedParallel(), which must give the same result, the same DFS
+ values and the same adjacency lists, in the same order. The parallel
+ result must also pass the integrity test. For -d, gp_EmbedParallel() just
+ calls gp_Embed(), since the graph has an extension attached.
+ ****************************************************************************/
+
+#define EMBEDPARALLELTEST_NUMGRAPHS 50
+#define EMBEDPARALLELTEST_ORDER 120
+#define EMBEDPARALLELTEST_NUMCOMPONENTS 8
+#define EMBEDPARALLELTEST_NUMTHREADS 4
+
+int runEmbedParallelTests(void)
+{
+    char const *commands = "pdo";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Parallel Embedding Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runEmbedParallelTest(*c)) != OK)
+            gp_ErrorMessage("Parallel embedding test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Parallel Embedding Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runEmbedParallelTest(char command)
+{
+    graphP origGraph = NULL, serialGraph = NULL, parallelGraph = NULL;
+    int embedFlags = 0, serialResult = OK, parallelResult = OK, Result = OK;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, EMBEDPARALLELTEST_ORDER) != OK ||
+        (serialGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(serialGraph, EMBEDPARALLELTEST_ORDER) != OK ||
+        ExtendGraph(serialGraph, command) != OK ||
+        (parallelGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(parallelGraph, EMBEDPARALLELTEST_ORDER) != OK ||
+        ExtendGraph(parallelGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for parallel embedding test for command -%c.", command);
+        Result = NOTOK;
+    }
+
+    else if (gp_EmbedParallel(parallelGraph, embedFlags, 0) != NOTOK)
+    {
+        gp_ErrorMessage("gp_EmbedParallel() accepted zero threads.");
+        Result = NOTOK;
+    }
+
+    for (int K = 0; K < EMBEDPARALLELTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(origGraph);
+        gp_ResetGraphStorage(serialGraph);
+        gp_ResetGraphStorage(parallelGraph);
+
+        // Between a forest and a graph with many nonplanar components
+        if (createComponentsTestGraph(origGraph, EMBEDPARALLELTEST_NUMCOMPONENTS,
+                                      gp_GetRandomNumber(EMBEDPARALLELTEST_ORDER / 2, 2 * EMBEDPARALLELTEST_ORDER)) != OK ||
+            gp_CopyAdjacencyLists(serialGraph, origGraph) != OK ||
+            gp_CopyAdjacencyLists(parallelGraph, origGraph) != OK)
+        {
+            gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        serialResult = gp_Embed(serialGraph, embedFlags);
+        parallelResult = gp_EmbedParallel(parallelGraph, embedFlags, EMBEDPARALLELTEST_NUMTHREADS);
+
+        if (serialResult == NOTOK || parallelResult != serialResult ||
+            gp_GetM(parallelGraph) != gp_GetM(serialGraph) ||
+            gp_GetObstructionMinorType(parallelGraph) != gp_GetObstructionMinorType(serialGraph) ||
+            compareDFSInfo(parallelGraph, serialGraph, TRUE) != OK)
+        {
+            gp_ErrorMessage("Parallel embedding of random graph number %d differs from the serial one.", K);
+            Result = NOTOK;
+        }
+
+        else if (gp_TestEmbedResultIntegrity(parallelGraph, origGraph, parallelResult) != parallelResult)
+        {
+            gp_ErrorMessage("Parallel embedding of random graph number %d failed the integrity test.", K);
+            Result = NOTOK;
+        }
+    }
+
+    gp_Free(&origGraph);
+    gp_Free(&serialGraph);
+    gp_Free(&parallelGraph);
+
+    return Result;
+}
+
+// Adds numEdges random edges to theGraph, each joining two vertices of the
+// same one of numComponents random sets of vertices, so the components of
+// theGraph are interleaved in the vertex order
+int createComponentsTestGraph(graphP theGraph, int numComponents, graphInt numEdges)
+{
+    graphInt componentOf[EMBEDPARALLELTEST_ORDER];
+    graphInt u, v, lowerBound = gp_LowerBoundVertices(theGraph);
+    int Result = OK;
+
+    if (gp_GetN(theGraph) > EMBEDPARALLELTEST_ORDER)
+        return NOTOK;
+
+    for (v = lowerBound; v < gp_UpperBoundVertices(theGraph); ++v)
+        componentOf[v - lowerBound] = gp_GetRandomNumber(0, numComponents - 1);
+
+    for (graphInt attempts = 100 * numEdges; gp_GetM(theGraph) < numEdges && attempts > 0 && Result == OK; attempts--)
+    {
+        u = gp_GetRandomNumber(lowerBound, gp_UpperBoundVertices(theGraph) - 1);
+        v = gp_GetRandomNumber(lowerBound, gp_UpperBoundVertices(theGraph) - 1);
+
+        if (u != v && componentOf[u - lowerBound] == componentOf[v - lowerBound] && !gp_IsNeighbor(theGraph, u, v))
+            Result = gp_AddEdge(theGraph, u, 0, v, 0);
+    }
+
+    return Result;
+}
+
+/****************************************************************************
+ runEmbedBlocksTests()
+
+ Makes random connected graphs from small blocks joined at cut vertices,
+ with chords of varying density, so that some blocks are not embeddable.
+ The blocks found by gp_ComputeBiconnectedComponents() must be those of
+ the construction, and gp_EmbedBlocksParallel() must give the same result
+ as gp_Embed(), the same obstruction for one thread as for many, and a
+ result that passes the integrity test.
+ ****************************************************************************/
+
+#define EMBEDBLOCKSTEST_NUMGRAPHS 50
+#define EMBEDBLOCKSTEST_ORDER 120
+#define EMBEDBLOCKSTEST_MAXBLOCKORDER 7
+#define EMBEDBLOCKSTEST_NUMTHREADS 4
+
+int runEmbedBlocksTests(void)
+{
+    char const *commands = "pdo";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Block Embedding Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runEmbedBlocksTest(*c)) != OK)
+            gp_ErrorMessage("Block embedding test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Block Embedding Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runEmbedBlocksTest(char command)
+{
+    graphP origGraph = NULL, serialGraph = NULL, oneThreadGraph = NULL, parallelGraph = NULL;
+    int embedFlags = 0, serialResult = OK, oneThreadResult = OK, parallelResult = OK, Result = OK;
+    graphInt numBlocks = 0;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (origGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(origGraph, EMBEDBLOCKSTEST_ORDER) != OK ||
+        (serialGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(serialGraph, EMBEDBLOCKSTEST_ORDER) != OK ||
+        ExtendGraph(serialGraph, command) != OK ||
+        (oneThreadGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(oneThreadGraph, EMBEDBLOCKSTEST_ORDER) != OK ||
+        ExtendGraph(oneThreadGraph, command) != OK ||
+        (parallelGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(parallelGraph, EMBEDBLOCKSTEST_ORDER) != OK ||
+        ExtendGraph(parallelGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for block embedding test for command -%c.", command);
+        Result = NOTOK;
+    }
+
+    for (int K = 0; K < EMBEDBLOCKSTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(origGraph);
+        gp_ResetGraphStorage(serialGraph);
+        gp_ResetGraphStorage(oneThreadGraph);
+        gp_ResetGraphStorage(parallelGraph);
+
+        // From a cactus graph to a graph with many nonplanar blocks
+        if (createBlocksTestGraph(origGraph, 20 * (K % 4), &numBlocks) != OK ||
+            gp_CopyAdjacencyLists(serialGraph, origGraph) != OK ||
+            gp_CopyAdjacencyLists(oneThreadGraph, origGraph) != OK ||
+            gp_CopyAdjacencyLists(parallelGraph, origGraph) != OK)
+        {
+            gp_ErrorMessage("Unable to create or copy random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        if (checkBlockCutTree(origGraph, numBlocks) != OK)
+        {
+            gp_ErrorMessage("The blocks of random graph number %d are not those of its construction.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        serialResult = gp_Embed(serialGraph, embedFlags);
+        oneThreadResult = gp_EmbedBlocksParallel(oneThreadGraph, embedFlags, 1);
+        parallelResult = gp_EmbedBlocksParallel(parallelGraph, embedFlags, EMBEDBLOCKSTEST_NUMTHREADS);
+
+        if (serialResult == NOTOK || oneThreadResult != serialResult || parallelResult != serialResult ||
+            gp_GetM(parallelGraph) != gp_GetM(oneThreadGraph) ||
+            gp_GetObstructionMinorType(parallelGraph) != gp_GetObstructionMinorType(oneThreadGraph))
+        {
+            gp_ErrorMessage("Block embedding of random graph number %d differs from the expected one.", K);
+            Result = NOTOK;
+        }
+
+        else if (gp_TestEmbedResultIntegrity(parallelGraph, origGraph, parallelResult) != parallelResult)
+        {
+            gp_ErrorMessage("Block embedding of random graph number %d failed the integrity test.", K);
+            Result = NOTOK;
+        }
+    }
+
+    gp_Free(&origGraph);
+    gp_Free(&serialGraph);
+    gp_Free(&oneThreadGraph);
+    gp_Free(&parallelGraph);
+
+    return Result;
+}
+
+// Makes theGraph a chain of blocks, each of which is a cycle through a
+// random vertex of the blocks made so far and up to
+// EMBEDBLOCKSTEST_MAXBLOCKORDER - 1 new vertices, plus each chord of the
+// cycle with probability chordPercent / 100. A block of two vertices is
+// a single edge. The number of blocks made is returned in *pNumBlocks.
+int createBlocksTestGraph(graphP theGraph, int chordPercent, graphInt *pNumBlocks)
+{
+    graphInt blockVertices[EMBEDBLOCKSTEST_MAXBLOCKORDER];
+    graphInt u, v, numVertices, nextVertex, lowerBound = gp_LowerBoundVertices(theGraph);
+    int i, j, Result = OK;
+
+    *pNumBlocks = 0;
+    nextVertex = lowerBound + 1;
+
+    while (nextVertex < gp_UpperBoundVertices(theGraph) && Result == OK)
+    {
+        blockVertices[0] = gp_GetRandomNumber(lowerBound, nextVertex - 1);
+        numVertices = 1 + gp_GetRandomNumber(1, EMBEDBLOCKSTEST_MAXBLOCKORDER - 1);
+        if (numVertices > 1 + gp_UpperBoundVertices(theGraph) - nextVertex)
+            numVertices = 1 + gp_UpperBoundVertices(theGraph) - nextVertex;
+
+        for (i = 1; i < numVertices; i++)
+            blockVertices[i] = nextVertex++;
+
+        for (i = 0; i < numVertices && Result == OK; i++)
+        {
+            for (j = i + 1; j < numVertices && Result == OK; j++)
+            {
+                u = blockVertices[i];
+                v = blockVertices[j];
+
+                // The cycle is blockVertices[0], ..., blockVertices[numVertices - 1]
+                if (j == i + 1 || (i == 0 && j == numVertices - 1) ||
+                    gp_GetRandomNumber(0, 99) < chordPercent)
+                {
+                    if (!gp_IsNeighbor(theGraph, u, v))
+                        Result = gp_AddEdge(theGraph, u, 0, v, 0);
+                }
+            }
+        }
+
+        (*pNumBlocks)++;
+    }
+
+    return Result;
+}
+
+// Checks the block-cut tree of theGraph, which must be connected and have
+// expectedNumBlocks blocks: each edge must be in one block, with both of
+// its endpoints, and the vertices must be listed once per block that
+// contains them, with the cut vertices in more than one block
+int checkBlockCutTree(graphP theGraph, graphInt expectedNumBlocks)
+{
+    blockCutTreeP theTree = NULL;
+    graphInt B, k, j, e, v, lowerBound = gp_LowerBoundVertices(theGraph);
+    graphInt *blockOf = NULL, numListed = 0, numCutVertexBlocks = 0;
+    int Result = OK;
+
+    if (gp_ComputeBiconnectedComponents(theGraph, &theTree) != expectedNumBlocks ||
+        theTree->edgeStart[theTree->numBlocks] != gp_GetM(theGraph) ||
+        (blockOf = (graphInt *)malloc(gp_GetN(theGraph) * sizeof(graphInt))) == NULL)
+    {
+        gp_FreeBlockCutTree(&theTree);
+        return NOTOK;
+    }
+
+    for (v = 0; v < gp_GetN(theGraph); v++)
+        blockOf[v] = -1;
+
+    for (B = 0; B < theTree->numBlocks && Result == OK; B++)
+    {
+        for (k = theTree->blockStart[B]; k < theTree->blockStart[B + 1]; k++)
+            blockOf[theTree->blockVertices[k]] = B;
+
+        numListed += theTree->blockStart[B + 1] - theTree->blockStart[B];
+
+        // The first vertex of a block is its attachment to its parent
+        if (theTree->parentBlockOf[theTree->blockVertices[theTree->blockStart[B]]] == B)
+            Result = NOTOK;
+
+        for (j = theTree->edgeStart[B]; j < theTree->edgeStart[B + 1]; j++)
+        {
+            e = theTree->blockEdges[j];
+            if (blockOf[gp_GetNeighbor(theGraph, e) - lowerBound] != B ||
+                blockOf[gp_GetNeighbor(theGraph, gp_GetTwin(theGraph, e)) - lowerBound] != B)
+                Result = NOTOK;
+        }
+    }
+
+    for (v = 0; v < gp_GetN(theGraph); v++)
+    {
+        if (theTree->blockCountOf[v] > 1)
+            numCutVertexBlocks += theTree->blockCountOf[v] - 1;
+    }
+
+    // In a connected graph, each block but the root adds one cut vertex listing
+    if (numListed != gp_GetN(theGraph) + theTree->numBlocks - 1 ||
+        numCutVertexBlocks != theTree->numBlocks - 1)
+        Result = NOTOK;
+
+    free(blockOf);
+    gp_FreeBlockCutTree(&theTree);
+
+    return Result;
+}
+
+/****************************************************************************
+ runEmbedBatchTests()
+
+ Packs random graphs of one order, from sparse planar graphs to maximal
+ planar graphs with extra edges, into the edge lists of gp_EmbedBatch(),
+ which must give the same result and obstruction minor type for each of
+ them as gp_Embed() does on a graph read the usual way. An edge list
+ with a loop must be rejected. For planarity and outerplanarity, adding
+ EMBEDFLAGS_TESTONLY must not change any result, including on graphs
+ with duplicate edges.
+ ****************************************************************************/
+
+#define EMBEDBATCHTEST_NUMGRAPHS 60
+#define EMBEDBATCHTEST_ORDER 20
+
+int runEmbedBatchTests(void)
+{
+    char const *commands = "pdo234";
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Batch Embedding Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (char const *c = commands; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runEmbedBatchTest(*c)) != OK)
+            gp_ErrorMessage("Batch embedding test failed for command -%c.", *c);
+    }
+
+    for (char const *c = "po"; *c != '\0' && Result == OK; c++)
+    {
+        if ((Result = runTestOnlyMultigraphTest(*c)) != OK)
+            gp_ErrorMessage("Test-only multigraph test failed for command -%c.", *c);
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Batch Embedding Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runEmbedBatchTest(char command)
+{
+    graphP theGraph = NULL, randomGraph = NULL;
+    graphInt N = EMBEDBATCHTEST_ORDER, maxM = 4 * EMBEDBATCHTEST_ORDER, *edgeLists = NULL;
+    graphInt numEntries = 0, loop[3] = {1, 0, 0}, v, e, w;
+    int results[EMBEDBATCHTEST_NUMGRAPHS], testOnlyResults[EMBEDBATCHTEST_NUMGRAPHS], loopResult = OK;
+    unsigned minorTypes[EMBEDBATCHTEST_NUMGRAPHS];
+    int embedFlags = 0, Result = OK, K;
+
+    loop[1] = loop[2] = gp_LowerBoundVertices(theGraph);
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (edgeLists = (graphInt *)malloc(EMBEDBATCHTEST_NUMGRAPHS * (2 * maxM + 1) * sizeof(graphInt))) == NULL ||
+        (randomGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(randomGraph, maxM) != OK ||
+        gp_EnsureVertexCapacity(randomGraph, N) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, maxM) != OK ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK ||
+        ExtendGraph(theGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for batch embedding test for command -%c.", command);
+        Result = NOTOK;
+    }
+
+    // Each graph is listed as its number of edges followed by their endpoints
+    for (K = 0; K < EMBEDBATCHTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(randomGraph);
+        if (gp_CreateRandomGraphEx(randomGraph, N - 1 + (K * (maxM - N)) / EMBEDBATCHTEST_NUMGRAPHS) != OK)
+        {
+            gp_ErrorMessage("Unable to create random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        edgeLists[numEntries++] = gp_GetM(randomGraph);
+        for (v = gp_LowerBoundVertices(randomGraph); v < gp_UpperBoundVertices(randomGraph); ++v)
+        {
+            e = gp_GetFirstEdge(randomGraph, v);
+            while (gp_IsEdge(randomGraph, e))
+            {
+                w = gp_GetNeighbor(randomGraph, e);
+                if (v < w)
+                {
+                    edgeLists[numEntries++] = v;
+                    edgeLists[numEntries++] = w;
+                }
+                e = gp_GetNextEdge(randomGraph, e);
+            }
+        }
+    }
+
+    if (Result == OK &&
+        (gp_EmbedBatch(edgeLists, EMBEDBATCHTEST_NUMGRAPHS, N, embedFlags, results, minorTypes) != OK ||
+         gp_EmbedBatch(loop, 1, N, embedFlags, &loopResult, NULL) != NOTOK))
+    {
+        gp_ErrorMessage("gp_EmbedBatch() failed.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && (embedFlags == EMBEDFLAGS_PLANAR || embedFlags == EMBEDFLAGS_OUTERPLANAR))
+    {
+        if (gp_EmbedBatch(edgeLists, EMBEDBATCHTEST_NUMGRAPHS, N, embedFlags | EMBEDFLAGS_TESTONLY,
+                          testOnlyResults, NULL) != OK ||
+            memcmp(testOnlyResults, results, EMBEDBATCHTEST_NUMGRAPHS * sizeof(int)) != 0)
+        {
+            gp_ErrorMessage("gp_EmbedBatch() with EMBEDFLAGS_TESTONLY differs from gp_EmbedBatch().");
+            Result = NOTOK;
+        }
+    }
+
+    numEntries = 0;
+    for (K = 0; K < EMBEDBATCHTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(theGraph);
+        for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+            gp_SetIndex(theGraph, v, v);
+
+        if (gp_AddEdgesBulk(theGraph, edgeLists + numEntries + 1, edgeLists[numEntries]) != OK ||
+            gp_Embed(theGraph, embedFlags) != results[K] ||
+            (results[K] == NONEMBEDDABLE && gp_GetObstructionMinorType(theGraph) != minorTypes[K]))
+        {
+            gp_ErrorMessage("Batch embedding of random graph number %d differs from gp_Embed().", K);
+            Result = NOTOK;
+        }
+
+        numEntries += 2 * edgeLists[numEntries] + 1;
+    }
+
+    free(edgeLists);
+    gp_Free(&theGraph);
+    gp_Free(&randomGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runTestOnlyMultigraphTest()
+
+ Embeds random graphs, from trees to graphs with 4N edges, with every edge
+ tripled, and each result with EMBEDFLAGS_TESTONLY must be the result of
+ the full embedding. The duplicates put every graph over the edge bound of
+ a simple (outer)planar graph, which must therefore not decide any of the
+ results. The full embedding is given EMBEDFLAGS_DEFERISOLATION, since the
+ obstruction isolators do not all support duplicate edges.
+ ****************************************************************************/
+
+int runTestOnlyMultigraphTest(char command)
+{
+    graphP theGraph = NULL, randomGraph = NULL;
+    graphInt N = EMBEDBATCHTEST_ORDER, maxM = 4 * EMBEDBATCHTEST_ORDER, *pairs = NULL, m, v, e, w;
+    int embedFlags = 0, Result = OK, K, copy, expected;
+
+    if (GetEmbedFlags(command, '\0', &embedFlags) != OK ||
+        (pairs = (graphInt *)malloc(6 * maxM * sizeof(graphInt))) == NULL ||
+        (randomGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(randomGraph, maxM) != OK ||
+        gp_EnsureVertexCapacity(randomGraph, N) != OK ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(theGraph, 3 * maxM) != OK ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK ||
+        ExtendGraph(theGraph, command) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for test-only multigraph test for command -%c.", command);
+        Result = NOTOK;
+    }
+
+    for (K = 0; K < EMBEDBATCHTEST_NUMGRAPHS && Result == OK; K++)
+    {
+        gp_ResetGraphStorage(randomGraph);
+        if (gp_CreateRandomGraphEx(randomGraph, N - 1 + (K * (maxM - N)) / EMBEDBATCHTEST_NUMGRAPHS) != OK)
+        {
+            gp_ErrorMessage("Unable to create random graph number %d.", K);
+            Result = NOTOK;
+            break;
+        }
+
+        m = 0;
+        for (v = gp_LowerBoundVertices(randomGraph); v < gp_UpperBoundVertices(randomGraph); ++v)
+        {
+            e = gp_GetFirstEdge(randomGraph, v);
+            while (gp_IsEdge(randomGraph, e))
+            {
+                w = gp_GetNeighbor(randomGraph, e);
+                for (copy = 0; copy < 3 && v < w; copy++)
+                {
+                    pairs[2 * m] = v;
+                    pairs[2 * m + 1] = w;
+                    m++;
+                }
+                e = gp_GetNextEdge(randomGraph, e);
+            }
+        }
+
+        expected = NOTOK;
+        for (copy = 0; copy < 2 && Result == OK; copy++)
+        {
+            gp_ResetGraphStorage(theGraph);
+            for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+                gp_SetIndex(theGraph, v, v);
+
+            if (gp_AddEdgesBulk(theGraph, pairs, m) != OK)
+            {
+                gp_ErrorMessage("Unable to load multigraph number %d.", K);
+                Result = NOTOK;
+            }
+            else if (copy == 0)
+                expected = gp_Embed(theGraph, embedFlags | EMBEDFLAGS_DEFERISOLATION);
+            else if (gp_Embed(theGraph, embedFlags | EMBEDFLAGS_TESTONLY) != expected)
+            {
+                gp_ErrorMessage("EMBEDFLAGS_TESTONLY changes the result of multigraph number %d.", K);
+                Result = NOTOK;
+            }
+        }
+    }
+
+    free(pairs);
+    gp_Free(&theGraph);
+    gp_Free(&randomGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ runIncrementalEmbedTests()
+
+ Adds a stream of random edges, one at a time, with gp_AddEdgeToEmbedding()
+ to a graph that starts as an embedding with no edges, both in the original
+ vertex numbering and sorted by DFI. Each result must be the one gp_Embed()
+ with EMBEDFLAGS_TESTONLY gives for the accepted edges plus the new one, and
+ the embedding must pass gp_TestEmbedResultIntegrity() against a graph of
+ the accepted edges every so often, and after each rejected edge, since the
+ embedding is then restored from a backup. The stream is long enough that
+ most of its last edges are rejected.
+ ****************************************************************************/
+
+#define INCREMENTALTEST_ORDER 40
+#define INCREMENTALTEST_NUMEDGES (4 * INCREMENTALTEST_ORDER)
+
+int runIncrementalEmbedTests(void)
+{
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Incremental Embedding Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    if (runIncrementalEmbedTest(FALSE) != OK)
+    {
+        gp_ErrorMessage("Incremental embedding test failed in the original numbering.");
+        Result = NOTOK;
+    }
+    else if (runIncrementalEmbedTest(TRUE) != OK)
+    {
+        gp_ErrorMessage("Incremental embedding test failed in DFI order.");
+        Result = NOTOK;
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Incremental Embedding Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runIncrementalEmbedTest(int sortedByDFI)
+{
+    graphP theGraph = NULL, refGraph = NULL;
+    graphInt N = INCREMENTALTEST_ORDER, *pairs = NULL, *current = NULL, m = 0, a, b, u, v, w, K;
+    int Result = OK, expected, actual;
+
+    if ((pairs = (graphInt *)malloc(2 * (INCREMENTALTEST_NUMEDGES + 1) * sizeof(graphInt))) == NULL ||
+        (current = (graphInt *)malloc((N + gp_LowerBoundVertices(theGraph)) * sizeof(graphInt))) == NULL ||
+        (theGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK ||
+        (refGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(refGraph, INCREMENTALTEST_NUMEDGES + 1) != OK ||
+        gp_EnsureVertexCapacity(refGraph, N) != OK)
+    {
+        gp_ErrorMessage("Unable to create graphs for incremental embedding test.");
+        Result = NOTOK;
+    }
+
+    for (w = gp_LowerBoundVertices(theGraph); Result == OK && w < gp_UpperBoundVertices(theGraph); ++w)
+        gp_SetIndex(theGraph, w, w);
+
+    // The edges are added to an embedding, not to a graph that is not embedded
+    if (Result == OK &&
+        (gp_AddEdgeToEmbedding(theGraph, gp_LowerBoundVertices(theGraph), gp_LowerBoundVertices(theGraph) + 1) != NOTOK ||
+         gp_Embed(theGraph, EMBEDFLAGS_PLANAR) != OK ||
+         (!sortedByDFI && gp_SortVertices(theGraph) != OK) ||
+         gp_AddEdgeToEmbedding(theGraph, gp_LowerBoundVertices(theGraph), gp_LowerBoundVertices(theGraph)) != NOTOK))
+    {
+        gp_ErrorMessage("gp_AddEdgeToEmbedding() did not reject invalid input.");
+        Result = NOTOK;
+    }
+
+    for (K = 0; K < INCREMENTALTEST_NUMEDGES && Result == OK; K++)
+    {
+        // The stream is in the original numbering, which is mapped to
+        // the current numbering if the embedding is sorted by DFI
+        a = gp_GetRandomNumber(gp_LowerBoundVertices(theGraph), gp_UpperBoundVertices(theGraph) - 1);
+        do
+        {
+            b = gp_GetRandomNumber(gp_LowerBoundVertices(theGraph), gp_UpperBoundVertices(theGraph) - 1);
+        } while (b == a);
+
+        for (w = gp_LowerBoundVertices(theGraph); w < gp_UpperBoundVertices(theGraph); ++w)
+            current[sortedByDFI ? gp_GetIndex(theGraph, w) : w] = w;
+        u = current[a];
+        v = current[b];
+
+        pairs[2 * m] = a;
+        pairs[2 * m + 1] = b;
+
+        if (gp_IsNeighbor(theGraph, u, v))
+            expected = OK;
+        else
+        {
+            gp_ResetGraphStorage(refGraph);
+            for (w = gp_LowerBoundVertices(refGraph); w < gp_UpperBoundVertices(refGraph); ++w)
+                gp_SetIndex(refGraph, w, w);
+            if (gp_AddEdgesBulk(refGraph, pairs, m + 1) != OK)
+                expected = NOTOK;
+            else
+                expected = gp_Embed(refGraph, EMBEDFLAGS_PLANAR | EMBEDFLAGS_TESTONLY);
+
+            if (expected == OK)
+                m++;
+        }
+
+        if ((actual = gp_AddEdgeToEmbedding(theGraph, u, v)) != expected || gp_GetM(theGraph) != m)
+        {
+            gp_ErrorMessage("gp_AddEdgeToEmbedding() gave %d rather than %d for edge number %d.",
+                            actual, expected, (int)K);
+            Result = NOTOK;
+        }
+        else if (((K + 1) % N == 0 || actual == NONEMBEDDABLE) &&
+                 checkIncrementalEmbedding(theGraph, refGraph, pairs, m) != OK)
+        {
+            gp_ErrorMessage("Incremental embedding failed its integrity check after edge number %d.", (int)K);
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK && (gp_GetM(theGraph) == 0 || gp_GetM(theGraph) >= INCREMENTALTEST_NUMEDGES))
+    {
+        gp_ErrorMessage("The incremental embedding test accepted too few or too many edges.");
+        Result = NOTOK;
+    }
+
+    free(pairs);
+    free(current);
+    gp_Free(&theGraph);
+    gp_Free(&refGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ checkIncrementalEmbedding()
+
+ Loads the m accepted edges, given by original vertex numbers in pairs,
+ into refGraph and checks that theGraph is a planar embedding of them.
+ ****************************************************************************/
+
+int checkIncrementalEmbedding(graphP theGraph, graphP refGraph, graphInt *pairs, graphInt m)
+{
+    graphInt v;
+
+    gp_ResetGraphStorage(refGraph);
+    for (v = gp_LowerBoundVertices(refGraph); v < gp_UpperBoundVertices(refGraph); ++v)
+        gp_SetIndex(refGraph, v, v);
+
+    if (gp_AddEdgesBulk(refGraph, pairs, m) != OK ||
+        gp_TestEmbedResultIntegrity(theGraph, refGraph, OK) != OK)
+        return NOTOK;
+
+    return OK;
+}
+
+/****************************************************************************
+ runMaximalPlanarSubgraphTests()
+
+ Embeds random graphs, from planar graphs to maximal planar graphs with
+ many extra edges, with EMBEDFLAGS_MAXIMALPLANARSUBGRAPH, both as they
+ are and with every other edge doubled. The result must always be OK,
+ the embedding and rejected edges must pass gp_TestEmbedResultIntegrity(),
+ and no edge may be rejected from a planar graph. Each graph is embedded
+ with and without gp_MaximalPlanarSubgraph_SetEnsureMaximal(), and in the
+ former case the planar subgraph must be maximal.
+ ****************************************************************************/
+
+#define MAXIMALPLANARSUBGRAPHTEST_NUMGRAPHS 40
+#define MAXIMALPLANARSUBGRAPHTEST_ORDER 50
+
+int runMaximalPlanarSubgraphTests(void)
+{
+    graphInt N = MAXIMALPLANARSUBGRAPHTEST_ORDER, numEdges[] = {2 * N, 3 * N - 6, 4 * N, 8 * N};
+    platform_time start, end;
+    int Result = OK, K, i, ensureMaximal, multigraph;
+
+    gp_Message("Starting Maximal Planar Subgraph Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (i = 0; i < (int)(sizeof(numEdges) / sizeof(numEdges[0])) && Result == OK; i++)
+    {
+        for (K = 0; K < 4 * MAXIMALPLANARSUBGRAPHTEST_NUMGRAPHS && Result == OK; K++)
+        {
+            ensureMaximal = (K & 1) ? TRUE : FALSE;
+            multigraph = (K & 2) ? TRUE : FALSE;
+            if ((Result = runMaximalPlanarSubgraphTest(numEdges[i], ensureMaximal, multigraph)) != OK)
+                gp_ErrorMessage("Maximal planar subgraph test failed on %sgraph %d with %d edges%s.",
+                                multigraph ? "multi" : "", K, (int)numEdges[i],
+                                ensureMaximal ? " when ensuring maximality" : "");
+        }
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Maximal Planar Subgraph Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runMaximalPlanarSubgraphTest(graphInt numEdges, int ensureMaximal, int multigraph)
+{
+    graphP origGraph = NULL, theGraph = NULL, refGraph = NULL;
+    graphInt *pairs = NULL, numVisited = 0, m = 0, v, e;
+    int Result = OK;
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(origGraph, 2 * numEdges) != OK ||
+        gp_EnsureVertexCapacity(origGraph, MAXIMALPLANARSUBGRAPHTEST_ORDER) != OK ||
+        gp_CreateRandomGraphEx(origGraph, numEdges) != OK ||
+        (pairs = (graphInt *)malloc((numEdges + 1) * sizeof(graphInt))) == NULL)
+    {
+        gp_ErrorMessage("Unable to create graphs for maximal planar subgraph test.");
+        Result = NOTOK;
+    }
+
+    // Every other edge is doubled, and the duplicates are added after
+    // the adjacency lists are scanned
+    if (Result == OK && multigraph)
+    {
+        for (v = gp_LowerBoundVertices(origGraph); v < gp_UpperBoundVertices(origGraph); ++v)
+        {
+            for (e = gp_GetFirstEdge(origGraph, v); gp_IsEdge(origGraph, e); e = gp_GetNextEdge(origGraph, e))
+            {
+                if (v < gp_GetNeighbor(origGraph, e) && numVisited++ % 2 == 0)
+                {
+                    pairs[2 * m] = v;
+                    pairs[2 * m + 1] = gp_GetNeighbor(origGraph, e);
+                    m++;
+                }
+            }
+        }
+
+        if (gp_AddEdgesBulk(origGraph, pairs, m) != OK)
+        {
+            gp_ErrorMessage("Unable to double the edges for maximal planar subgraph test.");
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK &&
+        ((theGraph = gp_DupGraph(origGraph)) == NULL ||
+         gp_ExtendWith_MaximalPlanarSubgraph(theGraph) != OK ||
+         gp_MaximalPlanarSubgraph_SetEnsureMaximal(theGraph, ensureMaximal) != OK ||
+         (refGraph = gp_New()) == NULL ||
+         gp_EnsureEdgeCapacity(refGraph, numEdges) != OK ||
+         gp_EnsureVertexCapacity(refGraph, MAXIMALPLANARSUBGRAPHTEST_ORDER) != OK))
+    {
+        gp_ErrorMessage("Unable to create graphs for maximal planar subgraph test.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK &&
+        (gp_Embed(theGraph, EMBEDFLAGS_MAXIMALPLANARSUBGRAPH) != OK ||
+         gp_TestEmbedResultIntegrity(theGraph, origGraph, OK) != OK))
+    {
+        gp_ErrorMessage("The maximal planar subgraph failed its integrity check.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK &&
+        (gp_GetM(theGraph) + gp_MaximalPlanarSubgraph_GetNumRejectedEdges(theGraph) != gp_GetM(origGraph) ||
+         (numEdges <= 3 * MAXIMALPLANARSUBGRAPHTEST_ORDER - 6 && gp_MaximalPlanarSubgraph_GetNumRejectedEdges(theGraph) != 0)))
+    {
+        gp_ErrorMessage("The maximal planar subgraph rejected the wrong number of edges.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && ensureMaximal && checkMaximalPlanarSubgraph(theGraph, refGraph) != OK)
+    {
+        gp_ErrorMessage("The planar subgraph is not maximal.");
+        Result = NOTOK;
+    }
+
+    free(pairs);
+    gp_Free(&origGraph);
+    gp_Free(&theGraph);
+    gp_Free(&refGraph);
+
+    return Result;
+}
+
+/****************************************************************************
+ checkMaximalPlanarSubgraph()
+
+ Loads the edges of the planar subgraph in theGraph into refGraph, along
+ with one rejected edge at a time, and checks that each rejected edge
+ makes the subgraph nonplanar. Only one of each set of parallel edges
+ is loaded, since the planarity test does not support parallel edges,
+ and they do not change whether the subgraph is planar.
+ ****************************************************************************/
+
+int checkMaximalPlanarSubgraph(graphP theGraph, graphP refGraph)
+{
+    int sortedByDFI = (gp_GetGraphFlags(theGraph) & GRAPHFLAGS_SORTEDBYDFI) ? TRUE : FALSE;
+    graphInt *pairs = NULL, *lastSeenFrom = NULL, m = 0, i, v, e, w;
+    int Result = OK;
+
+    if ((pairs = (graphInt *)malloc(2 * (gp_GetM(theGraph) + 1) * sizeof(graphInt))) == NULL ||
+        (lastSeenFrom = (graphInt *)malloc(gp_UpperBoundVertices(theGraph) * sizeof(graphInt))) == NULL)
+    {
+        free(pairs);
+        return NOTOK;
+    }
+
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+        lastSeenFrom[v] = NIL;
+
+    // The edges are given by original vertex numbers, as the rejected edges are
+    for (v = gp_LowerBoundVertices(theGraph); v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        e = gp_GetFirstEdge(theGraph, v);
+        while (gp_IsEdge(theGraph, e))
+        {
+            w = gp_GetNeighbor(theGraph, e);
+            if (v < w && lastSeenFrom[w] != v)
+            {
+                lastSeenFrom[w] = v;
+                pairs[2 * m] = sortedByDFI ? gp_GetIndex(theGraph, v) : v;
+                pairs[2 * m + 1] = sortedByDFI ? gp_GetIndex(theGraph, w) : w;
+                m++;
+            }
+            e = gp_GetNextEdge(theGraph, e);
+        }
+    }
+
+    for (i = 0; i < gp_MaximalPlanarSubgraph_GetNumRejectedEdges(theGraph) && Result == OK; i++)
+    {
+        gp_ResetGraphStorage(refGraph);
+        for (v = gp_LowerBoundVertices(refGraph); v < gp_UpperBoundVertices(refGraph); ++v)
+            gp_SetIndex(refGraph, v, v);
+
+        if (gp_MaximalPlanarSubgraph_GetRejectedEdge(theGraph, i, &pairs[2 * m], &pairs[2 * m + 1]) != OK ||
+            gp_AddEdgesBulk(refGraph, pairs, m + 1) != OK ||
+            gp_Embed(refGraph, EMBEDFLAGS_PLANAR | EMBEDFLAGS_TESTONLY) != NONEMBEDDABLE)
+            Result = NOTOK;
+    }
+
+    free(pairs);
+    free(lastSeenFrom);
+
+    return Result;
+}
+
+/****************************************************************************
+ runEmbedStatsTests()
+
+ With USE_EMBED_STATS, embeds a random planar graph, for which
+ there must be a Walkup step for each back edge, a Walkdown iteration
+ for each back edge embedded, fewer bicomp merges than vertices, and
+ an initialization and main loop that took some time. Then a graph with
+ too many edges to be planar, given EMBEDFLAGS_TESTONLY, must have all
+ statistics cleared. Without USE_EMBED_STATS, gp_GetEmbedStats() must
+ return NOTOK.
+ ****************************************************************************/
+
+#define EMBEDSTATSTEST_ORDER 500
+
+int runEmbedStatsTests(void)
+{
+    graphP theGraph = NULL;
+    graphInt N = EMBEDSTATSTEST_ORDER, numBackEdges;
+    embedStatsStruct stats;
+    platform_time start, end;
+    int Result = OK;
+
+    gp_Message("Starting Embedding Statistics Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    if ((theGraph = gp_New()) == NULL ||
+        gp_EnsureVertexCapacity(theGraph, N) != OK ||
+        gp_EnsureEdgeCapacity(theGraph, 3 * N) != OK ||
+        gp_CreateRandomGraphEx(theGraph, 3 * N - 6) != OK ||
+        gp_Embed(theGraph, EMBEDFLAGS_PLANAR) != OK)
+    {
+        gp_ErrorMessage("Unable to embed a graph for the embedding statistics test.");
+        Result = NOTOK;
+    }
+
+#ifdef USE_EMBED_STATS
+    numBackEdges = gp_GetM(theGraph) - (N - 1);
+
+    if (Result == OK &&
+        (gp_GetEmbedStats(theGraph, &stats) != OK ||
+         stats.walkUpSteps < (unsigned long long)numBackEdges ||
+         stats.walkDownIterations < (unsigned long long)numBackEdges ||
+         stats.mergeVertexCalls >= (unsigned long long)N ||
+         stats.mergeBicompsCalls > stats.mergeVertexCalls ||
+         stats.initializeNanoseconds == 0 || stats.mainLoopNanoseconds == 0))
+    {
+        gp_ErrorMessage("The embedding statistics are inconsistent with the graph.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK)
+    {
+        gp_ResetGraphStorage(theGraph);
+        if (gp_CreateRandomGraphEx(theGraph, 3 * N) != OK ||
+            gp_Embed(theGraph, EMBEDFLAGS_PLANAR | EMBEDFLAGS_TESTONLY) != NONEMBEDDABLE ||
+            gp_GetEmbedStats(theGraph, &stats) != OK ||
+            stats.walkUpSteps != 0 || stats.mainLoopNanoseconds != 0)
+        {
+            gp_ErrorMessage("The embedding statistics were not cleared by gp_Embed().");
+            Result = NOTOK;
+        }
+    }
+#else
+    (void)numBackEdges;
+    if (Result == OK && gp_GetEmbedStats(theGraph, &stats) != NOTOK)
+    {
+        gp_ErrorMessage("gp_GetEmbedStats() succeeded without USE_EMBED_STATS.");
+        Result = NOTOK;
+    }
+#endif
+
+    gp_Free(&theGraph);
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Embedding Statistics Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+/****************************************************************************
+ runDeferredIsolationTests()
+
+ Embeds random graphs, from sparse graphs to graphs with too many edges,
+ with EMBEDFLAGS_DEFERISOLATION added to EMBEDFLAGS_PLANAR and to
+ EMBEDFLAGS_OUTERPLANAR. The result must be that of gp_Embed() without
+ the flag. If it is NONEMBEDDABLE, then the minor type must be
+ MINORTYPE_NONE until gp_IsolateObstruction(), after which the
+ obstruction must pass gp_TestEmbedResultIntegrity() and have the minor
+ type and number of edges of the one isolated without the flag. A second
+ gp_IsolateObstruction(), or one after an OK result, must fail.
+ ****************************************************************************/
+
+#define DEFERREDISOLATIONTEST_NUMGRAPHS 40
+#define DEFERREDISOLATIONTEST_ORDER 50
+
+int runDeferredIsolationTests(void)
+{
+    graphInt N = DEFERREDISOLATIONTEST_ORDER;
+    graphInt planarEdges[] = {2 * N, 3 * N - 6, 4 * N}, outerplanarEdges[] = {N, 2 * N - 3, 3 * N};
+    platform_time start, end;
+    int Result = OK, K, i;
+
+    gp_Message("Starting Deferred Isolation Tests");
+    platform_GetTime(start);
+
+    gp_SetRandomSeed(1);
+    for (i = 0; i < 3 && Result == OK; i++)
+    {
+        for (K = 0; K < DEFERREDISOLATIONTEST_NUMGRAPHS && Result == OK; K++)
+        {
+            if ((Result = runDeferredIsolationTest(EMBEDFLAGS_PLANAR, planarEdges[i])) != OK)
+                gp_ErrorMessage("Deferred planar isolation test failed on graph %d with %d edges.", K, (int)planarEdges[i]);
+            else if ((Result = runDeferredIsolationTest(EMBEDFLAGS_OUTERPLANAR, outerplanarEdges[i])) != OK)
+                gp_ErrorMessage("Deferred outerplanar isolation test failed on graph %d with %d edges.", K, (int)outerplanarEdges[i]);
+        }
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Deferred Isolation Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    return Result;
+}
+
+int runDeferredIsolationTest(unsigned embedFlags, graphInt numEdges)
+{
+    graphP origGraph = NULL, refGraph = NULL, theGraph = NULL;
+    int Result = OK, expected = NOTOK;
+
+    if ((origGraph = gp_New()) == NULL ||
+        gp_EnsureEdgeCapacity(origGraph, numEdges) != OK ||
+        gp_EnsureVertexCapacity(origGraph, DEFERREDISOLATIONTEST_ORDER) != OK ||
+        gp_CreateRandomGraphEx(origGraph, numEdges) != OK ||
+        (refGraph = gp_DupGraph(origGraph)) == NULL ||
+        (theGraph = gp_DupGraph(origGraph)) == NULL ||
+        (expected = gp_Embed(refGraph, embedFlags)) == NOTOK)
+    {
+        gp_ErrorMessage("Unable to create graphs for deferred isolation test.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && gp_Embed(theGraph, embedFlags | EMBEDFLAGS_DEFERISOLATION) != expected)
+    {
+        gp_ErrorMessage("gp_Embed() with EMBEDFLAGS_DEFERISOLATION gave a different result.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && expected == NONEMBEDDABLE &&
+        (gp_GetObstructionMinorType(theGraph) != MINORTYPE_NONE ||
+         gp_IsolateObstruction(theGraph) != OK ||
+         gp_TestEmbedResultIntegrity(theGraph, origGraph, NONEMBEDDABLE) != NONEMBEDDABLE ||
+         gp_GetObstructionMinorType(theGraph) != gp_GetObstructionMinorType(refGraph) ||
+         gp_GetM(theGraph) != gp_GetM(refGraph)))
+    {
+        gp_ErrorMessage("The deferred obstruction differs from the one isolated by gp_Embed().");
+        Result = NOTOK;
+    }
+
+    if (Result == OK && gp_IsolateObstruction(theGraph) != NOTOK)
+    {
+        gp_ErrorMessage("gp_IsolateObstruction() succeeded without a pending obstruction.");
+        Result = NOTOK;
+    }
+
+    gp_Free(&origGraph);
+    gp_Free(&refGraph);
+    gp_Free(&theGraph);
+
+    return Result;
+}
+
+int runHideRestoreTest(graphP theGraph)
+{
+    char *beforeStr = NULL, *afterStr = NULL;
+    int Result = OK;
+    graphInt v;
+
+    if (theGraph == NULL)
+    {
+        gp_ErrorMessage("runHideRestoreTest() received NULL graph.");
+        return NOTOK;
+    }
+
+    if (gp_WriteToString(theGraph, &beforeStr, WRITE_ADJLIST) != OK || beforeStr == NULL)
+    {
+        gp_ErrorMessage("Unable to write graph to string before hide/restore test.");
+        Result = NOTOK;
+    }
+
+    for (v = gp_LowerBoundVertices(theGraph); Result == OK && v < gp_UpperBoundVertices(theGraph); ++v)
+    {
+        if (gp_HideVertex(theGraph, v) != OK)
+        {
+            gp_ErrorMessage("gp_HideVertex() failed during hide/restore test.");
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK && gp_RestoreVertices(theGraph) != OK)
+    {
+        gp_ErrorMessage("gp_RestoreVertices() failed during hide/restore test.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK)
+    {
+        if (gp_WriteToString(theGraph, &afterStr, WRITE_ADJLIST) != OK || afterStr == NULL)
+        {
+            gp_ErrorMessage("Unable to write graph to string after hide/restore test.");
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK && strcmp(beforeStr, afterStr) != 0)
+    {
+        gp_ErrorMessage("Graph changed after hide/restore test.");
+        Result = NOTOK;
+    }
+
+    if (beforeStr != NULL)
+    {
+        free(beforeStr);
+        beforeStr = NULL;
+    }
+
+    if (afterStr != NULL)
+    {
+        free(afterStr);
+        afterStr = NULL;
+    }
+
+    return Result;
+}
+
+int runIdentifyContractTests(void)
+{
+    graphP theGraph = NULL;
+    G6ReadIteratorP theG6ReadIterator = NULL;
+    platform_time start, end;
+    int Result = OK;
+    int lineNum = 0;
+
+    gp_Message("Starting Identify/Contract Tests");
+    platform_GetTime(start);
+
+    if ((theGraph = gp_New()) == NULL)
+    {
+        gp_ErrorMessage("Unable to allocate graph for identify/contract tests.");
+        return NOTOK;
+    }
+
+    if (g6_NewReader((&theG6ReadIterator), theGraph) != OK ||
+        g6_InitReaderWithFileName(theG6ReadIterator, "n8.mALL.g6") != OK)
+    {
+        gp_ErrorMessage("Unable to allocate or initialize G6 read iterator for identify/contract tests.");
+        Result = NOTOK;
+    }
+
+    while (Result == OK)
+    {
+        if (g6_ReadGraph(theG6ReadIterator) != OK)
+        {
+            gp_ErrorMessage("Unable to read graph on line %d for identify/contract tests.", lineNum + 1);
+            Result = NOTOK;
+            break;
+        }
+
+        if (g6_EndReached(theG6ReadIterator))
+            break;
+
+        lineNum++;
+
+        if (runIdentifyContractTest(theGraph) != OK)
+        {
+            gp_ErrorMessage("Identify/contract test failed for graph on line %d.", lineNum);
+            Result = NOTOK;
+            break;
+        }
+    }
+
+    platform_GetTime(end);
+
+    if (Result == OK)
+        gp_Message("Done running Identify/Contract Tests (%.3lf seconds).", platform_GetDuration(start, end));
+
+    gp_Message(" ");
+
+    g6_FreeReader((&theG6ReadIterator));
+    gp_Free(&theGraph);
+
+    return Result;
+}
+
+int runIdentifyContractTest(graphP theGraph)
+{
+    char *beforeStr = NULL, *afterStr = NULL;
+    int Result = OK;
+    int vertexOffset;
+    int pairs[7][2];
+    int i;
+
+    if (theGraph == NULL)
+    {
+        gp_ErrorMessage("runIdentifyContractTest() received NULL graph.");
+        return NOTOK;
+    }
+
+    vertexOffset = gp_LowerBoundVertices(theGraph);
+
+    pairs[0][0] = vertexOffset;
+    pairs[0][1] = vertexOffset + 1;
+    pairs[1][0] = vertexOffset + 2;
+    pairs[1][1] = vertexOffset + 3;
+    pairs[2][0] = vertexOffset + 4;
+    pairs[2][1] = vertexOffset + 5;
+    pairs[3][0] = vertexOffset + 6;
+    pairs[3][1] = vertexOffset + 7;
+    pairs[4][0] = vertexOffset;
+    pairs[4][1] = vertexOffset + 2;
+    pairs[5][0] = vertexOffset + 4;
+    pairs[5][1] = vertexOffset + 6;
+    pairs[6][0] = vertexOffset;
+    pairs[6][1] = vertexOffset + 4;
+
+    if (gp_WriteToString(theGraph, &beforeStr, WRITE_ADJLIST) != OK || beforeStr == NULL)
+    {
+        gp_ErrorMessage("Unable to write graph to string before identify/contract test.");
+        Result = NOTOK;
+    }
+
+    for (i = 0; Result == OK && i < 7; i++)
+    {
+        if (gp_IdentifyVertices(theGraph, pairs[i][0], pairs[i][1], NIL) != OK)
+        {
+            gp_ErrorMessage("gp_IdentifyVertices() failed during identify/contract test.");
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK && gp_RestoreVertices(theGraph) != OK)
+    {
+        gp_ErrorMessage("gp_RestoreVertices() failed during identify/contract test.");
+        Result = NOTOK;
+    }
+
+    if (Result == OK)
+    {
+        if (gp_WriteToString(theGraph, &afterStr, WRITE_ADJLIST) != OK || afterStr == NULL)
+        {
+            gp_ErrorMessage("Unable to write graph to string after identify/contract test.");
+            Result = NOTOK;
+        }
+    }
+
+    if (Result == OK && strcmp(beforeStr, afterStr) != 0)
+    {
+        gp_ErrorMessage("Graph changed after identify/contract test.");
+        Result = NOTOK;
+    }
+
+    if (beforeStr != NULL)
+    {
+        free(beforeStr);
+        beforeStr = NULL;
+    }
+
+    if (afterStr != NULL)
+    {
+        free(afterStr);
+        afterStr = NULL;
+    }
+
+    return Result;
+}
+
+int runTestAllGraphsTest(char const *commandString, char const *infileName)
+{
+    char *outputStr = NULL;
+    int Result = OK;
+    char command = '\0', modifier = '\0';
+
+    if (GetCommandAndOptionalModifier(commandString, &command, &modifier) != OK)
+    {
+        gp_ErrorMessage("Unable to extract command (or optional modifier) from "
+                        "command string.");
+        return NOTOK;
+    }
+
+    Result = TestAllGraphs(commandString, infileName, NULL, &outputStr);
+
+    if (Result == OK)
+    {
+        const char *planarityValidationStr = "-p 12346 6966 5380 SUCCESS";
+        const char *drawPlanarValidationStr = "-d 12346 6966 5380 SUCCESS";
+        const char *outerplanarityValidationStr = "-o 12346 1150 11196 SUCCESS";
+        const char *K23SearchValidationStr = "-2 12346 1251 11095 SUCCESS";
+        const char *K33SearchValidationStr = "-3 12346 7200 5146 SUCCESS";
+        const char *K4SearchValidationStr = "-4 12346 1715 10631 SUCCESS";
+        const char *theValidationStr = NULL;
+
+        switch (command)
+        {
+        case 'p':
+            theValidationStr = planarityValidationStr;
+            break;
         case 'd':
             theValidationStr = drawPlanarValidationStr;
             break;
@@ -1324,6 +3811,15 @@ int callSpecificGraph(int argc, char *argv[])
         offset = 1;
     }
 
+    if (strcmp(argv[2 + offset], "-stats") == 0)
+    {
+        if (argc < 6 + offset)
+            return NOTOK;
+
+        EmbedStatsOut = 'y';
+        offset++;
+    }
+
     if (argc > (6 + offset))
         return NOTOK;
 
@@ -1403,6 +3899,124 @@ int callRandomNonplanarGraph(int argc, char *argv[])
     return RandomGraph("-p", 1, numVertices, outfileName, outfile2Name);
 }
 
+/****************************************************************************
+ callBenchmark()
+ ****************************************************************************/
+
+// 'planarity -b [-q] C K N [S]': Benchmark the phases of algorithm C on K
+// iterations of the same random maximal planar graph with N vertices, with
+// the edge storage S (heap, reserve or hugepages; the default is heap)
+int callBenchmark(int argc, char *argv[])
+{
+    int offset = 0;
+    char const *storageName = NULL;
+
+    if (argc < 5)
+        return NOTOK;
+
+    if (strncmp(argv[2], "-q", 2) == 0)
+    {
+        if (argc < 6)
+            return NOTOK;
+
+        offset = 1;
+    }
+
+    if (argc > (6 + offset))
+        return NOTOK;
+
+    if (argc == 6 + offset)
+        storageName = argv[5 + offset];
+
+    return Benchmark(argv[2 + offset], atoi(argv[3 + offset]), atoi(argv[4 + offset]), storageName);
+}
+
+/****************************************************************************
+ callBenchmarkParallel()
+ ****************************************************************************/
+
+// 'planarity -bp [-q] C K N': Benchmark algorithm C with 1 to 64 threads on
+// a random graph of K connected components, each a random maximal planar
+// graph with N vertices
+// 'planarity -bb [-q] C K N': Same, but the K random maximal planar graphs
+// are joined in a chain at cut vertices, so they are the blocks of the graph
+int callBenchmarkParallel(int argc, char *argv[])
+{
+    int offset = 0;
+
+    if (argc < 5)
+        return NOTOK;
+
+    if (strncmp(argv[2], "-q", 2) == 0)
+    {
+        if (argc < 6)
+            return NOTOK;
+
+        offset = 1;
+    }
+
+    if (argc > (5 + offset))
+        return NOTOK;
+
+    return BenchmarkParallel(argv[2 + offset], atoi(argv[3 + offset]), atoi(argv[4 + offset]),
+                             strcmp(argv[1], "-bb") == 0);
+}
+
+/****************************************************************************
+ callBenchmarkTestOnly()
+ ****************************************************************************/
+
+// 'planarity -bt [-q] C K N': Benchmark algorithm C, with and without
+// EMBEDFLAGS_TESTONLY, on K random planar and nonplanar graphs with N vertices
+int callBenchmarkTestOnly(int argc, char *argv[])
+{
+    int offset = 0;
+
+    if (argc < 5)
+        return NOTOK;
+
+    if (strncmp(argv[2], "-q", 2) == 0)
+    {
+        if (argc < 6)
+            return NOTOK;
+
+        offset = 1;
+    }
+
+    if (argc > (5 + offset))
+        return NOTOK;
+
+    return BenchmarkTestOnly(argv[2 + offset], atoi(argv[3 + offset]), atoi(argv[4 + offset]));
+}
+
+/****************************************************************************
+ callBenchmarkIncremental()
+ ****************************************************************************/
+
+// 'planarity -bi [-q] C K N': Benchmark adding the edges of a random graph
+// with N vertices one at a time to a planar embedding, against embedding
+// the accepted edges from scratch at K points of the stream
+int callBenchmarkIncremental(int argc, char *argv[])
+{
+    int offset = 0;
+
+    if (argc < 5)
+        return NOTOK;
+
+    if (strncmp(argv[2], "-q", 2) == 0)
+    {
+        if (argc < 6)
+            return NOTOK;
+
+        offset = 1;
+    }
+
+    if (argc > (5 + offset))
+        return NOTOK;
+
+    return BenchmarkIncremental(argv[2 + offset], atoi(argv[3 + offset]), atoi(argv[4 + offset]));
+}
+
 /****************************************************************************
  callTransformGraph()
  ****************************************************************************/
@@ -1475,9 +4089,104 @@ int callTestAllGraphs(int argc, char *argv[])
     infileName = argv[3 + offset];
     outfileName = argv[4 + offset];
 
+#ifdef NARROWINDEX_REEXEC
+    // Only returns if the planarity16 executable is not used
+    execNarrowIndexBuildIfSmallOrder(argv, infileName);
+#endif
+
     // NOTE: We don't want to write to string, so pOutputStr is NULL
     return TestAllGraphs(commandString, infileName, outfileName, NULL);
 }
+
+#ifdef NARROWINDEX_REEXEC
+/****************************************************************************
+ execNarrowIndexBuildIfSmallOrder()
+
+ If the order in the header of the .g6 infile is small enough that every
+ graph of that order can be indexed by 16-bit integers, then this process
+ is replaced by the planarity16 executable, which is built with the
+ libplanarity16 flavor of the graph library, using the same arguments.
+
+ The planarity16 executable must be in the same directory as this
+ executable, which is found from /proc/self/exe if available, or else
+ from the directory part of argv[0]. In a build tree, this executable is
+ in the libtool .libs subdirectory, so planarity16 is sought in its
+ parent directory. The PATH is never searched, so that a planarity16
+ of another version cannot be run by mistake. Unless in quiet mode, a
+ message tells which executable was selected.
+
+ Returns only if planarity16 was not run, in which case the caller simply
+ proceeds using this build of the graph library.
+ ****************************************************************************/
+
+// The largest order N for which the edge storage of a complete graph,
+// N(N-1) edge records plus 2, can be indexed by a signed 16-bit integer
+#define NARROWINDEX_MAXORDER 181
+
+void execNarrowIndexBuildIfSmallOrder(char *argv[], char const *infileName)
+{
+    graphP theGraph = NULL;
+    G6ReadIteratorP theG6ReadIterator = NULL;
+    int quietModeCache = gp_GetQuietMode();
+    graphInt order = 0;
+    char const *narrowIndexName = "planarity16";
+    char *narrowIndexPath = NULL, *lastDelimiter = NULL;
+    ssize_t pathLength = 0;
+
+    // Get the order from the .g6 header; errors are reported later by
+    // TestAllGraphs() when it reads the file with this build
+    gp_SetQuietMode(QUIETMODE_ALL);
+    if ((theGraph = gp_New()) != NULL &&
+        g6_NewReader(&theG6ReadIterator, theGraph) == OK &&
+        g6_InitReaderWithFileName(theG6ReadIterator, infileName) == OK)
+        order = gp_GetN(theGraph);
+    g6_FreeReader(&theG6ReadIterator);
+    gp_Free(&theGraph);
+    gp_SetQuietMode(quietModeCache);
+
+    if (order <= 0 || order > NARROWINDEX_MAXORDER)
+        return;
+
+    // Get this executable's directory; without one, planarity16 is not run
+    if ((narrowIndexPath = (char *)malloc(PATH_MAX + strlen(narrowIndexName) + 2)) == NULL)
+        return;
+
+    if ((pathLength = readlink("/proc/self/exe", narrowIndexPath, PATH_MAX)) > 0)
+        narrowIndexPath[pathLength] = '\0';
+    else if (strlen(argv[0]) < PATH_MAX)
+        strcpy(narrowIndexPath, argv[0]);
+    else
+        narrowIndexPath[0] = '\0';
+
+    if ((lastDelimiter = strrchr(narrowIndexPath, FILE_DELIMITER)) == NULL)
+    {
+        free(narrowIndexPath);
+        return;
+    }
+    *lastDelimiter = '\0';
+
+    // If in a libtool .libs directory, then use the parent directory, which
+    // is the current directory if the path is just .libs
+    if (strcmp(narrowIndexPath, ".libs") == 0)
+        strcpy(narrowIndexPath, ".");
+    else if ((lastDelimiter = strrchr(narrowIndexPath, FILE_DELIMITER)) != NULL &&
+             strcmp(lastDelimiter + 1, ".libs") == 0)
+        *lastDelimiter = '\0';
+
+    sprintf(narrowIndexPath + strlen(narrowIndexPath), "%c%s", FILE_DELIMITER, narrowIndexName);
+
+    if (access(narrowIndexPath, X_OK) == 0)
+    {
+        gp_Message("Using %s for graphs of order %d.", narrowIndexPath, (int)order);
+        FlushConsole(stdout);
+
+        argv[0] = narrowIndexPath;
+        execv(narrowIndexPath, argv);
+    }
+
+    free(narrowIndexPath);
+}
+#endif
 /****************************************************************************
  testPetersenDigraph()
  ****************************************************************************/
@@ -1487,7 +4196,8 @@ int testPetersenDigraph(void)
     graphP G = gp_New();
     graphP G1 = NULL;
     char const *inputFileName = NULL;
-    int quietModeCache, v, e, eTwin, eDir, eTwinDir;
+    graphInt v, e, eTwin;
+    int quietModeCache, eDir, eTwinDir;
     char *dummyStr = NULL; // Safe throwaway pointer for early-outs
 
     if (G == NULL)
@@ -1636,7 +4346,7 @@ int testDigraphTranspose(void)
     char const *expectedOutputFileName = NULL;
     int preservedEdgeSource = NIL;
     int preservedEdgeTarget = NIL;
-    int e = NIL;
+    graphInt e = NIL;
 
     if (G == NULL)
         return NOTOK;
@@ -83,20 +83,27 @@ int helpMessage(char *param)
     {
         gp_Message(
             "'planarity -r [-q] C K N [O]': Random graphs\n"
-            "'planarity -s [-q] C I O [O2]': Specific graph\n"
+            "'planarity -s [-q] [-stats] C I O [O2]': Specific graph\n"
             "'planarity -rm [-q] N O [O2]': Random maximal planar graph\n"
             "'planarity -rn [-q] N O [O2]': Random nonplanar graph (maximal planar + edge)\n"
             "'planarity -t [-q] C I O': Test algorithm on graph(s) in .g6 file\n"
             "'planarity -x [-q] -(gam) I O': Transform graph to .g6 (g), Adjacency List (a), or Adjacency Matrix (m)\n"
+            "'planarity -b [-q] C K N [S]': Benchmark algorithm phases on K runs of a random maximal planar graph\n"
+            "'planarity -bp [-q] C K N': Benchmark algorithm on 1 to 64 threads with K random maximal planar components\n"
+            "'planarity -bb [-q] C K N': Benchmark algorithm on 1 to 64 threads with K random maximal planar blocks\n"
+            "'planarity -bt [-q] C K N': Benchmark algorithm with and without test only mode on K mixed random graphs\n"
+            "'planarity -bi [-q] C K N': Benchmark adding a stream of random edges one at a time, against K re-embeddings\n"
             "'planarity I O [-n O2]': Legacy command-line (default -s -p)\n");
 
         gp_Message("-q is for quiet mode (no messages to stdout and stderr)\n");
+        gp_Message("-stats is for writing the embedding statistics of -s (needs a library built with USE_EMBED_STATS)\n");
 
         gp_Message("%s", GetAlgorithmFlags());
 
         gp_Message(
-            "K = # of graphs to randomly generate\n"
-            "N = # of vertices in each randomly generated graph\n"
+            "K = # of graphs to randomly generate (for -b, # of benchmark iterations)\n"
+            "    (for -bp and -bb, # of connected components or blocks in the benchmark graph)\n"
+            "N = # of vertices in each randomly generated graph (or component)\n"
             "I = Input file (for work on a specific graph)\n"
             "O = Primary output file\n"
             "    For example, if C=-p then O receives the planar embedding\n"
@@ -104,7 +111,10 @@ int helpMessage(char *param)
             "O2= Secondary output file\n"
             "    For -s, if C=-p or -o, then O2 receives the embedding obstruction\n"
             "    For -s, if C=-d, then O2 receives a drawing of the planar graph\n"
-            "    For -rm and -rn, O2 contains the original randomly generated graph");
+            "    For -rm and -rn, O2 contains the original randomly generated graph\n"
+            "S = Edge storage for -b: heap, reserve (reserved address space),\n"
+            "    or hugepages (reserved address space backed by huge pages);\n"
+            "    if given, the first copy also grows the edge storage");
 
         gp_Message(
             "planarity process results: 0=OK, -1=NOTOK, 1=NONEMBEDDABLE\n"
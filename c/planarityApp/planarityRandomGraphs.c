@@ -8,7 +8,7 @@ See the LICENSE.TXT file for licensing information.
 
 int GetNumberIfZero(int *pNum, char const *prompt, int min, int max);
 void ResetGraphStorage(graphP *pGraph, int ReuseGraphs, char command);
-graphP MakeGraph(int Size, char command);
+graphP MakeGraph(graphInt Size, char command);
 int PromptSaveGraph(graphP theGraph, graphP origGraph, int extraEdges, int saveMode);
 
 /****************************************************************************
@@ -77,7 +77,7 @@ int RandomGraphs(char const *const commandString, int NumGraphs, int SizeOfGraph
         return NOTOK;
     }
 
-    if ((Result = GetNumberIfZero(&SizeOfGraphs, "Enter size of graphs:", 1, 10000000)) != OK)
+    if ((Result = GetNumberIfZero(&SizeOfGraphs, "Enter size of graphs:", 1, MAXRANDOMGRAPHSIZE)) != OK)
     {
         gp_ErrorMessage("Encountered unrecoverable error when prompting for "
                         "SizeOfGraphs.\n");
@@ -143,7 +143,7 @@ int RandomGraphs(char const *const commandString, int NumGraphs, int SizeOfGraph
     // Seed the random number generator with "now". Do it after any prompting
     // to tie randomness to human process of answering the prompt.
     // Acceptable downcast of time_t to unsigned int (seeding benefits from the lower bits of now)
-    srand((unsigned int)time(NULL));
+    gp_SetRandomSeed((unsigned int)time(NULL));
 
     // Select a counter update frequency that updates more frequently with larger graphs
     // and which is relatively prime with 10 so that all digits of the count will change
@@ -507,7 +507,7 @@ int GetNumberIfZero(int *pNum, char const *prompt, int min, int max)
  algorithm to it based on the command.
  ****************************************************************************/
 
-graphP MakeGraph(int Size, char command)
+graphP MakeGraph(graphInt Size, char command)
 {
     graphP theGraph = NULL;
 
@@ -576,7 +576,7 @@ int RandomGraph(char const *const commandString, int extraEdges, int numVertices
         return Result;
     }
 
-    if ((Result = GetNumberIfZero(&numVertices, "Enter number of vertices:", 1, 10000000) != OK))
+    if ((Result = GetNumberIfZero(&numVertices, "Enter number of vertices:", 1, MAXRANDOMGRAPHSIZE) != OK))
     {
         gp_ErrorMessage("Encountered unrecoverable error when prompting for "
                         "numVertices.");
@@ -587,11 +587,11 @@ int RandomGraph(char const *const commandString, int extraEdges, int numVertices
         return NOTOK;
 
     // Acceptable downcast of time_t to unsigned int (seeding benefits from the lower bits of now)
-    srand((unsigned int)time(NULL));
+    gp_SetRandomSeed((unsigned int)time(NULL));
 
     gp_Message("Creating the random graph...");
     platform_GetTime(start);
-    if (gp_CreateRandomGraphEx(theGraph, 3 * numVertices - 6 + extraEdges) != OK)
+    if (gp_CreateRandomGraphEx(theGraph, 3 * (graphInt)numVertices - 6 + extraEdges) != OK)
     {
         gp_ErrorMessage("gp_CreateRandomGraphEx() failed");
         gp_Free(&theGraph);
@@ -599,7 +599,7 @@ int RandomGraph(char const *const commandString, int extraEdges, int numVertices
     }
     platform_GetTime(end);
 
-    gp_Message("Created random graph with %d edges in %.3lf seconds.",
+    gp_Message("Created random graph with %" GRAPHINT_FMT " edges in %.3lf seconds.",
                gp_GetM(theGraph), platform_GetDuration(start, end));
 
     // The user may have requested a copy of the random graph before processing
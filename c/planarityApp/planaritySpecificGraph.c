@@ -169,6 +169,8 @@ int SpecificGraph(
 
     // Write what the algorithm determined and how long it took
     WriteAlgorithmResults(theGraph, Result, command, start, end, infileName);
+    if (EmbedStatsOut == 'y')
+        WriteEmbedStats(theGraph);
 
     // Free the graph obtained for integrity checking.
     gp_Free(&origGraph);
@@ -104,7 +104,7 @@ int testAllGraphs(char command, char modifier, char const *const infileName, tes
     graphP origGraphRead = NULL;
     graphP graphForEmbedding = NULL;
     int embedFlags = 0, numOK = 0, numNONEMBEDDABLE = 0;
-    int order = 0;
+    graphInt order = 0;
     int lineNum = 0;
 
     G6ReadIteratorP theG6ReadIterator = NULL;
@@ -18,7 +18,8 @@ char Mode = 'r',
      OrigOutFormat = 'a',
      EmbeddableOut = 'n',
      ObstructedOut = 'n',
-     AdjListsForEmbeddingsOut = 'n';
+     AdjListsForEmbeddingsOut = 'n',
+     EmbedStatsOut = 'n';
 
 int Reconfigure(void)
 {
@@ -229,7 +230,8 @@ void FlushConsole(FILE *f)
 
 void SaveAsciiGraph(graphP theGraph, char *fileName)
 {
-    int vertexLabelFix, e;
+    graphInt e;
+    int vertexLabelFix;
     FILE *outfile = fopen(fileName, WRITETEXT);
 
     // The fileName may specify a directory that doesn't exist
@@ -259,8 +261,8 @@ void SaveAsciiGraph(graphP theGraph, char *fileName)
         // Only output edges that haven't been deleted (i.e. skip the edge holes)
         if (gp_EdgeInUse(theGraph, e))
         {
-            fprintf(outfile, "%d ", gp_GetNeighbor(theGraph, e) + vertexLabelFix);
-            fprintf(outfile, "%d\n", gp_GetNeighbor(theGraph, e + 1) + vertexLabelFix);
+            fprintf(outfile, "%" GRAPHINT_FMT " ", gp_GetNeighbor(theGraph, e) + vertexLabelFix);
+            fprintf(outfile, "%" GRAPHINT_FMT "\n", gp_GetNeighbor(theGraph, e + 1) + vertexLabelFix);
         }
     }
 
@@ -1055,6 +1057,35 @@ void WriteAlgorithmResults(graphP theGraph, int Result, char command, platform_t
                GetAlgorithmName(command), platform_GetDuration(start, end));
 }
 
+/****************************************************************************
+ * WriteEmbedStats()
+ ****************************************************************************/
+
+void WriteEmbedStats(graphP theGraph)
+{
+    embedStatsStruct stats;
+
+    if (gp_GetEmbedStats(theGraph, &stats) != OK)
+    {
+        gp_Message("Embedding statistics are not available, since the graph library "
+                   "was not built with USE_EMBED_STATS (configure --enable-embed-stats).");
+        return;
+    }
+
+    gp_Message("Embedding statistics:");
+    gp_Message("  Walkup steps:                    %llu", stats.walkUpSteps);
+    gp_Message("  Walkdown iterations:             %llu", stats.walkDownIterations);
+    gp_Message("  Merge bicomps calls:             %llu", stats.mergeBicompsCalls);
+    gp_Message("  Merge vertex calls:              %llu", stats.mergeVertexCalls);
+    gp_Message("  Inactive vertex skips:           %llu", stats.inactiveVertexSkips);
+    gp_Message("  Invert vertex flips:             %llu", stats.invertVertexFlips);
+    gp_Message("  External face short-circuits:    %llu", stats.extFaceShortCircuits);
+    gp_Message("  Future pertinent child advances: %llu", stats.futurePertinentChildAdvances);
+    gp_Message("  Initialization:                  %llu ns", stats.initializeNanoseconds);
+    gp_Message("  Main loop:                       %llu ns", stats.mainLoopNanoseconds);
+    gp_Message("  Postprocessing:                  %llu ns", stats.postprocessNanoseconds);
+}
+
 /****************************************************************************
  * GetNumCharsToReprInt()
  ****************************************************************************/
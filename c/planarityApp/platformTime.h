@@ -17,6 +17,11 @@ See the LICENSE.TXT file for licensing information.
 #define platform_GetTime(timeVar) (timeVar = GetTickCount())
 #define platform_GetDuration(startTime, endTime) ((double)(endTime - startTime) / 1000.0)
 
+// The tick count is already elapsed (wall clock) time
+#define platform_walltime DWORD
+#define platform_GetWallTime(timeVar) (timeVar = GetTickCount())
+#define platform_GetWallDuration(startTime, endTime) ((double)(endTime - startTime) / 1000.0)
+
 #else
 
 #include <time.h>
@@ -36,6 +41,16 @@ typedef struct
 #define platform_GetDuration(startTime, endTime) ( \
     ((double)(endTime.lowresTime - startTime.lowresTime)) > 2000 ? ((double)(endTime.lowresTime - startTime.lowresTime)) : ((double)(endTime.hiresTime - startTime.hiresTime)) / CLOCKS_PER_SEC)
 
+// The clock() measure above is the processor time of all threads, so the
+// elapsed time of work done by more than one thread is measured separately
+
+typedef struct timespec platform_walltime;
+
+#define platform_GetWallTime(timeVar) clock_gettime(CLOCK_MONOTONIC, &(timeVar))
+
+#define platform_GetWallDuration(startTime, endTime) ( \
+    ((double)(endTime.tv_sec - startTime.tv_sec)) + ((double)(endTime.tv_nsec - startTime.tv_nsec)) / 1e9)
+
 /*
 #define platform_time clock_t
 #define platform_GetTime() clock()